@@ -96,6 +96,7 @@ cmake -G "${CMAKE_GENERATOR:-Ninja}" \
       -DARROW_WITH_BROTLI=${ARROW_WITH_BROTLI:-OFF} \
       -DARROW_WITH_BZ2=${ARROW_WITH_BZ2:-OFF} \
       -DARROW_WITH_LZ4=${ARROW_WITH_LZ4:-OFF} \
+      -DARROW_WITH_RE2=${ARROW_WITH_RE2:-ON} \
       -DARROW_WITH_SNAPPY=${ARROW_WITH_SNAPPY:-OFF} \
       -DARROW_WITH_UTF8PROC=${ARROW_WITH_UTF8PROC:-ON} \
       -DARROW_WITH_ZLIB=${ARROW_WITH_ZLIB:-OFF} \
@@ -342,6 +342,15 @@ if(ARROW_CPU_FLAG STREQUAL "x86")
   endif()
 endif()
 
+# Some x86 kernels also have AVX2 versions, compiled separately and
+# selected at runtime when the CPU supports them
+if(ARROW_CPU_FLAG STREQUAL "x86"
+   AND CXX_SUPPORTS_AVX2
+   AND NOT ARROW_SIMD_LEVEL STREQUAL "NONE")
+  set(ARROW_HAVE_RUNTIME_AVX2 ON)
+  add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+endif()
+
 if(ARROW_CPU_FLAG STREQUAL "ppc")
   if(CXX_SUPPORTS_ALTIVEC AND ARROW_ALTIVEC)
     set(CXX_COMMON_FLAGS "${CXX_COMMON_FLAGS} ${ARROW_ALTIVEC_FLAG}")
@@ -218,6 +218,15 @@ if(NOT ARROW_COMPUTE)
   set(ARROW_WITH_UTF8PROC OFF)
 endif()
 
+if(NOT ARROW_COMPUTE AND NOT ARROW_GANDIVA)
+  # re2 is used by the string kernels and by Gandiva
+  set(ARROW_WITH_RE2 OFF)
+endif()
+
+if(ARROW_GANDIVA)
+  set(ARROW_WITH_RE2 ON)
+endif()
+
 # ----------------------------------------------------------------------
 # Versions and URLs for toolchain builds, which also can be used to configure
 # offline builds
@@ -1973,7 +1982,7 @@ if(ARROW_WITH_ZSTD)
 endif()
 
 # ----------------------------------------------------------------------
-# RE2 (required for Gandiva)
+# RE2 (required for Gandiva, optional for the string kernels)
 
 macro(build_re2)
   message(STATUS "Building re2 from source")
@@ -2000,9 +2009,11 @@ macro(build_re2)
   add_dependencies(RE2::re2 re2_ep)
 endmacro()
 
-if(ARROW_GANDIVA)
+if(ARROW_WITH_RE2)
   resolve_dependency(RE2)
 
+  add_definitions(-DARROW_WITH_RE2)
+
   # TODO: Don't use global includes but rather target_include_directories
   get_target_property(RE2_INCLUDE_DIR RE2::re2 INTERFACE_INCLUDE_DIRECTORIES)
   include_directories(SYSTEM ${RE2_INCLUDE_DIR})
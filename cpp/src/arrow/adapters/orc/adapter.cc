@@ -32,6 +32,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -39,14 +40,19 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/visibility.h"
+#include "arrow/visitor_inline.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
+#include "orc/Statistics.hh"
+#include "orc/sargs/SearchArgument.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -116,6 +122,42 @@ struct StripeInformation {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+static Status GetColumnStatistics(const liborc::ColumnStatistics& orc_stats,
+                                  const std::shared_ptr<DataType>& type,
+                                  ColumnStatistics* out) {
+  out->num_values = static_cast<int64_t>(orc_stats.getNumberOfValues());
+  out->has_null = orc_stats.hasNull();
+  if (out->num_values == 0) {
+    return Status::OK();
+  }
+
+  if (auto stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(&orc_stats)) {
+    if (stats->hasMinimum() && stats->hasMaximum()) {
+      ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(type, stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(type, stats->getMaximum()));
+    }
+  } else if (auto stats =
+                 dynamic_cast<const liborc::DoubleColumnStatistics*>(&orc_stats)) {
+    if (stats->hasMinimum() && stats->hasMaximum()) {
+      ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(type, stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(type, stats->getMaximum()));
+    }
+  } else if (auto stats =
+                 dynamic_cast<const liborc::DateColumnStatistics*>(&orc_stats)) {
+    if (stats->hasMinimum() && stats->hasMaximum()) {
+      ARROW_ASSIGN_OR_RAISE(out->min, MakeScalar(type, stats->getMinimum()));
+      ARROW_ASSIGN_OR_RAISE(out->max, MakeScalar(type, stats->getMaximum()));
+    }
+  } else if (auto stats =
+                 dynamic_cast<const liborc::StringColumnStatistics*>(&orc_stats)) {
+    if (stats->hasMinimum() && stats->hasMaximum() && type->id() == Type::STRING) {
+      out->min = MakeScalar(stats->getMinimum());
+      out->max = MakeScalar(stats->getMaximum());
+    }
+  }
+  return Status::OK();
+}
+
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
@@ -163,6 +205,256 @@ class OrcStripeReader : public RecordBatchReader {
   int64_t batch_size_;
 };
 
+// ----------------------------------------------------------------------
+// ORC search arguments
+
+class SearchArgument::Impl {
+ public:
+  std::unique_ptr<liborc::SearchArgument> search_argument;
+};
+
+SearchArgument::SearchArgument() { impl_.reset(new SearchArgument::Impl()); }
+
+SearchArgument::~SearchArgument() {}
+
+static bool GetPredicateDataType(const DataType& type, liborc::PredicateDataType* out) {
+  switch (type.id()) {
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+      *out = liborc::PredicateDataType::LONG;
+      return true;
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      *out = liborc::PredicateDataType::FLOAT;
+      return true;
+    case Type::STRING:
+      *out = liborc::PredicateDataType::STRING;
+      return true;
+    case Type::DATE32:
+      *out = liborc::PredicateDataType::DATE;
+      return true;
+    case Type::BOOL:
+      *out = liborc::PredicateDataType::BOOLEAN;
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns null if the value can't be compared by ORC
+static std::unique_ptr<liborc::Literal> GetLiteral(const Scalar& value) {
+  liborc::PredicateDataType type;
+  if (!value.is_valid || !GetPredicateDataType(*value.type, &type)) {
+    return nullptr;
+  }
+  switch (type) {
+    case liborc::PredicateDataType::LONG: {
+      auto maybe_value = value.CastTo(int64());
+      if (!maybe_value.ok()) {
+        return nullptr;
+      }
+      const auto& long_value = checked_cast<const Int64Scalar&>(**maybe_value).value;
+      return std::unique_ptr<liborc::Literal>(new liborc::Literal(long_value));
+    }
+    case liborc::PredicateDataType::FLOAT: {
+      auto maybe_value = value.CastTo(float64());
+      if (!maybe_value.ok()) {
+        return nullptr;
+      }
+      const auto& double_value = checked_cast<const DoubleScalar&>(**maybe_value).value;
+      return std::unique_ptr<liborc::Literal>(new liborc::Literal(double_value));
+    }
+    case liborc::PredicateDataType::STRING: {
+      const auto& buffer = *checked_cast<const StringScalar&>(value).value;
+      return std::unique_ptr<liborc::Literal>(new liborc::Literal(
+          reinterpret_cast<const char*>(buffer.data()), buffer.size()));
+    }
+    case liborc::PredicateDataType::DATE: {
+      int64_t days = checked_cast<const Date32Scalar&>(value).value;
+      return std::unique_ptr<liborc::Literal>(new liborc::Literal(type, days));
+    }
+    case liborc::PredicateDataType::BOOLEAN: {
+      bool bool_value = checked_cast<const BooleanScalar&>(value).value;
+      return std::unique_ptr<liborc::Literal>(new liborc::Literal(bool_value));
+    }
+    default:
+      return nullptr;
+  }
+}
+
+class SearchArgumentBuilder::Impl {
+ public:
+  Impl() : builder_(liborc::SearchArgumentFactory::newBuilder()) {}
+
+  void StartAnd() { builder_->startAnd(); }
+
+  void StartOr() { builder_->startOr(); }
+
+  void StartNot() { builder_->startNot(); }
+
+  void End() {
+    try {
+      builder_->end();
+    } catch (const std::exception& e) {
+      error_ = Status::Invalid(e.what());
+    }
+  }
+
+  template <typename AddLeaf>
+  void Compare(const std::string& column, const Scalar& value, AddLeaf&& add_leaf) {
+    auto literal = GetLiteral(value);
+    if (literal == nullptr) {
+      return Unknown();
+    }
+    liborc::PredicateDataType type;
+    GetPredicateDataType(*value.type, &type);
+    add_leaf(column, type, *literal);
+  }
+
+  void Equals(const std::string& column, const Scalar& value) {
+    Compare(column, value,
+            [this](const std::string& column, liborc::PredicateDataType type,
+                   const liborc::Literal& literal) {
+              builder_->equals(column, type, literal);
+            });
+  }
+
+  void LessThan(const std::string& column, const Scalar& value) {
+    Compare(column, value,
+            [this](const std::string& column, liborc::PredicateDataType type,
+                   const liborc::Literal& literal) {
+              builder_->lessThan(column, type, literal);
+            });
+  }
+
+  void LessThanEquals(const std::string& column, const Scalar& value) {
+    Compare(column, value,
+            [this](const std::string& column, liborc::PredicateDataType type,
+                   const liborc::Literal& literal) {
+              builder_->lessThanEquals(column, type, literal);
+            });
+  }
+
+  void In(const std::string& column, const Array& values) {
+    liborc::PredicateDataType type;
+    if (values.length() == 0 || !GetPredicateDataType(*values.type(), &type)) {
+      return Unknown();
+    }
+    std::vector<liborc::Literal> literals;
+    for (int64_t i = 0; i < values.length(); i++) {
+      auto maybe_value = values.GetScalar(i);
+      if (!maybe_value.ok()) {
+        return Unknown();
+      }
+      auto literal = GetLiteral(**maybe_value);
+      if (literal == nullptr) {
+        return Unknown();
+      }
+      literals.push_back(*literal);
+    }
+    builder_->in(column, type, literals);
+  }
+
+  void IsNull(const std::string& column, const DataType& type) {
+    liborc::PredicateDataType predicate_type;
+    if (!GetPredicateDataType(type, &predicate_type)) {
+      return Unknown();
+    }
+    builder_->isNull(column, predicate_type);
+  }
+
+  void Unknown() { builder_->literal(liborc::TruthValue::YES_NO_NULL); }
+
+  Status Finish(std::unique_ptr<SearchArgument>* out) {
+    RETURN_NOT_OK(error_);
+    std::unique_ptr<SearchArgument> search_argument(new SearchArgument());
+    try {
+      search_argument->impl_->search_argument = builder_->build();
+    } catch (const std::exception& e) {
+      return Status::Invalid(e.what());
+    }
+    *out = std::move(search_argument);
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<liborc::SearchArgumentBuilder> builder_;
+  Status error_;
+};
+
+SearchArgumentBuilder::SearchArgumentBuilder() {
+  impl_.reset(new SearchArgumentBuilder::Impl());
+}
+
+SearchArgumentBuilder::~SearchArgumentBuilder() {}
+
+SearchArgumentBuilder& SearchArgumentBuilder::StartAnd() {
+  impl_->StartAnd();
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::StartOr() {
+  impl_->StartOr();
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::StartNot() {
+  impl_->StartNot();
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::End() {
+  impl_->End();
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::Equals(const std::string& column,
+                                                     const Scalar& value) {
+  impl_->Equals(column, value);
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::LessThan(const std::string& column,
+                                                       const Scalar& value) {
+  impl_->LessThan(column, value);
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::LessThanEquals(const std::string& column,
+                                                             const Scalar& value) {
+  impl_->LessThanEquals(column, value);
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::In(const std::string& column,
+                                                 const Array& values) {
+  impl_->In(column, values);
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::IsNull(const std::string& column,
+                                                     const DataType& type) {
+  impl_->IsNull(column, type);
+  return *this;
+}
+
+SearchArgumentBuilder& SearchArgumentBuilder::Unknown() {
+  impl_->Unknown();
+  return *this;
+}
+
+Status SearchArgumentBuilder::Finish(std::unique_ptr<SearchArgument>* out) {
+  return impl_->Finish(out);
+}
+
+// ----------------------------------------------------------------------
+// ORC reader
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
@@ -178,7 +470,9 @@ class ORCFileReader::Impl {
       return Status::IOError(e.what());
     }
     pool_ = pool;
+    file_ = file;
     reader_ = std::move(liborc_reader);
+    use_threads_ = false;
     current_row_ = 0;
 
     return Init();
@@ -195,9 +489,27 @@ class ORCFileReader::Impl {
                                        stripe->getNumberOfRows(), first_row_of_stripe});
       first_row_of_stripe += stripe->getNumberOfRows();
     }
+    file_tail_ = reader_->getSerializedFileTail();
+    return Status::OK();
+  }
+
+  // A liborc::Reader isn't thread-safe, so concurrent reads each use their own
+  // reader.  It is created from the already parsed file tail, which saves
+  // reading and decoding the footer again.
+  Status NewReader(std::unique_ptr<liborc::Reader>* out) {
+    std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file_));
+    liborc::ReaderOptions options;
+    options.setSerializedFileTail(file_tail_);
+    try {
+      *out = createReader(std::move(io_wrapper), options);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
     return Status::OK();
   }
 
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
   int64_t NumberOfStripes() { return stripes_.size(); }
 
   int64_t NumberOfRows() { return reader_->getNumberOfRows(); }
@@ -208,9 +520,14 @@ class ORCFileReader::Impl {
   }
 
   Status ReadSchema(const liborc::RowReaderOptions& opts, std::shared_ptr<Schema>* out) {
+    return ReadSchema(*reader_, opts, out);
+  }
+
+  Status ReadSchema(const liborc::Reader& reader, const liborc::RowReaderOptions& opts,
+                    std::shared_ptr<Schema>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
     try {
-      row_reader = reader_->createRowReader(opts);
+      row_reader = reader.createRowReader(opts);
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
     }
@@ -290,6 +607,54 @@ class ORCFileReader::Impl {
     return ReadBatch(opts, schema, stripes_[stripe].num_rows, out);
   }
 
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::unique_ptr<liborc::SearchArgument> search_argument,
+                    std::shared_ptr<RecordBatch>* out) {
+    liborc::RowReaderOptions opts;
+    opts.include(std::list<std::string>(include_names.begin(), include_names.end()));
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::unique_ptr<liborc::Reader> reader;
+    RETURN_NOT_OK(NewReader(&reader));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(*reader, opts, &schema));
+    if (search_argument) {
+      opts.searchArgument(std::move(search_argument));
+    }
+    return ReadBatch(*reader, opts, schema, stripes_[stripe].num_rows, out);
+  }
+
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ColumnStatistics>* out) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    out->clear();
+    if (static_cast<uint64_t>(stripe) >= reader_->getNumberOfStripeStatistics()) {
+      return Status::OK();
+    }
+
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(&schema));
+    std::unique_ptr<liborc::StripeStatistics> stripe_stats;
+    try {
+      stripe_stats = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+
+    const liborc::Type& type = reader_->getType();
+    std::vector<ColumnStatistics> stats(schema->num_fields());
+    for (int i = 0; i < schema->num_fields(); i++) {
+      auto column_id = static_cast<uint32_t>(type.getSubtype(i)->getColumnId());
+      const liborc::ColumnStatistics* orc_stats =
+          stripe_stats->getColumnStatistics(column_id);
+      if (orc_stats != nullptr) {
+        RETURN_NOT_OK(
+            GetColumnStatistics(*orc_stats, schema->field(i)->type(), &stats[i]));
+      }
+    }
+    *out = std::move(stats);
+    return Status::OK();
+  }
+
   Status SelectStripe(liborc::RowReaderOptions* opts, int64_t stripe) {
     ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
                     Status::Invalid("Out of bounds stripe: ", stripe));
@@ -328,22 +693,36 @@ class ORCFileReader::Impl {
 
   Status ReadTable(const liborc::RowReaderOptions& row_opts,
                    const std::shared_ptr<Schema>& schema, std::shared_ptr<Table>* out) {
-    liborc::RowReaderOptions opts(row_opts);
     std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
-    for (size_t stripe = 0; stripe < stripes_.size(); stripe++) {
+    auto read_stripe = [&](int stripe) -> Status {
+      liborc::RowReaderOptions opts(row_opts);
       opts.range(stripes_[stripe].offset, stripes_[stripe].length);
-      RETURN_NOT_OK(ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]));
-    }
+      if (!use_threads_) {
+        return ReadBatch(opts, schema, stripes_[stripe].num_rows, &batches[stripe]);
+      }
+      std::unique_ptr<liborc::Reader> reader;
+      RETURN_NOT_OK(NewReader(&reader));
+      return ReadBatch(*reader, opts, schema, stripes_[stripe].num_rows,
+                       &batches[stripe]);
+    };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads_, static_cast<int>(stripes_.size()), read_stripe));
     return Table::FromRecordBatches(schema, std::move(batches)).Value(out);
   }
 
   Status ReadBatch(const liborc::RowReaderOptions& opts,
                    const std::shared_ptr<Schema>& schema, int64_t nrows,
                    std::shared_ptr<RecordBatch>* out) {
+    return ReadBatch(*reader_, opts, schema, nrows, out);
+  }
+
+  Status ReadBatch(const liborc::Reader& reader, const liborc::RowReaderOptions& opts,
+                   const std::shared_ptr<Schema>& schema, int64_t nrows,
+                   std::shared_ptr<RecordBatch>* out) {
     std::unique_ptr<liborc::RowReader> row_reader;
     std::unique_ptr<liborc::ColumnVectorBatch> batch;
     try {
-      row_reader = reader_->createRowReader(opts);
+      row_reader = reader.createRowReader(opts);
       batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
     } catch (const liborc::ParseError& e) {
       return Status::Invalid(e.what());
@@ -355,12 +734,20 @@ class ORCFileReader::Impl {
     const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
 
     const liborc::Type& type = row_reader->getSelectedType();
+    int64_t num_rows = 0;
     while (row_reader->next(*batch)) {
+      num_rows += batch->numElements;
       for (int i = 0; i < builder->num_fields(); i++) {
         RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0,
                                   batch->numElements, builder->GetField(i)));
       }
     }
+    if (builder->num_fields() == 0) {
+      // No column selected: the builder can't tell how many rows were read
+      // (which may be less than nrows if row groups were skipped)
+      *out = RecordBatch::Make(schema, num_rows, ArrayVector{});
+      return Status::OK();
+    }
     RETURN_NOT_OK(builder->Flush(out));
     return Status::OK();
   }
@@ -408,9 +795,12 @@ class ORCFileReader::Impl {
 
  private:
   MemoryPool* pool_;
+  std::shared_ptr<io::RandomAccessFile> file_;
   std::unique_ptr<liborc::Reader> reader_;
+  std::string file_tail_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  bool use_threads_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -456,6 +846,22 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::ReadStripe(int64_t stripe,
+                                 const std::vector<std::string>& include_names,
+                                 std::unique_ptr<SearchArgument> search_argument,
+                                 std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<liborc::SearchArgument> orc_search_argument;
+  if (search_argument) {
+    orc_search_argument = std::move(search_argument->impl_->search_argument);
+  }
+  return impl_->ReadStripe(stripe, include_names, std::move(orc_search_argument), out);
+}
+
+Status ORCFileReader::ReadStripeStatistics(int64_t stripe,
+                                           std::vector<ColumnStatistics>* out) {
+  return impl_->ReadStripeStatistics(stripe, out);
+}
+
 Status ORCFileReader::Seek(int64_t row_number) { return impl_->Seek(row_number); }
 
 Status ORCFileReader::NextStripeReader(int64_t batch_sizes,
@@ -469,10 +875,188 @@ Status ORCFileReader::NextStripeReader(int64_t batch_size,
   return impl_->NextStripeReader(batch_size, include_indices, out);
 }
 
+void ORCFileReader::set_use_threads(bool use_threads) {
+  impl_->set_use_threads(use_threads);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORC writer
+
+class ArrowOutputFile : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputFile(io::OutputStream* output_stream)
+      : output_stream_(output_stream), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_stream_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The Arrow stream is owned by the caller, which is responsible for closing it
+  void close() override {}
+
+ private:
+  io::OutputStream* output_stream_;
+  uint64_t length_;
+};
+
+static Status GetORCCompression(Compression::type compression,
+                                liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::NotImplemented("Compression codec ",
+                                    util::Codec::GetCodecAsString(compression),
+                                    " is not supported by ORC");
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema, io::OutputStream* output_stream,
+              const WriteOptions& options) {
+    ARROW_RETURN_IF(options.batch_size <= 0,
+                    Status::Invalid("ORC batch size must be positive"));
+    schema_ = schema;
+    batch_size_ = options.batch_size;
+
+    liborc::WriterOptions orc_options;
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetORCCompression(options.compression, &compression));
+    orc_options.setCompression(compression);
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+
+    RETURN_NOT_OK(GetORCType(*schema, &orc_type_));
+    output_file_.reset(new ArrowOutputFile(output_stream));
+    try {
+      writer_ = liborc::createWriter(*orc_type_, output_file_.get(), orc_options);
+      if (schema->metadata() != nullptr) {
+        const auto& metadata = *schema->metadata();
+        for (int64_t i = 0; i < metadata.size(); i++) {
+          writer_->addUserMetadata(metadata.key(i), metadata.value(i));
+        }
+      }
+      // The batch is reused for all writes
+      batch_ = writer_->createRowBatch(static_cast<uint64_t>(batch_size_));
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& record_batch) {
+    ARROW_RETURN_IF(writer_ == nullptr, Status::Invalid("ORC writer is closed"));
+    if (!record_batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("RecordBatch schema does not match the ORC writer's: ",
+                             record_batch.schema()->ToString(), " vs ",
+                             schema_->ToString());
+    }
+    auto struct_batch = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    const int64_t num_rows = record_batch.num_rows();
+    for (int64_t offset = 0; offset < num_rows; offset += batch_size_) {
+      const int64_t length = std::min(batch_size_, num_rows - offset);
+      for (int i = 0; i < record_batch.num_columns(); i++) {
+        RETURN_NOT_OK(WriteBatch(*record_batch.column(i), offset, length,
+                                 struct_batch->fields[i]));
+      }
+      struct_batch->numElements = length;
+      struct_batch->hasNulls = false;
+      // The ORC writer encodes the values right away, so the batch's pointers
+      // into the Arrow data don't need to outlive this call
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    TableBatchReader reader(table);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    if (writer_ == nullptr) {
+      return Status::OK();
+    }
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError(e.what());
+    }
+    batch_.reset();
+    writer_.reset();
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  int64_t batch_size_;
+  std::unique_ptr<liborc::Type> orc_type_;
+  std::unique_ptr<ArrowOutputFile> output_file_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           io::OutputStream* output_stream, const WriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output_stream, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
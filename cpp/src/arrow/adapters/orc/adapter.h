@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
@@ -26,6 +27,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -34,6 +36,80 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief Statistics of a top-level column in a stripe
+struct ARROW_EXPORT ColumnStatistics {
+  /// The number of non-null values
+  int64_t num_values = 0;
+  /// Whether the column has null values
+  bool has_null = true;
+  /// The minimum and maximum values, or null if they are not available for
+  /// this column type
+  std::shared_ptr<Scalar> min, max;
+};
+
+/// \class SearchArgument
+/// \brief A predicate on the top-level columns of an ORC file, used to skip
+/// the row groups whose statistics show that none of their rows match it
+///
+/// A SearchArgument is created with a SearchArgumentBuilder.
+class ARROW_EXPORT SearchArgument {
+ public:
+  ~SearchArgument();
+
+ private:
+  SearchArgument();
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+
+  friend class ORCFileReader;
+  friend class SearchArgumentBuilder;
+};
+
+/// \class SearchArgumentBuilder
+/// \brief Build a SearchArgument from a tree of predicates
+///
+/// Leaf predicates compare a column with values of the same type.  Integer,
+/// floating point, string, date and boolean columns are supported; leaves on
+/// other columns, or with null values, are considered satisfiable by any row.
+class ARROW_EXPORT SearchArgumentBuilder {
+ public:
+  SearchArgumentBuilder();
+  ~SearchArgumentBuilder();
+
+  /// \brief Start the conjunction of the predicates up to the matching End()
+  SearchArgumentBuilder& StartAnd();
+  /// \brief Start the disjunction of the predicates up to the matching End()
+  SearchArgumentBuilder& StartOr();
+  /// \brief Start the negation of the predicate up to the matching End()
+  SearchArgumentBuilder& StartNot();
+  /// \brief End the last started conjunction, disjunction or negation
+  SearchArgumentBuilder& End();
+
+  /// \brief Add the predicate `column == value`
+  SearchArgumentBuilder& Equals(const std::string& column, const Scalar& value);
+  /// \brief Add the predicate `column < value`
+  SearchArgumentBuilder& LessThan(const std::string& column, const Scalar& value);
+  /// \brief Add the predicate `column <= value`
+  SearchArgumentBuilder& LessThanEquals(const std::string& column,
+                                        const Scalar& value);
+  /// \brief Add the predicate `column IN values`
+  SearchArgumentBuilder& In(const std::string& column, const Array& values);
+  /// \brief Add the predicate `column IS NULL`
+  SearchArgumentBuilder& IsNull(const std::string& column, const DataType& type);
+  /// \brief Add a predicate which may be satisfied by any row
+  SearchArgumentBuilder& Unknown();
+
+  /// \brief Create the SearchArgument
+  ///
+  /// Fails if the Start and End calls aren't balanced.
+  Status Finish(std::unique_ptr<SearchArgument>* out);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -101,6 +177,31 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Read a single stripe as a RecordBatch, skipping the row groups
+  /// which cannot match a search argument
+  ///
+  /// Row groups are skipped using the row index of the file.  The rows of the
+  /// remaining row groups are not filtered.  Unlike the other read methods,
+  /// this one may be called concurrently from several threads.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] include_names the names of the top-level fields to read
+  /// \param[in] search_argument the search argument, or null
+  /// \param[out] out the returned RecordBatch
+  Status ReadStripe(int64_t stripe, const std::vector<std::string>& include_names,
+                    std::unique_ptr<SearchArgument> search_argument,
+                    std::shared_ptr<RecordBatch>* out);
+
+  /// \brief Read the statistics of the top-level columns in a stripe
+  ///
+  /// Minimum and maximum values are available for integer, floating point,
+  /// string and date columns.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[out] out the statistics, one per field of the file schema, or
+  ///            empty if the file doesn't have stripe statistics
+  Status ReadStripeStatistics(int64_t stripe, std::vector<ColumnStatistics>* out);
+
   /// \brief Seek to designated row. Invoke NextStripeReader() after seek
   ///        will return stripe reader starting from designated row.
   ///
@@ -130,6 +231,10 @@ class ARROW_EXPORT ORCFileReader {
   Status NextStripeReader(int64_t batch_size, const std::vector<int>& include_indices,
                           std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Set whether Read() decodes stripes in parallel, using the global
+  /// CPU thread pool.  This is disabled by default.
+  void set_use_threads(bool use_threads);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -142,6 +247,63 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for writing ORC files
+struct ARROW_EXPORT WriteOptions {
+  /// The number of rows converted at once into an ORC batch
+  int64_t batch_size = 1024;
+  /// The size of a stripe in bytes, before compression
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// The compression codec, among UNCOMPRESSED, GZIP (written as ZLIB), SNAPPY,
+  /// LZ4 and ZSTD
+  Compression::type compression = Compression::UNCOMPRESSED;
+  /// The size of a compression block in bytes
+  int64_t compression_block_size = 64 * 1024;
+  /// The number of rows between row index entries, or 0 to disable the index
+  int64_t row_index_stride = 10000;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables or RecordBatches to an ORC file.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the data to be written
+  /// \param[in] output_stream the sink, which must outlive the writer. It is
+  ///            not closed by the writer.
+  /// \param[in] options the ORC writer options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     io::OutputStream* output_stream, const WriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a RecordBatch
+  ///
+  /// Stripes are cut according to WriteOptions::stripe_size, independently of
+  /// the batches written.
+  ///
+  /// \param[in] batch the RecordBatch, whose schema must match the writer's
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table
+  ///
+  /// \param[in] table the Table, whose schema must match the writer's
+  Status Write(const Table& table);
+
+  /// \brief Write the file footer
+  ///
+  /// No data can be written after this call.
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
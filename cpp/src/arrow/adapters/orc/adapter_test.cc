@@ -19,7 +19,11 @@
 
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/io/api.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -157,4 +161,288 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+class TestORCWriter : public ::testing::Test {
+ public:
+  void WriteTable(const Table& table, const adapters::orc::WriteOptions& options) {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+    ASSERT_OK(adapters::orc::ORCFileWriter::Open(table.schema(), sink.get(), options,
+                                                 &writer));
+    ASSERT_OK(writer->Write(table));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+  }
+
+  void OpenReader(std::unique_ptr<adapters::orc::ORCFileReader>* out) {
+    ASSERT_OK(adapters::orc::ORCFileReader::Open(
+        std::make_shared<io::BufferReader>(buffer_), default_memory_pool(), out));
+    num_stripes_ = (*out)->NumberOfStripes();
+  }
+
+  void ReadTable(std::shared_ptr<Table>* out, bool use_threads = false) {
+    std::unique_ptr<adapters::orc::ORCFileReader> reader;
+    ASSERT_NO_FATAL_FAILURE(OpenReader(&reader));
+    reader->set_use_threads(use_threads);
+    ASSERT_OK(reader->Read(out));
+  }
+
+  std::shared_ptr<Table> MakeIntTable(int64_t length) {
+    Int64Builder builder;
+    for (int64_t i = 0; i < length; ++i) {
+      ABORT_NOT_OK(builder.Append(i));
+    }
+    std::shared_ptr<Array> ints;
+    ABORT_NOT_OK(builder.Finish(&ints));
+    return Table::Make(::arrow::schema({field("int", int64())}), {ints});
+  }
+
+  void CheckRoundtrip(const Table& table, const Table& expected,
+                      const adapters::orc::WriteOptions& options =
+                          adapters::orc::WriteOptions()) {
+    WriteTable(table, options);
+    std::shared_ptr<Table> actual;
+    ReadTable(&actual);
+    ASSERT_OK(actual->ValidateFull());
+    AssertSchemaEqual(*expected.schema(), *actual->schema());
+    AssertTablesEqual(expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+  void CheckRoundtrip(const Table& table, const adapters::orc::WriteOptions& options =
+                                              adapters::orc::WriteOptions()) {
+    CheckRoundtrip(table, table, options);
+  }
+
+ protected:
+  std::shared_ptr<Buffer> buffer_;
+  int64_t num_stripes_ = 0;
+};
+
+TEST_F(TestORCWriter, Primitives) {
+  auto schema = ::arrow::schema(
+      {field("bool", boolean()), field("int8", int8()), field("int16", int16()),
+       field("int32", int32()), field("int64", int64()), field("float", float32()),
+       field("double", float64()), field("string", utf8()), field("binary", binary()),
+       field("date", date32()), field("timestamp", timestamp(TimeUnit::NANO)),
+       field("decimal", decimal(10, 2)), field("wide_decimal", decimal(30, 4))});
+  auto table = TableFromJSON(schema, {R"([
+      [true, 1, 2, 3, 4, 1.5, 2.5, "foo", "bar", 18000, 1500000000123456789,
+       "12.34", "123456789012345678901234.5678"],
+      [null, null, null, null, null, null, null, null, null, null, null, null, null],
+      [false, -1, -2, -3, -4, -1.5, -2.5, "", "", -1, -1, "-0.01", "-1.0000"]
+    ])",
+                                      R"([
+      [true, 127, 32767, 2147483647, 9223372036854775807, 0, 0, "bar", "", 0, 0,
+       "0.00", "0.0000"]
+    ])"});
+  CheckRoundtrip(*table);
+}
+
+TEST_F(TestORCWriter, Nested) {
+  auto struct_type = struct_({field("a", int32()), field("b", utf8())});
+  auto schema = ::arrow::schema({field("list", list(int64())),
+                                 field("struct", struct_type),
+                                 field("list_of_struct", list(struct_type))});
+  auto table = TableFromJSON(schema, {R"([
+      [[1, 2, null], {"a": 1, "b": "x"}, [{"a": 2, "b": null}]],
+      [null, null, null],
+      [[], {"a": null, "b": "y"}, []],
+      [[3], {"a": 4, "b": "z"}, [null, {"a": 5, "b": "w"}]]
+    ])"});
+  CheckRoundtrip(*table);
+
+  // Slices exercise non-zero array offsets
+  CheckRoundtrip(*table->Slice(1, 2));
+}
+
+TEST_F(TestORCWriter, NestedChildrenLargerThanBatch) {
+  // The lists and maps hold more struct values than the default batch size
+  const int64_t num_values = 3000;
+  Int32Builder int_builder;
+  StringBuilder str_builder;
+  for (int64_t i = 0; i < num_values; ++i) {
+    ASSERT_OK(int_builder.Append(static_cast<int32_t>(i)));
+    ASSERT_OK(str_builder.Append(std::to_string(i)));
+  }
+  std::shared_ptr<Array> ints, strs;
+  ASSERT_OK(int_builder.Finish(&ints));
+  ASSERT_OK(str_builder.Finish(&strs));
+  std::shared_ptr<Array> inner, values, entries;
+  ASSERT_OK_AND_ASSIGN(inner, StructArray::Make({strs}, std::vector<std::string>{"b"}));
+  ASSERT_OK_AND_ASSIGN(
+      values, StructArray::Make({ints, inner}, std::vector<std::string>{"a", "inner"}));
+
+  auto offsets = ArrayFromJSON(int32(), "[0, 1000, 1000, 3000]");
+  ASSERT_OK_AND_ASSIGN(auto lists, ListArray::FromArrays(*offsets, *values));
+  ASSERT_OK_AND_ASSIGN(auto maps, MapArray::FromArrays(offsets, strs, values));
+  auto table = Table::Make(
+      ::arrow::schema({field("list", lists->type()), field("map", maps->type())}),
+      {lists, maps});
+
+  // Maps are read back as lists of key-value structs
+  ASSERT_OK_AND_ASSIGN(
+      entries,
+      StructArray::Make({strs, values}, std::vector<std::string>{"key", "value"}));
+  ASSERT_OK_AND_ASSIGN(auto map_lists, ListArray::FromArrays(*offsets, *entries));
+  auto expected = Table::Make(
+      ::arrow::schema({field("list", lists->type()), field("map", map_lists->type())}),
+      {lists, map_lists});
+  CheckRoundtrip(*table, *expected);
+}
+
+TEST_F(TestORCWriter, ConvertedTypes) {
+  // Types without an exact ORC equivalent are written as the closest ORC type
+  auto schema = ::arrow::schema({field("large_string", large_utf8()),
+                                 field("date64", date64()),
+                                 field("timestamp", timestamp(TimeUnit::MILLI))});
+  auto expected_schema = ::arrow::schema({field("large_string", utf8()),
+                                          field("date64", date32()),
+                                          field("timestamp", timestamp(TimeUnit::NANO))});
+  auto table = TableFromJSON(schema, {R"([
+      ["foo", 86400000, 1500],
+      [null, -86400000, -1500],
+      ["bar", 0, null]
+    ])"});
+  auto expected = TableFromJSON(expected_schema, {R"([
+      ["foo", 1, 1500000000],
+      [null, -1, -1500000000],
+      ["bar", 0, null]
+    ])"});
+  CheckRoundtrip(*table, *expected);
+}
+
+TEST_F(TestORCWriter, MultipleStripes) {
+  auto schema = ::arrow::schema({field("int", int64()), field("str", utf8())});
+  Int64Builder int_builder;
+  StringBuilder str_builder;
+  for (int64_t i = 0; i < 100000; ++i) {
+    ASSERT_OK(int_builder.Append(i));
+    ASSERT_OK(str_builder.Append(std::to_string(i)));
+  }
+  std::shared_ptr<Array> ints, strs;
+  ASSERT_OK(int_builder.Finish(&ints));
+  ASSERT_OK(str_builder.Finish(&strs));
+  auto table = Table::Make(schema, {ints, strs});
+
+  adapters::orc::WriteOptions options;
+  options.batch_size = 1000;
+  options.stripe_size = 64 * 1024;
+  options.compression = Compression::ZSTD;
+  CheckRoundtrip(*table, options);
+  ASSERT_GT(num_stripes_, 1);
+}
+
+TEST_F(TestORCWriter, ReadWithThreads) {
+  auto table = MakeIntTable(100000);
+  adapters::orc::WriteOptions options;
+  options.stripe_size = 64 * 1024;
+  WriteTable(*table, options);
+
+  std::shared_ptr<Table> actual;
+  ReadTable(&actual, /*use_threads=*/true);
+  ASSERT_GT(num_stripes_, 1);
+  ASSERT_OK(actual->ValidateFull());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestORCWriter, StripeStatistics) {
+  auto table = MakeIntTable(100000);
+  adapters::orc::WriteOptions options;
+  options.stripe_size = 64 * 1024;
+  WriteTable(*table, options);
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenReader(&reader));
+  ASSERT_GT(num_stripes_, 1);
+  int64_t next_value = 0;
+  for (int64_t stripe = 0; stripe < num_stripes_; ++stripe) {
+    std::vector<adapters::orc::ColumnStatistics> stats;
+    ASSERT_OK(reader->ReadStripeStatistics(stripe, &stats));
+    ASSERT_EQ(stats.size(), 1);
+    ASSERT_FALSE(stats[0].has_null);
+    AssertScalarsEqual(Int64Scalar(next_value), *stats[0].min, /*verbose=*/true);
+    next_value += stats[0].num_values;
+    AssertScalarsEqual(Int64Scalar(next_value - 1), *stats[0].max, /*verbose=*/true);
+  }
+  ASSERT_EQ(next_value, 100000);
+
+  std::vector<adapters::orc::ColumnStatistics> stats;
+  ASSERT_RAISES(Invalid, reader->ReadStripeStatistics(num_stripes_, &stats));
+}
+
+TEST_F(TestORCWriter, SearchArgument) {
+  auto table = MakeIntTable(100000);
+  adapters::orc::WriteOptions options;
+  options.row_index_stride = 1000;
+  WriteTable(*table, options);
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenReader(&reader));
+  ASSERT_EQ(num_stripes_, 1);
+
+  auto check_num_rows = [&](adapters::orc::SearchArgumentBuilder* builder,
+                            int64_t expected) {
+    std::unique_ptr<adapters::orc::SearchArgument> search_argument;
+    ASSERT_OK(builder->Finish(&search_argument));
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadStripe(0, {"int"}, std::move(search_argument), &batch));
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_EQ(batch->num_rows(), expected);
+  };
+
+  // Whole row groups are read
+  adapters::orc::SearchArgumentBuilder less_than;
+  less_than.LessThan("int", Int64Scalar(2500));
+  check_num_rows(&less_than, 3000);
+
+  adapters::orc::SearchArgumentBuilder greater_than;
+  greater_than.StartNot().LessThanEquals("int", Int64Scalar(94999)).End();
+  check_num_rows(&greater_than, 5000);
+
+  adapters::orc::SearchArgumentBuilder in;
+  in.In("int", *ArrayFromJSON(int64(), "[10, 20, 50000]"));
+  check_num_rows(&in, 2000);
+
+  adapters::orc::SearchArgumentBuilder unknown;
+  unknown.StartAnd().Unknown().Equals("int", Int64Scalar(-1)).End();
+  check_num_rows(&unknown, 0);
+
+  // Unsupported types can't skip any row group
+  adapters::orc::SearchArgumentBuilder other_type;
+  other_type.StartOr()
+      .Equals("int", Int64Scalar(-1))
+      .Equals("int", Decimal128Scalar(Decimal128(1), decimal(10, 2)))
+      .End();
+  check_num_rows(&other_type, 100000);
+
+  adapters::orc::SearchArgumentBuilder unbalanced;
+  unbalanced.StartAnd().Equals("int", Int64Scalar(1));
+  std::unique_ptr<adapters::orc::SearchArgument> search_argument;
+  ASSERT_RAISES(Invalid, unbalanced.Finish(&search_argument));
+}
+
+TEST_F(TestORCWriter, Errors) {
+  auto sink = *io::BufferOutputStream::Create();
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+
+  auto schema = ::arrow::schema({field("dict", dictionary(int32(), utf8()))});
+  ASSERT_RAISES(NotImplemented, adapters::orc::ORCFileWriter::Open(
+                                    schema, sink.get(), adapters::orc::WriteOptions(),
+                                    &writer));
+
+  adapters::orc::WriteOptions options;
+  options.compression = Compression::BROTLI;
+  schema = ::arrow::schema({field("int", int32())});
+  ASSERT_RAISES(NotImplemented,
+                adapters::orc::ORCFileWriter::Open(schema, sink.get(), options, &writer));
+
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(schema, sink.get(),
+                                               adapters::orc::WriteOptions(), &writer));
+  auto other_batch = RecordBatchFromJSON(::arrow::schema({field("int", int64())}), "[]");
+  ASSERT_RAISES(Invalid, writer->Write(*other_batch));
+  ASSERT_OK(writer->Close());
+  auto batch = RecordBatchFromJSON(schema, "[[1]]");
+  ASSERT_RAISES(Invalid, writer->Write(*batch));
+}
+
 }  // namespace arrow
@@ -15,13 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include "arrow/adapters/orc/adapter_util.h"
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/range.h"
@@ -425,6 +429,399 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Arrow to ORC conversion
+
+namespace {
+
+// Set the number of elements and the validity of a batch
+void FillNotNull(const Array& array, int64_t offset, int64_t length,
+                 liborc::ColumnVectorBatch* batch) {
+  batch->numElements = length;
+  char* not_null = batch->notNull.data();
+  if (array.null_count() == 0) {
+    batch->hasNulls = false;
+    std::memset(not_null, 1, length);
+    return;
+  }
+  bool has_nulls = false;
+  for (int64_t i = 0; i < length; i++) {
+    not_null[i] = array.IsValid(offset + i);
+    has_nulls |= !not_null[i];
+  }
+  batch->hasNulls = has_nulls;
+}
+
+template <class array_type, class batch_type>
+Status WriteNumericBatch(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+  const auto& numeric_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<batch_type*>(cbatch);
+
+  // Values of null slots are copied as well, which is harmless
+  const auto* source = numeric_array.raw_values() + offset;
+  std::copy(source, source + length, batch->data.data());
+  return Status::OK();
+}
+
+Status WriteBoolBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto& bool_array = checked_cast<const BooleanArray&>(array);
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+
+  int64_t* target = batch->data.data();
+  for (int64_t i = 0; i < length; i++) {
+    target[i] = bool_array.Value(offset + i);
+  }
+  return Status::OK();
+}
+
+Status WriteDate64Batch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  constexpr int64_t kMillisecondsInDay = 86400000LL;
+  const int64_t* source = checked_cast<const Date64Array&>(array).raw_values() + offset;
+  auto batch = checked_cast<liborc::LongVectorBatch*>(cbatch);
+
+  int64_t* target = batch->data.data();
+  for (int64_t i = 0; i < length; i++) {
+    // Floor division, as dates before the epoch are negative
+    int64_t days = source[i] / kMillisecondsInDay;
+    if (source[i] % kMillisecondsInDay < 0) {
+      --days;
+    }
+    target[i] = days;
+  }
+  return Status::OK();
+}
+
+Status WriteTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* cbatch) {
+  const auto& ts_type = checked_cast<const TimestampType&>(*array.type());
+  const int64_t* source =
+      checked_cast<const TimestampArray&>(array).raw_values() + offset;
+  auto batch = checked_cast<liborc::TimestampVectorBatch*>(cbatch);
+
+  int64_t units_per_second;
+  switch (ts_type.unit()) {
+    case TimeUnit::SECOND:
+      units_per_second = 1;
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000LL;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000LL;
+      break;
+    default:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+
+  int64_t* seconds = batch->data.data();
+  int64_t* nanos = batch->nanoseconds.data();
+  for (int64_t i = 0; i < length; i++) {
+    int64_t secs = source[i] / units_per_second;
+    int64_t remainder = source[i] % units_per_second;
+    if (remainder < 0) {
+      // ORC nanoseconds are always positive
+      --secs;
+      remainder += units_per_second;
+    }
+    seconds[i] = secs;
+    nanos[i] = remainder * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+
+  // No copy: the batch points to the Arrow data
+  char** data = batch->data.data();
+  int64_t* lengths = batch->length.data();
+  for (int64_t i = 0; i < length; i++) {
+    typename array_type::offset_type value_length;
+    const uint8_t* value = binary_array.GetValue(offset + i, &value_length);
+    data[i] = const_cast<char*>(reinterpret_cast<const char*>(value));
+    lengths[i] = value_length;
+  }
+  return Status::OK();
+}
+
+Status WriteFixedBinaryBatch(const Array& array, int64_t offset, int64_t length,
+                             liborc::ColumnVectorBatch* cbatch) {
+  const auto& binary_array = checked_cast<const FixedSizeBinaryArray&>(array);
+  auto batch = checked_cast<liborc::StringVectorBatch*>(cbatch);
+
+  char** data = batch->data.data();
+  int64_t* lengths = batch->length.data();
+  for (int64_t i = 0; i < length; i++) {
+    data[i] = const_cast<char*>(
+        reinterpret_cast<const char*>(binary_array.GetValue(offset + i)));
+    lengths[i] = binary_array.byte_width();
+  }
+  return Status::OK();
+}
+
+Status WriteDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch) {
+  const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+  const auto& decimal_type = checked_cast<const Decimal128Type&>(*array.type());
+
+  if (decimal_type.precision() > 18) {
+    auto batch = checked_cast<liborc::Decimal128VectorBatch*>(cbatch);
+    batch->precision = decimal_type.precision();
+    batch->scale = decimal_type.scale();
+    for (int64_t i = 0; i < length; i++) {
+      Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  } else {
+    auto batch = checked_cast<liborc::Decimal64VectorBatch*>(cbatch);
+    batch->precision = decimal_type.precision();
+    batch->scale = decimal_type.scale();
+    for (int64_t i = 0; i < length; i++) {
+      Decimal128 value(decimal_array.GetValue(offset + i));
+      batch->values[i] = static_cast<int64_t>(value.low_bits());
+    }
+  }
+  return Status::OK();
+}
+
+void EnsureCapacity(int64_t length, liborc::ColumnVectorBatch* batch) {
+  if (batch->capacity < static_cast<uint64_t>(length)) {
+    batch->resize(length);
+  }
+}
+
+Status WriteStructBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch) {
+  const auto& struct_array = checked_cast<const StructArray&>(array);
+  auto batch = checked_cast<liborc::StructVectorBatch*>(cbatch);
+
+  for (int i = 0; i < struct_array.num_fields(); i++) {
+    // StructVectorBatch::resize() doesn't grow the field batches, which may
+    // be smaller than the struct batch inside a list or map
+    EnsureCapacity(length, batch->fields[i]);
+    RETURN_NOT_OK(
+        WriteBatch(*struct_array.field(i), offset, length, batch->fields[i]));
+  }
+  return Status::OK();
+}
+
+// Fill the offsets of a list or map batch and return the range of child values
+template <class array_type>
+void FillOffsets(const array_type& list_array, int64_t offset, int64_t length,
+                 int64_t* offsets, int64_t* values_offset, int64_t* values_length) {
+  const int64_t start = list_array.value_offset(offset);
+  for (int64_t i = 0; i <= length; i++) {
+    offsets[i] = list_array.value_offset(offset + i) - start;
+  }
+  *values_offset = start;
+  *values_length = offsets[length];
+}
+
+template <class array_type>
+Status WriteListBatch(const Array& array, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch) {
+  const auto& list_array = checked_cast<const array_type&>(array);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+
+  int64_t values_offset, values_length;
+  FillOffsets(list_array, offset, length, batch->offsets.data(), &values_offset,
+              &values_length);
+  EnsureCapacity(values_length, batch->elements.get());
+  return WriteBatch(*list_array.values(), values_offset, values_length,
+                    batch->elements.get());
+}
+
+Status WriteFixedSizeListBatch(const Array& array, int64_t offset, int64_t length,
+                               liborc::ColumnVectorBatch* cbatch) {
+  const auto& list_array = checked_cast<const FixedSizeListArray&>(array);
+  auto batch = checked_cast<liborc::ListVectorBatch*>(cbatch);
+
+  const int64_t list_size = list_array.list_type()->list_size();
+  int64_t* offsets = batch->offsets.data();
+  for (int64_t i = 0; i <= length; i++) {
+    offsets[i] = i * list_size;
+  }
+  const int64_t values_length = length * list_size;
+  EnsureCapacity(values_length, batch->elements.get());
+  return WriteBatch(*list_array.values(), list_array.value_offset(offset),
+                    values_length, batch->elements.get());
+}
+
+Status WriteMapBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* cbatch) {
+  const auto& map_array = checked_cast<const MapArray&>(array);
+  auto batch = checked_cast<liborc::MapVectorBatch*>(cbatch);
+
+  int64_t values_offset, values_length;
+  FillOffsets(map_array, offset, length, batch->offsets.data(), &values_offset,
+              &values_length);
+  EnsureCapacity(values_length, batch->keys.get());
+  EnsureCapacity(values_length, batch->elements.get());
+  RETURN_NOT_OK(
+      WriteBatch(*map_array.keys(), values_offset, values_length, batch->keys.get()));
+  return WriteBatch(*map_array.items(), values_offset, values_length,
+                    batch->elements.get());
+}
+
+}  // namespace
+
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch) {
+  FillNotNull(array, offset, length, batch);
+  if (length == 0) {
+    return Status::OK();
+  }
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteBoolBatch(array, offset, length, batch);
+    case Type::INT8:
+      return WriteNumericBatch<Int8Array, liborc::LongVectorBatch>(array, offset,
+                                                                   length, batch);
+    case Type::INT16:
+      return WriteNumericBatch<Int16Array, liborc::LongVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::INT32:
+      return WriteNumericBatch<Int32Array, liborc::LongVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::INT64:
+      return WriteNumericBatch<Int64Array, liborc::LongVectorBatch>(array, offset,
+                                                                    length, batch);
+    case Type::FLOAT:
+      return WriteNumericBatch<FloatArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                      length, batch);
+    case Type::DOUBLE:
+      return WriteNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(array, offset,
+                                                                       length, batch);
+    case Type::STRING:
+    case Type::BINARY:
+      return WriteBinaryBatch<BinaryArray>(array, offset, length, batch);
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return WriteBinaryBatch<LargeBinaryArray>(array, offset, length, batch);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteFixedBinaryBatch(array, offset, length, batch);
+    case Type::DATE32:
+      return WriteNumericBatch<Date32Array, liborc::LongVectorBatch>(array, offset,
+                                                                     length, batch);
+    case Type::DATE64:
+      return WriteDate64Batch(array, offset, length, batch);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, offset, length, batch);
+    case Type::DECIMAL:
+      return WriteDecimalBatch(array, offset, length, batch);
+    case Type::STRUCT:
+      return WriteStructBatch(array, offset, length, batch);
+    case Type::LIST:
+      return WriteListBatch<ListArray>(array, offset, length, batch);
+    case Type::LARGE_LIST:
+      return WriteListBatch<LargeListArray>(array, offset, length, batch);
+    case Type::FIXED_SIZE_LIST:
+      return WriteFixedSizeListBatch(array, offset, length, batch);
+    case Type::MAP:
+      return WriteMapBatch(array, offset, length, batch);
+    default:
+      return Status::NotImplemented("Writing Arrow type ", array.type()->ToString(),
+                                    " to ORC is not supported");
+  }
+}
+
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+    case Type::DATE64:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(decimal_type.precision(), decimal_type.scale());
+      break;
+    }
+    case Type::LIST:
+    case Type::LARGE_LIST:
+    case Type::FIXED_SIZE_LIST: {
+      std::unique_ptr<liborc::Type> elemtype;
+      RETURN_NOT_OK(GetORCType(*checked_cast<const BaseListType&>(type).value_type(),
+                               &elemtype));
+      *out = liborc::createListType(std::move(elemtype));
+      break;
+    }
+    case Type::MAP: {
+      const auto& map_type = checked_cast<const MapType&>(type);
+      std::unique_ptr<liborc::Type> keytype, valtype;
+      RETURN_NOT_OK(GetORCType(*map_type.key_type(), &keytype));
+      RETURN_NOT_OK(GetORCType(*map_type.item_type(), &valtype));
+      *out = liborc::createMapType(std::move(keytype), std::move(valtype));
+      break;
+    }
+    case Type::STRUCT: {
+      auto struct_type = liborc::createStructType();
+      for (const auto& child : type.fields()) {
+        std::unique_ptr<liborc::Type> elemtype;
+        RETURN_NOT_OK(GetORCType(*child->type(), &elemtype));
+        struct_type->addStructField(child->name(), std::move(elemtype));
+      }
+      *out = std::move(struct_type);
+      break;
+    }
+    default:
+      return Status::NotImplemented("Writing Arrow type ", type.ToString(),
+                                    " to ORC is not supported");
+  }
+  return Status::OK();
+}
+
+Status GetORCType(const Schema& schema, std::unique_ptr<liborc::Type>* out) {
+  auto struct_type = liborc::createStructType();
+  for (const auto& field : schema.fields()) {
+    std::unique_ptr<liborc::Type> elemtype;
+    RETURN_NOT_OK(GetORCType(*field->type(), &elemtype));
+    struct_type->addStructField(field->name(), std::move(elemtype));
+  }
+  *out = std::move(struct_type);
+  return Status::OK();
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -22,6 +22,7 @@
 
 #include "arrow/array/builder_base.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "orc/OrcFile.hh"
 
 namespace liborc = orc;
@@ -36,6 +37,19 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out);
+
+/// \brief Get the ORC struct type equivalent to an Arrow schema
+Status GetORCType(const Schema& schema, std::unique_ptr<liborc::Type>* out);
+
+/// \brief Fill an ORC batch with `length` values of `array` starting at `offset`
+///
+/// The batch must have been created for the ORC type returned by GetORCType.
+/// String and binary batches point to the array's data, so `array` must outlive
+/// the use of the batch.
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch);
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
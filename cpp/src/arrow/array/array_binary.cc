@@ -32,9 +32,36 @@ using internal::checked_cast;
 
 namespace {
 
+// Whether all the strings are valid, by validating the character data in one
+// go: this is equivalent to validating each string, as long as no string
+// starts or ends in the middle of a character.
+template <typename StringArrayType>
+bool ValidateAllStringData(const StringArrayType& array) {
+  if (array.length() == 0) {
+    return true;
+  }
+  const auto first_offset = array.value_offset(0);
+  const uint8_t* data = array.value_data()->data() + first_offset;
+  const int64_t size = array.value_offset(array.length()) - first_offset;
+  if (!util::ValidateUTF8(data, size)) {
+    return false;
+  }
+  for (int64_t i = 0; i < array.length(); ++i) {
+    const int64_t position = array.value_offset(i) - first_offset;
+    if (position < size && util::Utf8IsContinuation(data[position])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename StringArrayType>
 Status ValidateStringData(const StringArrayType& array) {
   util::InitializeUTF8();
+  if (ValidateAllStringData(array)) {
+    return Status::OK();
+  }
+  // Find the invalid string (null entries may hold invalid data)
   for (int64_t i = 0; i < array.length(); ++i) {
     if (!array.IsNull(i) && !util::ValidateUTF8(array.GetView(i))) {
       return Status::Invalid("Invalid UTF8 sequence at string index ", i);
@@ -301,15 +301,31 @@ class TestStringArray : public ::testing::Test {
     auto st2 = ValidateFull(1, {0, 4}, "\xf4\x90\x80\x80");
     // Single UTF8 character straddles two entries
     auto st3 = ValidateFull(2, {0, 1, 2}, "\xc3\xa9");
+    // Same, in data long enough to be validated as a whole
+    const std::string padding(100, 'x');
+    const auto padded_size = static_cast<offset_type>(padding.size());
+    auto st4 = ValidateFull(2, {0, padded_size + 1, 2 * padded_size + 2},
+                            padding + "\xc3\xa9" + padding);
     if (T::is_utf8) {
       ASSERT_RAISES(Invalid, st1);
       ASSERT_RAISES(Invalid, st2);
       ASSERT_RAISES(Invalid, st3);
+      ASSERT_RAISES(Invalid, st4);
     } else {
       ASSERT_OK(st1);
       ASSERT_OK(st2);
       ASSERT_OK(st3);
+      ASSERT_OK(st4);
     }
+
+    // Invalid data behind a null entry is ignored
+    std::vector<offset_type> offsets = {0, 4, 5, 9};
+    const uint8_t null_bitmap = 0x5;  // 0b101
+    const std::string data = "abcd\xff"
+                             "efgh";
+    ArrayType arr(3, Buffer::Wrap(offsets), std::make_shared<Buffer>(data),
+                  std::make_shared<Buffer>(&null_bitmap, 1), /*null_count=*/1);
+    ASSERT_OK(arr.ValidateFull());
   }
 
  protected:
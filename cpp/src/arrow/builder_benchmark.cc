@@ -140,6 +140,28 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetBytesProcessed(state.iterations() * kBytesProcessed);
 }
 
+#ifdef __linux__
+// Same as BuildBinaryArray, with the system allocator backing large buffers
+// with memory mappings (grown without copying) or not
+static void BuildBinaryArraySystemPool(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ABORT_NOT_OK(system_memory_pool_set_mmap_threshold(state.range(0) ? 1 << 20 : -1));
+  for (auto _ : state) {
+    BinaryBuilder builder(system_memory_pool());
+
+    for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
+      ABORT_NOT_OK(builder.Append(kBinaryView));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  ABORT_NOT_OK(system_memory_pool_set_mmap_threshold(64 << 20));
+}
+#endif
+
 static void BuildChunkedBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   // 1MB chunks
@@ -364,13 +386,14 @@ static void ArrayDataConstructDestruct(
 
 static void BenchmarkBufferBuilder(
     const std::string& datum,
-    benchmark::State& state) {  // NOLINT non-const reference
+    benchmark::State& state,  // NOLINT non-const reference
+    MemoryPool* pool = default_memory_pool()) {
   const void* raw_data = datum.data();
   int64_t raw_nbytes = static_cast<int64_t>(datum.size());
   // Write approx. 256 MB to BufferBuilder
   int64_t num_raw_values = (1 << 28) / raw_nbytes;
   for (auto _ : state) {
-    BufferBuilder builder;
+    BufferBuilder builder(pool);
     std::shared_ptr<Buffer> buf;
     for (int64_t i = 0; i < num_raw_values; ++i) {
       ABORT_NOT_OK(builder.Append(raw_data, raw_nbytes));
@@ -403,9 +426,26 @@ static void BufferBuilderLargeWrites(
   return BenchmarkBufferBuilder(datum, state);
 }
 
+#ifdef __linux__
+static void BufferBuilderLargeWritesSystemPool(
+    benchmark::State& state) {  // NOLINT non-const reference
+  ABORT_NOT_OK(system_memory_pool_set_mmap_threshold(state.range(0) ? 1 << 20 : -1));
+  std::string datum(1500000, 'x');
+  BenchmarkBufferBuilder(datum, state, system_memory_pool());
+  ABORT_NOT_OK(system_memory_pool_set_mmap_threshold(64 << 20));
+}
+#endif
+
 BENCHMARK(BufferBuilderTinyWrites)->UseRealTime();
 BENCHMARK(BufferBuilderSmallWrites)->UseRealTime();
 BENCHMARK(BufferBuilderLargeWrites)->UseRealTime();
+#ifdef __linux__
+BENCHMARK(BufferBuilderLargeWritesSystemPool)
+    ->Arg(0)
+    ->Arg(1)
+    ->ArgName("mmap")
+    ->UseRealTime();
+#endif
 
 // ----------------------------------------------------------------------
 // Benchmark declarations
@@ -439,6 +479,9 @@ BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+#ifdef __linux__
+BENCHMARK(BuildBinaryArraySystemPool)->Arg(0)->Arg(1)->ArgName("mmap");
+#endif
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
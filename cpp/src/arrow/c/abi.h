@@ -60,6 +60,30 @@ struct ArrowArray {
   void* private_data;
 };
 
+// A stream of arrays of a common type, e.g. the record batches of a table
+// exported as struct arrays.
+//
+// The callbacks return 0 on success, or an errno-compatible error code on
+// failure, in which case get_last_error() may describe the error. They must
+// not be called on a released stream, nor concurrently.
+struct ArrowArrayStream {
+  // Get the type of the arrays of the stream.  On success, `out` is a new
+  // schema owned by the caller.
+  int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+  // Get the next array of the stream.  On success, `out` is a new array owned
+  // by the caller, or a released array at the end of the stream.
+  int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+  // Describe the last error returned by get_schema() or get_next(), as a
+  // null-terminated UTF8 string, or return NULL if there is no description.
+  // The string is only valid until the next call on the stream.
+  const char* (*get_last_error)(struct ArrowArrayStream*);
+
+  // Release callback
+  void (*release)(struct ArrowArrayStream*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
 #ifdef __cplusplus
 }
 #endif
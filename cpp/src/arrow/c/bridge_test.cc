@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cerrno>
 #include <deque>
 #include <functional>
 #include <string>
@@ -40,6 +41,7 @@ namespace arrow {
 
 using internal::ArrayExportGuard;
 using internal::ArrayExportTraits;
+using internal::ArrayStreamExportGuard;
 using internal::SchemaExportGuard;
 using internal::SchemaExportTraits;
 
@@ -2648,6 +2650,181 @@ TEST_F(TestArrayRoundtrip, RecordBatch) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////
+// Array stream export and import tests
+
+// A reader failing after yielding its batches
+class FailingRecordBatchReader : public RecordBatchReader {
+ public:
+  FailingRecordBatchReader(std::shared_ptr<Schema> schema, RecordBatchVector batches,
+                           Status error)
+      : schema_(std::move(schema)), batches_(std::move(batches)), error_(error) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (next_ < batches_.size()) {
+      *batch = batches_[next_++];
+      return Status::OK();
+    }
+    return error_;
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  size_t next_ = 0;
+  Status error_;
+};
+
+class TestArrayStream : public ::testing::Test {
+ public:
+  void SetUp() override {
+    pool_ = default_memory_pool();
+    schema_ = ::arrow::schema({field("ints", int16()), field("strs", utf8())},
+                              key_value_metadata(kMetadataKeys2, kMetadataValues2));
+    batches_ = {
+        RecordBatch::Make(schema_, 3,
+                          {ArrayFromJSON(int16(), "[1, 2, null]"),
+                           ArrayFromJSON(utf8(), R"(["a", null, "bc"])")}),
+        RecordBatch::Make(schema_, 0,
+                          {ArrayFromJSON(int16(), "[]"), ArrayFromJSON(utf8(), "[]")}),
+        RecordBatch::Make(schema_, 1,
+                          {ArrayFromJSON(int16(), "[4]"),
+                           ArrayFromJSON(utf8(), R"(["d"])")}),
+    };
+  }
+
+  std::shared_ptr<RecordBatchReader> MakeReader() {
+    return *RecordBatchReader::Make(batches_, schema_);
+  }
+
+ protected:
+  MemoryPool* pool_;
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_F(TestArrayStream, Export) {
+  const auto orig_bytes = pool_->bytes_allocated();
+  struct ArrowArrayStream c_stream {};
+  ASSERT_OK(ExportRecordBatchReader(MakeReader(), &c_stream));
+  ArrayStreamExportGuard guard(&c_stream);
+  ASSERT_FALSE(ArrowArrayStreamIsReleased(&c_stream));
+
+  struct ArrowSchema c_schema {};
+  ASSERT_EQ(0, c_stream.get_schema(&c_stream, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto schema, ImportSchema(&c_schema));
+  AssertSchemaEqual(*schema_, *schema, /*check_metadata=*/true);
+
+  for (const auto& expected : batches_) {
+    struct ArrowArray c_array {};
+    ASSERT_EQ(0, c_stream.get_next(&c_stream, &c_array));
+    ASSERT_FALSE(ArrowArrayIsReleased(&c_array));
+    ASSERT_OK_AND_ASSIGN(auto batch, ImportRecordBatch(&c_array, schema));
+    AssertBatchesEqual(*expected, *batch);
+    // The batches are exported without copying their buffers
+    ASSERT_EQ(expected->column_data(1)->buffers[2]->data(),
+              batch->column_data(1)->buffers[2]->data());
+  }
+  // The end of the stream is signalled by a released array, repeatedly
+  for (int i = 0; i < 2; ++i) {
+    struct ArrowArray c_array {};
+    ASSERT_EQ(0, c_stream.get_next(&c_stream, &c_array));
+    ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  }
+  ASSERT_EQ(nullptr, c_stream.get_last_error(&c_stream));
+
+  ArrowArrayStreamRelease(&c_stream);
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  ASSERT_EQ(orig_bytes, pool_->bytes_allocated());
+}
+
+TEST_F(TestArrayStream, ExportError) {
+  auto reader = std::make_shared<FailingRecordBatchReader>(
+      schema_, RecordBatchVector{batches_[0]}, Status::IOError("disk on fire"));
+  struct ArrowArrayStream c_stream {};
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  ArrayStreamExportGuard guard(&c_stream);
+
+  struct ArrowArray c_array {};
+  ASSERT_EQ(0, c_stream.get_next(&c_stream, &c_array));
+  ArrowArrayRelease(&c_array);
+  ASSERT_EQ(EIO, c_stream.get_next(&c_stream, &c_array));
+  ASSERT_NE(nullptr, c_stream.get_last_error(&c_stream));
+  ASSERT_EQ("IOError: disk on fire", std::string(c_stream.get_last_error(&c_stream)));
+}
+
+TEST_F(TestArrayStream, Roundtrip) {
+  const auto orig_bytes = pool_->bytes_allocated();
+  {
+    struct ArrowArrayStream c_stream {};
+    ASSERT_OK(ExportRecordBatchReader(MakeReader(), &c_stream));
+    ASSERT_OK_AND_ASSIGN(auto reader, ImportRecordBatchReader(&c_stream));
+    // The imported reader owns the stream
+    ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+    AssertSchemaEqual(*schema_, *reader->schema(), /*check_metadata=*/true);
+
+    RecordBatchVector batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    ASSERT_EQ(batches_.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      AssertBatchesEqual(*batches_[i], *batches[i]);
+    }
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    ASSERT_EQ(nullptr, batch);
+  }
+  ASSERT_EQ(orig_bytes, pool_->bytes_allocated());
+}
+
+TEST_F(TestArrayStream, RoundtripError) {
+  auto check_error = [&](Status error) {
+    auto reader = std::make_shared<FailingRecordBatchReader>(
+        schema_, RecordBatchVector{batches_[0]}, error);
+    struct ArrowArrayStream c_stream {};
+    ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+    ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatchReader(&c_stream));
+
+    ASSERT_OK_AND_ASSIGN(auto batch, imported->Next());
+    AssertBatchesEqual(*batches_[0], *batch);
+    auto st = imported->Next().status();
+    ASSERT_EQ(error.code(), st.code());
+    ASSERT_NE(std::string::npos, st.message().find(error.message())) << st.ToString();
+  };
+  check_error(Status::IOError("disk on fire"));
+  check_error(Status::Invalid("bad data"));
+  check_error(Status::NotImplemented("no way"));
+  check_error(Status::OutOfMemory("too big"));
+}
+
+// A stream implemented in C whose schema can't be produced
+struct BrokenStreamData {
+  bool released = false;
+};
+
+TEST_F(TestArrayStream, ImportError) {
+  BrokenStreamData data;
+  struct ArrowArrayStream c_stream {};
+  c_stream.get_schema = [](struct ArrowArrayStream*, struct ArrowSchema*) {
+    return EINVAL;
+  };
+  c_stream.get_next = [](struct ArrowArrayStream*, struct ArrowArray*) { return EIO; };
+  c_stream.get_last_error = [](struct ArrowArrayStream*) -> const char* {
+    return "no schema";
+  };
+  c_stream.release = [](struct ArrowArrayStream* stream) {
+    reinterpret_cast<BrokenStreamData*>(stream->private_data)->released = true;
+    ArrowArrayStreamMarkReleased(stream);
+  };
+  c_stream.private_data = &data;
+
+  ASSERT_RAISES(Invalid, ImportRecordBatchReader(&c_stream));
+  // The stream was released, even though the import failed
+  ASSERT_TRUE(data.released);
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  ASSERT_RAISES(Invalid, ImportRecordBatchReader(&c_stream));
+}
+
 // TODO C -> C++ -> C roundtripping tests?
 
 }  // namespace arrow
@@ -25,6 +25,7 @@
 #include "arrow/compute/api_vector.h"     // IWYU pragma: export
 #include "arrow/compute/cast.h"           // IWYU pragma: export
 #include "arrow/compute/exec.h"           // IWYU pragma: export
+#include "arrow/compute/expression.h"     // IWYU pragma: export
 #include "arrow/compute/function.h"       // IWYU pragma: export
 #include "arrow/compute/kernel.h"         // IWYU pragma: export
 #include "arrow/compute/registry.h"       // IWYU pragma: export
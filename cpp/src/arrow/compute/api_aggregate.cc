@@ -41,5 +41,25 @@ Result<Datum> MinMax(const Datum& value, const MinMaxOptions& options, ExecConte
   return CallFunction("minmax", {value}, &options, ctx);
 }
 
+Result<Datum> ApproxCountDistinct(const Datum& value,
+                                  const ApproxCountDistinctOptions& options,
+                                  ExecContext* ctx) {
+  return CallFunction("approx_count_distinct", {value}, &options, ctx);
+}
+
+Result<Datum> Quantile(const Datum& value, const QuantileOptions& options,
+                       ExecContext* ctx) {
+  return CallFunction("quantile", {value}, &options, ctx);
+}
+
+Result<Datum> Median(const Datum& value, ExecContext* ctx) {
+  return CallFunction("median", {value}, ctx);
+}
+
+Result<Datum> ApproxQuantile(const Datum& value, const ApproxQuantileOptions& options,
+                             ExecContext* ctx) {
+  return CallFunction("approx_quantile", {value}, &options, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
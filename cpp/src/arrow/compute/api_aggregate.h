@@ -20,6 +20,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -144,5 +148,145 @@ Result<Datum> MinMax(const Array& array,
                      const MinMaxOptions& options = MinMaxOptions::Defaults(),
                      ExecContext* ctx = NULLPTR);
 
+/// \class ApproxCountDistinctOptions
+///
+/// Control the precision of the HyperLogLog sketch used by
+/// ApproxCountDistinct. The sketch uses 2^precision bytes of memory and the
+/// relative standard error of the estimate is about 1.04 / sqrt(2^precision).
+struct ARROW_EXPORT ApproxCountDistinctOptions : public FunctionOptions {
+  explicit ApproxCountDistinctOptions(int precision = 12) : precision(precision) {}
+
+  static ApproxCountDistinctOptions Defaults() { return ApproxCountDistinctOptions{}; }
+
+  /// Between 4 and 18
+  int precision = 12;
+};
+
+/// \brief Estimate the number of distinct non-null values of an array
+///
+/// The estimate is computed with a HyperLogLog sketch, using memory bounded
+/// by the precision option regardless of the number of distinct values.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxCountDistinctOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as an Int64Scalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproxCountDistinct(
+    const Datum& value,
+    const ApproxCountDistinctOptions& options = ApproxCountDistinctOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \class QuantileOptions
+///
+/// Select the quantiles computed by Quantile and the interpolation used when
+/// a quantile lies between two data points.
+struct ARROW_EXPORT QuantileOptions : public FunctionOptions {
+  enum Interpolation {
+    /// i + (j - i) * fraction
+    LINEAR = 0,
+    /// i
+    LOWER,
+    /// j
+    HIGHER,
+    /// i or j, whichever is nearest
+    NEAREST,
+    /// (i + j) / 2
+    MIDPOINT,
+  };
+
+  explicit QuantileOptions(double q = 0.5, enum Interpolation interpolation = LINEAR)
+      : q{q}, interpolation{interpolation} {}
+
+  explicit QuantileOptions(std::vector<double> q,
+                           enum Interpolation interpolation = LINEAR)
+      : q{std::move(q)}, interpolation{interpolation} {}
+
+  static QuantileOptions Defaults() { return QuantileOptions{}; }
+
+  /// Quantiles to compute, each between 0 and 1
+  std::vector<double> q;
+  enum Interpolation interpolation;
+};
+
+/// \brief Compute exact quantiles of a numeric array
+///
+/// Null values are skipped. All the non-null values are held in memory, see
+/// ApproxQuantile for a bounded-memory alternative.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see QuantileOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a DoubleArray with one value per requested
+/// quantile (null if the input has no non-null values)
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Quantile(const Datum& value,
+                       const QuantileOptions& options = QuantileOptions::Defaults(),
+                       ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the exact median of a numeric array
+///
+/// Null values are skipped. The median of an even number of values is the
+/// mean of the two middle values.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a DoubleScalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Median(const Datum& value, ExecContext* ctx = NULLPTR);
+
+/// \class ApproxQuantileOptions
+///
+/// Select the quantiles computed by ApproxQuantile and the parameters of the
+/// t-digest sketch.
+struct ARROW_EXPORT ApproxQuantileOptions : public FunctionOptions {
+  explicit ApproxQuantileOptions(double q = 0.5, uint32_t delta = 100,
+                                 uint32_t buffer_size = 500)
+      : q{q}, delta{delta}, buffer_size{buffer_size} {}
+
+  explicit ApproxQuantileOptions(std::vector<double> q, uint32_t delta = 100,
+                                 uint32_t buffer_size = 500)
+      : q{std::move(q)}, delta{delta}, buffer_size{buffer_size} {}
+
+  static ApproxQuantileOptions Defaults() { return ApproxQuantileOptions{}; }
+
+  /// Quantiles to compute, each between 0 and 1
+  std::vector<double> q;
+  /// Compression parameter of the t-digest: the number of centroids, and
+  /// hence the memory use and accuracy, grow with delta
+  uint32_t delta;
+  /// Number of values buffered before they are merged into the centroids
+  uint32_t buffer_size;
+};
+
+/// \brief Estimate quantiles of a numeric array
+///
+/// The quantiles are estimated with a t-digest sketch, using memory bounded
+/// by the options regardless of the input size. Null and NaN values are
+/// skipped.
+///
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[in] options see ApproxQuantileOptions for more information
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a DoubleArray with one value per requested
+/// quantile (null if the input has no non-null values)
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> ApproxQuantile(
+    const Datum& value,
+    const ApproxQuantileOptions& options = ApproxQuantileOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
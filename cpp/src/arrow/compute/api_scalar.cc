@@ -24,8 +24,12 @@
 #include "arrow/compute/exec.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 #define SCALAR_EAGER_UNARY(NAME, REGISTRY_NAME)              \
@@ -51,6 +55,13 @@ namespace compute {
 SCALAR_ARITHMETIC_BINARY(Add, "add", "add_checked")
 SCALAR_ARITHMETIC_BINARY(Subtract, "subtract", "subtract_checked")
 SCALAR_ARITHMETIC_BINARY(Multiply, "multiply", "multiply_checked")
+SCALAR_ARITHMETIC_BINARY(Divide, "divide", "divide_checked")
+SCALAR_ARITHMETIC_BINARY(Power, "power", "power_checked")
+
+Result<Datum> Negate(const Datum& arg, ArithmeticOptions options, ExecContext* ctx) {
+  auto func_name = (options.check_overflow) ? "negate_checked" : "negate";
+  return CallFunction(func_name, {arg}, ctx);
+}
 
 // ----------------------------------------------------------------------
 // Set-related operations
@@ -62,7 +73,12 @@ static Result<Datum> ExecSetLookup(const std::string& func_name, const Datum& da
     return Status::Invalid("Set lookup value set must be Array or ChunkedArray");
   }
 
-  if (value_set.length() > 0 && !data.type()->Equals(value_set.type())) {
+  // Dictionary arrays are looked up by their values
+  std::shared_ptr<DataType> data_type = data.type();
+  if (data_type->id() == Type::DICTIONARY) {
+    data_type = checked_cast<const DictionaryType&>(*data_type).value_type();
+  }
+  if (value_set.length() > 0 && !data_type->Equals(value_set.type())) {
     std::stringstream ss;
     ss << "Array type didn't match type of values set: " << data.type()->ToString()
        << " vs " << value_set.type()->ToString();
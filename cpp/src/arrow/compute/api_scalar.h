@@ -79,6 +79,47 @@ Result<Datum> Multiply(const Datum& left, const Datum& right,
                        ArithmeticOptions options = ArithmeticOptions(),
                        ExecContext* ctx = NULLPTR);
 
+/// \brief Divide two values. Array values must be the same length. If either
+/// argument is null the result will be null. For integer types, division by
+/// zero is an error and the result is truncated towards zero. With overflow
+/// checking, floating point division by zero is also an error.
+///
+/// \param[in] left the dividend
+/// \param[in] right the divisor
+/// \param[in] options arithmetic options (overflow handling), optional
+/// \param[in] ctx the function execution context, optional
+/// \return the elementwise quotient
+ARROW_EXPORT
+Result<Datum> Divide(const Datum& left, const Datum& right,
+                     ArithmeticOptions options = ArithmeticOptions(),
+                     ExecContext* ctx = NULLPTR);
+
+/// \brief Raise values to a power. Array values must be the same length. If
+/// either argument is null the result will be null. For integer types, a
+/// negative exponent is an error.
+///
+/// \param[in] left the base
+/// \param[in] right the exponent
+/// \param[in] options arithmetic options (overflow handling), optional
+/// \param[in] ctx the function execution context, optional
+/// \return the elementwise base value raised to the power of exponent
+ARROW_EXPORT
+Result<Datum> Power(const Datum& left, const Datum& right,
+                    ArithmeticOptions options = ArithmeticOptions(),
+                    ExecContext* ctx = NULLPTR);
+
+/// \brief Negate values. If the value is null the result will be null.
+/// Overflow checking is only available for signed integer and floating point
+/// types.
+///
+/// \param[in] arg the value to negate
+/// \param[in] options arithmetic options (overflow handling), optional
+/// \param[in] ctx the function execution context, optional
+/// \return the elementwise negation
+ARROW_EXPORT
+Result<Datum> Negate(const Datum& arg, ArithmeticOptions options = ArithmeticOptions(),
+                     ExecContext* ctx = NULLPTR);
+
 enum CompareOperator {
   EQUAL,
   NOT_EQUAL,
@@ -268,6 +309,39 @@ struct ARROW_EXPORT BinaryContainsExactOptions : public FunctionOptions {
   std::string pattern;
 };
 
+/// \brief Options for the "match_like" and "match_regex" functions
+///
+/// For "match_like", the pattern is a SQL LIKE pattern: '%' matches any
+/// sequence of characters, '_' matches any single character and '\' escapes
+/// the next character.  For "match_regex", the pattern is a RE2 regular
+/// expression which may match anywhere in the string.
+struct ARROW_EXPORT MatchPatternOptions : public FunctionOptions {
+  explicit MatchPatternOptions(std::string pattern) : pattern(std::move(pattern)) {}
+
+  std::string pattern;
+};
+
+/// \brief Options for the "split_pattern" function
+struct ARROW_EXPORT SplitPatternOptions : public FunctionOptions {
+  explicit SplitPatternOptions(std::string pattern, int64_t max_splits = -1)
+      : pattern(std::move(pattern)), max_splits(max_splits) {}
+
+  /// The literal separator, must not be empty
+  std::string pattern;
+  /// Maximum number of splits per string, -1 for no limit
+  int64_t max_splits;
+};
+
+/// \brief Options for the "extract_regex" function
+///
+/// Every capture group of the pattern must be named; each yields a field of
+/// the struct output.  Strings not matching the pattern yield null.
+struct ARROW_EXPORT ExtractRegexOptions : public FunctionOptions {
+  explicit ExtractRegexOptions(std::string pattern) : pattern(std::move(pattern)) {}
+
+  std::string pattern;
+};
+
 // ----------------------------------------------------------------------
 // Temporal functions
 
@@ -46,6 +46,14 @@ Result<std::shared_ptr<Array>> SortToIndices(const Array& values, ExecContext* c
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("select_k_unstable", {datum}, &options, ctx));
+  return result.make_array();
+}
+
 Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, ctx));
   return result.make_array();
@@ -65,6 +73,37 @@ Result<std::shared_ptr<Array>> ValueCounts(const Datum& value, ExecContext* ctx)
   return result.make_array();
 }
 
+// ----------------------------------------------------------------------
+// Cumulative and window functions
+
+#define VECTOR_CUMULATIVE(NAME, REGISTRY_NAME, REGISTRY_CHECKED_NAME)                  \
+  Result<Datum> NAME(const Datum& values, const CumulativeOptions& options,            \
+                     ExecContext* ctx) {                                               \
+    auto func_name = (options.check_overflow) ? REGISTRY_CHECKED_NAME : REGISTRY_NAME; \
+    return CallFunction(func_name, {values}, &options, ctx);                           \
+  }
+
+VECTOR_CUMULATIVE(CumulativeSum, "cumulative_sum", "cumulative_sum_checked")
+VECTOR_CUMULATIVE(CumulativeProduct, "cumulative_prod", "cumulative_prod_checked")
+VECTOR_CUMULATIVE(CumulativeMin, "cumulative_min", "cumulative_min")
+VECTOR_CUMULATIVE(CumulativeMax, "cumulative_max", "cumulative_max")
+
+#define VECTOR_ROLLING(NAME, REGISTRY_NAME)                              \
+  Result<Datum> NAME(const Datum& values, const RollingOptions& options, \
+                     ExecContext* ctx) {                                 \
+    return CallFunction(REGISTRY_NAME, {values}, &options, ctx);         \
+  }
+
+VECTOR_ROLLING(RollingSum, "rolling_sum")
+VECTOR_ROLLING(RollingMean, "rolling_mean")
+VECTOR_ROLLING(RollingMin, "rolling_min")
+VECTOR_ROLLING(RollingMax, "rolling_max")
+
+Result<Datum> Shift(const Datum& values, const ShiftOptions& options,
+                    ExecContext* ctx) {
+  return CallFunction("shift", {values}, &options, ctx);
+}
+
 // ----------------------------------------------------------------------
 // Filter- and take-related selection functions
 
@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
@@ -160,6 +164,87 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortToIndices(const Array& values,
                                              ExecContext* ctx = NULLPTR);
 
+enum class SortOrder {
+  Ascending,
+  Descending,
+};
+
+/// \brief One sort key: a column name and an ordering
+struct ARROW_EXPORT SortKey {
+  explicit SortKey(std::string name, SortOrder order = SortOrder::Ascending)
+      : name(std::move(name)), order(order) {}
+
+  /// The name of the column to sort on (ignored for array-like inputs)
+  std::string name;
+  SortOrder order;
+};
+
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  static SelectKOptions Defaults() { return SelectKOptions{}; }
+
+  /// \brief Options selecting the k largest values of the given columns
+  static SelectKOptions TopKDefault(int64_t k,
+                                    const std::vector<std::string>& key_names = {}) {
+    return Make(k, key_names, SortOrder::Descending);
+  }
+
+  /// \brief Options selecting the k smallest values of the given columns
+  static SelectKOptions BottomKDefault(int64_t k,
+                                       const std::vector<std::string>& key_names = {}) {
+    return Make(k, key_names, SortOrder::Ascending);
+  }
+
+  /// The number of rows to select
+  int64_t k;
+  /// The keys to order the rows by, the first one being the most significant.
+  /// Array-like inputs take at most one key, whose name is ignored; if none is
+  /// given they are ordered ascending.
+  std::vector<SortKey> sort_keys;
+
+ private:
+  static SelectKOptions Make(int64_t k, const std::vector<std::string>& key_names,
+                             SortOrder order) {
+    std::vector<SortKey> keys;
+    for (const auto& name : key_names) {
+      keys.emplace_back(name, order);
+    }
+    if (keys.empty()) {
+      keys.emplace_back("", order);
+    }
+    return SelectKOptions(k, std::move(keys));
+  }
+};
+
+/// \brief Returns the indices of the first k rows in sort order
+///
+/// The input may be an Array, a ChunkedArray, a RecordBatch or a Table.
+/// The output holds the indices of the selected rows in the (logical,
+/// unchunked) input, ordered by the sort keys. It has min(k, length)
+/// elements. Nulls sort after NaNs, which sort after all other values,
+/// whatever the sort order. The relative order of equal rows is unspecified.
+///
+/// Unlike sorting and taking the first k indices, this does not need to
+/// concatenate chunked inputs nor to materialize an index per input row: each
+/// thread keeps a bounded heap of its k best rows, and the heaps are merged.
+///
+/// For example given values = [null, 1, 3.3, null, 2, 5.3] and
+/// options = SelectKOptions::TopKDefault(3), the output will be [5, 2, 4]
+///
+/// \param[in] datum array-like or tabular input
+/// \param[in] options the number of rows to select and the sort keys
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected rows as an UInt64Array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectKUnstable(const Datum& datum,
+                                               const SelectKOptions& options,
+                                               ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -206,6 +291,160 @@ Result<std::shared_ptr<Array>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+// ----------------------------------------------------------------------
+// Cumulative and window functions
+
+struct ARROW_EXPORT CumulativeOptions : public FunctionOptions {
+  explicit CumulativeOptions(bool skip_nulls = false, bool check_overflow = false)
+      : skip_nulls(skip_nulls), check_overflow(check_overflow) {}
+
+  static CumulativeOptions Defaults() { return CumulativeOptions(); }
+
+  /// If false, the outputs at and after the first null are null. If true,
+  /// the outputs at nulls are null and the accumulation continues after them.
+  bool skip_nulls;
+  /// If true, integer sums and products raise an error on overflow rather
+  /// than wrapping around
+  bool check_overflow;
+};
+
+/// \brief Compute the running sums of an array-like object
+///
+/// For example given values = [1, 2, null, 4], the output will be
+/// [1, 3, null, null], or [1, 3, null, 7] with options.skip_nulls.
+///
+/// Chunked inputs are accumulated across chunks. Large inputs of exact types
+/// (integers) are computed in parallel if the context allows threads.
+///
+/// \param[in] values array-like input of a numeric type
+/// \param[in] options configures null handling and overflow checking
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CumulativeSum(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running products of an array-like object
+///
+/// \see CumulativeSum
+ARROW_EXPORT
+Result<Datum> CumulativeProduct(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running minimums of an array-like object
+///
+/// NaNs are ignored, unless all values accumulated so far are NaN.
+/// options.check_overflow has no effect.
+///
+/// \see CumulativeSum
+ARROW_EXPORT
+Result<Datum> CumulativeMin(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the running maximums of an array-like object
+///
+/// \see CumulativeMin
+ARROW_EXPORT
+Result<Datum> CumulativeMax(
+    const Datum& values, const CumulativeOptions& options = CumulativeOptions::Defaults(),
+    ExecContext* ctx = NULLPTR);
+
+struct ARROW_EXPORT RollingOptions : public FunctionOptions {
+  explicit RollingOptions(int64_t window_size, int64_t min_periods = -1)
+      : window_size(window_size), min_periods(min_periods) {}
+
+  /// The number of values in each window, ending at the current position
+  int64_t window_size;
+  /// The minimum number of non-null values in a window for its output to be
+  /// non-null. If negative, window_size is used.
+  int64_t min_periods;
+};
+
+/// \brief Compute the sums of a fixed-size window sliding over an
+/// array-like object
+///
+/// For example given values = [1, 2, null, 4, 5] and a window_size of 2,
+/// the output will be [null, 3, null, null, 9], or [1, 3, 2, 4, 9] with a
+/// min_periods of 1.
+///
+/// Windows span the chunks of chunked inputs. Integers are summed into int64
+/// or uint64 and floating point values into double.
+///
+/// \param[in] values array-like input of a numeric type
+/// \param[in] options configures the size of the windows
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape as the input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> RollingSum(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the means, as double, of a fixed-size window sliding over an
+/// array-like object
+///
+/// \see RollingSum
+ARROW_EXPORT
+Result<Datum> RollingMean(const Datum& values, const RollingOptions& options,
+                          ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the minimums of a fixed-size window sliding over an
+/// array-like object
+///
+/// The output has the type of the input. NaNs are ignored unless all non-null
+/// values of the window are NaN.
+///
+/// \see RollingSum
+ARROW_EXPORT
+Result<Datum> RollingMin(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+/// \brief Compute the maximums of a fixed-size window sliding over an
+/// array-like object
+///
+/// \see RollingMin
+ARROW_EXPORT
+Result<Datum> RollingMax(const Datum& values, const RollingOptions& options,
+                         ExecContext* ctx = NULLPTR);
+
+struct ARROW_EXPORT ShiftOptions : public FunctionOptions {
+  explicit ShiftOptions(int64_t periods = 1) : periods(periods) {}
+
+  static ShiftOptions Defaults() { return ShiftOptions(); }
+
+  /// The number of positions to shift values forward by (lag), or backward
+  /// by if negative (lead)
+  int64_t periods;
+};
+
+/// \brief Shift the values of an array-like object by a number of positions,
+/// filling the vacated positions with nulls
+///
+/// For example given values = [1, 2, 3, 4], the output will be
+/// [null, 1, 2, 3] with a periods of 1 and [3, 4, null, null] with a periods
+/// of -2.
+///
+/// Chunked inputs are shifted without copying their chunks.
+///
+/// \param[in] values array-like input of any type
+/// \param[in] options configures the number of positions
+/// \param[in] ctx the function execution context, optional
+/// \return result with the same shape and type as the input
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> Shift(const Datum& values,
+                    const ShiftOptions& options = ShiftOptions::Defaults(),
+                    ExecContext* ctx = NULLPTR);
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
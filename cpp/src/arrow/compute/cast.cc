@@ -60,6 +60,8 @@ class CastMetaFunction : public MetaFunction {
  public:
   CastMetaFunction() : MetaFunction("cast", Arity::Unary()) {}
 
+  using MetaFunction::Execute;
+
   Result<const CastOptions*> ValidateOptions(const FunctionOptions* options) const {
     auto cast_options = static_cast<const CastOptions*>(options);
 
@@ -83,6 +85,21 @@ class CastMetaFunction : public MetaFunction {
                           GetCastFunction(cast_options->to_type));
     return cast_func->Execute(args, options, ctx);
   }
+
+  // Push a selection vector down into the cast function, rather than having
+  // the selected rows materialized
+  Result<Datum> Execute(const ExecBatch& batch, const FunctionOptions* options,
+                        ExecContext* ctx) const override {
+    if (batch.selection_vector != nullptr && batch.values.size() == 1) {
+      ARROW_ASSIGN_OR_RAISE(auto cast_options, ValidateOptions(options));
+      if (!batch[0].type()->Equals(*cast_options->to_type)) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<CastFunction> cast_func,
+                              GetCastFunction(cast_options->to_type));
+        return cast_func->Execute(batch, options, ctx);
+      }
+    }
+    return MetaFunction::Execute(batch, options, ctx);
+  }
 };
 
 void RegisterScalarCast(FunctionRegistry* registry) {
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -41,10 +42,13 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -52,6 +56,9 @@ using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
 using internal::CpuInfo;
+using internal::GenerateBitsUnrolled;
+using internal::OptionalParallelFor;
+using internal::ParallelFor;
 
 namespace compute {
 
@@ -207,6 +214,8 @@ bool ArrayHasNulls(const ArrayData& data) {
 // more flexibility.
 //
 // * If the batch has no nulls, then we do nothing
+// * If the batch has a selection vector, the validity bits of the selected
+//   rows are gathered into the output bitmap
 // * If only a single array has nulls, and its offset is a multiple of 8,
 //   then we can zero-copy the bitmap into the output
 // * Otherwise, we allocate the bitmap and populate it
@@ -275,7 +284,8 @@ class NullPropagator {
     // OK, the output should be all null
     output_->null_count = output_->length;
 
-    if (!bitmap_preallocated_ && all_null_bitmap) {
+    if (!bitmap_preallocated_ && all_null_bitmap &&
+        batch_.selection_vector == nullptr) {
       // If we did not pre-allocate memory, and we observed an all-null bitmap,
       // then we can zero-copy it into the output
       output_->buffers[0] = std::move(all_null_bitmap);
@@ -347,6 +357,32 @@ class NullPropagator {
     return Status::OK();
   }
 
+  Status PropagateSelected() {
+    // Gather the validity bits of the selected rows and intersect them
+    RETURN_NOT_OK(EnsureAllocated());
+
+    std::vector<const uint8_t*> bitmaps;
+    std::vector<int64_t> offsets;
+    for (const Datum* value : values_with_nulls_) {
+      // By construction, the values are arrays that are not all null
+      const ArrayData& arr = *value->array();
+      bitmaps.push_back(arr.buffers[0]->data());
+      offsets.push_back(arr.offset);
+    }
+    const int32_t* indices = batch_.selection_vector->indices();
+    int64_t position = 0;
+    GenerateBitsUnrolled(bitmap_, output_->offset, output_->length, [&]() -> bool {
+      const int32_t index = indices[position++];
+      for (size_t i = 0; i < bitmaps.size(); ++i) {
+        if (!BitUtil::GetBit(bitmaps[i], offsets[i] + index)) {
+          return false;
+        }
+      }
+      return true;
+    });
+    return Status::OK();
+  }
+
   Status Execute() {
     bool finished = false;
     ARROW_ASSIGN_OR_RAISE(finished, ShortCircuitIfAllNull());
@@ -377,6 +413,8 @@ class NullPropagator {
         BitUtil::SetBitsTo(bitmap_, output_->offset, output_->length, true);
       }
       return Status::OK();
+    } else if (batch_.selection_vector != nullptr) {
+      return PropagateSelected();
     } else if (values_with_nulls_.size() == 1) {
       return PropagateSingle();
     } else {
@@ -448,6 +486,83 @@ Status CheckAllValues(const std::vector<Datum>& values) {
   return Status::OK();
 }
 
+Status CheckSelection(const ExecBatch& batch) {
+  DCHECK_NE(nullptr, batch.selection_vector);
+  int64_t length = -1;
+  for (const auto& value : batch.values) {
+    if (value.kind() == Datum::CHUNKED_ARRAY) {
+      return Status::Invalid("Selection vectors are not supported with ",
+                             "chunked array arguments");
+    }
+    if (value.kind() == Datum::ARRAY) {
+      if (length >= 0 && value.length() != length) {
+        return Status::Invalid("Array arguments must all be the same length");
+      }
+      length = value.length();
+    }
+  }
+  if (length < 0) {
+    // Only scalar arguments
+    return Status::OK();
+  }
+  const int32_t* indices = batch.selection_vector->indices();
+  for (int32_t i = 0; i < batch.selection_vector->length(); ++i) {
+    if (indices[i] < 0 || indices[i] >= length) {
+      return Status::IndexError("Selection index ", indices[i],
+                                " out of bounds for arguments of length ", length);
+    }
+  }
+  return Status::OK();
+}
+
+Result<std::vector<Datum>> MaterializeSelection(const ExecBatch& batch,
+                                                ExecContext* ctx) {
+  DCHECK_NE(nullptr, batch.selection_vector);
+  const Datum indices(batch.selection_vector->data());
+  std::vector<Datum> args;
+  for (const auto& value : batch.values) {
+    if (value.kind() == Datum::ARRAY) {
+      ARROW_ASSIGN_OR_RAISE(Datum selected, CallFunction("take", {value, indices}, ctx));
+      args.push_back(std::move(selected));
+    } else {
+      args.push_back(value);
+    }
+  }
+  return args;
+}
+
+Result<Datum> ScatterSelection(const Datum& compacted, const ExecBatch& batch,
+                               ExecContext* ctx) {
+  DCHECK_NE(nullptr, batch.selection_vector);
+  if (compacted.kind() != Datum::ARRAY) {
+    return compacted;
+  }
+  int64_t length = 0;
+  for (const auto& value : batch.values) {
+    if (value.kind() == Datum::ARRAY) {
+      length = value.length();
+      break;
+    }
+  }
+
+  // Build the inverse of the selection: the index of each selected row in the
+  // compacted output, and null for the rows which are not selected
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> validity,
+                        AllocateEmptyBitmap(length, ctx->memory_pool()));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> positions,
+                        AllocateBuffer(length * sizeof(int32_t), ctx->memory_pool()));
+  auto out_positions = reinterpret_cast<int32_t*>(positions->mutable_data());
+  std::fill(out_positions, out_positions + length, 0);
+  const int32_t* indices = batch.selection_vector->indices();
+  for (int32_t i = 0; i < batch.selection_vector->length(); ++i) {
+    out_positions[indices[i]] = i;
+    BitUtil::SetBit(validity->mutable_data(), indices[i]);
+  }
+  auto inverse =
+      ArrayData::Make(int32(), length, {std::move(validity), std::move(positions)});
+  return CallFunction("take", {compacted, Datum(std::move(inverse))}, ctx);
+}
+
 template <typename FunctionType>
 class FunctionExecutorImpl : public FunctionExecutor {
  public:
@@ -460,6 +575,14 @@ class FunctionExecutorImpl : public FunctionExecutor {
 
   void Reset() {}
 
+  // Unless overridden, the selected rows are materialized and executed as
+  // regular arguments
+  Status ExecuteSelection(const ExecBatch& batch, ExecListener* listener) override {
+    ARROW_ASSIGN_OR_RAISE(std::vector<Datum> args,
+                          MaterializeSelection(batch, exec_ctx_));
+    return this->Execute(args, listener);
+  }
+
   Status InitState() {
     // Some kernels require initialization of an opaque state object
     if (kernel_->init) {
@@ -478,6 +601,19 @@ class FunctionExecutorImpl : public FunctionExecutor {
     return Status::OK();
   }
 
+  // Drain the ExecBatchIterator, recording the position of each batch in the
+  // overall input so that batches may be executed out of order
+  void CollectBatches(std::vector<ExecBatch>* batches,
+                      std::vector<int64_t>* positions = nullptr) {
+    ExecBatch batch;
+    while (batch_iterator_->Next(&batch)) {
+      if (positions != nullptr) {
+        positions->push_back(batch_iterator_->position() - batch.length);
+      }
+      batches->push_back(batch);
+    }
+  }
+
   Status BindArgs(const std::vector<Datum>& args) {
     RETURN_NOT_OK(GetValueDescriptors(args, &input_descrs_));
     ARROW_ASSIGN_OR_RAISE(kernel_, func_->DispatchExact(input_descrs_));
@@ -516,6 +652,14 @@ class FunctionExecutorImpl : public FunctionExecutor {
 
   ValueDescr output_descr() const override { return output_descr_; }
 
+  // Whether `num_tasks` tasks may be run on the CPU thread pool. When called
+  // from one of its workers they are run inline instead, since blocking a
+  // worker on tasks queued behind it can deadlock the pool
+  bool CanExecuteInParallel(int64_t num_tasks) const {
+    return exec_ctx_->use_threads() && num_tasks > 1 &&
+           !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+  }
+
   // Not all of these members are used for every executor type
 
   ExecContext* exec_ctx_;
@@ -547,9 +691,36 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
 
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
-    ExecBatch batch;
-    while (batch_iterator_->Next(&batch)) {
-      RETURN_NOT_OK(ExecuteBatch(batch, listener));
+    std::vector<ExecBatch> batches;
+    std::vector<int64_t> positions;
+    CollectBatches(&batches, &positions);
+
+    const int num_batches = static_cast<int>(batches.size());
+    if (CanExecuteInParallel(positions)) {
+      // Each batch is executed with its own KernelContext so that errors raised
+      // by concurrent kernel invocations do not interfere with one another.
+      // Chunked outputs are emitted in order once all batches are done
+      std::vector<Datum> outputs(num_batches);
+      RETURN_NOT_OK(ParallelFor(num_batches, [&](int i) {
+        KernelContext batch_ctx(exec_ctx_);
+        batch_ctx.SetState(state_.get());
+        return ExecuteBatch(&batch_ctx, batches[i], positions[i], &outputs[i]);
+      }));
+      if (!preallocate_contiguous_) {
+        for (auto& out : outputs) {
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
+    } else {
+      for (int i = 0; i < num_batches; ++i) {
+        Datum out;
+        RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, batches[i], positions[i], &out));
+        if (!preallocate_contiguous_) {
+          // If we are producing chunked output rather than one big array, then
+          // emit each chunk as soon as it's available
+          RETURN_NOT_OK(listener->OnResult(std::move(out)));
+        }
+      }
     }
     if (preallocate_contiguous_) {
       // If we preallocated one big chunk, since the kernel execution is
@@ -559,6 +730,25 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
     return Status::OK();
   }
 
+  Status ExecuteSelection(const ExecBatch& batch, ExecListener* listener) override {
+    std::vector<ValueDescr> descrs;
+    RETURN_NOT_OK(GetValueDescriptors(batch.values, &descrs));
+    ARROW_ASSIGN_OR_RAISE(const ScalarKernel* kernel, func_->DispatchExact(descrs));
+    const bool have_array = std::any_of(
+        batch.values.begin(), batch.values.end(),
+        [](const Datum& value) { return value.kind() == Datum::ARRAY; });
+    if (!kernel->can_use_selection_vector || !have_array) {
+      return BASE::ExecuteSelection(batch, listener);
+    }
+
+    // The kernel computes the selected rows only, as a single batch
+    selection_length_ = batch.length;
+    RETURN_NOT_OK(PrepareExecute(batch.values));
+    Datum out;
+    RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, batch, /*batch_start_position=*/0, &out));
+    return listener->OnResult(std::move(out));
+  }
+
   Datum WrapResults(const std::vector<Datum>& inputs,
                     const std::vector<Datum>& outputs) override {
     if (output_descr_.shape == ValueDescr::SCALAR) {
@@ -587,31 +777,42 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   }
 
  protected:
-  Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
-    Datum out;
-    RETURN_NOT_OK(PrepareNextOutput(batch, &out));
+  // Batches are executed on the CPU thread pool if the ExecContext allows it
+  // and there is more than one. When writing into a contiguous preallocation,
+  // every batch must start on a byte boundary so that concurrent kernels never
+  // write to the same byte of a bitmap
+  bool CanExecuteInParallel(const std::vector<int64_t>& positions) const {
+    if (!FunctionExecutorImpl::CanExecuteInParallel(
+            static_cast<int64_t>(positions.size()))) {
+      return false;
+    }
+    if (preallocate_contiguous_) {
+      return std::all_of(positions.begin(), positions.end(),
+                         [](int64_t position) { return position % 8 == 0; });
+    }
+    return true;
+  }
+
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch,
+                      int64_t batch_start_position, Datum* out) {
+    RETURN_NOT_OK(PrepareNextOutput(batch, batch_start_position, out));
 
     if (kernel_->null_handling == NullHandling::INTERSECTION) {
       if (output_descr_.shape == ValueDescr::ARRAY) {
-        RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out.mutable_array()));
+        RETURN_NOT_OK(PropagateNulls(ctx, batch, out->mutable_array()));
       } else {
         // set scalar validity
-        out.scalar()->is_valid =
+        out->scalar()->is_valid =
             std::all_of(batch.values.begin(), batch.values.end(),
                         [](const Datum& input) { return input.scalar()->is_valid; });
       }
     } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL &&
                output_descr_.shape == ValueDescr::SCALAR) {
-      out.scalar()->is_valid = true;
+      out->scalar()->is_valid = true;
     }
 
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
-    if (!preallocate_contiguous_) {
-      // If we are producing chunked output rather than one big array, then
-      // emit each chunk as soon as it's available
-      RETURN_NOT_OK(listener->OnResult(std::move(out)));
-    }
+    kernel_->exec(ctx, batch, out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
     return Status::OK();
   }
 
@@ -624,11 +825,17 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
       // kernels supporting preallocation, then we do so up front and then
       // iterate over slices of that large array. Otherwise, we preallocate prior
       // to processing each batch emitted from the ExecBatchIterator
-      RETURN_NOT_OK(SetupPreallocation(batch_iterator_->length()));
+      RETURN_NOT_OK(SetupPreallocation(output_length()));
     }
     return Status::OK();
   }
 
+  // The length of the output of executing all batches: the length of the
+  // selection if the arguments have one
+  int64_t output_length() const {
+    return selection_length_ >= 0 ? selection_length_ : batch_iterator_->length();
+  }
+
   // We must accommodate two different modes of execution for preallocated
   // execution
   //
@@ -643,13 +850,12 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
   // outputs), then contiguous results are only possible if the input is
   // contiguous.
 
-  Status PrepareNextOutput(const ExecBatch& batch, Datum* out) {
+  Status PrepareNextOutput(const ExecBatch& batch, int64_t batch_start_position,
+                           Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       if (preallocate_contiguous_) {
         // The output is already fully preallocated
-        const int64_t batch_start_position = batch_iterator_->position() - batch.length;
-
-        if (batch.length < batch_iterator_->length()) {
+        if (batch.length < output_length()) {
           // If this is a partial execution, then we write into a slice of
           // preallocated_
           out->value = preallocated_->Slice(batch_start_position, batch.length);
@@ -708,6 +914,10 @@ class ScalarExecutor : public FunctionExecutorImpl<ScalarFunction> {
 
   // For storing a contiguous preallocation per above. Unused otherwise
   std::shared_ptr<ArrayData> preallocated_;
+
+  // The length of the selection when executing a batch with a selection
+  // vector, -1 otherwise
+  int64_t selection_length_ = -1;
 };
 
 Status PackBatchNoChunks(const std::vector<Datum>& args, ExecBatch* out) {
@@ -739,14 +949,39 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
 
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(PrepareExecute(args));
-    ExecBatch batch;
+    std::vector<ExecBatch> batches;
     if (kernel_->can_execute_chunkwise) {
-      while (batch_iterator_->Next(&batch)) {
-        RETURN_NOT_OK(ExecuteBatch(batch, listener));
-      }
+      CollectBatches(&batches);
     } else {
+      ExecBatch batch;
       RETURN_NOT_OK(PackBatchNoChunks(args, &batch));
-      RETURN_NOT_OK(ExecuteBatch(batch, listener));
+      batches.push_back(std::move(batch));
+    }
+
+    const int num_batches = static_cast<int>(batches.size());
+    // Kernels with a result finalizer may accumulate state across batches
+    // (e.g. a hash table), so only kernels without one are run in parallel
+    if (!kernel_->finalize && !kernel_->ordered_batches &&
+        CanExecuteInParallel(num_batches)) {
+      std::vector<Datum> outputs(num_batches);
+      RETURN_NOT_OK(ParallelFor(num_batches, [&](int i) {
+        KernelContext batch_ctx(exec_ctx_);
+        batch_ctx.SetState(state_.get());
+        return ExecuteBatch(&batch_ctx, batches[i], &outputs[i]);
+      }));
+      for (int i = 0; i < num_batches; ++i) {
+        if (batches[i].length > 0) {
+          RETURN_NOT_OK(EmitResult(std::move(outputs[i]), listener));
+        }
+      }
+    } else {
+      for (const auto& batch : batches) {
+        if (batch.length > 0) {
+          Datum out;
+          RETURN_NOT_OK(ExecuteBatch(&kernel_ctx_, batch, &out));
+          RETURN_NOT_OK(EmitResult(std::move(out), listener));
+        }
+      }
     }
     return Finalize(listener);
   }
@@ -772,25 +1007,25 @@ class VectorExecutor : public FunctionExecutorImpl<VectorFunction> {
   }
 
  protected:
-  Status ExecuteBatch(const ExecBatch& batch, ExecListener* listener) {
-    if (batch.length == 0) {
-      // Skip empty batches. This may only happen when not using
-      // ExecBatchIterator
-      return Status::OK();
-    }
-    Datum out;
+  // Empty batches must be skipped by the caller. They may only happen when not
+  // using ExecBatchIterator
+  Status ExecuteBatch(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // We preallocate (maybe) only for the output of processing the current
       // batch
-      ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(batch.length));
+      ARROW_ASSIGN_OR_RAISE(out->value, PrepareOutput(batch.length));
     }
 
     if (kernel_->null_handling == NullHandling::INTERSECTION &&
         output_descr_.shape == ValueDescr::ARRAY) {
-      RETURN_NOT_OK(PropagateNulls(&kernel_ctx_, batch, out.mutable_array()));
+      RETURN_NOT_OK(PropagateNulls(ctx, batch, out->mutable_array()));
     }
-    kernel_->exec(&kernel_ctx_, batch, &out);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    kernel_->exec(ctx, batch, out);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
+    return Status::OK();
+  }
+
+  Status EmitResult(Datum out, ExecListener* listener) {
     if (!kernel_->finalize) {
       // If there is no result finalizer (e.g. for hash-based functions, we can
       // emit the processed batch right away rather than waiting
@@ -849,12 +1084,39 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
   Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
     RETURN_NOT_OK(BindArgs(args));
 
-    ExecBatch batch;
-    while (batch_iterator_->Next(&batch)) {
-      // TODO: implement parallelism
-      if (batch.length > 0) {
-        RETURN_NOT_OK(Consume(batch));
+    std::vector<ExecBatch> batches;
+    CollectBatches(&batches);
+
+    // Split the batches into contiguous groups, each one aggregated into its
+    // own partial state. When threads are enabled the groups are consumed in
+    // parallel; the partial states are then merged in order into state_
+    int num_partials = 1;
+    if (CanExecuteInParallel(static_cast<int64_t>(batches.size()))) {
+      num_partials = std::max(
+          1, std::min(static_cast<int>(batches.size()), GetCpuThreadPoolCapacity()));
+    }
+    std::vector<std::unique_ptr<KernelState>> partials(num_partials);
+    for (auto& partial : partials) {
+      ARROW_ASSIGN_OR_RAISE(partial, InitBatchState(&kernel_ctx_));
+    }
+
+    const auto num_batches = static_cast<int64_t>(batches.size());
+    RETURN_NOT_OK(OptionalParallelFor(num_partials > 1, num_partials, [&](int i) {
+      KernelContext partial_ctx(exec_ctx_);
+      partial_ctx.SetState(partials[i].get());
+      const int64_t begin = num_batches * i / num_partials;
+      const int64_t end = num_batches * (i + 1) / num_partials;
+      for (int64_t j = begin; j < end; ++j) {
+        if (batches[j].length > 0) {
+          RETURN_NOT_OK(Consume(&partial_ctx, batches[j], partials[i].get()));
+        }
       }
+      return Status::OK();
+    }));
+
+    for (const auto& partial : partials) {
+      kernel_->merge(&kernel_ctx_, *partial, state_.get());
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
     }
 
     Datum out;
@@ -871,16 +1133,21 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
   }
 
  private:
-  Status Consume(const ExecBatch& batch) {
+  Result<std::unique_ptr<KernelState>> InitBatchState(KernelContext* ctx) {
     KernelInitArgs init_args{kernel_, input_descrs_, options_};
-    auto batch_state = kernel_->init(&kernel_ctx_, init_args);
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    auto batch_state = kernel_->init(ctx, init_args);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
 
     if (batch_state == nullptr) {
-      kernel_ctx_.SetStatus(
-          Status::Invalid("ScalarAggregation requires non-null kernel state"));
-      return kernel_ctx_.status();
+      return Status::Invalid("ScalarAggregation requires non-null kernel state");
     }
+    return std::move(batch_state);
+  }
+
+  // Consume a batch into a fresh state and merge it into `partial`. May be
+  // called concurrently for distinct partial states
+  Status Consume(KernelContext* ctx, const ExecBatch& batch, KernelState* partial) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_state, InitBatchState(ctx));
 
     KernelContext batch_ctx(exec_ctx_);
     batch_ctx.SetState(batch_state.get());
@@ -888,8 +1155,8 @@ class ScalarAggExecutor : public FunctionExecutorImpl<ScalarAggregateFunction> {
     kernel_->consume(&batch_ctx, batch);
     ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
 
-    kernel_->merge(&kernel_ctx_, *batch_state, state_.get());
-    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    kernel_->merge(ctx, *batch_state, partial);
+    ARROW_CTX_RETURN_IF_ERROR(ctx);
     return Status::OK();
   }
 };
@@ -943,8 +1210,22 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Mask too large for a selection vector: ", arr.length());
+  }
+  const int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto out_indices = reinterpret_cast<int32_t*>(indices->mutable_data());
+  for (int64_t i = 0; i < arr.length(); ++i) {
+    if (arr.IsValid(i) && arr.Value(i)) {
+      *out_indices++ = static_cast<int32_t>(i);
+    }
+  }
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)},
+                      /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -966,5 +1247,24 @@ Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum
   return CallFunction(func_name, args, /*options=*/nullptr, ctx);
 }
 
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           const FunctionOptions* options, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return CallFunction(func_name, batch, options, &default_ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        ctx->func_registry()->GetFunction(func_name));
+  if (options == nullptr) {
+    options = func->default_options();
+  }
+  return func->Execute(batch, options, ctx);
+}
+
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           ExecContext* ctx) {
+  return CallFunction(func_name, batch, /*options=*/nullptr, ctx);
+}
+
 }  // namespace compute
 }  // namespace arrow
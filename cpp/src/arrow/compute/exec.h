@@ -83,12 +83,14 @@ class ARROW_EXPORT ExecContext {
   // smaller chunks.
   int64_t exec_chunksize() const { return exec_chunksize_; }
 
-  /// \brief Set whether to use multiple threads for function execution. This
-  /// is not yet used.
+  /// \brief Set whether to use multiple threads for function execution.
   void set_use_threads(bool use_threads = true) { use_threads_ = use_threads; }
 
   /// \brief If true, then utilize multiple threads where relevant for function
-  /// execution. This is not yet used.
+  /// execution. When the input is split into several ExecBatches (because of
+  /// ChunkedArray arguments or exec_chunksize()), the batches are executed in
+  /// parallel on the CPU thread pool, and scalar aggregations are computed as
+  /// partial aggregates which are then merged.
   bool use_threads() const { return use_threads_; }
 
   // Set the preallocation strategy for kernel execution as it relates to
@@ -111,12 +113,27 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set the layout of the output of functions executed on an ExecBatch
+  /// with a selection vector. By default, outputs are compacted: they only
+  /// contain the selected rows, in selection order. If sparse, outputs have the
+  /// length of the input arrays and the rows which are not selected are null,
+  /// so that the output can be passed to subsequent calls with the same (or a
+  /// narrower) selection vector.
+  ///
+  /// Sparse outputs are only supported for scalar functions.
+  void set_sparse_selection_output(bool sparse) { sparse_selection_output_ = sparse; }
+
+  /// \brief If true, functions executed with a selection vector emit sparse
+  /// outputs. See set_sparse_selection_output() for more information.
+  bool sparse_selection_output() const { return sparse_selection_output_; }
+
  private:
   MemoryPool* pool_;
   FunctionRegistry* func_registry_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  bool sparse_selection_output_ = false;
 };
 
 // TODO: Consider standardizing on uint16 selection vectors and only use them
@@ -131,7 +148,9 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Scalar kernels declaring ScalarKernel::can_use_selection_vector compute
+/// only the selected rows of their inputs. For other kernels, the selected
+/// rows are materialized (using "take") before execution.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,11 +160,17 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// Null slots of the mask are not selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The selection indices as an Int32 array
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -224,5 +249,20 @@ ARROW_EXPORT
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            ExecContext* ctx = NULLPTR);
 
+/// \brief Variant of CallFunction executing the function on the values of an
+/// ExecBatch, restricted to the rows selected by batch.selection_vector if it
+/// is set. The array values must not be chunked and the selection indices must
+/// be in bounds of the arrays. See ExecContext::set_sparse_selection_output()
+/// for the layout of the output.
+ARROW_EXPORT
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           const FunctionOptions* options, ExecContext* ctx = NULLPTR);
+
+/// \brief Variant of CallFunction taking an ExecBatch which uses a function's
+/// default options.
+ARROW_EXPORT
+Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
+                           ExecContext* ctx = NULLPTR);
+
 }  // namespace compute
 }  // namespace arrow
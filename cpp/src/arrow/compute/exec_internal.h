@@ -102,6 +102,25 @@ class DatumAccumulator : public ExecListener {
 /// inputs will be split into non-chunked ExecBatch values for execution
 Status CheckAllValues(const std::vector<Datum>& values);
 
+/// \brief Check that the values of an ExecBatch with a selection vector are
+/// all Array or Scalar values of the same length, and that the selection
+/// indices are in bounds
+Status CheckSelection(const ExecBatch& batch);
+
+/// \brief Take the rows selected by batch.selection_vector from each of the
+/// array values of the batch. Scalar values are passed through.
+ARROW_EXPORT
+Result<std::vector<Datum>> MaterializeSelection(const ExecBatch& batch,
+                                                ExecContext* ctx);
+
+/// \brief Convert the compacted result of executing a function on the rows
+/// selected by batch.selection_vector into a sparse result, with the length of
+/// the batch's arrays and nulls in the rows which are not selected. Scalar
+/// results are returned as is.
+ARROW_EXPORT
+Result<Datum> ScatterSelection(const Datum& compacted, const ExecBatch& batch,
+                               ExecContext* ctx);
+
 class ARROW_EXPORT FunctionExecutor {
  public:
   virtual ~FunctionExecutor() = default;
@@ -110,6 +129,13 @@ class ARROW_EXPORT FunctionExecutor {
   /// Not thread-safe
   virtual Status Execute(const std::vector<Datum>& args, ExecListener* listener) = 0;
 
+  /// Execute on the rows selected by batch.selection_vector, emitting outputs
+  /// with one slot per selected row. batch.length must be the length of the
+  /// selection. Unless the kernel can use the selection vector, the selected
+  /// rows are materialized first.
+  /// Not thread-safe
+  virtual Status ExecuteSelection(const ExecBatch& batch, ExecListener* listener) = 0;
+
   virtual ValueDescr output_descr() const = 0;
 
   virtual Datum WrapResults(const std::vector<Datum>& args,
@@ -84,6 +84,18 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, false, true]");
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(
+                                            checked_cast<const BooleanArray&>(*mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 5]"), *MakeArray(sel_vector->data()));
+
+  mask = ArrayFromJSON(boolean(), "[false, null]");
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*mask)));
+  ASSERT_EQ(0, sel_vector->length());
+}
+
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
   const Buffer& buf = *arr.buffers[0];
 
@@ -393,6 +405,46 @@ TEST_F(TestPropagateNulls, IntersectsNulls) {
             /*output_offset=*/4);
 }
 
+TEST_F(TestPropagateNulls, SelectionVector) {
+  const int64_t length = 1000;
+  auto arr1 = rng_->Boolean(length, 0.5, /*null_probability=*/0.2);
+  auto arr2 = rng_->Boolean(length, 0.5, /*null_probability=*/0.2);
+  auto indices = rng_->Int32(300, 0, static_cast<int32_t>(length - 1));
+
+  auto CheckSelected = [&](const ExecBatch& batch,
+                           const std::vector<std::shared_ptr<Array>>& arrays) {
+    for (bool preallocate : {false, true}) {
+      ArrayData output(boolean(), batch.length, {nullptr, nullptr});
+      if (preallocate) {
+        ASSERT_OK_AND_ASSIGN(output.buffers[0], AllocateBitmap(batch.length));
+      }
+      ASSERT_OK(PropagateNulls(ctx_.get(), batch, &output));
+      ASSERT_NE(nullptr, output.buffers[0]);
+      for (int64_t i = 0; i < batch.length; ++i) {
+        const int32_t index = batch.selection_vector->indices()[i];
+        bool expected = true;
+        for (const auto& arr : arrays) {
+          expected = expected && arr->IsValid(index);
+        }
+        ASSERT_EQ(expected, BitUtil::GetBit(output.buffers[0]->data(), i)) << i;
+      }
+    }
+  };
+
+  ExecBatch batch({arr1, arr2, MakeScalar(true)}, indices->length());
+  batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+  CheckSelected(batch, {arr1, arr2});
+
+  batch.values = {arr1->Slice(7)};
+  CheckSelected(batch, {arr1->Slice(7)});
+
+  // A null scalar makes the output all null
+  batch.values = {arr1, MakeNullScalar(boolean())};
+  ArrayData output(boolean(), batch.length, {nullptr, nullptr});
+  ASSERT_OK(PropagateNulls(ctx_.get(), batch, &output));
+  ASSERT_EQ(batch.length, output.GetNullCount());
+}
+
 TEST_F(TestPropagateNulls, NullOutputTypeNoop) {
   // Ensure we leave the buffers alone when the output type is null()
   const int64_t length = 100;
@@ -840,6 +892,104 @@ TEST_F(TestCallScalarFunction, StatefulKernel) {
   AssertArraysEqual(*expected, *result.make_array());
 }
 
+TEST_F(TestCallScalarFunction, ParallelExecution) {
+  auto CheckFunction = [&](std::string func_name) {
+    for (bool chunked : {false, true}) {
+      for (bool preallocate_contiguous : {true, false}) {
+        // A chunksize which is not a multiple of 8 exercises the serial
+        // fallback for contiguous preallocations
+        for (int64_t chunksize : {64, 111, 1 << 20}) {
+          SCOPED_TRACE(func_name + " chunked=" + std::to_string(chunked) +
+                       " contiguous=" + std::to_string(preallocate_contiguous) +
+                       " chunksize=" + std::to_string(chunksize));
+          // Use fresh data each time, as some of the test kernels check that
+          // their output was not already populated
+          auto arr = GetUInt8Array(1000, /*null_probability=*/0.2);
+          Datum input(arr);
+          if (chunked) {
+            input = std::make_shared<ChunkedArray>(
+                ArrayVector{arr->Slice(0, 104), arr->Slice(104, 400), arr->Slice(504)});
+          }
+          std::vector<Datum> results;
+          for (bool use_threads : {false, true}) {
+            ExecContext ctx;
+            ctx.set_use_threads(use_threads);
+            ctx.set_preallocate_contiguous(preallocate_contiguous);
+            ctx.set_exec_chunksize(chunksize);
+            ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(func_name, {input}, &ctx));
+            results.push_back(result);
+          }
+          // Chunks are assembled in the same order as with serial execution
+          AssertDatumsEqual(results[0], results[1], /*verbose=*/true);
+          if (results[0].kind() == Datum::CHUNKED_ARRAY) {
+            ASSERT_EQ(results[0].chunked_array()->num_chunks(),
+                      results[1].chunked_array()->num_chunks());
+          }
+          ASSERT_EQ(input.length(), results[1].length());
+        }
+      }
+    }
+  };
+
+  CheckFunction("test_copy");
+  CheckFunction("test_copy_computed_bitmap");
+  CheckFunction("test_nopre_data");
+  CheckFunction("test_nopre_validity_or_data");
+}
+
+TEST_F(TestCallScalarFunction, SelectionVector) {
+  auto arr = GetInt32Array(1000, /*null_probability=*/0.2);
+  auto indices = ArrayFromJSON(int32(), "[0, 5, 6, 7, 500, 999, 5]");
+  ExecBatch batch({arr}, arr->length());
+  batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+
+  // test_copy can't use the selection vector, so the selected rows are
+  // materialized before execution
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_copy", batch));
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("take", {arr, indices}));
+  AssertDatumsEqual(expected, result, /*verbose=*/true);
+
+  // Sparse output
+  ExecContext ctx;
+  ctx.set_sparse_selection_output(true);
+  indices = ArrayFromJSON(int32(), "[1, 2, 998]");
+  batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("test_copy", batch, &ctx));
+  auto sparse = result.make_array();
+  ASSERT_EQ(arr->length(), sparse->length());
+  for (int64_t i = 0; i < arr->length(); ++i) {
+    if (i == 1 || i == 2 || i == 998) {
+      ASSERT_OK_AND_ASSIGN(auto expected_value, arr->GetScalar(i));
+      ASSERT_OK_AND_ASSIGN(auto value, sparse->GetScalar(i));
+      AssertScalarsEqual(*expected_value, *value, /*verbose=*/true);
+    } else {
+      ASSERT_TRUE(sparse->IsNull(i)) << i;
+    }
+  }
+
+  // Without a selection vector, the batch is executed as is
+  batch.selection_vector = nullptr;
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("test_copy", batch));
+  AssertArraysEqual(*arr, *result.make_array());
+}
+
+TEST_F(TestCallScalarFunction, SelectionVectorValidation) {
+  auto arr = GetInt32Array(10);
+  ExecBatch batch({arr}, arr->length());
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 10]"));
+  ASSERT_RAISES(IndexError, CallFunction("test_copy", batch));
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, -1]"));
+  ASSERT_RAISES(IndexError, CallFunction("test_copy", batch));
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 1]"));
+  batch.values = {std::make_shared<ChunkedArray>(ArrayVector{arr})};
+  ASSERT_RAISES(Invalid, CallFunction("test_copy", batch));
+}
+
 TEST_F(TestCallScalarFunction, ScalarFunction) {
   std::vector<Datum> args = {Datum(std::make_shared<Int32Scalar>(5)),
                              Datum(std::make_shared<Int32Scalar>(7))};
@@ -0,0 +1,593 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/expression.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/array/data.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+// ----------------------------------------------------------------------
+// Expression
+
+struct Expression::Impl {
+  Kind kind;
+  int argument_index = -1;
+  Datum literal;
+  std::string function_name;
+  std::vector<Expression> arguments;
+  std::shared_ptr<FunctionOptions> options;
+};
+
+Expression::Expression(std::shared_ptr<const Impl> impl) : impl_(std::move(impl)) {}
+
+Expression::Kind Expression::kind() const { return impl_->kind; }
+
+int Expression::argument_index() const { return impl_->argument_index; }
+
+const Datum& Expression::literal() const { return impl_->literal; }
+
+const std::string& Expression::function_name() const { return impl_->function_name; }
+
+const std::vector<Expression>& Expression::arguments() const {
+  return impl_->arguments;
+}
+
+const std::shared_ptr<FunctionOptions>& Expression::options() const {
+  return impl_->options;
+}
+
+std::string Expression::ToString() const {
+  switch (kind()) {
+    case ARGUMENT:
+      return "$" + std::to_string(argument_index());
+    case LITERAL:
+      return literal().is_scalar() ? literal().scalar()->ToString()
+                                   : literal().ToString();
+    case CALL:
+      break;
+  }
+  std::string out = function_name() + "(";
+  for (size_t i = 0; i < arguments().size(); ++i) {
+    if (i > 0) {
+      out += ", ";
+    }
+    out += arguments()[i].ToString();
+  }
+  return out + ")";
+}
+
+Expression argument(int index) {
+  auto impl = std::make_shared<Expression::Impl>();
+  impl->kind = Expression::ARGUMENT;
+  impl->argument_index = index;
+  return Expression(std::move(impl));
+}
+
+Expression literal(Datum value) {
+  auto impl = std::make_shared<Expression::Impl>();
+  impl->kind = Expression::LITERAL;
+  impl->literal = std::move(value);
+  return Expression(std::move(impl));
+}
+
+Expression call(std::string function_name, std::vector<Expression> arguments,
+                std::shared_ptr<FunctionOptions> options) {
+  auto impl = std::make_shared<Expression::Impl>();
+  impl->kind = Expression::CALL;
+  impl->function_name = std::move(function_name);
+  impl->arguments = std::move(arguments);
+  impl->options = std::move(options);
+  return Expression(std::move(impl));
+}
+
+// ----------------------------------------------------------------------
+// ExpressionExecutor
+
+namespace {
+
+bool CanPreallocate(const DataType& type) {
+  return is_fixed_width(type.id()) && type.id() != Type::NA;
+}
+
+int64_t DataBufferSize(const DataType& type, int64_t length) {
+  const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+  return bit_width == 1 ? BitUtil::BytesForBits(length) : length * bit_width / 8;
+}
+
+// A free list of the buffers of temporaries. A buffer is only handed out
+// again once nothing else references it: a kernel may have zero-copied it
+// into another value, e.g. an output.
+class ScratchBuffers {
+ public:
+  explicit ScratchBuffers(MemoryPool* pool) : pool_(pool) {}
+
+  Result<std::shared_ptr<Buffer>> Acquire(int64_t nbytes) {
+    for (auto it = free_.begin(); it != free_.end(); ++it) {
+      if ((*it)->size() >= nbytes && it->use_count() == 1) {
+        std::shared_ptr<Buffer> buffer = std::move(*it);
+        free_.erase(it);
+        return buffer;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, AllocateBuffer(nbytes, pool_));
+    return buffer;
+  }
+
+  void Release(std::vector<std::shared_ptr<Buffer>>* buffers) {
+    for (auto& buffer : *buffers) {
+      free_.push_back(std::move(buffer));
+    }
+    buffers->clear();
+  }
+
+ private:
+  MemoryPool* pool_;
+  std::vector<std::shared_ptr<Buffer>> free_;
+};
+
+}  // namespace
+
+class ExpressionExecutor::Impl {
+ public:
+  // The bound form of an Expression. Nodes are stored in topological order so
+  // that the arguments of a call are evaluated before the call.
+  struct Node {
+    Expression::Kind kind;
+    int argument_index = -1;
+    Datum literal;
+
+    // For CALL nodes
+    const FunctionOptions* options = nullptr;
+    const ScalarKernel* kernel = nullptr;
+    std::unique_ptr<KernelState> state;
+    std::vector<int> arguments;
+    bool data_preallocated = false;
+    bool validity_preallocated = false;
+
+    ValueDescr descr;
+
+    // The number of array arguments of calls referencing this node, and the
+    // number of those calls not yet evaluated in the current block
+    int num_uses = 0;
+    int remaining_uses = 0;
+    bool is_output = false;
+
+    // The value in the current block (or for all blocks, for scalars)
+    Datum value;
+    // The scratch buffers of value
+    std::vector<std::shared_ptr<Buffer>> scratch;
+
+    // For array outputs, either a contiguous allocation of the whole output
+    // which is written block-wise, or the output of each block
+    std::shared_ptr<ArrayData> preallocated;
+    std::vector<Datum> chunks;
+  };
+
+  Impl(std::vector<Expression> outputs, std::vector<ValueDescr> input_descrs,
+       ExecContext* ctx)
+      : ctx_(ctx == nullptr ? &default_ctx_ : ctx),
+        kernel_ctx_(ctx_),
+        scratch_(ctx_->memory_pool()),
+        outputs_(std::move(outputs)),
+        input_descrs_(std::move(input_descrs)) {
+    block_size_ = std::max<int64_t>(
+        1, std::min(kDefaultExpressionBlockSize, ctx_->exec_chunksize()));
+  }
+
+  Status Bind() {
+    for (const auto& descr : input_descrs_) {
+      if (descr.shape == ValueDescr::ANY) {
+        return Status::Invalid("Expression inputs must be arrays or scalars");
+      }
+    }
+    for (const auto& output : outputs_) {
+      ARROW_ASSIGN_OR_RAISE(int id, Bind(output));
+      nodes_[id].is_output = true;
+      output_ids_.push_back(id);
+      output_descrs_.push_back(nodes_[id].descr);
+    }
+    return Status::OK();
+  }
+
+  Result<int> Bind(const Expression& expr) {
+    auto it = node_ids_.find(expr.impl_.get());
+    if (it != node_ids_.end()) {
+      return it->second;
+    }
+
+    Node node;
+    node.kind = expr.kind();
+    switch (expr.kind()) {
+      case Expression::ARGUMENT:
+        if (expr.argument_index() < 0 ||
+            expr.argument_index() >= static_cast<int>(input_descrs_.size())) {
+          return Status::Invalid("Expression argument index ", expr.argument_index(),
+                                 " out of bounds for ", input_descrs_.size(),
+                                 " inputs");
+        }
+        node.argument_index = expr.argument_index();
+        node.descr = input_descrs_[node.argument_index];
+        break;
+      case Expression::LITERAL:
+        if (!expr.literal().is_scalar()) {
+          return Status::Invalid("Expression literals must be scalars, got ",
+                                 expr.literal().ToString());
+        }
+        node.literal = expr.literal();
+        node.descr = node.literal.descr();
+        break;
+      case Expression::CALL:
+        RETURN_NOT_OK(BindCall(expr, &node));
+        break;
+    }
+
+    const int id = static_cast<int>(nodes_.size());
+    nodes_.push_back(std::move(node));
+    node_ids_.emplace(expr.impl_.get(), id);
+    return id;
+  }
+
+  Status BindCall(const Expression& expr, Node* node) {
+    std::vector<ValueDescr> descrs;
+    for (const auto& arg : expr.arguments()) {
+      ARROW_ASSIGN_OR_RAISE(int id, Bind(arg));
+      node->arguments.push_back(id);
+      descrs.push_back(nodes_[id].descr);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Function> func,
+                          ctx_->func_registry()->GetFunction(expr.function_name()));
+    if (func->kind() != Function::SCALAR) {
+      return Status::NotImplemented("Function '", expr.function_name(),
+                                    "' is not a scalar function and can't be used "
+                                    "in an expression");
+    }
+    // Keep the function (and its default options) alive
+    functions_.push_back(func);
+    node->options =
+        expr.options() != nullptr ? expr.options().get() : func->default_options();
+    const auto& scalar_func = checked_cast<const ScalarFunction&>(*func);
+    ARROW_ASSIGN_OR_RAISE(node->kernel, scalar_func.DispatchExact(descrs));
+
+    KernelContext kernel_ctx(ctx_);
+    if (node->kernel->init) {
+      KernelInitArgs init_args{node->kernel, descrs, node->options};
+      node->state = node->kernel->init(&kernel_ctx, init_args);
+      ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx);
+      kernel_ctx.SetState(node->state.get());
+    }
+    const OutputType& out_type = node->kernel->signature->out_type();
+    ARROW_ASSIGN_OR_RAISE(node->descr, out_type.Resolve(&kernel_ctx, descrs));
+
+    node->data_preallocated =
+        node->kernel->mem_allocation == MemAllocation::PREALLOCATE &&
+        CanPreallocate(*node->descr.type);
+    node->validity_preallocated =
+        node->kernel->null_handling != NullHandling::COMPUTED_NO_PREALLOCATE &&
+        node->kernel->null_handling != NullHandling::OUTPUT_NOT_NULL;
+
+    for (int id : node->arguments) {
+      if (nodes_[id].descr.shape == ValueDescr::ARRAY) {
+        ++nodes_[id].num_uses;
+      }
+    }
+    return Status::OK();
+  }
+
+  Status CheckInputs(const std::vector<Datum>& inputs) const {
+    if (inputs.size() != input_descrs_.size()) {
+      return Status::Invalid("Expected ", input_descrs_.size(),
+                             " expression inputs, got ", inputs.size());
+    }
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      if (!inputs[i].is_value() || !(inputs[i].descr() == input_descrs_[i])) {
+        return Status::Invalid("Expression input ", i, " doesn't match ",
+                               input_descrs_[i].ToString(), ": ", inputs[i].ToString());
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::vector<Datum>> Execute(const std::vector<Datum>& inputs) {
+    RETURN_NOT_OK(CheckInputs(inputs));
+    // A previous execution may have failed midway
+    ResetNodes();
+
+    // Calls on scalars only are evaluated once rather than for every block
+    for (auto& node : nodes_) {
+      if (node.descr.shape == ValueDescr::SCALAR) {
+        RETURN_NOT_OK(Evaluate(inputs, /*length=*/1, /*position=*/0, &node));
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto iterator,
+                          detail::ExecBatchIterator::Make(inputs, block_size_));
+    const bool have_chunked =
+        std::any_of(inputs.begin(), inputs.end(), [](const Datum& input) {
+          return input.kind() == Datum::CHUNKED_ARRAY;
+        });
+    RETURN_NOT_OK(PrepareOutputs(iterator->length()));
+
+    ExecBatch batch;
+    int64_t position = 0;
+    while (iterator->Next(&batch)) {
+      for (auto& node : nodes_) {
+        node.remaining_uses = node.num_uses;
+      }
+      for (auto& node : nodes_) {
+        if (node.descr.shape != ValueDescr::ARRAY) {
+          continue;
+        }
+        RETURN_NOT_OK(Evaluate(batch.values, batch.length, position, &node));
+        for (int id : node.arguments) {
+          Node& arg = nodes_[id];
+          if (arg.descr.shape == ValueDescr::ARRAY && --arg.remaining_uses == 0 &&
+              !arg.is_output) {
+            // The temporary isn't needed anymore in this block
+            arg.value = Datum();
+            scratch_.Release(&arg.scratch);
+          }
+        }
+        if (node.is_output && node.kind == Expression::CALL && !node.preallocated) {
+          node.chunks.push_back(node.value);
+        }
+      }
+      position += batch.length;
+    }
+
+    std::vector<Datum> results;
+    for (int id : output_ids_) {
+      ARROW_ASSIGN_OR_RAISE(Datum result, WrapOutput(inputs, have_chunked, &nodes_[id]));
+      results.push_back(std::move(result));
+    }
+    ResetNodes();
+    return results;
+  }
+
+  const std::vector<ValueDescr>& output_descrs() const { return output_descrs_; }
+
+ private:
+  // Drop the values of the last execution, recycling their scratch buffers
+  void ResetNodes() {
+    for (auto& node : nodes_) {
+      node.value = Datum();
+      node.preallocated.reset();
+      node.chunks.clear();
+      scratch_.Release(&node.scratch);
+    }
+  }
+
+  // Contiguous outputs are allocated at full length up front, like
+  // ScalarExecutor does when ExecContext::preallocate_contiguous() is set
+  Status PrepareOutputs(int64_t length) {
+    for (int id : output_ids_) {
+      Node& node = nodes_[id];
+      if (node.kind != Expression::CALL || node.descr.shape != ValueDescr::ARRAY ||
+          !ctx_->preallocate_contiguous() || !node.kernel->can_write_into_slices ||
+          !node.data_preallocated || !node.validity_preallocated) {
+        continue;
+      }
+      auto out = std::make_shared<ArrayData>(node.descr.type, length);
+      out->buffers.resize(2);
+      ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_ctx_.AllocateBitmap(length));
+      const int64_t data_size = DataBufferSize(*node.descr.type, length);
+      ARROW_ASSIGN_OR_RAISE(out->buffers[1], kernel_ctx_.Allocate(data_size));
+      node.preallocated = std::move(out);
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> AllocateBlockBuffer(Node* node, int64_t nbytes) {
+    if (node->is_output) {
+      // Outputs are handed to the caller, don't recycle them
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, kernel_ctx_.Allocate(nbytes));
+      return buffer;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, scratch_.Acquire(nbytes));
+    node->scratch.push_back(buffer);
+    return buffer;
+  }
+
+  Status PrepareBlockOutput(Node* node, int64_t length, int64_t position, Datum* out) {
+    if (node->descr.shape == ValueDescr::SCALAR) {
+      out->value = MakeNullScalar(node->descr.type);
+      return Status::OK();
+    }
+    if (node->preallocated) {
+      if (length == node->preallocated->length) {
+        out->value = node->preallocated;
+      } else {
+        out->value = node->preallocated->Slice(position, length);
+      }
+      return Status::OK();
+    }
+    // Temporaries are sized for a whole block so that their buffers can be
+    // recycled by any other temporary of the same width
+    const int64_t capacity = node->is_output ? length : block_size_;
+    auto data = std::make_shared<ArrayData>(node->descr.type, length);
+    data->buffers.resize(node->descr.type->layout().buffers.size());
+    if (node->validity_preallocated) {
+      ARROW_ASSIGN_OR_RAISE(data->buffers[0],
+                            AllocateBlockBuffer(node, BitUtil::BytesForBits(capacity)));
+    }
+    if (node->data_preallocated) {
+      ARROW_ASSIGN_OR_RAISE(
+          data->buffers[1],
+          AllocateBlockBuffer(node, DataBufferSize(*node->descr.type, capacity)));
+    }
+    out->value = std::move(data);
+    return Status::OK();
+  }
+
+  Status Evaluate(const std::vector<Datum>& inputs, int64_t length, int64_t position,
+                  Node* node) {
+    switch (node->kind) {
+      case Expression::ARGUMENT:
+        node->value = inputs[node->argument_index];
+        return Status::OK();
+      case Expression::LITERAL:
+        node->value = node->literal;
+        return Status::OK();
+      case Expression::CALL:
+        break;
+    }
+
+    ExecBatch batch;
+    batch.length = length;
+    for (int id : node->arguments) {
+      batch.values.push_back(nodes_[id].value);
+    }
+    Datum out;
+    RETURN_NOT_OK(PrepareBlockOutput(node, length, position, &out));
+
+    // Same null handling as ScalarExecutor
+    if (node->kernel->null_handling == NullHandling::INTERSECTION) {
+      if (node->descr.shape == ValueDescr::ARRAY) {
+        RETURN_NOT_OK(detail::PropagateNulls(&kernel_ctx_, batch, out.mutable_array()));
+      } else {
+        out.scalar()->is_valid =
+            std::all_of(batch.values.begin(), batch.values.end(),
+                        [](const Datum& input) { return input.scalar()->is_valid; });
+      }
+    } else if (node->kernel->null_handling == NullHandling::OUTPUT_NOT_NULL &&
+               node->descr.shape == ValueDescr::SCALAR) {
+      out.scalar()->is_valid = true;
+    }
+
+    kernel_ctx_.SetState(node->state.get());
+    node->kernel->exec(&kernel_ctx_, batch, &out);
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx_);
+    node->value = std::move(out);
+    return Status::OK();
+  }
+
+  Result<Datum> WrapOutput(const std::vector<Datum>& inputs, bool have_chunked,
+                           Node* node) {
+    if (node->descr.shape == ValueDescr::SCALAR) {
+      return node->value;
+    }
+    if (node->kind == Expression::ARGUMENT) {
+      return inputs[node->argument_index];
+    }
+    std::vector<std::shared_ptr<Array>> chunks;
+    if (node->preallocated) {
+      chunks.push_back(MakeArray(node->preallocated));
+    } else {
+      for (const auto& chunk : node->chunks) {
+        chunks.push_back(chunk.make_array());
+      }
+    }
+    if (!have_chunked && chunks.size() == 1) {
+      return Datum(chunks[0]);
+    }
+    if (!have_chunked && chunks.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto empty, MakeArrayOfNull(node->descr.type, /*length=*/0));
+      return Datum(empty);
+    }
+    chunks.erase(std::remove_if(chunks.begin(), chunks.end(),
+                                [](const std::shared_ptr<Array>& chunk) {
+                                  return chunk->length() == 0;
+                                }),
+                 chunks.end());
+    return Datum(std::make_shared<ChunkedArray>(std::move(chunks), node->descr.type));
+  }
+
+  ExecContext default_ctx_;
+  ExecContext* ctx_;
+  KernelContext kernel_ctx_;
+  ScratchBuffers scratch_;
+  int64_t block_size_;
+
+  std::vector<Expression> outputs_;
+  std::vector<ValueDescr> input_descrs_;
+  std::vector<std::shared_ptr<Function>> functions_;
+
+  std::vector<Node> nodes_;
+  std::unordered_map<const Expression::Impl*, int> node_ids_;
+  std::vector<int> output_ids_;
+  std::vector<ValueDescr> output_descrs_;
+};
+
+ExpressionExecutor::ExpressionExecutor(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+ExpressionExecutor::~ExpressionExecutor() = default;
+
+Result<std::unique_ptr<ExpressionExecutor>> ExpressionExecutor::Make(
+    std::vector<Expression> outputs, std::vector<ValueDescr> input_descrs,
+    ExecContext* ctx) {
+  std::unique_ptr<Impl> impl(
+      new Impl(std::move(outputs), std::move(input_descrs), ctx));
+  RETURN_NOT_OK(impl->Bind());
+  return std::unique_ptr<ExpressionExecutor>(new ExpressionExecutor(std::move(impl)));
+}
+
+const std::vector<ValueDescr>& ExpressionExecutor::output_descrs() const {
+  return impl_->output_descrs();
+}
+
+Result<std::vector<Datum>> ExpressionExecutor::Execute(const std::vector<Datum>& inputs) {
+  return impl_->Execute(inputs);
+}
+
+Result<std::vector<Datum>> ExecuteExpressions(const std::vector<Expression>& exprs,
+                                              const std::vector<Datum>& inputs,
+                                              ExecContext* ctx) {
+  std::vector<ValueDescr> descrs;
+  for (const auto& input : inputs) {
+    if (!input.is_value()) {
+      return Status::Invalid("Tried executing expression with non-value type: ",
+                             input.ToString());
+    }
+    descrs.push_back(input.descr());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto executor,
+                        ExpressionExecutor::Make(exprs, std::move(descrs), ctx));
+  return executor->Execute(inputs);
+}
+
+Result<Datum> ExecuteExpression(const Expression& expr, const std::vector<Datum>& inputs,
+                                ExecContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(std::vector<Datum> results,
+                        ExecuteExpressions({expr}, inputs, ctx));
+  return results[0];
+}
+
+}  // namespace compute
+}  // namespace arrow
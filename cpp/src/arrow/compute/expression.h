@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// NOTE: API is EXPERIMENTAL and will change without going through a
+// deprecation cycle
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct FunctionOptions;
+
+// The number of rows evaluated at a time by ExpressionExecutor. The
+// temporaries of a block of this length should fit in the L2 cache for
+// typical expressions
+static constexpr int64_t kDefaultExpressionBlockSize = 4096;
+
+class Expression;
+
+/// \brief Reference the input value at the given position
+ARROW_EXPORT
+Expression argument(int index);
+
+/// \brief A constant value, which must be a Scalar
+ARROW_EXPORT
+Expression literal(Datum value);
+
+/// \brief Call a scalar function from the function registry
+ARROW_EXPORT
+Expression call(std::string function_name, std::vector<Expression> arguments,
+                std::shared_ptr<FunctionOptions> options = NULLPTR);
+
+/// \brief An immutable tree of scalar function calls over positional input
+/// values and literals.
+///
+/// Copies of an Expression share their nodes, so that an expression used
+/// several times (e.g. as the argument of several calls) is a DAG which is
+/// evaluated only once by ExpressionExecutor.
+class ARROW_EXPORT Expression {
+ public:
+  enum Kind {
+    /// A positional input value
+    ARGUMENT,
+    /// A constant Scalar
+    LITERAL,
+    /// The call of a scalar function on the values of other expressions
+    CALL,
+  };
+
+  Kind kind() const;
+
+  /// \brief The index of the input value, for ARGUMENT expressions
+  int argument_index() const;
+
+  /// \brief The constant value, for LITERAL expressions
+  const Datum& literal() const;
+
+  /// \brief The name of the called function, for CALL expressions
+  const std::string& function_name() const;
+
+  /// \brief The arguments of the called function, for CALL expressions
+  const std::vector<Expression>& arguments() const;
+
+  /// \brief The options of the called function, for CALL expressions. If
+  /// null, the function's default options are used.
+  const std::shared_ptr<FunctionOptions>& options() const;
+
+  /// \brief A human-readable representation, e.g. "add($0, 1)"
+  std::string ToString() const;
+
+ private:
+  struct Impl;
+  explicit Expression(std::shared_ptr<const Impl> impl);
+
+  std::shared_ptr<const Impl> impl_;
+
+  friend class ExpressionExecutor;
+  friend Expression argument(int index);
+  friend Expression literal(Datum value);
+  friend Expression call(std::string function_name, std::vector<Expression> arguments,
+                         std::shared_ptr<FunctionOptions> options);
+};
+
+/// \brief Evaluate a list of expressions without materializing intermediate
+/// results at full length.
+///
+/// Input values are processed in blocks of rows (see
+/// kDefaultExpressionBlockSize and ExecContext::exec_chunksize()). Each
+/// function call is evaluated on a block at a time, writing into scratch
+/// buffers which are owned by the executor and recycled as soon as the
+/// consumers of a temporary have been evaluated. Only the outputs are allocated
+/// at full length. Calls whose arguments are all scalars are evaluated once,
+/// before iterating over the blocks.
+///
+/// An ExpressionExecutor is not thread-safe. Use one executor per thread so
+/// that each thread reuses its own scratch buffers across calls to Execute.
+class ARROW_EXPORT ExpressionExecutor {
+ public:
+  ~ExpressionExecutor();
+
+  /// \brief Bind the expressions to the types and shapes of the input values,
+  /// selecting a kernel for each function call
+  ///
+  /// \param[in] outputs the expressions to evaluate
+  /// \param[in] input_descrs the descriptors of the values referenced by
+  /// ARGUMENT expressions
+  /// \param[in] ctx the execution context, which must outlive the executor.
+  /// If null, the default context is used.
+  static Result<std::unique_ptr<ExpressionExecutor>> Make(
+      std::vector<Expression> outputs, std::vector<ValueDescr> input_descrs,
+      ExecContext* ctx = NULLPTR);
+
+  /// \brief The types and shapes of the outputs
+  const std::vector<ValueDescr>& output_descrs() const;
+
+  /// \brief Evaluate the expressions on input values matching the descriptors
+  /// given to Make. Array outputs are ChunkedArrays if an input is chunked, or
+  /// if the output can't be written block-wise into a contiguous allocation
+  /// (e.g. with string outputs) and there is more than one block.
+  Result<std::vector<Datum>> Execute(const std::vector<Datum>& inputs);
+
+ private:
+  class Impl;
+  explicit ExpressionExecutor(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Evaluate expressions once with a temporary ExpressionExecutor
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteExpressions(const std::vector<Expression>& exprs,
+                                              const std::vector<Datum>& inputs,
+                                              ExecContext* ctx = NULLPTR);
+
+/// \brief Evaluate a single expression with a temporary ExpressionExecutor
+ARROW_EXPORT
+Result<Datum> ExecuteExpression(const Expression& expr, const std::vector<Datum>& inputs,
+                                ExecContext* ctx = NULLPTR);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+// Evaluate (a + b) * c > d on int64 columns, either with one CallFunction per
+// operation or with an ExpressionExecutor. The benchmark argument is the size
+// of each column in bytes
+static void CompareProduct(benchmark::State& state, bool fused) {
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(int64_t);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<Datum> columns;
+  for (int i = 0; i < 4; ++i) {
+    columns.push_back(rand.Int64(array_size, -1000, 1000, args.null_proportion));
+  }
+
+  auto expr = call(
+      "greater",
+      {call("multiply", {call("add", {argument(0), argument(1)}), argument(2)}),
+       argument(3)});
+  std::vector<ValueDescr> descrs(4, ValueDescr::Array(int64()));
+  auto executor = *ExpressionExecutor::Make({expr}, descrs);
+
+  for (auto _ : state) {
+    if (fused) {
+      ABORT_NOT_OK(executor->Execute(columns).status());
+    } else {
+      auto sum = *Add(columns[0], columns[1]);
+      auto product = *Multiply(sum, columns[2]);
+      ABORT_NOT_OK(Compare(product, columns[3], CompareOptions(CompareOperator::GREATER))
+                       .status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void CompareProductUnfused(benchmark::State& state) {
+  CompareProduct(state, false);
+}
+
+static void CompareProductFused(benchmark::State& state) { CompareProduct(state, true); }
+
+BENCHMARK(CompareProductUnfused)->Apply(BenchmarkSetArgs);
+BENCHMARK(CompareProductFused)->Apply(BenchmarkSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+#include "arrow/array/array_base.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/memory_pool.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+// (a + b) * c > d
+Expression MakeCompareProduct() {
+  return call("greater",
+              {call("multiply", {call("add", {argument(0), argument(1)}), argument(2)}),
+               argument(3)});
+}
+
+Result<Datum> CompareProductUnfused(const std::vector<Datum>& args) {
+  ARROW_ASSIGN_OR_RAISE(Datum sum, Add(args[0], args[1]));
+  ARROW_ASSIGN_OR_RAISE(Datum product, Multiply(sum, args[2]));
+  return Compare(product, args[3], CompareOptions(CompareOperator::GREATER));
+}
+
+class TestExpression : public ::testing::Test {
+ public:
+  void SetUp() override {
+    random::RandomArrayGenerator rand(/*seed=*/0);
+    for (int i = 0; i < 4; ++i) {
+      args_.push_back(rand.Int64(kLength, -1000, 1000, /*null_probability=*/0.1));
+    }
+  }
+
+ protected:
+  static constexpr int64_t kLength = 10007;
+  std::vector<Datum> args_;
+};
+
+TEST_F(TestExpression, ToString) {
+  ASSERT_EQ("greater(multiply(add($0, $1), $2), $3)", MakeCompareProduct().ToString());
+  auto expr = call("add", {argument(0), literal(Datum(int64_t(42)))});
+  ASSERT_EQ("add($0, 42)", expr.ToString());
+}
+
+TEST_F(TestExpression, Basics) {
+  ASSERT_OK_AND_ASSIGN(Datum expected, CompareProductUnfused(args_));
+
+  for (int64_t chunksize : {kLength, int64_t(1000), int64_t(999), int64_t(1)}) {
+    SCOPED_TRACE("exec_chunksize = " + std::to_string(chunksize));
+    ExecContext ctx;
+    ctx.set_exec_chunksize(chunksize);
+    ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteExpression(MakeCompareProduct(), args_,
+                                                         &ctx));
+    ASSERT_EQ(Datum::ARRAY, actual.kind());
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
+TEST_F(TestExpression, SharedSubexpression) {
+  auto sum = call("add", {argument(0), argument(1)});
+  auto product = call("multiply", {sum, sum});
+  auto difference = call("subtract", {product, sum});
+
+  ASSERT_OK_AND_ASSIGN(auto executor,
+                       ExpressionExecutor::Make({difference, sum, argument(2)},
+                                                {ValueDescr::Array(int64()),
+                                                 ValueDescr::Array(int64()),
+                                                 ValueDescr::Array(int64())}));
+  ASSERT_EQ(3, executor->output_descrs().size());
+  ASSERT_EQ(ValueDescr::Array(int64()), executor->output_descrs()[0]);
+
+  // Execute twice, reusing the scratch buffers
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto actual, executor->Execute({args_[0], args_[1], args_[2]}));
+    ASSERT_EQ(3, actual.size());
+
+    ASSERT_OK_AND_ASSIGN(Datum expected_sum, Add(args_[0], args_[1]));
+    ASSERT_OK_AND_ASSIGN(Datum expected_product, Multiply(expected_sum, expected_sum));
+    ASSERT_OK_AND_ASSIGN(Datum expected, Subtract(expected_product, expected_sum));
+    AssertDatumsEqual(expected, actual[0], /*verbose=*/true);
+    AssertDatumsEqual(expected_sum, actual[1], /*verbose=*/true);
+    AssertDatumsEqual(args_[2], actual[2], /*verbose=*/true);
+  }
+}
+
+TEST_F(TestExpression, Scalars) {
+  auto expr = call("multiply", {call("add", {argument(0), literal(Datum(int64_t(2)))}),
+                                call("negate", {argument(1)})});
+
+  // Calls on scalars are evaluated once
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       ExecuteExpression(expr, {args_[0], Datum(int64_t(3))}));
+  ASSERT_OK_AND_ASSIGN(Datum sum, Add(args_[0], Datum(int64_t(2))));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Multiply(sum, Datum(int64_t(-3))));
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+  // Scalar inputs only
+  ASSERT_OK_AND_ASSIGN(actual,
+                       ExecuteExpression(expr, {Datum(int64_t(5)), Datum(int64_t(3))}));
+  ASSERT_EQ(Datum::SCALAR, actual.kind());
+  AssertScalarsEqual(Int64Scalar(-21), *actual.scalar(), /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteExpression(expr, {MakeNullScalar(int64()),
+                                                        Datum(int64_t(3))}));
+  ASSERT_FALSE(actual.scalar()->is_valid);
+}
+
+TEST_F(TestExpression, ChunkedInputs) {
+  std::vector<Datum> chunked_args;
+  for (const auto& arg : args_) {
+    auto array = arg.make_array();
+    chunked_args.push_back(std::make_shared<ChunkedArray>(ArrayVector{
+        array->Slice(0, 17), array->Slice(17, 5000), array->Slice(5017)}));
+  }
+  ASSERT_OK_AND_ASSIGN(Datum expected, CompareProductUnfused(args_));
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteExpression(MakeCompareProduct(),
+                                                       chunked_args));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  ASSERT_TRUE(ChunkedArray(expected.make_array()).Equals(*actual.chunked_array()));
+}
+
+TEST_F(TestExpression, VariableWidthOutput) {
+  auto strings = ArrayFromJSON(utf8(), R"(["aA", null, "bcd", "", "EfG"])");
+  auto expr = call("ascii_upper", {call("ascii_lower", {argument(0)})});
+
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteExpression(expr, {strings}));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["AA", null, "BCD", "", "EFG"])"), actual,
+                    /*verbose=*/true);
+
+  // Outputs which can't be preallocated are chunked by block
+  ExecContext ctx;
+  ctx.set_exec_chunksize(2);
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteExpression(expr, {strings}, &ctx));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  ASSERT_EQ(3, actual.chunked_array()->num_chunks());
+  ASSERT_TRUE(ChunkedArray(ArrayFromJSON(utf8(), R"(["AA", null, "BCD", "", "EFG"])"))
+                  .Equals(*actual.chunked_array()));
+}
+
+TEST_F(TestExpression, EmptyInputs) {
+  auto empty = ArrayFromJSON(int64(), "[]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteExpression(MakeCompareProduct(),
+                                                       {empty, empty, empty, empty}));
+  AssertDatumsEqual(ArrayFromJSON(boolean(), "[]"), actual);
+}
+
+TEST_F(TestExpression, TemporariesNotMaterialized) {
+  ProxyMemoryPool pool(default_memory_pool());
+  ExecContext ctx(&pool);
+
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       ExecuteExpression(MakeCompareProduct(), args_, &ctx));
+  // Only the boolean output and the scratch buffers of a few blocks were
+  // allocated, rather than two int64 temporaries of the full length
+  ASSERT_LT(pool.max_memory(), kLength * static_cast<int64_t>(sizeof(int64_t)));
+}
+
+TEST_F(TestExpression, Errors) {
+  // Unknown function
+  ASSERT_RAISES(KeyError, ExpressionExecutor::Make({call("nonexistent", {argument(0)})},
+                                                   {ValueDescr::Array(int64())}));
+  // Not a scalar function
+  ASSERT_RAISES(NotImplemented, ExpressionExecutor::Make({call("sum", {argument(0)})},
+                                                         {ValueDescr::Array(int64())}));
+  // No matching kernel
+  ASSERT_RAISES(NotImplemented,
+                ExpressionExecutor::Make({call("add", {argument(0), argument(1)})},
+                                         {ValueDescr::Array(int64()),
+                                          ValueDescr::Array(utf8())}));
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make({argument(1)},
+                                                  {ValueDescr::Array(int64())}));
+  ASSERT_RAISES(Invalid, ExpressionExecutor::Make(
+                             {literal(ArrayFromJSON(int64(), "[1]"))}, {}));
+
+  ASSERT_OK_AND_ASSIGN(
+      auto executor,
+      ExpressionExecutor::Make({call("divide", {argument(0), argument(1)})},
+                               {ValueDescr::Array(int64()), ValueDescr::Array(int64())}));
+  // Inputs not matching the bound descriptors
+  ASSERT_RAISES(Invalid, executor->Execute({args_[0]}));
+  ASSERT_RAISES(Invalid, executor->Execute({args_[0], Datum(int64_t(1))}));
+
+  // Kernel errors are propagated, and the executor remains usable
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("divide by zero"),
+      executor->Execute({ArrayFromJSON(int64(), "[1, 2]"),
+                         ArrayFromJSON(int64(), "[1, 0]")}));
+  ASSERT_OK_AND_ASSIGN(auto actual, executor->Execute({ArrayFromJSON(int64(), "[4, 2]"),
+                                                      ArrayFromJSON(int64(), "[2, 1]")}));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[2, 2]"), actual[0]);
+
+  // Same when failing after some blocks were output separately
+  ExecContext ctx;
+  ctx.set_exec_chunksize(2);
+  ctx.set_preallocate_contiguous(false);
+  ASSERT_OK_AND_ASSIGN(
+      executor,
+      ExpressionExecutor::Make({call("divide", {argument(0), argument(1)})},
+                               {ValueDescr::Array(int64()), ValueDescr::Array(int64())},
+                               &ctx));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("divide by zero"),
+      executor->Execute({ArrayFromJSON(int64(), "[1, 2, 3]"),
+                         ArrayFromJSON(int64(), "[1, 1, 0]")}));
+  ASSERT_OK_AND_ASSIGN(actual, executor->Execute({ArrayFromJSON(int64(), "[4, 2]"),
+                                                  ArrayFromJSON(int64(), "[2, 1]")}));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[2, 2]"), actual[0]);
+}
+
+}  // namespace compute
+}  // namespace arrow
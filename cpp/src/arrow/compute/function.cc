@@ -95,6 +95,44 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   return executor->WrapResults(args, listener->values());
 }
 
+Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* options,
+                                ExecContext* ctx) const {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return Execute(batch, options, &default_ctx);
+  }
+  if (batch.selection_vector == nullptr) {
+    return Execute(batch.values, options, ctx);
+  }
+  RETURN_NOT_OK(detail::CheckAllValues(batch.values));
+  RETURN_NOT_OK(detail::CheckSelection(batch));
+  if (ctx->sparse_selection_output() && kind_ != Function::SCALAR) {
+    return Status::Invalid("Sparse selection output is only supported for ",
+                           "scalar functions, not for function '", name_, "'");
+  }
+
+  if (kind_ == Function::META) {
+    // Meta functions dispatch to other functions, which are given the
+    // materialized selected rows
+    ARROW_ASSIGN_OR_RAISE(auto args, detail::MaterializeSelection(batch, ctx));
+    return Execute(args, options, ctx);
+  }
+
+  // Normalize the batch length to the length of the selection
+  ExecBatch selected_batch(batch.values, batch.selection_vector->length());
+  selected_batch.selection_vector = batch.selection_vector;
+
+  ARROW_ASSIGN_OR_RAISE(auto executor,
+                        detail::FunctionExecutor::Make(ctx, this, options));
+  auto listener = std::make_shared<detail::DatumAccumulator>();
+  RETURN_NOT_OK(executor->ExecuteSelection(selected_batch, listener.get()));
+  Datum result = executor->WrapResults(batch.values, listener->values());
+  if (ctx->sparse_selection_output()) {
+    return detail::ScatterSelection(result, batch, ctx);
+  }
+  return result;
+}
+
 Status ScalarFunction::AddKernel(std::vector<InputType> in_types, OutputType out_type,
                                  ArrayKernelExec exec, KernelInit init) {
   RETURN_NOT_OK(CheckArity(in_types, arity_));
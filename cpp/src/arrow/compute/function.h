@@ -127,6 +127,16 @@ class ARROW_EXPORT Function {
   virtual Result<Datum> Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const;
 
+  /// \brief Execute the function on the values of an ExecBatch, restricted to
+  /// the rows selected by batch.selection_vector if it is set.
+  ///
+  /// Scalar functions push the selection down into kernels supporting it.
+  /// Otherwise, the selected rows are materialized before execution.
+  ///
+  /// This function can be overridden in subclasses.
+  virtual Result<Datum> Execute(const ExecBatch& batch, const FunctionOptions* options,
+                                ExecContext* ctx) const;
+
   /// \brief Returns a the default options for this function.
   ///
   /// Whatever option semantics a Function has, implementations must guarantee
@@ -262,6 +272,7 @@ class ARROW_EXPORT MetaFunction : public Function {
  public:
   int num_kernels() const override { return 0; }
 
+  using Function::Execute;
   Result<Datum> Execute(const std::vector<Datum>& args, const FunctionOptions* options,
                         ExecContext* ctx) const override;
 
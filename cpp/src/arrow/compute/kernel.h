@@ -601,6 +601,13 @@ struct ScalarKernel : public ArrayKernel {
   // bitmaps is a reasonable default
   NullHandling::type null_handling = NullHandling::INTERSECTION;
   MemAllocation::type mem_allocation = MemAllocation::PREALLOCATE;
+
+  /// \brief Whether the kernel can execute an ExecBatch with a selection
+  /// vector. Such a kernel reads its array arguments only at the selected
+  /// positions and writes one output slot per selected position (the output
+  /// has length ExecBatch::length). If false, the selected rows of the
+  /// arguments are materialized before the kernel is invoked.
+  bool can_use_selection_vector = false;
 };
 
 // ----------------------------------------------------------------------
@@ -650,6 +657,11 @@ struct VectorKernel : public ArrayKernel {
   /// be passed whole arrays and don't work on ChunkedArray inputs
   bool can_execute_chunkwise = true;
 
+  /// Some kernels (like cumulative sums) carry state from one batch to the
+  /// next without needing a result finalizer. Their batches are always
+  /// executed in order, rather than in parallel when the context allows it
+  bool ordered_batches = false;
+
   /// Some kernels (like unique and value_counts) yield non-chunked output from
   /// chunked-array inputs. This option controls how the results are boxed when
   /// returned from ExecVectorFunction
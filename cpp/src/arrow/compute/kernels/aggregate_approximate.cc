@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Aggregate kernels computing bounded-memory approximations
+
+#include <cmath>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+
+using internal::HyperLogLog;
+using internal::ScalarHelper;
+using internal::TDigest;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Approximate distinct count implementation
+
+template <typename ArrowType>
+struct ApproxCountDistinctImpl : public ScalarAggregator {
+  using ThisType = ApproxCountDistinctImpl<ArrowType>;
+  using ValueType = typename ::arrow::internal::ArrayDataInlineVisitor<ArrowType>::c_type;
+
+  explicit ApproxCountDistinctImpl(int precision) : sketch(precision) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](ValueType value) {
+          sketch.Add(ScalarHelper<ValueType>::ComputeHash(value));
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    sketch.Merge(other.sketch);
+  }
+
+  void Finalize(KernelContext*, Datum* out) override {
+    out->value = std::make_shared<Int64Scalar>(sketch.Estimate());
+  }
+
+  HyperLogLog sketch;
+};
+
+struct ApproxCountDistinctInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const ApproxCountDistinctOptions& options;
+
+  ApproxCountDistinctInitState(KernelContext* ctx, const DataType& in_type,
+                               const ApproxCountDistinctOptions& options)
+      : ctx(ctx), in_type(in_type), options(options) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approximate distinct count implemented");
+  }
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value || is_base_binary_type<Type>::value ||
+                  is_fixed_size_binary_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    state.reset(new ApproxCountDistinctImpl<Type>(options.precision));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    if (options.precision < HyperLogLog::kMinPrecision ||
+        options.precision > HyperLogLog::kMaxPrecision) {
+      ctx->SetStatus(Status::Invalid("HyperLogLog precision must be between ",
+                                     HyperLogLog::kMinPrecision, " and ",
+                                     HyperLogLog::kMaxPrecision, ", got ",
+                                     options.precision));
+      return nullptr;
+    }
+    ctx->SetStatus(VisitTypeInline(in_type, this));
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> ApproxCountDistinctInit(KernelContext* ctx,
+                                                     const KernelInitArgs& args) {
+  ApproxCountDistinctInitState visitor(
+      ctx, *args.inputs[0].type,
+      static_cast<const ApproxCountDistinctOptions&>(*args.options));
+  return visitor.Create();
+}
+
+// ----------------------------------------------------------------------
+// Approximate quantile implementation
+
+template <typename ArrowType>
+struct ApproxQuantileImpl : public ScalarAggregator {
+  using ThisType = ApproxQuantileImpl<ArrowType>;
+  using CType = typename ArrowType::c_type;
+
+  explicit ApproxQuantileImpl(const ApproxQuantileOptions& options)
+      : q(options.q), digest(options.delta, options.buffer_size) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    VisitArrayDataInline<ArrowType>(
+        *batch[0].array(),
+        [&](CType value) {
+          const auto v = static_cast<double>(value);
+          if (!std::isnan(v)) {
+            digest.Add(v);
+          }
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    digest.Merge(other.digest);
+  }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    DoubleBuilder builder(ctx->memory_pool());
+    KERNEL_RETURN_IF_ERROR(ctx, builder.Reserve(q.size()));
+    if (digest.is_empty()) {
+      KERNEL_RETURN_IF_ERROR(ctx, builder.AppendNulls(q.size()));
+    } else {
+      for (double p : q) {
+        builder.UnsafeAppend(digest.Quantile(p));
+      }
+    }
+    std::shared_ptr<ArrayData> result;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&result));
+    out->value = std::move(result);
+  }
+
+  std::vector<double> q;
+  TDigest digest;
+};
+
+struct ApproxQuantileInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const ApproxQuantileOptions& options;
+
+  ApproxQuantileInitState(KernelContext* ctx, const DataType& in_type,
+                          const ApproxQuantileOptions& options)
+      : ctx(ctx), in_type(in_type), options(options) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No approximate quantile implemented");
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No approximate quantile implemented");
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    state.reset(new ApproxQuantileImpl<Type>(options));
+    return Status::OK();
+  }
+
+  Status CheckOptions() {
+    if (options.q.empty()) {
+      return Status::Invalid("Requires at least one quantile");
+    }
+    for (double p : options.q) {
+      if (!(p >= 0 && p <= 1)) {
+        return Status::Invalid("Quantile must be between 0 and 1, got ", p);
+      }
+    }
+    if (options.delta < 10) {
+      return Status::Invalid("t-digest delta must be at least 10, got ", options.delta);
+    }
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    Status status = CheckOptions();
+    if (status.ok()) {
+      status = VisitTypeInline(in_type, this);
+    }
+    ctx->SetStatus(status);
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> ApproxQuantileInit(KernelContext* ctx,
+                                                const KernelInitArgs& args) {
+  ApproxQuantileInitState visitor(
+      ctx, *args.inputs[0].type,
+      static_cast<const ApproxQuantileOptions&>(*args.options));
+  return visitor.Create();
+}
+
+}  // namespace
+
+namespace internal {
+
+void RegisterScalarAggregateApproximate(FunctionRegistry* registry) {
+  static auto default_count_distinct_options = ApproxCountDistinctOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "approx_count_distinct", Arity::Unary(), &default_count_distinct_options);
+  auto AddCountDistinctKernel = [&](InputType in_type) {
+    // array[T] -> scalar[int64]
+    auto sig = KernelSignature::Make({std::move(in_type)}, ValueDescr::Scalar(int64()));
+    aggregate::AddAggKernel(std::move(sig), ApproxCountDistinctInit, func.get());
+  };
+  AddCountDistinctKernel(InputType::Array(boolean()));
+  for (const auto& ty : NumericTypes()) {
+    AddCountDistinctKernel(InputType::Array(ty));
+  }
+  for (const auto& ty : BaseBinaryTypes()) {
+    AddCountDistinctKernel(InputType::Array(ty));
+  }
+  for (const auto& ty : {date32(), date64()}) {
+    AddCountDistinctKernel(InputType::Array(ty));
+  }
+  // Parametric types
+  for (auto id : {Type::TIMESTAMP, Type::TIME32, Type::TIME64, Type::DURATION,
+                  Type::FIXED_SIZE_BINARY}) {
+    AddCountDistinctKernel(InputType::Array(id));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  static auto default_quantile_options = ApproxQuantileOptions::Defaults();
+  func = std::make_shared<ScalarAggregateFunction>("approx_quantile", Arity::Unary(),
+                                                   &default_quantile_options);
+  for (const auto& ty : NumericTypes()) {
+    // array[T] -> array[double]
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(float64()));
+    aggregate::AddAggKernel(std::move(sig), ApproxQuantileInit, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
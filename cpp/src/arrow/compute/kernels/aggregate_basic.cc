@@ -27,12 +27,6 @@ namespace compute {
 
 namespace {
 
-struct ScalarAggregator : public KernelState {
-  virtual void Consume(KernelContext* ctx, const ExecBatch& batch) = 0;
-  virtual void MergeFrom(KernelContext* ctx, const KernelState& src) = 0;
-  virtual void Finalize(KernelContext* ctx, Datum* out) = 0;
-};
-
 void AggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
   checked_cast<ScalarAggregator*>(ctx->state())->Consume(ctx, batch);
 }
@@ -574,7 +568,7 @@ std::unique_ptr<KernelState> MinMaxInit(KernelContext* ctx, const KernelInitArgs
 
 }  // namespace
 
-namespace internal {
+namespace aggregate {
 
 void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                   ScalarAggregateFunction* func) {
@@ -582,13 +576,17 @@ void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
                                                   AggregateMerge, AggregateFinalize)));
 }
 
+}  // namespace aggregate
+
+namespace internal {
+
 void AddBasicAggKernels(KernelInit init,
                         const std::vector<std::shared_ptr<DataType>>& types,
                         std::shared_ptr<DataType> out_ty, ScalarAggregateFunction* func) {
   for (const auto& ty : types) {
     // array[InT] -> scalar[OutT]
     auto sig = KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Scalar(out_ty));
-    AddAggKernel(std::move(sig), init, func);
+    aggregate::AddAggKernel(std::move(sig), init, func);
   }
 }
 
@@ -599,7 +597,7 @@ void AddMinMaxKernels(KernelInit init,
     // array[T] -> scalar[struct<min: T, max: T>]
     auto out_ty = struct_({field("min", ty), field("max", ty)});
     auto sig = KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Scalar(out_ty));
-    AddAggKernel(std::move(sig), init, func);
+    aggregate::AddAggKernel(std::move(sig), init, func);
   }
 }
 
@@ -610,8 +608,9 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
 
   /// Takes any array input, outputs int64 scalar
   InputType any_array(ValueDescr::ARRAY);
-  AddAggKernel(KernelSignature::Make({any_array}, ValueDescr::Scalar(int64())), CountInit,
-               func.get());
+  aggregate::AddAggKernel(
+      KernelSignature::Make({any_array}, ValueDescr::Scalar(int64())), CountInit,
+      func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
   func = std::make_shared<ScalarAggregateFunction>("sum", Arity::Unary());
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <memory>
+
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 
@@ -47,5 +51,20 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
+// Base class of the kernel states of scalar aggregate functions added with
+// AddAggKernel
+struct ScalarAggregator : public KernelState {
+  virtual void Consume(KernelContext* ctx, const ExecBatch& batch) = 0;
+  virtual void MergeFrom(KernelContext* ctx, const KernelState& src) = 0;
+  virtual void Finalize(KernelContext* ctx, Datum* out) = 0;
+};
+
+namespace aggregate {
+
+// Add a kernel whose state, created by `init`, is a ScalarAggregator
+void AddAggKernel(std::shared_ptr<KernelSignature> sig, KernelInit init,
+                  ScalarAggregateFunction* func);
+
+}  // namespace aggregate
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Exact quantile implementation
+
+Status CheckQuantiles(const std::vector<double>& q) {
+  if (q.empty()) {
+    return Status::Invalid("Requires at least one quantile");
+  }
+  for (double p : q) {
+    if (!(p >= 0 && p <= 1)) {
+      return Status::Invalid("Quantile must be between 0 and 1, got ", p);
+    }
+  }
+  return Status::OK();
+}
+
+double Interpolate(double lower, double higher, double fraction, int64_t lower_index,
+                   enum QuantileOptions::Interpolation interpolation) {
+  if (fraction == 0) {
+    return lower;
+  }
+  switch (interpolation) {
+    case QuantileOptions::LOWER:
+      return lower;
+    case QuantileOptions::HIGHER:
+      return higher;
+    case QuantileOptions::NEAREST:
+      if (fraction == 0.5) {
+        // Round half to even, like numpy
+        return lower_index % 2 == 0 ? lower : higher;
+      }
+      return fraction < 0.5 ? lower : higher;
+    case QuantileOptions::MIDPOINT:
+      return lower / 2 + higher / 2;
+    case QuantileOptions::LINEAR:
+    default:
+      return lower + (higher - lower) * fraction;
+  }
+}
+
+// Holds all the non-null (and non-NaN) values in memory. The quantiles are
+// computed with partial sorts when finalizing
+template <typename ArrowType>
+struct QuantileImpl : public ScalarAggregator {
+  using CType = typename ArrowType::c_type;
+  using ThisType = QuantileImpl<ArrowType>;
+
+  QuantileImpl(const QuantileOptions& options, bool scalar_output)
+      : options(options), scalar_output(scalar_output) {}
+
+  void Consume(KernelContext*, const ExecBatch& batch) override {
+    const ArrayData& arr = *batch[0].array();
+    values.reserve(values.size() + arr.length - arr.GetNullCount());
+    VisitArrayDataInline<ArrowType>(
+        arr,
+        [&](CType value) {
+          if (!IsNaN(value)) {
+            values.push_back(value);
+          }
+        },
+        [] {});
+  }
+
+  void MergeFrom(KernelContext*, const KernelState& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    values.insert(values.end(), other.values.begin(), other.values.end());
+  }
+
+  void Finalize(KernelContext* ctx, Datum* out) override {
+    if (scalar_output) {
+      if (values.empty()) {
+        out->value = std::make_shared<DoubleScalar>();
+      } else {
+        out->value = std::make_shared<DoubleScalar>(ComputeQuantiles()[0]);
+      }
+      return;
+    }
+
+    DoubleBuilder builder(ctx->memory_pool());
+    KERNEL_RETURN_IF_ERROR(ctx, builder.Reserve(options.q.size()));
+    if (values.empty()) {
+      KERNEL_RETURN_IF_ERROR(ctx, builder.AppendNulls(options.q.size()));
+    } else {
+      for (double quantile : ComputeQuantiles()) {
+        builder.UnsafeAppend(quantile);
+      }
+    }
+    std::shared_ptr<ArrayData> result;
+    KERNEL_RETURN_IF_ERROR(ctx, builder.FinishInternal(&result));
+    out->value = std::move(result);
+  }
+
+  // Compute the quantiles in ascending order, so that each partial sort only
+  // considers the values above the previous quantile
+  std::vector<double> ComputeQuantiles() {
+    const auto num_values = static_cast<int64_t>(values.size());
+    std::vector<size_t> order(options.q.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](size_t l, size_t r) { return options.q[l] < options.q[r]; });
+
+    std::vector<double> quantiles(options.q.size());
+    int64_t begin = 0;
+    for (size_t i : order) {
+      const double index = options.q[i] * (num_values - 1);
+      const auto lower_index = static_cast<int64_t>(index);
+      const double fraction = index - lower_index;
+
+      std::nth_element(values.begin() + begin, values.begin() + lower_index,
+                       values.end());
+      begin = lower_index;
+      const auto lower = static_cast<double>(values[lower_index]);
+      double higher = lower;
+      if (fraction > 0) {
+        // The values after lower_index are not smaller than it
+        higher = static_cast<double>(
+            *std::min_element(values.begin() + lower_index + 1, values.end()));
+      }
+      quantiles[i] =
+          Interpolate(lower, higher, fraction, lower_index, options.interpolation);
+    }
+    return quantiles;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, bool> IsNaN(T value) {
+    return std::isnan(value);
+  }
+
+  template <typename T>
+  static enable_if_t<!std::is_floating_point<T>::value, bool> IsNaN(T) {
+    return false;
+  }
+
+  QuantileOptions options;
+  bool scalar_output;
+  std::vector<CType> values;
+};
+
+struct QuantileInitState {
+  std::unique_ptr<KernelState> state;
+  KernelContext* ctx;
+  const DataType& in_type;
+  const QuantileOptions& options;
+  bool scalar_output;
+
+  QuantileInitState(KernelContext* ctx, const DataType& in_type,
+                    const QuantileOptions& options, bool scalar_output)
+      : ctx(ctx), in_type(in_type), options(options), scalar_output(scalar_output) {}
+
+  Status Visit(const DataType&) {
+    return Status::NotImplemented("No quantile implemented");
+  }
+
+  Status Visit(const HalfFloatType&) {
+    return Status::NotImplemented("No quantile implemented");
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    state.reset(new QuantileImpl<Type>(options, scalar_output));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create() {
+    Status status = CheckQuantiles(options.q);
+    if (status.ok()) {
+      status = VisitTypeInline(in_type, this);
+    }
+    ctx->SetStatus(status);
+    return std::move(state);
+  }
+};
+
+std::unique_ptr<KernelState> QuantileInit(KernelContext* ctx,
+                                          const KernelInitArgs& args) {
+  QuantileInitState visitor(ctx, *args.inputs[0].type,
+                            static_cast<const QuantileOptions&>(*args.options),
+                            /*scalar_output=*/false);
+  return visitor.Create();
+}
+
+std::unique_ptr<KernelState> MedianInit(KernelContext* ctx, const KernelInitArgs& args) {
+  static const QuantileOptions median_options(0.5, QuantileOptions::LINEAR);
+  QuantileInitState visitor(ctx, *args.inputs[0].type, median_options,
+                            /*scalar_output=*/true);
+  return visitor.Create();
+}
+
+}  // namespace
+
+namespace internal {
+
+void RegisterScalarAggregateQuantile(FunctionRegistry* registry) {
+  static auto default_quantile_options = QuantileOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>("quantile", Arity::Unary(),
+                                                        &default_quantile_options);
+  for (const auto& ty : NumericTypes()) {
+    // array[T] -> array[double]
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Array(float64()));
+    aggregate::AddAggKernel(std::move(sig), QuantileInit, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>("median", Arity::Unary());
+  for (const auto& ty : NumericTypes()) {
+    // array[T] -> scalar[double]
+    auto sig =
+        KernelSignature::Make({InputType::Array(ty)}, ValueDescr::Scalar(float64()));
+    aggregate::AddAggKernel(std::move(sig), MedianInit, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -17,12 +17,15 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
@@ -30,6 +33,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -237,6 +241,58 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
   }
 }
 
+TYPED_TEST(TestRandomNumericSumKernel, ParallelChunkedArraySum) {
+  auto rand = random::RandomArrayGenerator(0x3b1d2f5);
+  ArrayVector chunks;
+  for (int64_t length : {0, 1, 7, 64, 100, 257, 1000, 3, 0, 511}) {
+    chunks.push_back(rand.Numeric<TypeParam>(length, 0, 100, 0.2));
+  }
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(chunks));
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+  auto expected = NaiveSum<TypeParam>(*concatenated);
+
+  // Partial sums of the chunks are computed in parallel and merged
+  for (bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    ctx.set_exec_chunksize(50);
+    ASSERT_OK_AND_ASSIGN(Datum result, Sum(chunked, &ctx));
+    DatumEqual<typename FindAccumulatorType<TypeParam>::Type>::EnsureEqual(result,
+                                                                           expected);
+  }
+}
+
+TYPED_TEST(TestRandomNumericSumKernel, SumFromCpuThreadPoolTask) {
+  auto rand = random::RandomArrayGenerator(0x7e3a11c);
+  ArrayVector chunks;
+  for (int64_t length : {100, 257, 1000, 3, 511}) {
+    chunks.push_back(rand.Numeric<TypeParam>(length, 0, 100, 0.2));
+  }
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(chunks));
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+  auto expected = NaiveSum<TypeParam>(*concatenated);
+
+  // Aggregating from a pool task (as a dataset scan does) runs inline rather
+  // than blocking the worker on tasks queued behind it, so every worker can be
+  // busy at once without deadlocking
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  std::vector<Future<Datum>> futures;
+  for (int i = 0; i < pool->GetCapacity() + 1; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, pool->Submit([&]() -> Result<Datum> {
+      ExecContext ctx;
+      ctx.set_use_threads(true);
+      ctx.set_exec_chunksize(50);
+      return Sum(chunked, &ctx);
+    }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(Datum result, future.result());
+    DatumEqual<typename FindAccumulatorType<TypeParam>::Type>::EnsureEqual(result,
+                                                                           expected);
+  }
+}
+
 ///
 /// Count
 ///
@@ -545,5 +601,221 @@ TYPED_TEST(TestFloatingMinMaxKernel, DefaultOptions) {
   AssertDatumsEqual(explicit_defaults, no_options_provided);
 }
 
+///
+/// Quantile / Median
+///
+
+template <typename ArrowType>
+class TestPrimitiveQuantileKernel : public ::testing::Test {
+ public:
+  void AssertQuantilesAre(const Datum& input, const QuantileOptions& options,
+                          const std::string& expected_json) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Quantile(input, options));
+    auto expected = ArrayFromJSON(float64(), expected_json);
+    AssertArraysEqual(*expected, *out.make_array(), /*verbose=*/true);
+  }
+
+  void AssertQuantilesAre(const std::string& json, const QuantileOptions& options,
+                          const std::string& expected_json) {
+    AssertQuantilesAre(ArrayFromJSON(type_singleton(), json), options, expected_json);
+  }
+
+  void AssertMedianIs(const std::string& json, double expected) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Median(ArrayFromJSON(type_singleton(), json)));
+    const auto& value = out.scalar_as<DoubleScalar>();
+    ASSERT_TRUE(value.is_valid);
+    ASSERT_EQ(expected, value.value);
+  }
+
+  void AssertMedianIsNull(const std::string& json) {
+    ASSERT_OK_AND_ASSIGN(Datum out, Median(ArrayFromJSON(type_singleton(), json)));
+    ASSERT_FALSE(out.scalar()->is_valid);
+  }
+
+  std::shared_ptr<DataType> type_singleton() {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+};
+
+template <typename ArrowType>
+class TestNumericQuantileKernel : public TestPrimitiveQuantileKernel<ArrowType> {};
+
+TYPED_TEST_SUITE(TestNumericQuantileKernel, NumericArrowTypes);
+TYPED_TEST(TestNumericQuantileKernel, Basics) {
+  QuantileOptions options({0.0, 0.5, 1.0});
+  this->AssertQuantilesAre("[1]", options, "[1, 1, 1]");
+  this->AssertQuantilesAre("[5, 1, 4, 2, 3]", options, "[1, 3, 5]");
+  this->AssertQuantilesAre("[5, null, 1, 4, null, 2, 3]", options, "[1, 3, 5]");
+  this->AssertQuantilesAre("[]", options, "[null, null, null]");
+  this->AssertQuantilesAre("[null, null]", options, "[null, null, null]");
+
+  // Quantiles needn't be sorted
+  options.q = {0.75, 0.25};
+  this->AssertQuantilesAre("[4, 2, 3, 1, 5]", options, "[4, 2]");
+
+  this->AssertMedianIs("[5, 1, 4, 2, 3]", 3);
+  this->AssertMedianIs("[5, null, 1, 4, 2, 6, 3]", 3.5);
+  this->AssertMedianIsNull("[]");
+  this->AssertMedianIsNull("[null]");
+}
+
+TYPED_TEST(TestNumericQuantileKernel, Interpolation) {
+  // Quantile 0.5 falls between 2 and 3, 0.3 falls between 1 and 2 (closer to 2)
+  auto input = "[3, 1, 4, 2]";
+  QuantileOptions options({0.5, 0.3});
+
+  options.interpolation = QuantileOptions::LINEAR;
+  this->AssertQuantilesAre(input, options, "[2.5, 1.9]");
+  options.interpolation = QuantileOptions::LOWER;
+  this->AssertQuantilesAre(input, options, "[2, 1]");
+  options.interpolation = QuantileOptions::HIGHER;
+  this->AssertQuantilesAre(input, options, "[3, 2]");
+  // Ties are rounded to the even index, like numpy
+  options.interpolation = QuantileOptions::NEAREST;
+  this->AssertQuantilesAre(input, options, "[3, 2]");
+  options.interpolation = QuantileOptions::MIDPOINT;
+  this->AssertQuantilesAre(input, options, "[2.5, 1.5]");
+}
+
+TYPED_TEST(TestNumericQuantileKernel, Chunked) {
+  auto input = ChunkedArrayFromJSON(this->type_singleton(),
+                                    {"[6, 1]", "[]", "[null, 5, 2]", "[4, 3]"});
+  this->AssertQuantilesAre(input, QuantileOptions({0.0, 0.5, 1.0}), "[1, 3.5, 6]");
+}
+
+class TestFloatQuantileKernel : public TestPrimitiveQuantileKernel<DoubleType> {};
+
+TEST_F(TestFloatQuantileKernel, NaN) {
+  QuantileOptions options({0.0, 1.0});
+  this->AssertQuantilesAre("[NaN, 3, 1, NaN, 2]", options, "[1, 3]");
+  this->AssertQuantilesAre("[NaN, NaN]", options, "[null, null]");
+  this->AssertMedianIs("[NaN, 2, Inf, -Inf, 1]", 1.5);
+}
+
+TEST_F(TestFloatQuantileKernel, InvalidOptions) {
+  auto input = ArrayFromJSON(float64(), "[1, 2, 3]");
+  ASSERT_RAISES(Invalid, Quantile(input, QuantileOptions(std::vector<double>{})));
+  ASSERT_RAISES(Invalid, Quantile(input, QuantileOptions(1.5)));
+  ASSERT_RAISES(Invalid, Quantile(input, QuantileOptions(-0.1)));
+}
+
+TEST_F(TestFloatQuantileKernel, RandomArray) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const std::vector<double> quantiles = {0.0, 0.01, 0.3, 0.5, 0.77, 0.99, 1.0};
+  for (auto null_probability : {0.0, 0.1, 0.9}) {
+    auto array = rand.Numeric<DoubleType>(1000, -1000, 1000, null_probability);
+    const auto& values = checked_cast<const DoubleArray&>(*array);
+
+    std::vector<double> sorted;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) sorted.push_back(values.Value(i));
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum out, Quantile(array, QuantileOptions(quantiles, QuantileOptions::LOWER)));
+    auto result = checked_pointer_cast<DoubleArray>(out.make_array());
+    ASSERT_EQ(result->length(), static_cast<int64_t>(quantiles.size()));
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      const auto index = static_cast<size_t>(quantiles[i] * (sorted.size() - 1));
+      ASSERT_EQ(sorted[index], result->Value(i)) << "q = " << quantiles[i];
+    }
+  }
+}
+
+///
+/// Approximate aggregates
+///
+
+void AssertApproxCountDistinct(const Datum& input, int64_t expected,
+                               double tolerance = 0.03,
+                               const ApproxCountDistinctOptions& options =
+                                   ApproxCountDistinctOptions::Defaults()) {
+  ASSERT_OK_AND_ASSIGN(Datum out, ApproxCountDistinct(input, options));
+  const auto estimate = out.scalar_as<Int64Scalar>().value;
+  ASSERT_NEAR(static_cast<double>(expected), static_cast<double>(estimate),
+              tolerance * expected + 0.5);
+}
+
+TEST(TestApproxCountDistinct, Basics) {
+  AssertApproxCountDistinct(ArrayFromJSON(int32(), "[]"), 0);
+  AssertApproxCountDistinct(ArrayFromJSON(int32(), "[null, null]"), 0);
+  AssertApproxCountDistinct(ArrayFromJSON(int32(), "[1, 2, 2, null, 1, 3]"), 3);
+  AssertApproxCountDistinct(ArrayFromJSON(utf8(), R"(["a", "b", null, "a", ""])"), 3);
+  AssertApproxCountDistinct(ArrayFromJSON(boolean(), "[true, true, true]"), 1);
+  AssertApproxCountDistinct(
+      ChunkedArrayFromJSON(float64(), {"[1.5, 2.5]", "[]", "[2.5, 3.5, null]"}), 3);
+}
+
+TEST(TestApproxCountDistinct, InvalidOptions) {
+  auto input = ArrayFromJSON(int32(), "[1, 2, 3]");
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(input, ApproxCountDistinctOptions(3)));
+  ASSERT_RAISES(Invalid, ApproxCountDistinct(input, ApproxCountDistinctOptions(19)));
+}
+
+TEST(TestApproxCountDistinct, RandomArray) {
+  auto rand = random::RandomArrayGenerator(0x2c3b9f1);
+  for (const int64_t num_distinct : {100, 10000, 200000}) {
+    // Each distinct value appears about 4 times
+    auto array = rand.Int64(num_distinct * 4, 0, num_distinct - 1, 0.1);
+    const auto& values = checked_cast<const Int64Array&>(*array);
+    std::vector<int64_t> distinct;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) distinct.push_back(values.Value(i));
+    }
+    std::sort(distinct.begin(), distinct.end());
+    distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+    const auto expected = static_cast<int64_t>(distinct.size());
+
+    // Standard error is 1.04 / sqrt(2^precision)
+    SCOPED_TRACE("num_distinct = " + std::to_string(num_distinct));
+    AssertApproxCountDistinct(array, expected, 0.05, ApproxCountDistinctOptions(12));
+    AssertApproxCountDistinct(array, expected, 0.015, ApproxCountDistinctOptions(16));
+
+    auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+        array->Slice(0, num_distinct), array->Slice(num_distinct)});
+    AssertApproxCountDistinct(chunked, expected, 0.05, ApproxCountDistinctOptions(12));
+  }
+}
+
+TEST(TestApproxQuantile, Basics) {
+  auto input = ArrayFromJSON(int32(), "[5, null, 1, 4, 2, 3]");
+  ApproxQuantileOptions options(std::vector<double>{0.0, 0.5, 1.0});
+  ASSERT_OK_AND_ASSIGN(Datum out, ApproxQuantile(input, options));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[1, 3, 5]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  options.q = {0.1, 0.9};
+  ASSERT_OK_AND_ASSIGN(out, ApproxQuantile(ArrayFromJSON(float64(), "[null, NaN]"),
+                                           options));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  ASSERT_RAISES(Invalid, ApproxQuantile(input, ApproxQuantileOptions(1.1)));
+  ASSERT_RAISES(Invalid, ApproxQuantile(input, ApproxQuantileOptions(0.5, 5)));
+}
+
+TEST(TestApproxQuantile, RandomArray) {
+  auto rand = random::RandomArrayGenerator(0x9a1c0de);
+  const std::vector<double> quantiles = {0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999};
+  const int64_t length = 100000;
+  auto array = rand.Numeric<DoubleType>(length, -1000, 1000, 0.1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, length / 3), array->Slice(length / 3)});
+
+  ASSERT_OK_AND_ASSIGN(Datum exact, Quantile(array, QuantileOptions(quantiles)));
+  auto expected = checked_pointer_cast<DoubleArray>(exact.make_array());
+  for (const Datum& input : {Datum(array), Datum(chunked)}) {
+    ASSERT_OK_AND_ASSIGN(Datum out,
+                         ApproxQuantile(input, ApproxQuantileOptions(quantiles)));
+    auto result = checked_pointer_cast<DoubleArray>(out.make_array());
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      // The data is uniform over [-1000, 1000]: allow 0.5% of the value range,
+      // the t-digest being much more accurate near the tails.
+      ASSERT_NEAR(expected->Value(i), result->Value(i), 10.0) << "q = " << quantiles[i];
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -20,8 +20,15 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "arrow/array/array_dict.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/function.h"
 #include "arrow/type_fwd.h"
 
 namespace arrow {
@@ -40,6 +47,178 @@ ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec) {
   };
 }
 
+namespace {
+
+template <typename OutType>
+struct LookupOutput {
+  using T = typename OutType::c_type;
+  static void Set(uint8_t* out, int64_t i, T value) {
+    reinterpret_cast<T*>(out)[i] = value;
+  }
+};
+
+template <>
+struct LookupOutput<BooleanType> {
+  static void Set(uint8_t* out, int64_t i, bool value) {
+    BitUtil::SetBitTo(out, i, value);
+  }
+};
+
+// Gather lookup[indices[i]], or null_result where indices[i] is null
+template <typename IndexType, typename OutType>
+Status GatherDictionaryLookup(const ArrayData& indices, const ArrayData& lookup,
+                              const Scalar& null_result, MemoryPool* pool, Datum* out) {
+  using IndexCType = typename IndexType::c_type;
+  using OutCType = typename GetOutputType<OutType>::T;
+  using ScalarType = typename TypeTraits<OutType>::ScalarType;
+
+  // Flatten the lookup results, with the null result in the last slot
+  const int64_t null_slot = lookup.length;
+  std::vector<OutCType> values(null_slot + 1);
+  std::vector<uint8_t> valid(null_slot + 1);
+  {
+    const auto lookup_array = MakeArray(lookup.Copy());
+    const auto& lookup_values =
+        checked_cast<const typename TypeTraits<OutType>::ArrayType&>(*lookup_array);
+    for (int64_t i = 0; i < null_slot; ++i) {
+      valid[i] = lookup_values.IsValid(i);
+      values[i] = valid[i] ? lookup_values.Value(i) : OutCType{};
+    }
+  }
+  valid[null_slot] = null_result.is_valid;
+  if (null_result.is_valid) {
+    values[null_slot] = checked_cast<const ScalarType&>(null_result).value;
+  }
+
+  const int64_t length = indices.length;
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateBitmap(length, pool));
+  std::shared_ptr<Buffer> data;
+  if (std::is_same<OutType, BooleanType>::value) {
+    ARROW_ASSIGN_OR_RAISE(data, AllocateBitmap(length, pool));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(data, AllocateBuffer(length * sizeof(OutCType), pool));
+  }
+  uint8_t* out_validity = validity->mutable_data();
+  uint8_t* out_values = data->mutable_data();
+  const IndexCType* index_values = indices.GetValues<IndexCType>(1);
+  const uint8_t* index_validity =
+      indices.buffers[0] != NULLPTR ? indices.buffers[0]->data() : NULLPTR;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const bool index_valid =
+        index_validity == NULLPTR || BitUtil::GetBit(index_validity, indices.offset + i);
+    const int64_t slot = index_valid ? static_cast<int64_t>(index_values[i]) : null_slot;
+    DCHECK(slot >= 0 && slot <= null_slot);
+    BitUtil::SetBitTo(out_validity, i, valid[slot] != 0);
+    null_count += valid[slot] == 0;
+    LookupOutput<OutType>::Set(out_values, i, values[slot]);
+  }
+  out->value = ArrayData::Make(TypeTraits<OutType>::type_singleton(), length,
+                               {null_count > 0 ? std::move(validity) : NULLPTR,
+                                std::move(data)},
+                               null_count);
+  return Status::OK();
+}
+
+template <typename OutType>
+Status GatherDictionaryLookup(const ArrayData& indices, const ArrayData& lookup,
+                              const Scalar& null_result, MemoryPool* pool, Datum* out) {
+  switch (indices.type->id()) {
+    case Type::INT8:
+    case Type::UINT8:
+      return GatherDictionaryLookup<UInt8Type, OutType>(indices, lookup, null_result,
+                                                        pool, out);
+    case Type::INT16:
+    case Type::UINT16:
+      return GatherDictionaryLookup<UInt16Type, OutType>(indices, lookup, null_result,
+                                                         pool, out);
+    case Type::INT32:
+    case Type::UINT32:
+      return GatherDictionaryLookup<UInt32Type, OutType>(indices, lookup, null_result,
+                                                         pool, out);
+    case Type::INT64:
+    case Type::UINT64:
+      return GatherDictionaryLookup<UInt64Type, OutType>(indices, lookup, null_result,
+                                                         pool, out);
+    default:
+      return Status::TypeError("Invalid dictionary index type: ", *indices.type);
+  }
+}
+
+Status ExecDictionary(KernelContext* ctx, const std::string& func_name,
+                      const FunctionOptions* options, const ExecBatch& batch,
+                      Datum* out) {
+  ExecContext* exec_ctx = ctx->exec_context();
+  int dict_arg = -1;
+  int num_arrays = 0;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_array()) {
+      ++num_arrays;
+      if (batch[i].type()->id() == Type::DICTIONARY) {
+        dict_arg = i;
+      }
+    }
+  }
+  DCHECK_GE(dict_arg, 0);
+
+  const ArrayData& dict_data = *batch[dict_arg].array();
+  const auto& value_type =
+      checked_cast<const DictionaryType&>(*dict_data.type).value_type();
+  const std::shared_ptr<ArrayData>& dictionary = dict_data.dictionary;
+  // Looking up a dictionary longer than the indices isn't worth it
+  if (num_arrays == 1 && dictionary->length <= dict_data.length) {
+    std::vector<Datum> args = batch.values;
+    args[dict_arg] = dictionary;
+    ARROW_ASSIGN_OR_RAISE(Datum lookup, CallFunction(func_name, args, options, exec_ctx));
+    // Null indices take the result of evaluating the function on a null value
+    ARROW_ASSIGN_OR_RAISE(args[dict_arg],
+                          MakeArrayOfNull(value_type, 1, exec_ctx->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(Datum null_lookup,
+                          CallFunction(func_name, args, options, exec_ctx));
+    ARROW_ASSIGN_OR_RAISE(auto null_result, null_lookup.make_array()->GetScalar(0));
+
+    ArrayData indices = dict_data;
+    indices.type = checked_cast<const DictionaryType&>(*dict_data.type).index_type();
+    indices.dictionary = nullptr;
+    switch (lookup.type()->id()) {
+      case Type::BOOL:
+        return GatherDictionaryLookup<BooleanType>(indices, *lookup.array(), *null_result,
+                                                   exec_ctx->memory_pool(), out);
+      case Type::INT32:
+        return GatherDictionaryLookup<Int32Type>(indices, *lookup.array(), *null_result,
+                                                 exec_ctx->memory_pool(), out);
+      default:
+        break;
+    }
+  }
+
+  // Decode the dictionary arguments
+  std::vector<Datum> args = batch.values;
+  for (auto& arg : args) {
+    if (arg.is_array() && arg.type()->id() == Type::DICTIONARY) {
+      auto dict_array =
+          ::arrow::internal::checked_pointer_cast<DictionaryArray>(arg.make_array());
+      ARROW_ASSIGN_OR_RAISE(
+          arg, CallFunction("take", {dict_array->dictionary(), dict_array->indices()},
+                            exec_ctx));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(*out, CallFunction(func_name, args, options, exec_ctx));
+  return Status::OK();
+}
+
+}  // namespace
+
+ArrayKernelExec MakeDictionaryExec(
+    std::string func_name,
+    std::function<const FunctionOptions*(KernelContext*)> get_options) {
+  return [func_name, get_options](KernelContext* ctx, const ExecBatch& batch,
+                                  Datum* out) {
+    const FunctionOptions* options = get_options ? get_options(ctx) : NULLPTR;
+    KERNEL_RETURN_IF_ERROR(ctx, ExecDictionary(ctx, func_name, options, batch, out));
+  };
+}
+
 std::vector<std::shared_ptr<DataType>> g_signed_int_types;
 std::vector<std::shared_ptr<DataType>> g_unsigned_int_types;
 std::vector<std::shared_ptr<DataType>> g_int_types;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -175,6 +176,51 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+// Like ArrayIterator, but yields only the values at the positions of a
+// selection vector
+template <typename Type, typename Enable = void>
+struct SelectionIterator;
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_has_c_type_not_boolean<Type>> {
+  using T = typename Type::c_type;
+  const T* values;
+  const int32_t* indices;
+  SelectionIterator(const ArrayData& data, const SelectionVector& selection)
+      : values(data.GetValues<T>(1)), indices(selection.indices()) {}
+  T operator()() { return values[*indices++]; }
+};
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_boolean<Type>> {
+  const uint8_t* bitmap;
+  int64_t offset;
+  const int32_t* indices;
+  SelectionIterator(const ArrayData& data, const SelectionVector& selection)
+      : bitmap(data.buffers[1]->data()),
+        offset(data.offset),
+        indices(selection.indices()) {}
+  bool operator()() { return BitUtil::GetBit(bitmap, offset + *indices++); }
+};
+
+template <typename Type>
+struct SelectionIterator<Type, enable_if_base_binary<Type>> {
+  using offset_type = typename Type::offset_type;
+  const offset_type* offsets;
+  const char* data;
+  const int32_t* indices;
+  SelectionIterator(const ArrayData& arr, const SelectionVector& selection)
+      : offsets(reinterpret_cast<const offset_type*>(arr.buffers[1]->data()) +
+                arr.offset),
+        data(reinterpret_cast<const char*>(arr.buffers[2]->data())),
+        indices(selection.indices()) {}
+
+  util::string_view operator()() {
+    const int32_t index = *indices++;
+    return util::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
+};
+
 template <typename Type, typename Enable = void>
 struct UnboxScalar;
 
@@ -190,6 +236,7 @@ struct UnboxScalar<Type, enable_if_has_c_type<Type>> {
 template <typename Type>
 struct UnboxScalar<Type, enable_if_base_binary<Type>> {
   static util::string_view Unbox(const Scalar& val) {
+    if (!val.is_valid) return util::string_view();
     return util::string_view(*checked_cast<const BaseBinaryScalar&>(val).value);
   }
 };
@@ -276,6 +323,18 @@ void ExecFail(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
 ArrayKernelExec MakeFlippedBinaryExec(ArrayKernelExec exec);
 
+/// \brief Make a kernel exec function evaluating the function `func_name` on
+/// arguments that include dictionary arrays
+///
+/// If a single argument is a dictionary array, the others being scalars, the
+/// function is evaluated once on the dictionary values (and once on a null)
+/// and its boolean or int32 results are gathered through the indices.
+/// Otherwise the dictionary arguments are decoded first. `get_options`, if
+/// given, returns the FunctionOptions to call the function with.
+ArrayKernelExec MakeDictionaryExec(
+    std::string func_name,
+    std::function<const FunctionOptions*(KernelContext*)> get_options = {});
+
 // ----------------------------------------------------------------------
 // Helpers for iterating over common DataType instances for adding kernels to
 // functions
@@ -432,8 +491,18 @@ struct ScalarUnary {
     }
   }
 
+  static void SelectedArray(KernelContext* ctx, const ArrayData& arg0,
+                            const SelectionVector& selection, Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    OutputAdapter<OutType>::Write(
+        ctx, out, [&]() -> OUT { return Op::template Call<OUT, ARG0>(ctx, arg0_it()); });
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     if (batch[0].kind() == Datum::ARRAY) {
+      if (batch.selection_vector) {
+        return SelectedArray(ctx, *batch[0].array(), *batch.selection_vector, out);
+      }
       return Array(ctx, *batch[0].array(), out);
     } else {
       return Scalar(ctx, *batch[0].scalar(), out);
@@ -657,7 +726,55 @@ struct ScalarBinary {
     }
   }
 
+  // Variants of the above computing only the rows of a selection vector
+  static void SelectedArrayArray(KernelContext* ctx, const ArrayData& arg0,
+                                 const ArrayData& arg1, const SelectionVector& selection,
+                                 Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    SelectionIterator<Arg1Type> arg1_it(arg1, selection);
+    OutputAdapter<OutType>::Write(
+        ctx, out, [&]() -> OUT { return Op::template Call(ctx, arg0_it(), arg1_it()); });
+  }
+
+  static void SelectedArrayScalar(KernelContext* ctx, const ArrayData& arg0,
+                                  const Scalar& arg1, const SelectionVector& selection,
+                                  Datum* out) {
+    SelectionIterator<Arg0Type> arg0_it(arg0, selection);
+    auto arg1_val = UnboxScalar<Arg1Type>::Unbox(arg1);
+    OutputAdapter<OutType>::Write(
+        ctx, out, [&]() -> OUT { return Op::template Call(ctx, arg0_it(), arg1_val); });
+  }
+
+  static void SelectedScalarArray(KernelContext* ctx, const Scalar& arg0,
+                                  const ArrayData& arg1, const SelectionVector& selection,
+                                  Datum* out) {
+    auto arg0_val = UnboxScalar<Arg0Type>::Unbox(arg0);
+    SelectionIterator<Arg1Type> arg1_it(arg1, selection);
+    OutputAdapter<OutType>::Write(
+        ctx, out, [&]() -> OUT { return Op::template Call(ctx, arg0_val, arg1_it()); });
+  }
+
+  static void ExecSelected(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const SelectionVector& selection = *batch.selection_vector;
+    if (batch[0].kind() == Datum::ARRAY) {
+      if (batch[1].kind() == Datum::ARRAY) {
+        return SelectedArrayArray(ctx, *batch[0].array(), *batch[1].array(), selection,
+                                  out);
+      } else {
+        return SelectedArrayScalar(ctx, *batch[0].array(), *batch[1].scalar(),
+                                   selection, out);
+      }
+    } else {
+      return SelectedScalarArray(ctx, *batch[0].scalar(), *batch[1].array(), selection,
+                                 out);
+    }
+  }
+
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch.selection_vector) {
+      // The executor only passes a selection vector with array arguments
+      return ExecSelected(ctx, batch, out);
+    }
     if (batch[0].kind() == Datum::ARRAY) {
       if (batch[1].kind() == Datum::ARRAY) {
         return ArrayArray(ctx, *batch[0].array(), *batch[1].array(), out);
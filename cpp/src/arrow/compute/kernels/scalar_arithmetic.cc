@@ -15,8 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "arrow/compute/kernels/common.h"
-#include "arrow/util/int_util.h"
+#include "arrow/util/bit_block_counter.h"
 
 #ifndef __has_builtin
 #define __has_builtin(x) 0
@@ -70,38 +74,44 @@ struct Add {
   }
 };
 
+// Errors raised by arithmetic operations.  The checked operations below OR
+// these flags into an accumulator instead of setting a Status per element,
+// so that a block of values is computed without branches and the accumulator
+// is inspected once per block.
+enum ArithmeticError : uint8_t {
+  kOverflow = 1 << 0,
+  kDivideByZero = 1 << 1,
+  kNegativePower = 1 << 2,
+};
+
+Status ArithmeticErrorToStatus(uint8_t errors) {
+  if (errors & kDivideByZero) {
+    return Status::Invalid("divide by zero");
+  }
+  if (errors & kNegativePower) {
+    return Status::Invalid("integers to negative integer powers are not allowed");
+  }
+  return Status::Invalid("overflow");
+}
+
 struct AddChecked {
-#if __has_builtin(__builtin_add_overflow)
   template <typename T>
-  static enable_if_integer<T> Call(KernelContext* ctx, T left, T right) {
-    T result;
-    if (__builtin_add_overflow(left, right, &result)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
+  static enable_if_unsigned_integer<T> Call(T left, T right, uint8_t* errors) {
+    T result = left + right;
+    *errors |= (result < left) * kOverflow;
     return result;
   }
-#else
-  template <typename T>
-  static enable_if_unsigned_integer<T> Call(KernelContext* ctx, T left, T right) {
-    if (arrow::internal::HasAdditionOverflow(left, right)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return left + right;
-  }
 
   template <typename T>
-  static enable_if_signed_integer<T> Call(KernelContext* ctx, T left, T right) {
-    auto unsigned_left = to_unsigned(left);
-    auto unsigned_right = to_unsigned(right);
-    if (arrow::internal::HasAdditionOverflow(unsigned_left, unsigned_right)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return unsigned_left + unsigned_right;
+  static enable_if_signed_integer<T> Call(T left, T right, uint8_t* errors) {
+    // Overflow iff both operands have a sign different from the result's
+    T result = static_cast<T>(to_unsigned(left) + to_unsigned(right));
+    *errors |= (((left ^ result) & (right ^ result)) < 0) * kOverflow;
+    return result;
   }
-#endif
 
   template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+  static enable_if_floating_point<T> Call(T left, T right, uint8_t*) {
     return left + right;
   }
 };
@@ -124,35 +134,23 @@ struct Subtract {
 };
 
 struct SubtractChecked {
-#if __has_builtin(__builtin_sub_overflow)
   template <typename T>
-  static enable_if_integer<T> Call(KernelContext* ctx, T left, T right) {
-    T result;
-    if (__builtin_sub_overflow(left, right, &result)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return result;
-  }
-#else
-  template <typename T>
-  static enable_if_unsigned_integer<T> Call(KernelContext* ctx, T left, T right) {
-    if (arrow::internal::HasSubtractionOverflow(left, right)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
+  static enable_if_unsigned_integer<T> Call(T left, T right, uint8_t* errors) {
+    *errors |= (left < right) * kOverflow;
     return left - right;
   }
 
   template <typename T>
-  static enable_if_signed_integer<T> Call(KernelContext* ctx, T left, T right) {
-    if (arrow::internal::HasSubtractionOverflow(left, right)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
-    return to_unsigned(left) - to_unsigned(right);
+  static enable_if_signed_integer<T> Call(T left, T right, uint8_t* errors) {
+    // Overflow iff the operands have different signs and the result's sign
+    // differs from the minuend's
+    T result = static_cast<T>(to_unsigned(left) - to_unsigned(right));
+    *errors |= (((left ^ right) & (left ^ result)) < 0) * kOverflow;
+    return result;
   }
-#endif
 
   template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+  static enable_if_floating_point<T> Call(T left, T right, uint8_t*) {
     return left - right;
   }
 };
@@ -197,71 +195,432 @@ struct Multiply {
 };
 
 struct MultiplyChecked {
+  // Integers narrower than 64 bits are multiplied exactly in 64 bits, which
+  // vectorizes better than the overflow builtins
+  template <typename T>
+  static enable_if_t<is_signed_integer<T>::value && (sizeof(T) < 8), T> Call(
+      T left, T right, uint8_t* errors) {
+    int64_t result = static_cast<int64_t>(left) * static_cast<int64_t>(right);
+    *errors |= (result != static_cast<T>(result)) * kOverflow;
+    return static_cast<T>(result);
+  }
+
+  template <typename T>
+  static enable_if_t<is_unsigned_integer<T>::value && (sizeof(T) < 8), T> Call(
+      T left, T right, uint8_t* errors) {
+    uint64_t result = static_cast<uint64_t>(left) * static_cast<uint64_t>(right);
+    *errors |= (result != static_cast<T>(result)) * kOverflow;
+    return static_cast<T>(result);
+  }
+
   template <typename T>
-  static enable_if_integer<T> Call(KernelContext* ctx, T left, T right) {
+  static enable_if_t<is_signed_integer<T>::value || is_unsigned_integer<T>::value,
+                     enable_if_t<sizeof(T) == 8, T>>
+  Call(T left, T right, uint8_t* errors) {
     T result;
 #if __has_builtin(__builtin_mul_overflow)
-    if (__builtin_mul_overflow(left, right, &result)) {
-      ctx->SetStatus(Status::Invalid("overflow"));
-    }
+    *errors |= __builtin_mul_overflow(left, right, &result) * kOverflow;
 #else
-    result = Multiply::Call(ctx, left, right);
-    if (left != 0 && result / left != right) {
-      ctx->SetStatus(Status::Invalid("overflow"));
+    result = Multiply::Call(nullptr, left, right);
+    if (std::is_signed<T>::value && left == static_cast<T>(-1)) {
+      *errors |= (right == std::numeric_limits<T>::min()) * kOverflow;
+    } else if (left != 0 && result / left != right) {
+      *errors |= kOverflow;
     }
 #endif
     return result;
   }
 
   template <typename T>
-  static constexpr enable_if_floating_point<T> Call(KernelContext*, T left, T right) {
+  static enable_if_floating_point<T> Call(T left, T right, uint8_t*) {
     return left * right;
   }
 };
 
+struct Divide {
+  template <typename T>
+  static enable_if_floating_point<T> Call(T left, T right, uint8_t*) {
+    return left / right;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_integer<T> Call(T left, T right, uint8_t* errors) {
+    if (ARROW_PREDICT_FALSE(right == 0)) {
+      *errors |= kDivideByZero;
+      return 0;
+    }
+    return left / right;
+  }
+
+  template <typename T>
+  static enable_if_signed_integer<T> Call(T left, T right, uint8_t* errors) {
+    if (ARROW_PREDICT_FALSE(right == 0)) {
+      *errors |= kDivideByZero;
+      return 0;
+    }
+    // The quotient of the minimum value by -1 isn't representable; wrap around
+    if (ARROW_PREDICT_FALSE(right == -1)) {
+      return static_cast<T>(0 - to_unsigned(left));
+    }
+    return left / right;
+  }
+};
+
+struct DivideChecked {
+  template <typename T>
+  static enable_if_floating_point<T> Call(T left, T right, uint8_t* errors) {
+    *errors |= (right == 0) * kDivideByZero;
+    return left / right;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_integer<T> Call(T left, T right, uint8_t* errors) {
+    return Divide::Call(left, right, errors);
+  }
+
+  template <typename T>
+  static enable_if_signed_integer<T> Call(T left, T right, uint8_t* errors) {
+    if (ARROW_PREDICT_FALSE(right == -1 && left == std::numeric_limits<T>::min())) {
+      *errors |= kOverflow;
+      return 0;
+    }
+    return Divide::Call(left, right, errors);
+  }
+};
+
+struct Power {
+  template <typename T>
+  static enable_if_floating_point<T> Call(T base, T exp, uint8_t*) {
+    return std::pow(base, exp);
+  }
+
+  // Exponentiation by squaring, wrapping around on overflow.  Multiplying in
+  // at least 32 unsigned bits avoids promotion to (overflowing) signed int.
+  template <typename T>
+  static enable_if_integer<T> Call(T base, T exp, uint8_t* errors) {
+    using Wide = typename std::conditional<sizeof(T) <= 4, uint32_t, uint64_t>::type;
+    if (ARROW_PREDICT_FALSE(exp < 0)) {
+      *errors |= kNegativePower;
+      return 0;
+    }
+    Wide result = 1;
+    Wide factor = static_cast<Wide>(base);
+    for (auto bits = to_unsigned(exp); bits != 0; bits >>= 1) {
+      if (bits & 1) {
+        result *= factor;
+      }
+      factor *= factor;
+    }
+    return static_cast<T>(result);
+  }
+};
+
+struct PowerChecked {
+  template <typename T>
+  static enable_if_floating_point<T> Call(T base, T exp, uint8_t* errors) {
+    return Power::Call(base, exp, errors);
+  }
+
+  template <typename T>
+  static enable_if_integer<T> Call(T base, T exp, uint8_t* errors) {
+    if (ARROW_PREDICT_FALSE(exp < 0)) {
+      *errors |= kNegativePower;
+      return 0;
+    }
+    T result = 1;
+    T factor = base;
+    auto bits = to_unsigned(exp);
+    while (true) {
+      if (bits & 1) {
+        result = MultiplyChecked::Call(result, factor, errors);
+      }
+      bits >>= 1;
+      if (bits == 0) {
+        break;
+      }
+      factor = MultiplyChecked::Call(factor, factor, errors);
+    }
+    return result;
+  }
+};
+
+struct Negate {
+  template <typename T, typename Arg>
+  static constexpr enable_if_floating_point<T> Call(KernelContext*, Arg arg) {
+    return -arg;
+  }
+
+  template <typename T, typename Arg>
+  static constexpr enable_if_unsigned_integer<T> Call(KernelContext*, Arg arg) {
+    return static_cast<T>(~arg + 1);
+  }
+
+  template <typename T, typename Arg>
+  static constexpr enable_if_signed_integer<T> Call(KernelContext*, Arg arg) {
+    return static_cast<T>(~to_unsigned(arg) + 1);
+  }
+};
+
+struct NegateChecked {
+  template <typename T>
+  static enable_if_floating_point<T> Call(T arg, uint8_t*) {
+    return -arg;
+  }
+
+  template <typename T>
+  static enable_if_signed_integer<T> Call(T arg, uint8_t* errors) {
+    *errors |= (arg == std::numeric_limits<T>::min()) * kOverflow;
+    return static_cast<T>(~to_unsigned(arg) + 1);
+  }
+};
+
 using applicator::ScalarBinaryEqualTypes;
 
+template <typename Type, typename Op>
+using ScalarBinaryWrapping = ScalarBinaryEqualTypes<Type, Type, Op>;
+
+template <typename Type, typename Op>
+using ScalarUnaryWrapping = applicator::ScalarUnary<Type, Type, Op>;
+
+// Compute out_values[i] = compute(i, &errors) for the non-null slots of the
+// output. The output validity bitmap, which the executor has already
+// populated, is scanned block-wise: fully valid blocks are computed without
+// per-element branches, and the error flags are checked once per block.
+using arrow::internal::BitBlockCount;
+using arrow::internal::OptionalBitBlockCounter;
+
+template <typename T, typename ComputeFunc>
+Status ComputeNonNull(const ArrayData& out_arr, T* out_values, ComputeFunc&& compute) {
+  const uint8_t* bitmap =
+      out_arr.buffers[0] != nullptr ? out_arr.buffers[0]->data() : nullptr;
+  OptionalBitBlockCounter bit_counter(bitmap, out_arr.offset, out_arr.length);
+  int64_t position = 0;
+  while (position < out_arr.length) {
+    const BitBlockCount block = bit_counter.NextBlock();
+    const int64_t block_end = position + block.length;
+    uint8_t errors = 0;
+    if (block.AllSet()) {
+      for (int64_t i = position; i < block_end; ++i) {
+        out_values[i] = compute(i, &errors);
+      }
+    } else if (block.NoneSet()) {
+      std::fill(out_values + position, out_values + block_end, T(0));
+    } else {
+      for (int64_t i = position; i < block_end; ++i) {
+        out_values[i] =
+            BitUtil::GetBit(bitmap, out_arr.offset + i) ? compute(i, &errors) : T(0);
+      }
+    }
+    if (ARROW_PREDICT_FALSE(errors != 0)) {
+      return ArithmeticErrorToStatus(errors);
+    }
+    position = block_end;
+  }
+  return Status::OK();
+}
+
+// Generate a kernel for a binary operation reporting ArithmeticError flags.
+// Only the non-null slots are computed, so that e.g. a garbage divisor behind
+// a null doesn't raise a division by zero.
+template <typename Type, typename Op>
+struct ScalarBinaryChecked {
+  using T = typename Type::c_type;
+
+  template <typename GetLeft, typename GetRight>
+  static Status Compute(ArrayData* out_arr, GetLeft&& left, GetRight&& right) {
+    return ComputeNonNull(*out_arr, out_arr->GetMutableValues<T>(1),
+                          [&](int64_t i, uint8_t* errors) {
+                            return Op::template Call<T>(left(i), right(i), errors);
+                          });
+  }
+
+  static Status ExecScalarScalar(const Scalar& arg0, const Scalar& arg1, Scalar* out) {
+    if (out->is_valid) {
+      uint8_t errors = 0;
+      T result = Op::template Call<T>(UnboxScalar<Type>::Unbox(arg0),
+                                      UnboxScalar<Type>::Unbox(arg1), &errors);
+      if (errors != 0) {
+        return ArithmeticErrorToStatus(errors);
+      }
+      BoxScalar<Type>::Box(result, out);
+    }
+    return Status::OK();
+  }
+
+  static Status ExecArrays(const ExecBatch& batch, ArrayData* out_arr) {
+    // The executor only passes a selection vector with array arguments
+    const int32_t* indices =
+        batch.selection_vector ? batch.selection_vector->indices() : nullptr;
+    if (batch[0].is_array() && batch[1].is_array()) {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T* right = batch[1].array()->GetValues<T>(1);
+      if (indices) {
+        return Compute(
+            out_arr, [&](int64_t i) { return left[indices[i]]; },
+            [&](int64_t i) { return right[indices[i]]; });
+      }
+      return Compute(
+          out_arr, [&](int64_t i) { return left[i]; },
+          [&](int64_t i) { return right[i]; });
+    }
+    if (batch[0].is_array()) {
+      const T* left = batch[0].array()->GetValues<T>(1);
+      const T right = UnboxScalar<Type>::Unbox(*batch[1].scalar());
+      if (indices) {
+        return Compute(
+            out_arr, [&](int64_t i) { return left[indices[i]]; },
+            [&](int64_t) { return right; });
+      }
+      return Compute(
+          out_arr, [&](int64_t i) { return left[i]; }, [&](int64_t) { return right; });
+    }
+    const T left = UnboxScalar<Type>::Unbox(*batch[0].scalar());
+    const T* right = batch[1].array()->GetValues<T>(1);
+    if (indices) {
+      return Compute(
+          out_arr, [&](int64_t) { return left; },
+          [&](int64_t i) { return right[indices[i]]; });
+    }
+    return Compute(
+        out_arr, [&](int64_t) { return left; }, [&](int64_t i) { return right[i]; });
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].is_scalar() && batch[1].is_scalar()) {
+      KERNEL_RETURN_IF_ERROR(ctx, ExecScalarScalar(*batch[0].scalar(),
+                                                   *batch[1].scalar(),
+                                                   out->scalar().get()));
+      return;
+    }
+    KERNEL_RETURN_IF_ERROR(ctx, ExecArrays(batch, out->mutable_array()));
+  }
+};
+
+// Same as ScalarBinaryChecked, for unary operations
+template <typename Type, typename Op>
+struct ScalarUnaryChecked {
+  using T = typename Type::c_type;
+
+  static Status ExecScalar(const Scalar& arg, Scalar* out) {
+    if (out->is_valid) {
+      uint8_t errors = 0;
+      T result = Op::template Call<T>(UnboxScalar<Type>::Unbox(arg), &errors);
+      if (errors != 0) {
+        return ArithmeticErrorToStatus(errors);
+      }
+      BoxScalar<Type>::Box(result, out);
+    }
+    return Status::OK();
+  }
+
+  static Status ExecArray(const ExecBatch& batch, ArrayData* out_arr) {
+    const T* values = batch[0].array()->GetValues<T>(1);
+    if (batch.selection_vector) {
+      const int32_t* indices = batch.selection_vector->indices();
+      return ComputeNonNull(*out_arr, out_arr->GetMutableValues<T>(1),
+                            [&](int64_t i, uint8_t* errors) {
+                              return Op::template Call<T>(values[indices[i]], errors);
+                            });
+    }
+    return ComputeNonNull(*out_arr, out_arr->GetMutableValues<T>(1),
+                          [&](int64_t i, uint8_t* errors) {
+                            return Op::template Call<T>(values[i], errors);
+                          });
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    if (batch[0].is_scalar()) {
+      KERNEL_RETURN_IF_ERROR(ctx, ExecScalar(*batch[0].scalar(), out->scalar().get()));
+      return;
+    }
+    KERNEL_RETURN_IF_ERROR(ctx, ExecArray(batch, out->mutable_array()));
+  }
+};
+
 // Generate a kernel given an arithmetic functor
 //
 // To avoid undefined behaviour of signed integer overflow treat the signed
 // input argument values as unsigned then cast them to signed making them wrap
 // around.
-template <typename Op>
-ArrayKernelExec NumericEqualTypesBinary(detail::GetTypeId get_id) {
+template <template <typename, typename> class KernelGenerator, typename Op>
+ArrayKernelExec ArithmeticExecFromOp(detail::GetTypeId get_id) {
   switch (get_id.id) {
     case Type::INT8:
-      return ScalarBinaryEqualTypes<Int8Type, Int8Type, Op>::Exec;
+      return KernelGenerator<Int8Type, Op>::Exec;
     case Type::UINT8:
-      return ScalarBinaryEqualTypes<UInt8Type, UInt8Type, Op>::Exec;
+      return KernelGenerator<UInt8Type, Op>::Exec;
     case Type::INT16:
-      return ScalarBinaryEqualTypes<Int16Type, Int16Type, Op>::Exec;
+      return KernelGenerator<Int16Type, Op>::Exec;
     case Type::UINT16:
-      return ScalarBinaryEqualTypes<UInt16Type, UInt16Type, Op>::Exec;
+      return KernelGenerator<UInt16Type, Op>::Exec;
     case Type::INT32:
-      return ScalarBinaryEqualTypes<Int32Type, Int32Type, Op>::Exec;
+      return KernelGenerator<Int32Type, Op>::Exec;
     case Type::UINT32:
-      return ScalarBinaryEqualTypes<UInt32Type, UInt32Type, Op>::Exec;
+      return KernelGenerator<UInt32Type, Op>::Exec;
     case Type::INT64:
     case Type::TIMESTAMP:
-      return ScalarBinaryEqualTypes<Int64Type, Int64Type, Op>::Exec;
+      return KernelGenerator<Int64Type, Op>::Exec;
     case Type::UINT64:
-      return ScalarBinaryEqualTypes<UInt64Type, UInt64Type, Op>::Exec;
+      return KernelGenerator<UInt64Type, Op>::Exec;
+    case Type::FLOAT:
+      return KernelGenerator<FloatType, Op>::Exec;
+    case Type::DOUBLE:
+      return KernelGenerator<DoubleType, Op>::Exec;
+    default:
+      DCHECK(false);
+      return ExecFail;
+  }
+}
+
+// Like ArithmeticExecFromOp, for operations only defined on signed integers
+// and floating point types
+template <template <typename, typename> class KernelGenerator, typename Op>
+ArrayKernelExec ArithmeticSignedExecFromOp(detail::GetTypeId get_id) {
+  switch (get_id.id) {
+    case Type::INT8:
+      return KernelGenerator<Int8Type, Op>::Exec;
+    case Type::INT16:
+      return KernelGenerator<Int16Type, Op>::Exec;
+    case Type::INT32:
+      return KernelGenerator<Int32Type, Op>::Exec;
+    case Type::INT64:
+      return KernelGenerator<Int64Type, Op>::Exec;
     case Type::FLOAT:
-      return ScalarBinaryEqualTypes<FloatType, FloatType, Op>::Exec;
+      return KernelGenerator<FloatType, Op>::Exec;
     case Type::DOUBLE:
-      return ScalarBinaryEqualTypes<DoubleType, DoubleType, Op>::Exec;
+      return KernelGenerator<DoubleType, Op>::Exec;
     default:
       DCHECK(false);
       return ExecFail;
   }
 }
 
+// The arithmetic kernels can all compute only the rows of a selection vector
+void AddArithmeticKernel(std::vector<InputType> in_types, OutputType out_type,
+                         ArrayKernelExec exec, ScalarFunction* func) {
+  ScalarKernel kernel(std::move(in_types), std::move(out_type), std::move(exec));
+  kernel.can_use_selection_vector = true;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+// Create a binary function from an operation wrapping around on overflow
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
   for (const auto& ty : NumericTypes()) {
-    auto exec = NumericEqualTypesBinary<Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    auto exec = ArithmeticExecFromOp<ScalarBinaryWrapping, Op>(ty);
+    AddArithmeticKernel({ty, ty}, ty, exec, func.get());
+  }
+  return func;
+}
+
+// Create a binary function from an operation reporting ArithmeticError flags
+template <typename Op>
+std::shared_ptr<ScalarFunction> MakeCheckedArithmeticFunction(std::string name) {
+  auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
+  for (const auto& ty : NumericTypes()) {
+    auto exec = ArithmeticExecFromOp<ScalarBinaryChecked, Op>(ty);
+    AddArithmeticKernel({ty, ty}, ty, exec, func.get());
   }
   return func;
 }
@@ -274,7 +633,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(add)));
 
   // ----------------------------------------------------------------------
-  auto add_checked = MakeArithmeticFunction<AddChecked>("add_checked");
+  auto add_checked = MakeCheckedArithmeticFunction<AddChecked>("add_checked");
   DCHECK_OK(registry->AddFunction(std::move(add_checked)));
 
   // ----------------------------------------------------------------------
@@ -284,14 +643,16 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // Add subtract(timestamp, timestamp) -> duration
   for (auto unit : AllTimeUnits()) {
     InputType in_type(match::TimestampTypeUnit(unit));
-    auto exec = NumericEqualTypesBinary<Subtract>(Type::TIMESTAMP);
-    DCHECK_OK(subtract->AddKernel({in_type, in_type}, duration(unit), std::move(exec)));
+    auto exec = ArithmeticExecFromOp<ScalarBinaryWrapping, Subtract>(Type::TIMESTAMP);
+    AddArithmeticKernel({in_type, in_type}, duration(unit), std::move(exec),
+                        subtract.get());
   }
 
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
 
   // ----------------------------------------------------------------------
-  auto subtract_checked = MakeArithmeticFunction<SubtractChecked>("subtract_checked");
+  auto subtract_checked =
+      MakeCheckedArithmeticFunction<SubtractChecked>("subtract_checked");
   DCHECK_OK(registry->AddFunction(std::move(subtract_checked)));
 
   // ----------------------------------------------------------------------
@@ -299,8 +660,47 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
-  auto multiply_checked = MakeArithmeticFunction<MultiplyChecked>("multiply_checked");
+  auto multiply_checked =
+      MakeCheckedArithmeticFunction<MultiplyChecked>("multiply_checked");
   DCHECK_OK(registry->AddFunction(std::move(multiply_checked)));
+
+  // ----------------------------------------------------------------------
+  // Integer division by zero raises an error even when not checking overflow
+  auto divide = MakeCheckedArithmeticFunction<Divide>("divide");
+  DCHECK_OK(registry->AddFunction(std::move(divide)));
+
+  // ----------------------------------------------------------------------
+  auto divide_checked = MakeCheckedArithmeticFunction<DivideChecked>("divide_checked");
+  DCHECK_OK(registry->AddFunction(std::move(divide_checked)));
+
+  // ----------------------------------------------------------------------
+  auto power = MakeCheckedArithmeticFunction<Power>("power");
+  DCHECK_OK(registry->AddFunction(std::move(power)));
+
+  // ----------------------------------------------------------------------
+  auto power_checked = MakeCheckedArithmeticFunction<PowerChecked>("power_checked");
+  DCHECK_OK(registry->AddFunction(std::move(power_checked)));
+
+  // ----------------------------------------------------------------------
+  auto negate = std::make_shared<ScalarFunction>("negate", Arity::Unary());
+  for (const auto& ty : NumericTypes()) {
+    auto exec = ArithmeticExecFromOp<ScalarUnaryWrapping, Negate>(ty);
+    AddArithmeticKernel({ty}, ty, exec, negate.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(negate)));
+
+  // ----------------------------------------------------------------------
+  // Negating an unsigned integer always overflows except for zero, so
+  // negate_checked is only defined for signed types
+  auto negate_checked =
+      std::make_shared<ScalarFunction>("negate_checked", Arity::Unary());
+  for (const auto& types : {SignedIntTypes(), FloatingPointTypes()}) {
+    for (const auto& ty : types) {
+      auto exec = ArithmeticSignedExecFromOp<ScalarUnaryChecked, NegateChecked>(ty);
+      AddArithmeticKernel({ty}, ty, exec, negate_checked.get());
+    }
+  }
+  DCHECK_OK(registry->AddFunction(std::move(negate_checked)));
 }
 
 }  // namespace internal
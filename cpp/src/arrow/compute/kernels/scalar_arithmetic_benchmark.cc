@@ -20,12 +20,19 @@
 #include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/benchmark_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 constexpr auto kSeed = 0x94378165;
@@ -72,6 +79,102 @@ static void ArrayArrayKernel(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Operate on values bounded so that none of the operations overflows or
+// divides by zero, to compare the checked kernels to the unchecked ones
+template <BinaryOp& Op, typename ArrowType, typename CType = typename ArrowType::c_type>
+static void ArrayArrayBoundedKernel(benchmark::State& state, bool check_overflow) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(CType);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = std::static_pointer_cast<NumericArray<ArrowType>>(
+      rand.Numeric<ArrowType>(array_size, CType(2), CType(10), args.null_proportion));
+  auto rhs = std::static_pointer_cast<NumericArray<ArrowType>>(
+      rand.Numeric<ArrowType>(array_size, CType(1), CType(2), args.null_proportion));
+
+  ArithmeticOptions options;
+  options.check_overflow = check_overflow;
+  for (auto _ : state) {
+    ABORT_NOT_OK(Op(lhs, rhs, options, nullptr).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+template <BinaryOp& Op, typename ArrowType>
+static void ArrayArrayUnchecked(benchmark::State& state) {
+  ArrayArrayBoundedKernel<Op, ArrowType>(state, false);
+}
+
+template <BinaryOp& Op, typename ArrowType>
+static void ArrayArrayChecked(benchmark::State& state) {
+  ArrayArrayBoundedKernel<Op, ArrowType>(state, true);
+}
+
+// Compare adding the rows selected by a filter using a selection vector to
+// filtering the arguments first. The benchmark argument is the selectivity of
+// the filter in percent
+static void AddSelectedRows(benchmark::State& state, bool use_selection_vector) {
+  const int64_t array_size = kL2Size / sizeof(int64_t);
+  const double selectivity = static_cast<double>(state.range(0)) / 100;
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Int64(array_size, -1000, 1000, /*null_probability=*/0.01);
+  auto rhs = rand.Int64(array_size, -1000, 1000, /*null_probability=*/0.01);
+  auto mask = rand.Boolean(array_size, selectivity, /*null_probability=*/0);
+  auto selection = *SelectionVector::FromMask(checked_cast<const BooleanArray&>(*mask));
+
+  for (auto _ : state) {
+    if (use_selection_vector) {
+      ExecBatch batch({lhs, rhs}, array_size);
+      batch.selection_vector = selection;
+      ABORT_NOT_OK(CallFunction("add", batch).status());
+    } else {
+      auto selected_lhs = *Filter(lhs, mask);
+      auto selected_rhs = *Filter(rhs, mask);
+      ABORT_NOT_OK(Add(selected_lhs, selected_rhs).status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void AddSelectionVector(benchmark::State& state) { AddSelectedRows(state, true); }
+
+static void AddFilterThenAdd(benchmark::State& state) { AddSelectedRows(state, false); }
+
+// Same as AddSelectedRows, for a checked cast from int64 to int32
+static void CastSelectedRows(benchmark::State& state, bool use_selection_vector) {
+  const int64_t array_size = kL2Size / sizeof(int64_t);
+  const double selectivity = static_cast<double>(state.range(0)) / 100;
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -1000, 1000, /*null_probability=*/0.01);
+  auto mask = rand.Boolean(array_size, selectivity, /*null_probability=*/0);
+  auto selection = *SelectionVector::FromMask(checked_cast<const BooleanArray&>(*mask));
+  auto options = CastOptions::Safe();
+  options.to_type = int32();
+
+  for (auto _ : state) {
+    if (use_selection_vector) {
+      ExecBatch batch({values}, array_size);
+      batch.selection_vector = selection;
+      ABORT_NOT_OK(CallFunction("cast", batch, &options).status());
+    } else {
+      auto selected = *Filter(values, mask);
+      ABORT_NOT_OK(Cast(selected, int32(), options).status());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void CastSelectionVector(benchmark::State& state) {
+  CastSelectedRows(state, true);
+}
+
+static void CastFilterThenCast(benchmark::State& state) {
+  CastSelectedRows(state, false);
+}
+
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (const auto size : {kL1Size, kL2Size}) {
     for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
@@ -99,5 +202,21 @@ DECLARE_ARITHMETIC_BENCHMARKS(ArrayScalarKernel, Subtract);
 DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayKernel, Multiply);
 DECLARE_ARITHMETIC_BENCHMARKS(ArrayScalarKernel, Multiply);
 
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayUnchecked, Add);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayChecked, Add);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayUnchecked, Subtract);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayChecked, Subtract);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayUnchecked, Multiply);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayChecked, Multiply);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayUnchecked, Divide);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayChecked, Divide);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayUnchecked, Power);
+DECLARE_ARITHMETIC_BENCHMARKS(ArrayArrayChecked, Power);
+
+BENCHMARK(AddSelectionVector)->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK(AddFilterThenAdd)->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK(CastSelectionVector)->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK(CastFilterThenCast)->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+
 }  // namespace compute
 }  // namespace arrow
@@ -261,6 +261,106 @@ TYPED_TEST(TestBinaryArithmeticIntegral, OverflowRaises) {
                           "overflow");
 }
 
+TYPED_TEST(TestBinaryArithmeticIntegral, SelectionVector) {
+  using CType = typename TestFixture::CType;
+
+  random::RandomArrayGenerator rand(kRandomSeed);
+  const int64_t length = 500;
+  auto lhs = rand.ArrayOf(this->type_singleton(), length, /*null_probability=*/0.2);
+  auto rhs = rand.ArrayOf(this->type_singleton(), length, /*null_probability=*/0.2);
+  auto indices = rand.Int32(100, 0, static_cast<int32_t>(length - 1));
+  ASSERT_OK_AND_ASSIGN(auto scalar, MakeScalar(this->type_singleton(), CType(3)));
+
+  for (std::string func : {"add", "subtract", "multiply"}) {
+    for (const std::vector<Datum>& args : std::vector<std::vector<Datum>>{
+             {lhs, rhs}, {lhs, scalar}, {scalar, rhs}}) {
+      ExecBatch batch(args, length);
+      batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, batch));
+
+      std::vector<Datum> selected_args;
+      for (const auto& arg : args) {
+        if (arg.is_array()) {
+          ASSERT_OK_AND_ASSIGN(Datum selected, Take(arg, indices));
+          selected_args.push_back(selected);
+        } else {
+          selected_args.push_back(arg);
+        }
+      }
+      ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, selected_args));
+      ASSERT_OK(actual.make_array()->ValidateFull());
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+
+  // Rows which are not selected are not computed
+  auto max = std::numeric_limits<CType>::max();
+  ExecBatch batch({ArrayFromJSON(this->type_singleton(), MakeArray(max, 1, 2)),
+                   ArrayFromJSON(this->type_singleton(), "[1, 1, null]")},
+                  3);
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[1, 2]"));
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("add_checked", batch));
+  this->ValidateAndAssertApproxEqual(actual.make_array(), "[2, null]");
+}
+
+TYPED_TEST(TestBinaryArithmeticIntegral, Div) {
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinop(Divide, "[]", "[]", "[]");
+    this->AssertBinop(Divide, "[null]", "[null]", "[null]");
+    this->AssertBinop(Divide, "[3, 2, 6]", "[1, 1, 2]", "[3, 2, 3]");
+    this->AssertBinop(Divide, "[7, 7, 7, 0, 100]", "[1, 2, 7, 3, 7]",
+                      "[7, 3, 1, 0, 14]");
+    this->AssertBinop(Divide, "[null, 10, 30, null, 20, 50]", "[1, 4, 2, 5, 10, 3]",
+                      "[null, 2, 15, null, 2, 16]");
+    this->AssertBinop(Divide, 33, "[null, 1, 3, null, 2, 5]",
+                      "[null, 33, 11, null, 16, 6]");
+    this->AssertBinop(Divide, 16, 7, 2);
+  }
+}
+
+TYPED_TEST(TestBinaryArithmeticIntegral, DivideByZero) {
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinopRaises(Divide, "[3, 2, 6]", "[1, 1, 0]", "divide by zero");
+    // Null divisors are not evaluated
+    this->AssertBinop(Divide, "[3, 2, 6]", "[1, 1, null]", "[3, 2, null]");
+  }
+}
+
+TYPED_TEST(TestBinaryArithmeticIntegral, Power) {
+  using CType = typename TestFixture::CType;
+
+  auto max = std::numeric_limits<CType>::max();
+
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinop(Power, "[]", "[]", "[]");
+    this->AssertBinop(Power, "[null]", "[null]", "[null]");
+    this->AssertBinop(Power, "[3, 2, 6, 2, 0, 0]", "[1, 3, 2, 0, 0, 2]",
+                      "[3, 8, 36, 1, 1, 0]");
+    this->AssertBinop(Power, "[null, 1, 3, null, 2]", "[1, 4, 2, 5, 6]",
+                      "[null, 1, 9, null, 64]");
+    this->AssertBinop(Power, 2, "[null, 1, 3, null, 2, 5]",
+                      "[null, 2, 8, null, 4, 32]");
+    this->AssertBinop(Power, 3, 4, 81);
+    this->AssertBinop(Power, MakeArray(max), MakeArray(1), MakeArray(max));
+  }
+
+  // 2 ** (number of bits) wraps around to zero
+  const CType bits = static_cast<CType>(sizeof(CType) * 8);
+  this->SetOverflowCheck(false);
+  this->AssertBinop(Power, MakeArray(2), MakeArray(bits), MakeArray(0));
+
+  this->SetOverflowCheck(true);
+  this->AssertBinopRaises(Power, MakeArray(2), MakeArray(bits), "overflow");
+  this->AssertBinopRaises(Power, MakeArray(max), MakeArray(2), "overflow");
+}
+
 TYPED_TEST(TestBinaryArithmeticSigned, OverflowRaises) {
   using CType = typename TestFixture::CType;
 
@@ -274,6 +374,68 @@ TYPED_TEST(TestBinaryArithmeticSigned, OverflowRaises) {
   this->AssertBinopRaises(Multiply, MakeArray(min), MakeArray(-1), "overflow");
 }
 
+TYPED_TEST(TestBinaryArithmeticSigned, Div) {
+  using CType = typename TestFixture::CType;
+
+  auto min = std::numeric_limits<CType>::lowest();
+  auto max = std::numeric_limits<CType>::max();
+
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    // Integer division truncates towards zero
+    this->AssertBinop(Divide, "[-7, 7, -7, 6, -6]", "[2, -2, -2, -4, 4]",
+                      "[-3, -3, 3, -1, -1]");
+    this->AssertBinop(Divide, -10, "[null, 1, -3, null, 2, 5]",
+                      "[null, -10, 3, null, -5, -2]");
+    this->AssertBinop(Divide, MakeArray(min, max), MakeArray(1, -1),
+                      MakeArray(min, min + 1));
+  }
+
+  this->SetOverflowCheck(false);
+  this->AssertBinop(Divide, MakeArray(min), MakeArray(-1), MakeArray(min));
+
+  this->SetOverflowCheck(true);
+  this->AssertBinopRaises(Divide, MakeArray(min), MakeArray(-1), "overflow");
+}
+
+TYPED_TEST(TestBinaryArithmeticSigned, Power) {
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinop(Power, "[-3, -2, -2, -1, -1]", "[3, 3, 2, 4, 5]",
+                      "[-27, -8, 4, 1, -1]");
+    this->AssertBinopRaises(Power, "[2, 3]", "[1, -1]",
+                            "integers to negative integer powers are not allowed");
+  }
+}
+
+TYPED_TEST(TestBinaryArithmeticSigned, OverflowBehindNullIgnored) {
+  using CType = typename TestFixture::CType;
+
+  auto min = std::numeric_limits<CType>::lowest();
+  auto max = std::numeric_limits<CType>::max();
+
+  // Overflowing values hidden behind nulls must not raise
+  auto lhs = ArrayFromJSON(this->type_singleton(), MakeArray(max, min, 1, 2));
+  auto rhs = ArrayFromJSON(this->type_singleton(), MakeArray(max, -1, 1, 1));
+  auto validity = ArrayFromJSON(this->type_singleton(), "[null, null, 1, 1]");
+  auto lhs_data = lhs->data()->Copy();
+  lhs_data->buffers[0] = validity->data()->buffers[0];
+  lhs_data->null_count = 2;
+  auto lhs_with_nulls = ::arrow::MakeArray(lhs_data);
+
+  for (const std::string func :
+       {"add_checked", "subtract_checked", "multiply_checked", "divide_checked"}) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {lhs_with_nulls, rhs}));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    ASSERT_EQ(2, actual.null_count());
+  }
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("negate_checked", {lhs_with_nulls}));
+  ASSERT_EQ(2, actual.null_count());
+}
+
 TYPED_TEST(TestBinaryArithmeticUnsigned, OverflowWraps) {
   using CType = typename TestFixture::CType;
 
@@ -356,5 +518,113 @@ TYPED_TEST(TestBinaryArithmeticFloating, Sub) {
                     "[null, -0.9, -3.2, null, -1.9, -5.2]");
 }
 
+TYPED_TEST(TestBinaryArithmeticFloating, Div) {
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinop(Divide, "[]", "[]", "[]");
+    this->AssertBinop(Divide, "[3.4, 0.64, 1.28]", "[1, 2, 4]", "[3.4, 0.32, 0.32]");
+    this->AssertBinop(Divide, "[null, 1, 3.3, null, 2]", "[1, 4, 2, 5, 0.1]",
+                      "[null, 0.25, 1.65, null, 20]");
+    this->AssertBinop(Divide, 10.0F, "[null, 1, 2.5, null, 2, 5]",
+                      "[null, 10, 4, null, 5, 2]");
+    this->AssertBinop(Divide, 4.0F, 16.0F, 0.25F);
+  }
+
+  this->SetOverflowCheck(true);
+  this->AssertBinopRaises(Divide, "[3.4, 2.6, 6.3]", "[1, 0, 2]", "divide by zero");
+}
+
+TYPED_TEST(TestBinaryArithmeticFloating, Power) {
+  for (auto check_overflow : {false, true}) {
+    this->SetOverflowCheck(check_overflow);
+
+    this->AssertBinop(Power, "[]", "[]", "[]");
+    this->AssertBinop(Power, "[3.4, 16, 0.64, 1.2, 0]", "[1, 0.5, 2, 0, 3]",
+                      "[3.4, 4, 0.4096, 1, 0]");
+    this->AssertBinop(Power, "[null, 1, 3.3, null, 2]", "[1, 4, 2, 5, -1]",
+                      "[null, 1, 10.89, null, 0.5]");
+    this->AssertBinop(Power, 10.0F, "[null, 1, 2, null, -2]",
+                      "[null, 10, 100, null, 0.01]");
+  }
+}
+
+template <typename ArrowType>
+class TestUnaryArithmetic : public TestBase {
+ protected:
+  static std::shared_ptr<DataType> type_singleton() {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  void AssertUnaryOp(const std::string& func, const std::string& arg,
+                     const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         CallFunction(func, {ArrayFromJSON(type_singleton(), arg)}));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysApproxEqual(*ArrayFromJSON(type_singleton(), expected),
+                            *actual.make_array());
+  }
+};
+
+template <typename T>
+class TestUnaryArithmeticSigned : public TestUnaryArithmetic<T> {};
+
+template <typename T>
+class TestUnaryArithmeticUnsigned : public TestUnaryArithmetic<T> {};
+
+template <typename T>
+class TestUnaryArithmeticFloating : public TestUnaryArithmetic<T> {};
+
+TYPED_TEST_SUITE(TestUnaryArithmeticSigned, SignedIntegerTypes);
+TYPED_TEST_SUITE(TestUnaryArithmeticUnsigned, UnsignedIntegerTypes);
+TYPED_TEST_SUITE(TestUnaryArithmeticFloating, FloatingTypes);
+
+TYPED_TEST(TestUnaryArithmeticSigned, Negate) {
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto min = std::numeric_limits<CType>::lowest();
+  auto max = std::numeric_limits<CType>::max();
+
+  for (std::string func : {"negate", "negate_checked"}) {
+    this->AssertUnaryOp(func, "[]", "[]");
+    this->AssertUnaryOp(func, "[null]", "[null]");
+    this->AssertUnaryOp(func, "[1, -2, 0, null, 3]", "[-1, 2, 0, null, -3]");
+    this->AssertUnaryOp(func, MakeArray(max), MakeArray(min + 1));
+  }
+
+  this->AssertUnaryOp("negate", MakeArray(min), MakeArray(min));
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("overflow"),
+      Negate(ArrayFromJSON(this->type_singleton(), MakeArray(1, min)), options));
+
+  ASSERT_OK_AND_ASSIGN(auto scalar, MakeScalar(this->type_singleton(), CType(5)));
+  ASSERT_OK_AND_ASSIGN(Datum actual, Negate(scalar));
+  ASSERT_OK_AND_ASSIGN(auto expected, MakeScalar(this->type_singleton(), CType(-5)));
+  AssertScalarsEqual(*expected, *actual.scalar(), /*verbose=*/true);
+}
+
+TYPED_TEST(TestUnaryArithmeticUnsigned, Negate) {
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto max = std::numeric_limits<CType>::max();
+
+  // Unsigned negation wraps around
+  this->AssertUnaryOp("negate", "[]", "[]");
+  this->AssertUnaryOp("negate", MakeArray(0, 1, max), MakeArray(0, max, 1));
+  ArithmeticOptions options;
+  options.check_overflow = true;
+  ASSERT_RAISES(NotImplemented,
+                Negate(ArrayFromJSON(this->type_singleton(), "[1]"), options));
+}
+
+TYPED_TEST(TestUnaryArithmeticFloating, Negate) {
+  for (std::string func : {"negate", "negate_checked"}) {
+    this->AssertUnaryOp(func, "[]", "[]");
+    this->AssertUnaryOp(func, "[1.5, -2.25, null, 0]", "[-1.5, 2.25, null, 0]");
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include "arrow/compute/kernels/common.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_ops.h"
 
 namespace arrow {
@@ -156,6 +157,56 @@ struct Xor {
   }
 };
 
+// Gather the bits of a boolean array at the positions of a selection vector
+// into a contiguous array
+Result<std::shared_ptr<ArrayData>> GatherSelected(KernelContext* ctx,
+                                                  const ArrayData& arr,
+                                                  const SelectionVector& selection) {
+  const int64_t length = selection.length();
+  auto GatherBits = [&](const Buffer& bitmap) -> Result<std::shared_ptr<Buffer>> {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out, ctx->AllocateBitmap(length));
+    const uint8_t* bits = bitmap.data();
+    const int32_t* indices = selection.indices();
+    GenerateBitsUnrolled(out->mutable_data(), 0, length, [&]() -> bool {
+      return BitUtil::GetBit(bits, arr.offset + *indices++);
+    });
+    return out;
+  };
+
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  if (arr.GetNullCount() != 0) {
+    ARROW_ASSIGN_OR_RAISE(validity, GatherBits(*arr.buffers[0]));
+    null_count = kUnknownNullCount;
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data, GatherBits(*arr.buffers[1]));
+  return ArrayData::Make(boolean(), length, {std::move(validity), std::move(data)},
+                         null_count);
+}
+
+// The bitmap operations above work on whole words, so the selected rows of
+// the arguments are gathered before applying them.  Unlike the generic
+// fallback (a "take" of every argument), only the value and validity bits
+// are copied.
+template <void (*Exec)(KernelContext*, const ExecBatch&, Datum*)>
+void ExecSelected(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector == nullptr) {
+    return Exec(ctx, batch, out);
+  }
+  ExecBatch selected(batch.values, batch.length);
+  for (auto& value : selected.values) {
+    if (value.is_array()) {
+      auto maybe_selected = GatherSelected(ctx, *value.array(), *batch.selection_vector);
+      if (!maybe_selected.ok()) {
+        ctx->SetStatus(maybe_selected.status());
+        return;
+      }
+      value = *std::move(maybe_selected);
+    }
+  }
+  Exec(ctx, selected, out);
+}
+
 void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
                   FunctionRegistry* registry, bool can_write_into_slices = true,
                   NullHandling::type null_handling = NullHandling::INTERSECTION) {
@@ -166,6 +217,8 @@ void MakeFunction(std::string name, int arity, ArrayKernelExec exec,
   ScalarKernel kernel(std::move(in_types), boolean(), exec);
   kernel.null_handling = null_handling;
   kernel.can_write_into_slices = can_write_into_slices;
+  // All the kernels are wrapped by ExecSelected
+  kernel.can_use_selection_vector = true;
 
   DCHECK_OK(func->AddKernel(kernel));
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -177,16 +230,18 @@ namespace internal {
 
 void RegisterScalarBoolean(FunctionRegistry* registry) {
   // These functions can write into sliced output bitmaps
-  MakeFunction("invert", 1, applicator::SimpleUnary<Invert>, registry);
-  MakeFunction("and", 2, applicator::SimpleBinary<And>, registry);
-  MakeFunction("or", 2, applicator::SimpleBinary<Or>, registry);
-  MakeFunction("xor", 2, applicator::SimpleBinary<Xor>, registry);
+  MakeFunction("invert", 1, ExecSelected<applicator::SimpleUnary<Invert>>, registry);
+  MakeFunction("and", 2, ExecSelected<applicator::SimpleBinary<And>>, registry);
+  MakeFunction("or", 2, ExecSelected<applicator::SimpleBinary<Or>>, registry);
+  MakeFunction("xor", 2, ExecSelected<applicator::SimpleBinary<Xor>>, registry);
 
   // The Kleene logic kernels cannot write into sliced output bitmaps
-  MakeFunction("and_kleene", 2, applicator::SimpleBinary<KleeneAnd>, registry,
-               /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
-  MakeFunction("or_kleene", 2, applicator::SimpleBinary<KleeneOr>, registry,
-               /*can_write_into_slices=*/false, NullHandling::COMPUTED_PREALLOCATE);
+  MakeFunction("and_kleene", 2, ExecSelected<applicator::SimpleBinary<KleeneAnd>>,
+               registry, /*can_write_into_slices=*/false,
+               NullHandling::COMPUTED_PREALLOCATE);
+  MakeFunction("or_kleene", 2, ExecSelected<applicator::SimpleBinary<KleeneOr>>,
+               registry, /*can_write_into_slices=*/false,
+               NullHandling::COMPUTED_PREALLOCATE);
 }
 
 }  // namespace internal
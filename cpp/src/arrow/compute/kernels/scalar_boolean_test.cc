@@ -24,9 +24,11 @@
 
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 namespace compute {
@@ -208,5 +210,33 @@ TEST_F(TestBooleanKernel, KleeneOr) {
   TestBinaryKernel(KleeneOr, left, right, expected);
 }
 
+TEST_F(TestBooleanKernel, SelectionVector) {
+  auto rand = random::RandomArrayGenerator(0x2b4ef1);
+  const int64_t length = 500;
+  auto indices = rand.Int32(200, 0, static_cast<int32_t>(length - 1));
+  // Sliced arguments exercise non-zero offsets
+  auto lhs = rand.Boolean(length + 3, 0.5, /*null_probability=*/0.1)->Slice(3);
+  auto rhs = rand.Boolean(length, 0.5, /*null_probability=*/0.1);
+  for (std::string func : {"invert", "and", "or", "xor", "and_kleene", "or_kleene"}) {
+    SCOPED_TRACE(func);
+    std::vector<Datum> args = {lhs};
+    if (func != "invert") {
+      args.push_back(rhs);
+    }
+    ExecBatch batch(args, length);
+    batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, batch));
+
+    std::vector<Datum> selected_args;
+    for (const auto& arg : args) {
+      ASSERT_OK_AND_ASSIGN(Datum selected, Take(arg, indices));
+      selected_args.push_back(selected);
+    }
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, selected_args));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
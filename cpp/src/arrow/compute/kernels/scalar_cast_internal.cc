@@ -40,16 +40,31 @@ void DoStaticCast(const void* in_data, int64_t in_offset, int64_t length,
   }
 }
 
+// Like DoStaticCast, for the values at the positions of a selection vector
+template <typename OutT, typename InT>
+ARROW_DISABLE_UBSAN("float-cast-overflow")
+void DoSelectedStaticCast(const ArrayData& input, const SelectionVector& selection,
+                          ArrayData* output) {
+  const InT* in = input.GetValues<InT>(1);
+  const int32_t* indices = selection.indices();
+  OutT* out = output->GetMutableValues<OutT>(1);
+  for (int64_t i = 0; i < output->length; ++i) {
+    out[i] = static_cast<OutT>(in[indices[i]]);
+  }
+}
+
 using StaticCastFunc = std::function<void(const void*, int64_t, int64_t, int64_t, void*)>;
 
 template <typename OutType, typename InType, typename Enable = void>
 struct CastPrimitive {
-  static void Exec(const Datum& input, Datum* out) {
+  static void Exec(const Datum& input, const SelectionVector* selection, Datum* out) {
     using OutT = typename OutType::c_type;
     using InT = typename InType::c_type;
 
     StaticCastFunc caster = DoStaticCast<OutT, InT>;
-    if (input.kind() == Datum::ARRAY) {
+    if (selection != nullptr) {
+      DoSelectedStaticCast<OutT, InT>(*input.array(), *selection, out->mutable_array());
+    } else if (input.kind() == Datum::ARRAY) {
       const ArrayData& arr = *input.array();
       ArrayData* out_arr = out->mutable_array();
       caster(arr.buffers[1]->data(), arr.offset, arr.length, out_arr->offset,
@@ -68,10 +83,12 @@ struct CastPrimitive {
 template <typename OutType, typename InType>
 struct CastPrimitive<OutType, InType, enable_if_t<std::is_same<OutType, InType>::value>> {
   // memcpy output
-  static void Exec(const Datum& input, Datum* out) {
+  static void Exec(const Datum& input, const SelectionVector* selection, Datum* out) {
     using T = typename InType::c_type;
 
-    if (input.kind() == Datum::ARRAY) {
+    if (selection != nullptr) {
+      DoSelectedStaticCast<T, T>(*input.array(), *selection, out->mutable_array());
+    } else if (input.kind() == Datum::ARRAY) {
       const ArrayData& arr = *input.array();
       ArrayData* out_arr = out->mutable_array();
       std::memcpy(
@@ -90,56 +107,57 @@ struct CastPrimitive<OutType, InType, enable_if_t<std::is_same<OutType, InType>:
 };
 
 template <typename InType>
-void CastNumberImpl(Type::type out_type, const Datum& input, Datum* out) {
+void CastNumberImpl(Type::type out_type, const Datum& input,
+                    const SelectionVector* selection, Datum* out) {
   switch (out_type) {
     case Type::INT8:
-      return CastPrimitive<Int8Type, InType>::Exec(input, out);
+      return CastPrimitive<Int8Type, InType>::Exec(input, selection, out);
     case Type::INT16:
-      return CastPrimitive<Int16Type, InType>::Exec(input, out);
+      return CastPrimitive<Int16Type, InType>::Exec(input, selection, out);
     case Type::INT32:
-      return CastPrimitive<Int32Type, InType>::Exec(input, out);
+      return CastPrimitive<Int32Type, InType>::Exec(input, selection, out);
     case Type::INT64:
-      return CastPrimitive<Int64Type, InType>::Exec(input, out);
+      return CastPrimitive<Int64Type, InType>::Exec(input, selection, out);
     case Type::UINT8:
-      return CastPrimitive<UInt8Type, InType>::Exec(input, out);
+      return CastPrimitive<UInt8Type, InType>::Exec(input, selection, out);
     case Type::UINT16:
-      return CastPrimitive<UInt16Type, InType>::Exec(input, out);
+      return CastPrimitive<UInt16Type, InType>::Exec(input, selection, out);
     case Type::UINT32:
-      return CastPrimitive<UInt32Type, InType>::Exec(input, out);
+      return CastPrimitive<UInt32Type, InType>::Exec(input, selection, out);
     case Type::UINT64:
-      return CastPrimitive<UInt64Type, InType>::Exec(input, out);
+      return CastPrimitive<UInt64Type, InType>::Exec(input, selection, out);
     case Type::FLOAT:
-      return CastPrimitive<FloatType, InType>::Exec(input, out);
+      return CastPrimitive<FloatType, InType>::Exec(input, selection, out);
     case Type::DOUBLE:
-      return CastPrimitive<DoubleType, InType>::Exec(input, out);
+      return CastPrimitive<DoubleType, InType>::Exec(input, selection, out);
     default:
       break;
   }
 }
 
 void CastNumberToNumberUnsafe(Type::type in_type, Type::type out_type, const Datum& input,
-                              Datum* out) {
+                              Datum* out, const SelectionVector* selection) {
   switch (in_type) {
     case Type::INT8:
-      return CastNumberImpl<Int8Type>(out_type, input, out);
+      return CastNumberImpl<Int8Type>(out_type, input, selection, out);
     case Type::INT16:
-      return CastNumberImpl<Int16Type>(out_type, input, out);
+      return CastNumberImpl<Int16Type>(out_type, input, selection, out);
     case Type::INT32:
-      return CastNumberImpl<Int32Type>(out_type, input, out);
+      return CastNumberImpl<Int32Type>(out_type, input, selection, out);
     case Type::INT64:
-      return CastNumberImpl<Int64Type>(out_type, input, out);
+      return CastNumberImpl<Int64Type>(out_type, input, selection, out);
     case Type::UINT8:
-      return CastNumberImpl<UInt8Type>(out_type, input, out);
+      return CastNumberImpl<UInt8Type>(out_type, input, selection, out);
     case Type::UINT16:
-      return CastNumberImpl<UInt16Type>(out_type, input, out);
+      return CastNumberImpl<UInt16Type>(out_type, input, selection, out);
     case Type::UINT32:
-      return CastNumberImpl<UInt32Type>(out_type, input, out);
+      return CastNumberImpl<UInt32Type>(out_type, input, selection, out);
     case Type::UINT64:
-      return CastNumberImpl<UInt64Type>(out_type, input, out);
+      return CastNumberImpl<UInt64Type>(out_type, input, selection, out);
     case Type::FLOAT:
-      return CastNumberImpl<FloatType>(out_type, input, out);
+      return CastNumberImpl<FloatType>(out_type, input, selection, out);
     case Type::DOUBLE:
-      return CastNumberImpl<DoubleType>(out_type, input, out);
+      return CastNumberImpl<DoubleType>(out_type, input, selection, out);
     default:
       DCHECK(false);
       break;
@@ -233,6 +251,13 @@ void ZeroCopyCastExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
   }
 }
 
+void AddSelectionCast(Type::type in_type_id, InputType in_ty, OutputType out_ty,
+                      ArrayKernelExec exec, CastFunction* func) {
+  ScalarKernel kernel({std::move(in_ty)}, std::move(out_ty), exec);
+  kernel.can_use_selection_vector = true;
+  DCHECK_OK(func->AddKernel(in_type_id, std::move(kernel)));
+}
+
 void AddZeroCopyCast(Type::type in_type_id, InputType in_type, OutputType out_type,
                      CastFunction* func) {
   auto sig = KernelSignature::Make({in_type}, out_type);
@@ -42,9 +42,10 @@ struct CastFunctor<
 
 void CastFromExtension(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
-// Utility for numeric casts
+// Utility for numeric casts.  If `selection` is given, only the selected rows
+// of the input array are cast, into a compacted output.
 void CastNumberToNumberUnsafe(Type::type in_type, Type::type out_type, const Datum& input,
-                              Datum* out);
+                              Datum* out, const SelectionVector* selection = NULLPTR);
 
 // ----------------------------------------------------------------------
 // Dictionary to other things
@@ -63,6 +64,11 @@ void AddSimpleCast(InputType in_ty, OutputType out_ty, CastFunction* func) {
                             CastFunctor<OutType, InType>::Exec));
 }
 
+// Adds a cast kernel which computes only the rows of a selection vector, see
+// ScalarKernel::can_use_selection_vector
+void AddSelectionCast(Type::type in_type_id, InputType in_ty, OutputType out_ty,
+                      ArrayKernelExec exec, CastFunction* func);
+
 void ZeroCopyCastExec(KernelContext* ctx, const ExecBatch& batch, Datum* out);
 
 void AddZeroCopyCast(Type::type in_type_id, InputType in_type, OutputType out_type,
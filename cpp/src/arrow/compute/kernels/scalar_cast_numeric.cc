@@ -34,7 +34,12 @@ using internal::ParseValue;
 namespace compute {
 namespace internal {
 
+void CastSelectedNumberToNumber(KernelContext* ctx, const ExecBatch& batch, Datum* out);
+
 void CastIntegerToInteger(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    return CastSelectedNumberToNumber(ctx, batch, out);
+  }
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
   if (!options.allow_int_overflow) {
     KERNEL_RETURN_IF_ERROR(ctx, IntegersCanFit(batch[0], *out->type()));
@@ -42,7 +47,10 @@ void CastIntegerToInteger(KernelContext* ctx, const ExecBatch& batch, Datum* out
   CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
 
-void CastFloatingToFloating(KernelContext*, const ExecBatch& batch, Datum* out) {
+void CastFloatingToFloating(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    return CastSelectedNumberToNumber(ctx, batch, out);
+  }
   CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
 }
 
@@ -172,6 +180,9 @@ Status CheckFloatToIntTruncation(const Datum& input, const Datum& output) {
 }
 
 void CastFloatingToInteger(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    return CastSelectedNumberToNumber(ctx, batch, out);
+  }
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
   CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out);
   if (!options.allow_float_truncate) {
@@ -250,6 +261,9 @@ Status CheckForIntegerToFloatingTruncation(const Datum& input, Type::type out_ty
 }
 
 void CastIntegerToFloating(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  if (batch.selection_vector) {
+    return CastSelectedNumberToNumber(ctx, batch, out);
+  }
   const auto& options = checked_cast<const CastState*>(ctx->state())->options;
   Type::type out_type = out->type()->id();
   if (!options.allow_float_truncate) {
@@ -258,6 +272,195 @@ void CastIntegerToFloating(KernelContext* ctx, const ExecBatch& batch, Datum* ou
   CastNumberToNumberUnsafe(batch[0].type()->id(), out_type, batch[0], out);
 }
 
+// ----------------------------------------------------------------------
+// Casts between numbers on the rows of a selection vector
+//
+// The selected values are cast into the compacted output first. The checks
+// above work on whole input arrays, so the selected values are instead checked
+// against their cast value, for the rows which the executor found valid when
+// gathering the output validity.
+
+template <typename T>
+enable_if_t<std::is_signed<T>::value, bool> IsNegative(T val) {
+  return val < 0;
+}
+
+template <typename T>
+enable_if_t<!std::is_signed<T>::value, bool> IsNegative(T) {
+  return false;
+}
+
+template <typename OutType, typename InType, typename InT = typename InType::c_type,
+          typename OutT = typename OutType::c_type>
+struct SelectedCastChecker {
+  template <typename IsLossy, typename GetError>
+  static Status Check(const ArrayData& input, const SelectionVector& selection,
+                      const ArrayData& output, IsLossy&& is_lossy,
+                      GetError&& get_error) {
+    const InT* in_data = input.GetValues<InT>(1);
+    const int32_t* indices = selection.indices();
+    const OutT* out_data = output.GetValues<OutT>(1);
+    const uint8_t* bitmap = output.null_count != 0 && output.buffers[0]
+                                ? output.buffers[0]->data()
+                                : nullptr;
+    for (int64_t i = 0; i < output.length; ++i) {
+      const InT in_val = in_data[indices[i]];
+      if (ARROW_PREDICT_FALSE(is_lossy(in_val, out_data[i])) &&
+          (bitmap == nullptr || BitUtil::GetBit(bitmap, output.offset + i))) {
+        return get_error(in_val);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Between integers: the value must round-trip with the same sign
+  template <typename O = OutType, typename I = InType>
+  static enable_if_t<is_integer_type<O>::value && is_integer_type<I>::value, Status>
+  Check(const CastOptions& options, const ArrayData& input,
+        const SelectionVector& selection, const ArrayData& output) {
+    if (options.allow_int_overflow) {
+      return Status::OK();
+    }
+    return Check(
+        input, selection, output,
+        [](InT in_val, OutT out_val) {
+          return static_cast<InT>(out_val) != in_val ||
+                 IsNegative(in_val) != IsNegative(out_val);
+        },
+        [](InT in_val) {
+          return Status::Invalid("Integer value ", FormatInt(in_val), " not in range: ",
+                                 FormatInt(std::numeric_limits<OutT>::min()), " to ",
+                                 FormatInt(std::numeric_limits<OutT>::max()));
+        });
+  }
+
+  // Integer to floating point: the value must be exactly representable
+  template <typename O = OutType, typename I = InType>
+  static enable_if_t<is_floating_type<O>::value && is_integer_type<I>::value, Status>
+  Check(const CastOptions& options, const ArrayData& input,
+        const SelectionVector& selection, const ArrayData& output) {
+    if (options.allow_float_truncate) {
+      return Status::OK();
+    }
+    const int64_t limit = FloatingIntegerBound<OutT>::value;
+    return Check(
+        input, selection, output,
+        [&](InT in_val, OutT) {
+          return IsNegative(in_val)
+                     ? static_cast<int64_t>(in_val) < -limit
+                     : static_cast<uint64_t>(in_val) > static_cast<uint64_t>(limit);
+        },
+        [&](InT in_val) {
+          return Status::Invalid("Integer value ", FormatInt(in_val), " not in range: ",
+                                 std::is_signed<InT>::value ? -limit : 0, " to ", limit);
+        });
+  }
+
+  // Floating point to integer: the value must round-trip
+  template <typename O = OutType, typename I = InType>
+  static enable_if_t<is_integer_type<O>::value && is_floating_type<I>::value, Status>
+  Check(const CastOptions& options, const ArrayData& input,
+        const SelectionVector& selection, const ArrayData& output) {
+    if (options.allow_float_truncate) {
+      return Status::OK();
+    }
+    return Check(
+        input, selection, output,
+        [](InT in_val, OutT out_val) { return static_cast<InT>(out_val) != in_val; },
+        [&](InT in_val) {
+          return Status::Invalid("Float value ", FormatInt(in_val),
+                                 " was truncated converting to", *output.type);
+        });
+  }
+
+  // Between floating point types
+  template <typename O = OutType, typename I = InType>
+  static enable_if_t<is_floating_type<O>::value && is_floating_type<I>::value, Status>
+  Check(const CastOptions&, const ArrayData&, const SelectionVector&, const ArrayData&) {
+    return Status::OK();
+  }
+};
+
+template <typename InType>
+Status CheckSelectedCastImpl(const CastOptions& options, const ArrayData& input,
+                             const SelectionVector& selection, const ArrayData& output) {
+  switch (output.type->id()) {
+    case Type::INT8:
+      return SelectedCastChecker<Int8Type, InType>::Check(options, input, selection,
+                                                          output);
+    case Type::INT16:
+      return SelectedCastChecker<Int16Type, InType>::Check(options, input, selection,
+                                                           output);
+    case Type::INT32:
+      return SelectedCastChecker<Int32Type, InType>::Check(options, input, selection,
+                                                           output);
+    case Type::INT64:
+      return SelectedCastChecker<Int64Type, InType>::Check(options, input, selection,
+                                                           output);
+    case Type::UINT8:
+      return SelectedCastChecker<UInt8Type, InType>::Check(options, input, selection,
+                                                           output);
+    case Type::UINT16:
+      return SelectedCastChecker<UInt16Type, InType>::Check(options, input, selection,
+                                                            output);
+    case Type::UINT32:
+      return SelectedCastChecker<UInt32Type, InType>::Check(options, input, selection,
+                                                            output);
+    case Type::UINT64:
+      return SelectedCastChecker<UInt64Type, InType>::Check(options, input, selection,
+                                                            output);
+    case Type::FLOAT:
+      return SelectedCastChecker<FloatType, InType>::Check(options, input, selection,
+                                                           output);
+    case Type::DOUBLE:
+      return SelectedCastChecker<DoubleType, InType>::Check(options, input, selection,
+                                                            output);
+    default:
+      break;
+  }
+  DCHECK(false);
+  return Status::OK();
+}
+
+Status CheckSelectedCast(const CastOptions& options, const ArrayData& input,
+                         const SelectionVector& selection, const ArrayData& output) {
+  switch (input.type->id()) {
+    case Type::INT8:
+      return CheckSelectedCastImpl<Int8Type>(options, input, selection, output);
+    case Type::INT16:
+      return CheckSelectedCastImpl<Int16Type>(options, input, selection, output);
+    case Type::INT32:
+      return CheckSelectedCastImpl<Int32Type>(options, input, selection, output);
+    case Type::INT64:
+      return CheckSelectedCastImpl<Int64Type>(options, input, selection, output);
+    case Type::UINT8:
+      return CheckSelectedCastImpl<UInt8Type>(options, input, selection, output);
+    case Type::UINT16:
+      return CheckSelectedCastImpl<UInt16Type>(options, input, selection, output);
+    case Type::UINT32:
+      return CheckSelectedCastImpl<UInt32Type>(options, input, selection, output);
+    case Type::UINT64:
+      return CheckSelectedCastImpl<UInt64Type>(options, input, selection, output);
+    case Type::FLOAT:
+      return CheckSelectedCastImpl<FloatType>(options, input, selection, output);
+    case Type::DOUBLE:
+      return CheckSelectedCastImpl<DoubleType>(options, input, selection, output);
+    default:
+      break;
+  }
+  DCHECK(false);
+  return Status::OK();
+}
+
+void CastSelectedNumberToNumber(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& options = checked_cast<const CastState*>(ctx->state())->options;
+  CastNumberToNumberUnsafe(batch[0].type()->id(), out->type()->id(), batch[0], out,
+                           batch.selection_vector.get());
+  KERNEL_RETURN_IF_ERROR(ctx, CheckSelectedCast(options, *batch[0].array(),
+                                                *batch.selection_vector,
+                                                *out->array()));
+}
+
 // ----------------------------------------------------------------------
 // Boolean to number
 
@@ -538,8 +741,8 @@ void AddCommonNumberCasts(const std::shared_ptr<DataType>& out_ty, CastFunction*
   AddCommonCasts(out_ty->id(), out_ty, func);
 
   // Cast from boolean to number
-  DCHECK_OK(func->AddKernel(Type::BOOL, {boolean()}, out_ty,
-                            CastFunctor<OutType, BooleanType>::Exec));
+  AddSelectionCast(Type::BOOL, boolean(), out_ty, CastFunctor<OutType, BooleanType>::Exec,
+                   func);
 
   // Cast from other strings
   for (const std::shared_ptr<DataType>& in_ty : BaseBinaryTypes()) {
@@ -554,12 +757,12 @@ std::shared_ptr<CastFunction> GetCastToInteger(std::string name) {
   auto out_ty = TypeTraits<OutType>::type_singleton();
 
   for (const std::shared_ptr<DataType>& in_ty : IntTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastIntegerToInteger));
+    AddSelectionCast(in_ty->id(), in_ty, out_ty, CastIntegerToInteger, func.get());
   }
 
   // Cast from floating point
   for (const std::shared_ptr<DataType>& in_ty : FloatingPointTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastFloatingToInteger));
+    AddSelectionCast(in_ty->id(), in_ty, out_ty, CastFloatingToInteger, func.get());
   }
 
   // From other numbers to integer
@@ -578,12 +781,12 @@ std::shared_ptr<CastFunction> GetCastToFloating(std::string name) {
 
   // Casts from integer to floating point
   for (const std::shared_ptr<DataType>& in_ty : IntTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastIntegerToFloating));
+    AddSelectionCast(in_ty->id(), in_ty, out_ty, CastIntegerToFloating, func.get());
   }
 
   // Cast from floating point
   for (const std::shared_ptr<DataType>& in_ty : FloatingPointTypes()) {
-    DCHECK_OK(func->AddKernel(in_ty->id(), {in_ty}, out_ty, CastFloatingToFloating));
+    AddSelectionCast(in_ty->id(), in_ty, out_ty, CastFloatingToFloating, func.get());
   }
 
   // From other numbers to floating point
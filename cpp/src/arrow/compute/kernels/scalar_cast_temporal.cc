@@ -38,20 +38,46 @@ constexpr int64_t kMillisecondsInDay = 86400000;
 // ----------------------------------------------------------------------
 // From one timestamp to another
 
-template <typename in_type, typename out_type>
-void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
-               const int64_t factor, const ArrayData& input, ArrayData* output) {
+// The validity of the rows being cast.  With a selection vector, it is read
+// from the output, where the executor gathered the validity of the selected rows.
+struct CastValidity {
+  CastValidity(const ArrayData& input, const SelectionVector* selection,
+               const ArrayData& output) {
+    const ArrayData& data = selection != nullptr ? output : input;
+    if (data.null_count != 0 && data.buffers[0] != nullptr) {
+      bitmap = data.buffers[0]->data();
+      offset = data.offset;
+    }
+  }
+
+  // Null if all rows are valid
+  const uint8_t* bitmap = nullptr;
+  int64_t offset = 0;
+};
+
+// The values at the positions of a selection vector
+template <typename T>
+struct SelectedValues {
+  const T* values;
+  const int32_t* indices;
+  T operator[](int64_t i) const { return values[indices[i]]; }
+};
+
+template <typename out_type, typename InValues>
+void ShiftTimeImpl(KernelContext* ctx, const util::DivideOrMultiply factor_op,
+                   const int64_t factor, const ArrayData& input, InValues in_data,
+                   const CastValidity& validity, ArrayData* output) {
   const CastOptions& options = checked_cast<const CastState&>(*ctx->state()).options;
-  const in_type* in_data = input.GetValues<in_type>(1);
   auto out_data = output->GetMutableValues<out_type>(1);
+  const int64_t length = output->length;
 
   if (factor == 1) {
-    for (int64_t i = 0; i < input.length; i++) {
+    for (int64_t i = 0; i < length; i++) {
       out_data[i] = static_cast<out_type>(in_data[i]);
     }
   } else if (factor_op == util::MULTIPLY) {
     if (options.allow_time_overflow) {
-      for (int64_t i = 0; i < input.length; i++) {
+      for (int64_t i = 0; i < length; i++) {
         out_data[i] = static_cast<out_type>(in_data[i] * factor);
       }
     } else {
@@ -62,9 +88,9 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
 
       int64_t max_val = std::numeric_limits<int64_t>::max() / factor;
       int64_t min_val = std::numeric_limits<int64_t>::min() / factor;
-      if (input.null_count != 0) {
-        BitmapReader bit_reader(input.buffers[0]->data(), input.offset, input.length);
-        for (int64_t i = 0; i < input.length; i++) {
+      if (validity.bitmap != nullptr) {
+        BitmapReader bit_reader(validity.bitmap, validity.offset, length);
+        for (int64_t i = 0; i < length; i++) {
           if (bit_reader.IsSet() && (in_data[i] < min_val || in_data[i] > max_val)) {
             RAISE_OVERFLOW_CAST(in_data[i]);
             break;
@@ -73,7 +99,7 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
           bit_reader.Next();
         }
       } else {
-        for (int64_t i = 0; i < input.length; i++) {
+        for (int64_t i = 0; i < length; i++) {
           if (in_data[i] < min_val || in_data[i] > max_val) {
             RAISE_OVERFLOW_CAST(in_data[i]);
             break;
@@ -86,7 +112,7 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
     }
   } else {
     if (options.allow_time_truncate) {
-      for (int64_t i = 0; i < input.length; i++) {
+      for (int64_t i = 0; i < length; i++) {
         out_data[i] = static_cast<out_type>(in_data[i] / factor);
       }
     } else {
@@ -94,9 +120,9 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
   ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
                                  output->type->ToString(), " would lose data: ", VAL));
 
-      if (input.null_count != 0) {
-        BitmapReader bit_reader(input.buffers[0]->data(), input.offset, input.length);
-        for (int64_t i = 0; i < input.length; i++) {
+      if (validity.bitmap != nullptr) {
+        BitmapReader bit_reader(validity.bitmap, validity.offset, length);
+        for (int64_t i = 0; i < length; i++) {
           out_data[i] = static_cast<out_type>(in_data[i] / factor);
           if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
             RAISE_INVALID_CAST(in_data[i]);
@@ -105,7 +131,7 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
           bit_reader.Next();
         }
       } else {
-        for (int64_t i = 0; i < input.length; i++) {
+        for (int64_t i = 0; i < length; i++) {
           out_data[i] = static_cast<out_type>(in_data[i] / factor);
           if (out_data[i] * factor != in_data[i]) {
             RAISE_INVALID_CAST(in_data[i]);
@@ -119,6 +145,20 @@ void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
   }
 }
 
+template <typename in_type, typename out_type>
+void ShiftTime(KernelContext* ctx, const util::DivideOrMultiply factor_op,
+               const int64_t factor, const ArrayData& input,
+               const SelectionVector* selection, ArrayData* output) {
+  const CastValidity validity(input, selection, *output);
+  if (selection != nullptr) {
+    SelectedValues<in_type> in_data{input.GetValues<in_type>(1), selection->indices()};
+    ShiftTimeImpl<out_type>(ctx, factor_op, factor, input, in_data, validity, output);
+  } else {
+    ShiftTimeImpl<out_type>(ctx, factor_op, factor, input, input.GetValues<in_type>(1),
+                            validity, output);
+  }
+}
+
 // <TimestampType, TimestampType> and <DurationType, DurationType>
 template <typename O, typename I>
 struct CastFunctor<
@@ -140,7 +180,8 @@ struct CastFunctor<
     // lengths to make this zero copy in the future but we leave it for now
 
     auto conversion = util::GetTimestampConversion(in_type.unit(), out_type.unit());
-    ShiftTime<int64_t, int64_t>(ctx, conversion.first, conversion.second, input, output);
+    ShiftTime<int64_t, int64_t>(ctx, conversion.first, conversion.second, input,
+                                batch.selection_vector.get(), output);
   }
 };
 
@@ -163,7 +204,8 @@ struct CastFunctor<Date32Type, TimestampType> {
     };
 
     const int64_t factor = kTimestampToDateFactors[static_cast<int>(in_type.unit())];
-    ShiftTime<int64_t, int32_t>(ctx, util::DIVIDE, factor, input, output);
+    ShiftTime<int64_t, int32_t>(ctx, util::DIVIDE, factor, input,
+                                batch.selection_vector.get(), output);
   }
 };
 
@@ -179,18 +221,20 @@ struct CastFunctor<Date64Type, TimestampType> {
     const auto& in_type = checked_cast<const TimestampType&>(*input.type);
 
     auto conversion = util::GetTimestampConversion(in_type.unit(), TimeUnit::MILLI);
-    ShiftTime<int64_t, int64_t>(ctx, conversion.first, conversion.second, input, output);
+    ShiftTime<int64_t, int64_t>(ctx, conversion.first, conversion.second, input,
+                                batch.selection_vector.get(), output);
     if (!ctx->status().ok()) {
       return;
     }
 
     // Ensure that intraday milliseconds have been zeroed out
     auto out_data = output->GetMutableValues<int64_t>(1);
+    const CastValidity validity(input, batch.selection_vector.get(), *output);
 
-    if (input.null_count != 0) {
-      BitmapReader bit_reader(input.buffers[0]->data(), input.offset, input.length);
+    if (validity.bitmap != nullptr) {
+      BitmapReader bit_reader(validity.bitmap, validity.offset, output->length);
 
-      for (int64_t i = 0; i < input.length; ++i) {
+      for (int64_t i = 0; i < output->length; ++i) {
         const int64_t remainder = out_data[i] % kMillisecondsInDay;
         if (ARROW_PREDICT_FALSE(!options.allow_time_truncate && bit_reader.IsSet() &&
                                 remainder > 0)) {
@@ -202,7 +246,7 @@ struct CastFunctor<Date64Type, TimestampType> {
         bit_reader.Next();
       }
     } else {
-      for (int64_t i = 0; i < input.length; ++i) {
+      for (int64_t i = 0; i < output->length; ++i) {
         const int64_t remainder = out_data[i] % kMillisecondsInDay;
         if (ARROW_PREDICT_FALSE(!options.allow_time_truncate && remainder > 0)) {
           ctx->SetStatus(
@@ -235,7 +279,8 @@ struct CastFunctor<O, I, enable_if_t<is_time_type<I>::value && is_time_type<O>::
     const auto& out_type = checked_cast<const O&>(*output->type);
     DCHECK_NE(in_type.unit(), out_type.unit()) << "Do not cast equal types";
     auto conversion = util::GetTimestampConversion(in_type.unit(), out_type.unit());
-    ShiftTime<in_t, out_t>(ctx, conversion.first, conversion.second, input, output);
+    ShiftTime<in_t, out_t>(ctx, conversion.first, conversion.second, input,
+                           batch.selection_vector.get(), output);
   }
 };
 
@@ -249,7 +294,8 @@ struct CastFunctor<Date64Type, Date32Type> {
     DCHECK_EQ(batch[0].kind(), Datum::ARRAY);
 
     ShiftTime<int32_t, int64_t>(ctx, util::MULTIPLY, kMillisecondsInDay,
-                                *batch[0].array(), out->mutable_array());
+                                *batch[0].array(), batch.selection_vector.get(),
+                                out->mutable_array());
   }
 };
 
@@ -260,7 +306,7 @@ struct CastFunctor<Date32Type, Date64Type> {
     DCHECK_EQ(batch[0].kind(), Datum::ARRAY);
 
     ShiftTime<int64_t, int32_t>(ctx, util::DIVIDE, kMillisecondsInDay, *batch[0].array(),
-                                out->mutable_array());
+                                batch.selection_vector.get(), out->mutable_array());
   }
 };
 
@@ -294,12 +340,16 @@ struct CastFunctor<TimestampType, I, enable_if_t<is_base_binary_type<I>::value>>
   }
 };
 
+// The unit conversions all compute only the rows of a selection vector
+template <typename InType, typename OutType>
+void AddUnitCast(InputType in_ty, OutputType out_ty, CastFunction* func) {
+  AddSelectionCast(InType::type_id, std::move(in_ty), std::move(out_ty),
+                   CastFunctor<OutType, InType>::Exec, func);
+}
+
 template <typename Type>
 void AddCrossUnitCast(CastFunction* func) {
-  ScalarKernel kernel;
-  kernel.exec = CastFunctor<Type, Type>::Exec;
-  kernel.signature = KernelSignature::Make({InputType(Type::type_id)}, kOutputTargetType);
-  DCHECK_OK(func->AddKernel(Type::type_id, std::move(kernel)));
+  AddUnitCast<Type, Type>(InputType(Type::type_id), kOutputTargetType, func);
 }
 
 std::shared_ptr<CastFunction> GetDate32Cast() {
@@ -311,11 +361,11 @@ std::shared_ptr<CastFunction> GetDate32Cast() {
   AddZeroCopyCast(Type::INT32, int32(), date32(), func.get());
 
   // date64 -> date32
-  AddSimpleCast<Date64Type, Date32Type>(date64(), date32(), func.get());
+  AddUnitCast<Date64Type, Date32Type>(date64(), date32(), func.get());
 
   // timestamp -> date32
-  AddSimpleCast<TimestampType, Date32Type>(InputType(Type::TIMESTAMP), date32(),
-                                           func.get());
+  AddUnitCast<TimestampType, Date32Type>(InputType(Type::TIMESTAMP), date32(),
+                                         func.get());
   return func;
 }
 
@@ -328,11 +378,11 @@ std::shared_ptr<CastFunction> GetDate64Cast() {
   AddZeroCopyCast(Type::INT64, int64(), date64(), func.get());
 
   // date32 -> date64
-  AddSimpleCast<Date32Type, Date64Type>(date32(), date64(), func.get());
+  AddUnitCast<Date32Type, Date64Type>(date32(), date64(), func.get());
 
   // timestamp -> date64
-  AddSimpleCast<TimestampType, Date64Type>(InputType(Type::TIMESTAMP), date64(),
-                                           func.get());
+  AddUnitCast<TimestampType, Date64Type>(InputType(Type::TIMESTAMP), date64(),
+                                         func.get());
 
   return func;
 }
@@ -363,8 +413,8 @@ std::shared_ptr<CastFunction> GetTime32Cast() {
   AddZeroCopyCast(Type::INT32, /*in_type=*/int32(), kOutputTargetType, func.get());
 
   // time64 -> time32
-  AddSimpleCast<Time64Type, Time32Type>(InputType(Type::TIME64), kOutputTargetType,
-                                        func.get());
+  AddUnitCast<Time64Type, Time32Type>(InputType(Type::TIME64), kOutputTargetType,
+                                      func.get());
 
   // time32 -> time32
   AddCrossUnitCast<Time32Type>(func.get());
@@ -380,8 +430,8 @@ std::shared_ptr<CastFunction> GetTime64Cast() {
   AddZeroCopyCast(Type::INT64, /*in_type=*/int64(), kOutputTargetType, func.get());
 
   // time32 -> time64
-  AddSimpleCast<Time32Type, Time64Type>(InputType(Type::TIME32), kOutputTargetType,
-                                        func.get());
+  AddUnitCast<Time32Type, Time64Type>(InputType(Type::TIME32), kOutputTargetType,
+                                      func.get());
 
   // Between durations
   AddCrossUnitCast<Time64Type>(func.get());
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -1457,6 +1458,99 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+// Cast the selected rows of an array, and compare to casting them once taken
+void CheckSelectedCast(const std::shared_ptr<Array>& input,
+                       const std::shared_ptr<Array>& indices,
+                       const std::shared_ptr<DataType>& out_type,
+                       const CastOptions& options) {
+  ExecBatch batch({input}, input->length());
+  batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+  CastOptions cast_options = options;
+  cast_options.to_type = out_type;
+  ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("cast", batch, &cast_options));
+
+  ASSERT_OK_AND_ASSIGN(Datum selected, Take(input, indices));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Cast(selected, out_type, options));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertDatumsEqual(expected, actual, /*verbose=*/true);
+
+  // The selection is pushed down into the cast kernel
+  ASSERT_OK_AND_ASSIGN(auto cast_func, GetCastFunction(out_type));
+  ASSERT_OK_AND_ASSIGN(auto kernel, cast_func->DispatchExact({input->type()}));
+  ASSERT_TRUE(kernel->can_use_selection_vector);
+}
+
+TEST_F(TestCast, SelectionVector) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 200;
+  auto indices = rand.Int32(50, 0, static_cast<int32_t>(length - 1));
+
+  CastOptions options = CastOptions::Unsafe();
+  for (const auto& in_type : kNumericTypes) {
+    auto input = rand.ArrayOf(in_type, length, /*null_probability=*/0.2);
+    for (const auto& out_type : kNumericTypes) {
+      SCOPED_TRACE(in_type->ToString() + " -> " + out_type->ToString());
+      CheckSelectedCast(input, indices, out_type, options);
+    }
+  }
+  auto booleans = rand.Boolean(length, /*true_probability=*/0.5, 0.2);
+  CheckSelectedCast(booleans, indices, int32(), options);
+  CheckSelectedCast(booleans, indices, float64(), options);
+
+  // Temporal casts, with values which convert safely
+  options = CastOptions::Safe();
+  auto seconds = rand.Int64(length, -1000000, 1000000, 0.2);
+  auto days = rand.Int32(length, -10000, 10000, 0.2);
+  ASSERT_OK_AND_ASSIGN(auto timestamps, seconds->View(timestamp(TimeUnit::SECOND)));
+  CheckSelectedCast(timestamps, indices, timestamp(TimeUnit::NANO), options);
+  ASSERT_OK_AND_ASSIGN(auto durations, seconds->View(duration(TimeUnit::SECOND)));
+  CheckSelectedCast(durations, indices, duration(TimeUnit::MILLI), options);
+  ASSERT_OK_AND_ASSIGN(auto times, days->View(time32(TimeUnit::SECOND)));
+  CheckSelectedCast(times, indices, time32(TimeUnit::MILLI), options);
+  CheckSelectedCast(times, indices, time64(TimeUnit::MICRO), options);
+  ASSERT_OK_AND_ASSIGN(auto dates, days->View(date32()));
+  CheckSelectedCast(dates, indices, date64(), options);
+  ASSERT_OK_AND_ASSIGN(auto dates64, Cast(*dates, date64(), options));
+  CheckSelectedCast(dates64, indices, date32(), options);
+  ASSERT_OK_AND_ASSIGN(auto day_timestamps, dates64->View(timestamp(TimeUnit::MILLI)));
+  CheckSelectedCast(day_timestamps, indices, date32(), options);
+  CheckSelectedCast(day_timestamps, indices, date64(), options);
+}
+
+TEST_F(TestCast, SelectionVectorChecks) {
+  // Only the selected, valid rows are checked
+  auto indices = ArrayFromJSON(int32(), "[0, 2]");
+  auto ints = ArrayFromJSON(int32(), "[1, 1000, 2, 1000]");
+  CheckSelectedCast(ints, indices, int8(), CastOptions::Safe());
+  auto floats = ArrayFromJSON(float64(), "[1, 1.5, 2, 2.5]");
+  CheckSelectedCast(floats, indices, int64(), CastOptions::Safe());
+  auto big_ints = ArrayFromJSON(int64(), "[1, 9007199254740993, 2]");
+  CheckSelectedCast(big_ints, indices, float64(), CastOptions::Safe());
+  ASSERT_OK_AND_ASSIGN(auto timestamps, ArrayFromJSON(int64(), "[1000, 1001, 2000]")
+                                            ->View(timestamp(TimeUnit::MILLI)));
+  CheckSelectedCast(timestamps, indices, timestamp(TimeUnit::SECOND),
+                    CastOptions::Safe());
+
+  ints = ArrayFromJSON(int32(), "[1, 1000, 2, null]");
+  indices = ArrayFromJSON(int32(), "[3, 0]");
+  CheckSelectedCast(ints, indices, int8(), CastOptions::Safe());
+
+  // A selected row which doesn't convert safely
+  indices = ArrayFromJSON(int32(), "[0, 1]");
+  std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<DataType>>> cases = {
+      {ints, int8()},
+      {floats, int64()},
+      {big_ints, float64()},
+      {timestamps, timestamp(TimeUnit::SECOND)}};
+  for (const auto& input_and_type : cases) {
+    ExecBatch batch({input_and_type.first}, input_and_type.first->length());
+    batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+    auto options = CastOptions::Safe();
+    options.to_type = input_and_type.second;
+    ASSERT_RAISES(Invalid, CallFunction("cast", batch, &options));
+  }
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   std::vector<bool> is_valid = {true, false, true, true, true};
   std::vector<int32_t> v1 = {0, 1, 2, 3, 4};
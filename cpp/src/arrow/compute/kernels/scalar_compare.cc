@@ -58,27 +58,36 @@ struct GreaterEqual {
 
 // Implement Less, LessEqual by flipping arguments to Greater, GreaterEqual
 
+// The compare kernels are all generated by ScalarBinary, which can compute
+// only the rows of a selection vector
+void AddCompareKernel(std::vector<InputType> in_types, ArrayKernelExec exec,
+                      ScalarFunction* func) {
+  ScalarKernel kernel(std::move(in_types), boolean(), std::move(exec));
+  kernel.can_use_selection_vector = true;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
 template <typename Op>
 void AddIntegerCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   auto exec =
       GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-  DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+  AddCompareKernel({ty, ty}, std::move(exec), func);
 }
 
 template <typename InType, typename Op>
 void AddGenericCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
-  DCHECK_OK(
-      func->AddKernel({ty, ty}, boolean(),
-                      applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec));
+  AddCompareKernel(
+      {ty, ty}, applicator::ScalarBinaryEqualTypes<BooleanType, InType, Op>::Exec, func);
 }
 
 template <typename Op>
 std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
   auto func = std::make_shared<ScalarFunction>(name, Arity::Binary());
 
-  DCHECK_OK(func->AddKernel(
-      {boolean(), boolean()}, boolean(),
-      applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
+  AddCompareKernel(
+      {boolean(), boolean()},
+      applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec,
+      func.get());
 
   for (const std::shared_ptr<DataType>& ty : IntTypes()) {
     AddIntegerCompare<Op>(ty, func.get());
@@ -95,7 +104,7 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    AddCompareKernel({in_type, in_type}, std::move(exec), func.get());
   }
 
   // Duration
@@ -104,7 +113,7 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    AddCompareKernel({in_type, in_type}, std::move(exec), func.get());
   }
 
   // Time32 and Time64
@@ -113,20 +122,32 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name) {
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int32());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    AddCompareKernel({in_type, in_type}, std::move(exec), func.get());
   }
   for (auto unit : {TimeUnit::MICRO, TimeUnit::NANO}) {
     InputType in_type(match::Time64TypeUnit(unit));
     auto exec =
         GeneratePhysicalInteger<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
             int64());
-    DCHECK_OK(func->AddKernel({in_type, in_type}, boolean(), std::move(exec)));
+    AddCompareKernel({in_type, in_type}, std::move(exec), func.get());
   }
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
     auto exec =
         GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+    AddCompareKernel({ty, ty}, std::move(exec), func.get());
+  }
+
+  // Dictionary arrays compared with scalars are compared once per dictionary
+  // value; the boolean results are then gathered through the indices
+  auto dict_exec = MakeDictionaryExec(name);
+  InputType dict_array = InputType::Array(Type::DICTIONARY);
+  for (auto in_types : {std::vector<InputType>{dict_array, InputType()},
+                        std::vector<InputType>{InputType(), dict_array}}) {
+    ScalarKernel kernel(std::move(in_types), boolean(), dict_exec);
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
 
   return func;
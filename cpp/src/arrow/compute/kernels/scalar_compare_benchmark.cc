@@ -19,7 +19,9 @@
 
 #include <vector>
 
+#include "arrow/array/array_dict.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -54,6 +56,32 @@ static void CompareArrayArray(benchmark::State& state) {
   }
 }
 
+// Compare a dictionary<int32, string> array, or the equivalent decoded string
+// array, with a scalar
+static void EqualArrayScalarDictionary(benchmark::State& state, bool decode) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int32_t dict_length = 100;
+  auto dict = rand.String(dict_length, 1, 16, /*null_probability=*/0);
+  auto indices = rand.Int32(args.size, 0, dict_length - 1, args.null_proportion);
+  auto array = *DictionaryArray::FromArrays(dictionary(int32(), utf8()), indices, dict);
+  if (decode) {
+    array = *Take(*dict, *indices);
+  }
+  auto scalar = *dict->GetScalar(0);
+  for (auto _ : state) {
+    ABORT_NOT_OK(Compare(array, Datum(scalar), CompareOptions(EQUAL)).status());
+  }
+}
+
+static void EqualArrayScalarDictionaryString(benchmark::State& state) {
+  EqualArrayScalarDictionary(state, /*decode=*/false);
+}
+
+static void EqualArrayScalarDecodedString(benchmark::State& state) {
+  EqualArrayScalarDictionary(state, /*decode=*/true);
+}
+
 static void GreaterArrayArrayInt64(benchmark::State& state) {
   CompareArrayArray<GREATER, Int64Type>(state);
 }
@@ -76,5 +104,8 @@ BENCHMARK(GreaterArrayScalarInt64)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayArrayString)->Apply(RegressionSetArgs);
 BENCHMARK(GreaterArrayScalarString)->Apply(RegressionSetArgs);
 
+BENCHMARK(EqualArrayScalarDictionaryString)->Apply(RegressionSetArgs);
+BENCHMARK(EqualArrayScalarDecodedString)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
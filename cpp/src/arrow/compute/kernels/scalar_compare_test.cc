@@ -567,5 +567,78 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST(TestCompareKernel, DictionaryArrayScalar) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["b", "a", "c", "d"])");
+  std::shared_ptr<Array> input = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int32(), "[0, 1, null, 2, 3, 0, 1]"), dict);
+  std::shared_ptr<Scalar> scalar = std::make_shared<StringScalar>("b");
+
+  auto check = [](const std::string& func, const Datum& lhs, const Datum& rhs,
+                  const std::string& expected_json) {
+    SCOPED_TRACE(func);
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {lhs, rhs}));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected_json), *actual.make_array(),
+                      /*verbose=*/true);
+  };
+  check("equal", input, scalar, "[true, false, null, false, false, true, false]");
+  check("equal", scalar, input, "[true, false, null, false, false, true, false]");
+  check("not_equal", input, scalar, "[false, true, null, true, true, false, true]");
+  check("greater", input, scalar, "[false, false, null, true, true, false, false]");
+  check("less", input, scalar, "[false, true, null, false, false, false, true]");
+  check("less", scalar, input, "[false, false, null, true, true, false, false]");
+  check("greater_equal", scalar, input, "[true, true, null, false, false, true, true]");
+
+  // Null scalar
+  check("equal", input, MakeNullScalar(utf8()),
+        "[null, null, null, null, null, null, null]");
+
+  // Dictionary longer than the indices: values are decoded instead
+  check("equal", input->Slice(0, 2), scalar, "[true, false]");
+
+  // Dictionary compared against an array
+  auto other = ArrayFromJSON(utf8(), R"(["b", "b", "b", "c", "a", null, "a"])");
+  check("equal", input, other, "[true, false, null, true, false, null, true]");
+  check("less", other, input, "[false, false, null, false, true, null, false]");
+}
+
+TEST(TestCompareKernel, SelectionVector) {
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  const int64_t length = 500;
+  auto indices = rand.Int32(200, 0, static_cast<int32_t>(length - 1));
+  for (const auto& type : {boolean(), int32(), float64(), utf8(), large_binary()}) {
+    SCOPED_TRACE(type->ToString());
+    auto lhs = rand.ArrayOf(type, length, /*null_probability=*/0.1);
+    auto rhs = rand.ArrayOf(type, length, /*null_probability=*/0.1);
+    int64_t scalar_index = 0;
+    while (rhs->IsNull(scalar_index)) {
+      ++scalar_index;
+    }
+    ASSERT_OK_AND_ASSIGN(auto scalar, rhs->GetScalar(scalar_index));
+    for (std::string func : {"equal", "greater", "less_equal"}) {
+      for (const std::vector<Datum>& args : std::vector<std::vector<Datum>>{
+               {lhs, rhs}, {lhs, scalar}, {scalar, rhs}}) {
+        ExecBatch batch(args, length);
+        batch.selection_vector = std::make_shared<SelectionVector>(*indices);
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, batch));
+
+        std::vector<Datum> selected_args;
+        for (const auto& arg : args) {
+          if (arg.is_array()) {
+            ASSERT_OK_AND_ASSIGN(Datum selected, Take(arg, indices));
+            selected_args.push_back(selected);
+          } else {
+            selected_args.push_back(arg);
+          }
+        }
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(func, selected_args));
+        ASSERT_OK(actual.make_array()->ValidateFull());
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -395,6 +395,22 @@ void AddBasicSetLookupKernels(ScalarKernel kernel,
   }
 }
 
+// Dictionary arrays are looked up once per dictionary value; the results are
+// then gathered through the indices
+ScalarKernel MakeDictionarySetLookupKernel(std::string func_name,
+                                           std::shared_ptr<DataType> out_ty) {
+  using SetLookupOptionsState = OptionsWrapper<SetLookupOptions>;
+  ScalarKernel kernel({InputType::Array(Type::DICTIONARY)}, std::move(out_ty),
+                      MakeDictionaryExec(std::move(func_name),
+                                         [](KernelContext* ctx) {
+                                           return &SetLookupOptionsState::Get(ctx);
+                                         }),
+                      SetLookupOptionsState::Init);
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  return kernel;
+}
+
 }  // namespace
 
 void RegisterScalarSetLookup(FunctionRegistry* registry) {
@@ -410,6 +426,8 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
     isin_base.signature = KernelSignature::Make({null()}, boolean());
     isin_base.null_handling = NullHandling::COMPUTED_PREALLOCATE;
     DCHECK_OK(isin->AddKernel(isin_base));
+
+    DCHECK_OK(isin->AddKernel(MakeDictionarySetLookupKernel("isin", boolean())));
     DCHECK_OK(registry->AddFunction(isin));
   }
 
@@ -425,6 +443,8 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     match_base.signature = KernelSignature::Make({null()}, int32());
     DCHECK_OK(match->AddKernel(match_base));
+
+    DCHECK_OK(match->AddKernel(MakeDictionarySetLookupKernel("match", int32())));
     DCHECK_OK(registry->AddFunction(match));
   }
 }
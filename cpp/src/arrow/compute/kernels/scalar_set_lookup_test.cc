@@ -405,6 +405,32 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
 
   AssertChunkedEquivalent(*expected_carr, *encoded_out.chunked_array());
 }
+TEST_F(TestIsInKernel, IsInDictionary) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", null, "baz"])");
+  auto input = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int32(), "[0, 1, 2, 3, null, 1, 0]"), dict);
+  auto value_set = ArrayFromJSON(utf8(), R"(["bar", "quux", null])");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, IsIn(input, value_set));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[false, true, true, false, true, true, false]"),
+      *out.make_array(), /*verbose=*/true);
+
+  // Dictionary longer than the indices: values are decoded instead
+  ASSERT_OK_AND_ASSIGN(out, IsIn(input->Slice(4, 2), value_set));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true]"), *out.make_array(),
+                    /*verbose=*/true);
+
+  // Chunked input
+  auto chunked = *ChunkedArray::Make({input->Slice(0, 3), input->Slice(3)});
+  ASSERT_OK_AND_ASSIGN(out, IsIn(chunked, value_set));
+  AssertChunkedEquivalent(
+      *ChunkedArrayFromJSON(boolean(), {"[false, true, true, false, true, true, false]"}),
+      *out.chunked_array());
+}
+
 // ----------------------------------------------------------------------
 // Match tests
 
@@ -715,6 +741,19 @@ TEST_F(TestMatchKernel, MatchDecimal) {
              /* expected= */ R"([0, 1, 2, 0])");
 }
 
+TEST_F(TestMatchKernel, MatchDictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto input = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[2, 0, null, 1, 0, 2]"), dict);
+  auto value_set = ArrayFromJSON(utf8(), R"(["baz", null, "foo"])");
+
+  ASSERT_OK_AND_ASSIGN(Datum out, Match(input, value_set));
+  ASSERT_OK(out.make_array()->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 2, 1, null, 2, 0]"), *out.make_array(),
+                    /*verbose=*/true);
+}
+
 TEST_F(TestMatchKernel, MatchChunkedArrayInvoke) {
   std::vector<std::string> values1 = {"foo", "bar", "foo"};
   std::vector<std::string> values2 = {"bar", "baz", "quuux", "foo"};
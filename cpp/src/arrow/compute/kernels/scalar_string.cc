@@ -17,12 +17,18 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <string>
 
 #ifdef ARROW_WITH_UTF8PROC
 #include <utf8proc.h>
 #endif
 
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#endif
+
+#include "arrow/array/builder_nested.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
@@ -59,6 +65,120 @@ struct AsciiLength {
   }
 };
 
+using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
+
+// Transform a buffer of offsets to one which begins with 0 and has same
+// value lengths.
+template <typename T>
+Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
+                         int64_t length, std::shared_ptr<Buffer>* out) {
+  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
+  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
+  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
+  T first_offset = *input_offsets;
+  for (int64_t i = 0; i < length; ++i) {
+    *out_offsets++ = input_offsets[i] - first_offset;
+  }
+  *out_offsets = input_offsets[length] - first_offset;
+  return Status::OK();
+}
+
+// Apply `transform` to input character data- this function cannot change the
+// length
+template <typename Type>
+void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
+                         TransformFunc transform, Datum* out) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using offset_type = typename Type::offset_type;
+
+  if (batch[0].kind() == Datum::ARRAY) {
+    const ArrayData& input = *batch[0].array();
+    ArrayType input_boxed(batch[0].array());
+
+    ArrayData* out_arr = out->mutable_array();
+
+    if (input.offset == 0) {
+      // We can reuse offsets from input
+      out_arr->buffers[1] = input.buffers[1];
+    } else {
+      DCHECK(input.buffers[1]);
+      // We must allocate new space for the offsets and shift the existing offsets
+      KERNEL_RETURN_IF_ERROR(
+          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
+                                              input.length, &out_arr->buffers[1]));
+    }
+
+    // Allocate space for output data
+    int64_t data_nbytes = input_boxed.total_values_length();
+    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
+    if (input.length > 0) {
+      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
+                out_arr->buffers[2]->mutable_data());
+    }
+  } else {
+    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
+    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
+    if (input.is_valid) {
+      result->is_valid = true;
+      int64_t data_nbytes = input.value->size();
+      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
+      transform(input.value->data(), data_nbytes, result->value->mutable_data());
+    }
+    out->value = result;
+  }
+}
+
+// Flip the case of the bytes of `word` that are in [kFirst, kLast], where
+// [kFirst, kLast] is ['a', 'z'] or ['A', 'Z']
+template <uint8_t kFirst, uint8_t kLast>
+static inline uint64_t FlipAsciiCase(uint64_t word) {
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  constexpr uint64_t kHighBits = 0x80 * kOnes;
+  // Adding these to bytes without their high bit doesn't carry into the next byte
+  const uint64_t heptets = word & ~kHighBits;
+  const uint64_t ge_first = heptets + (0x80 - kFirst) * kOnes;
+  const uint64_t gt_last = heptets + (0x80 - kLast - 1) * kOnes;
+  const uint64_t in_range = (ge_first ^ gt_last) & ~word & kHighBits;
+  return word ^ (in_range >> 2);
+}
+
+// Process 8 bytes at a time, which is about as fast as SIMD without needing
+// runtime dispatch
+template <uint8_t kFirst, uint8_t kLast>
+void TransformAsciiCase(const uint8_t* input, int64_t length, uint8_t* output) {
+  for (; length >= 8; length -= 8, input += 8, output += 8) {
+    uint64_t word;
+    std::memcpy(&word, input, 8);
+    word = FlipAsciiCase<kFirst, kLast>(word);
+    std::memcpy(output, &word, 8);
+  }
+  for (; length > 0; --length) {
+    *output++ = kFirst == 'a' ? ascii_toupper(*input++) : ascii_tolower(*input++);
+  }
+}
+
+void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'a', 'z'>(input, length, output);
+}
+
+template <typename Type>
+struct AsciiUpper {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
+  }
+};
+
+void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
+  TransformAsciiCase<'A', 'Z'>(input, length, output);
+}
+
+template <typename Type>
+struct AsciiLower {
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
+  }
+};
+
 #ifdef ARROW_WITH_UTF8PROC
 
 // Direct lookup tables for unicode properties
@@ -79,6 +199,22 @@ void EnsureLookupTablesFilled() {
   });
 }
 
+// Whether the character data of a string array or scalar is all ASCII
+template <typename Type>
+bool IsAsciiData(const Datum& datum) {
+  if (datum.is_scalar()) {
+    const auto& scalar = checked_cast<const BaseBinaryScalar&>(*datum.scalar());
+    return !scalar.is_valid ||
+           util::ValidateAscii(scalar.value->data(), scalar.value->size());
+  }
+  typename TypeTraits<Type>::ArrayType array(datum.array());
+  if (array.length() == 0 || array.total_values_length() == 0) {
+    return true;
+  }
+  return util::ValidateAscii(array.value_data()->data() + array.value_offset(0),
+                             array.total_values_length());
+}
+
 template <typename Type, typename Derived>
 struct UTF8Transform {
   using offset_type = typename Type::offset_type;
@@ -97,6 +233,12 @@ struct UTF8Transform {
   }
 
   static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    // Case mapping ASCII data doesn't change its length, so it can be done
+    // without decoding, in one pass over the character data
+    if (IsAsciiData<Type>(batch[0])) {
+      StringDataTransform<Type>(ctx, batch, Derived::TransformAscii, out);
+      return;
+    }
     if (batch[0].kind() == Datum::ARRAY) {
       EnsureLookupTablesFilled();
       const ArrayData& input = *batch[0].array();
@@ -185,6 +327,10 @@ struct UTF8Transform {
 
 template <typename Type>
 struct UTF8Upper : UTF8Transform<Type, UTF8Upper<Type>> {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiUpper(input, length, output);
+  }
+
   inline static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
@@ -193,6 +339,10 @@ struct UTF8Upper : UTF8Transform<Type, UTF8Upper<Type>> {
 
 template <typename Type>
 struct UTF8Lower : UTF8Transform<Type, UTF8Lower<Type>> {
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiLower(input, length, output);
+  }
+
   static uint32_t TransformCodepoint(uint32_t codepoint) {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
@@ -201,91 +351,6 @@ struct UTF8Lower : UTF8Transform<Type, UTF8Lower<Type>> {
 
 #endif  // ARROW_WITH_UTF8PROC
 
-using TransformFunc = std::function<void(const uint8_t*, int64_t, uint8_t*)>;
-
-// Transform a buffer of offsets to one which begins with 0 and has same
-// value lengths.
-template <typename T>
-Status GetShiftedOffsets(KernelContext* ctx, const Buffer& input_buffer, int64_t offset,
-                         int64_t length, std::shared_ptr<Buffer>* out) {
-  ARROW_ASSIGN_OR_RAISE(*out, ctx->Allocate((length + 1) * sizeof(T)));
-  const T* input_offsets = reinterpret_cast<const T*>(input_buffer.data()) + offset;
-  T* out_offsets = reinterpret_cast<T*>((*out)->mutable_data());
-  T first_offset = *input_offsets;
-  for (int64_t i = 0; i < length; ++i) {
-    *out_offsets++ = input_offsets[i] - first_offset;
-  }
-  *out_offsets = input_offsets[length] - first_offset;
-  return Status::OK();
-}
-
-// Apply `transform` to input character data- this function cannot change the
-// length
-template <typename Type>
-void StringDataTransform(KernelContext* ctx, const ExecBatch& batch,
-                         TransformFunc transform, Datum* out) {
-  using ArrayType = typename TypeTraits<Type>::ArrayType;
-  using offset_type = typename Type::offset_type;
-
-  if (batch[0].kind() == Datum::ARRAY) {
-    const ArrayData& input = *batch[0].array();
-    ArrayType input_boxed(batch[0].array());
-
-    ArrayData* out_arr = out->mutable_array();
-
-    if (input.offset == 0) {
-      // We can reuse offsets from input
-      out_arr->buffers[1] = input.buffers[1];
-    } else {
-      DCHECK(input.buffers[1]);
-      // We must allocate new space for the offsets and shift the existing offsets
-      KERNEL_RETURN_IF_ERROR(
-          ctx, GetShiftedOffsets<offset_type>(ctx, *input.buffers[1], input.offset,
-                                              input.length, &out_arr->buffers[1]));
-    }
-
-    // Allocate space for output data
-    int64_t data_nbytes = input_boxed.total_values_length();
-    KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&out_arr->buffers[2]));
-    if (input.length > 0) {
-      transform(input.buffers[2]->data() + input_boxed.value_offset(0), data_nbytes,
-                out_arr->buffers[2]->mutable_data());
-    }
-  } else {
-    const auto& input = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar());
-    auto result = checked_pointer_cast<BaseBinaryScalar>(MakeNullScalar(out->type()));
-    if (input.is_valid) {
-      result->is_valid = true;
-      int64_t data_nbytes = input.value->size();
-      KERNEL_RETURN_IF_ERROR(ctx, ctx->Allocate(data_nbytes).Value(&result->value));
-      transform(input.value->data(), data_nbytes, result->value->mutable_data());
-    }
-    out->value = result;
-  }
-}
-
-void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
-}
-
-template <typename Type>
-struct AsciiUpper {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiUpper, out);
-  }
-};
-
-void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
-}
-
-template <typename Type>
-struct AsciiLower {
-  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
-    StringDataTransform<Type>(ctx, batch, TransformAsciiLower, out);
-  }
-};
-
 void AddAsciiLength(FunctionRegistry* registry) {
   auto func = std::make_shared<ScalarFunction>("ascii_length", Arity::Unary());
   ArrayKernelExec exec_offset_32 =
@@ -409,6 +474,416 @@ void AddBinaryContainsExact(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
+// ----------------------------------------------------------------------
+// Pattern matching (match_like, match_regex)
+
+// Find the first occurrence of `needle` in `haystack`, or -1.  Candidates are
+// located by scanning for the first byte of the needle with memchr, which libc
+// implements with vector instructions, and then verified with memcmp.
+int64_t FindSubstring(util::string_view haystack, util::string_view needle) {
+  if (needle.empty()) {
+    return 0;
+  }
+  if (needle.size() > haystack.size()) {
+    return -1;
+  }
+  const char* begin = haystack.data();
+  const char* last = begin + (haystack.size() - needle.size());
+  const char* p = begin;
+  while (p <= last) {
+    p = static_cast<const char*>(std::memchr(p, needle[0], last - p + 1));
+    if (p == nullptr) {
+      return -1;
+    }
+    if (std::memcmp(p + 1, needle.data() + 1, needle.size() - 1) == 0) {
+      return p - begin;
+    }
+    ++p;
+  }
+  return -1;
+}
+
+// A string predicate compiled once per kernel invocation.  Patterns that
+// reduce to a literal prefix, suffix or infix are matched directly; other
+// patterns are delegated to RE2.
+class StringMatcher : public KernelState {
+ public:
+  // Compile a SQL LIKE pattern
+  static Result<std::unique_ptr<StringMatcher>> MakeLike(const std::string& pattern) {
+    // Tokenize the pattern into literal runs and wildcards, resolving escapes
+    enum TokenKind { LITERAL, ANY_SEQUENCE, ANY_CHAR };
+    std::vector<std::pair<TokenKind, std::string>> tokens;
+    for (size_t i = 0; i < pattern.size(); ++i) {
+      char c = pattern[i];
+      if (c == '%' || c == '_') {
+        tokens.emplace_back(c == '%' ? ANY_SEQUENCE : ANY_CHAR, "");
+        continue;
+      }
+      if (c == '\\') {
+        if (++i == pattern.size()) {
+          return Status::Invalid("LIKE pattern '", pattern,
+                                 "' ends with an escape character");
+        }
+        c = pattern[i];
+      }
+      if (tokens.empty() || tokens.back().first != LITERAL) {
+        tokens.emplace_back(LITERAL, "");
+      }
+      tokens.back().second += c;
+    }
+
+    // Look for the fast path shapes: "abc", "abc%", "%abc" and "%abc%"
+    size_t begin = 0, end = tokens.size();
+    const bool leading_any = begin < end && tokens[begin].first == ANY_SEQUENCE;
+    while (begin < end && tokens[begin].first == ANY_SEQUENCE) {
+      ++begin;
+    }
+    const bool trailing_any = begin < end && tokens[end - 1].first == ANY_SEQUENCE;
+    while (begin < end && tokens[end - 1].first == ANY_SEQUENCE) {
+      --end;
+    }
+    if (end - begin <= 1 && (begin == end || tokens[begin].first == LITERAL)) {
+      std::string literal = begin == end ? "" : tokens[begin].second;
+      Kind kind = leading_any ? (trailing_any ? INFIX : SUFFIX)
+                              : (trailing_any ? PREFIX : EXACT);
+      if (begin == end) {
+        // Either "" or a sequence of '%'
+        kind = leading_any ? INFIX : EXACT;
+      }
+      return std::unique_ptr<StringMatcher>(new StringMatcher(kind, std::move(literal)));
+    }
+
+#ifdef ARROW_WITH_RE2
+    std::string regex;
+    for (const auto& token : tokens) {
+      switch (token.first) {
+        case LITERAL:
+          regex += RE2::QuoteMeta(token.second);
+          break;
+        case ANY_SEQUENCE:
+          regex += ".*";
+          break;
+        case ANY_CHAR:
+          regex += ".";
+          break;
+      }
+    }
+    return CompileRegex(regex, RE2::ANCHOR_BOTH);
+#else
+    return Status::NotImplemented("LIKE pattern '", pattern,
+                                  "' requires Arrow to be built with re2");
+#endif
+  }
+
+#ifdef ARROW_WITH_RE2
+  // Compile a RE2 regular expression
+  static Result<std::unique_ptr<StringMatcher>> MakeRegex(const std::string& pattern) {
+    if (pattern.find_first_of("\\^$.|?*+()[]{}") == std::string::npos) {
+      // No metacharacters, this is a plain substring search
+      return std::unique_ptr<StringMatcher>(new StringMatcher(INFIX, pattern));
+    }
+    return CompileRegex(pattern, RE2::UNANCHORED);
+  }
+#endif
+
+  bool Match(util::string_view s) const {
+    switch (kind_) {
+      case EXACT:
+        return s == literal_;
+      case PREFIX:
+        return s.size() >= literal_.size() &&
+               std::memcmp(s.data(), literal_.data(), literal_.size()) == 0;
+      case SUFFIX:
+        return s.size() >= literal_.size() &&
+               std::memcmp(s.data() + s.size() - literal_.size(), literal_.data(),
+                           literal_.size()) == 0;
+      case INFIX:
+        return FindSubstring(s, literal_) >= 0;
+      case REGEX:
+#ifdef ARROW_WITH_RE2
+        return regex_->Match(re2::StringPiece(s.data(), s.size()), 0, s.size(),
+                             anchor_, nullptr, 0);
+#else
+        break;
+#endif
+    }
+    return false;
+  }
+
+ private:
+  enum Kind { EXACT, PREFIX, SUFFIX, INFIX, REGEX };
+
+  StringMatcher(Kind kind, std::string literal)
+      : kind_(kind), literal_(std::move(literal)) {}
+
+#ifdef ARROW_WITH_RE2
+  static Result<std::unique_ptr<StringMatcher>> CompileRegex(
+      const std::string& pattern, RE2::Anchor anchor) {
+    RE2::Options options;
+    options.set_dot_nl(true);
+    options.set_log_errors(false);
+    std::unique_ptr<StringMatcher> matcher(new StringMatcher(REGEX, ""));
+    matcher->regex_.reset(new RE2(pattern, options));
+    if (!matcher->regex_->ok()) {
+      return Status::Invalid("Invalid regular expression '", pattern,
+                             "': ", matcher->regex_->error());
+    }
+    matcher->anchor_ = anchor;
+    return std::move(matcher);
+  }
+
+  std::unique_ptr<RE2> regex_;
+  RE2::Anchor anchor_ = RE2::UNANCHORED;
+#endif
+
+  Kind kind_;
+  std::string literal_;
+};
+
+template <Result<std::unique_ptr<StringMatcher>> (*Make)(const std::string&)>
+std::unique_ptr<KernelState> InitStringMatcher(KernelContext* ctx,
+                                               const KernelInitArgs& args) {
+  auto options = static_cast<const MatchPatternOptions*>(args.options);
+  if (options == nullptr) {
+    ctx->SetStatus(
+        Status::Invalid("Attempted to initialize KernelState from null FunctionOptions"));
+    return nullptr;
+  }
+  auto maybe_matcher = Make(options->pattern);
+  if (!maybe_matcher.ok()) {
+    ctx->SetStatus(maybe_matcher.status());
+    return nullptr;
+  }
+  return std::move(maybe_matcher).MoveValueUnsafe();
+}
+
+template <typename Type>
+struct MatchPattern {
+  using offset_type = typename Type::offset_type;
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& matcher = checked_cast<const StringMatcher&>(*ctx->state());
+    StringBoolTransform<Type>(
+        ctx, batch,
+        [&matcher](const void* raw_offsets, const uint8_t* data, int64_t length,
+                   int64_t output_offset, uint8_t* output) {
+          auto offsets = reinterpret_cast<const offset_type*>(raw_offsets);
+          FirstTimeBitmapWriter bitmap_writer(output, output_offset, length);
+          for (int64_t i = 0; i < length; ++i) {
+            util::string_view current(reinterpret_cast<const char*>(data + offsets[i]),
+                                      offsets[i + 1] - offsets[i]);
+            if (matcher.Match(current)) {
+              bitmap_writer.Set();
+            }
+            bitmap_writer.Next();
+          }
+          bitmap_writer.Finish();
+        },
+        out);
+  }
+};
+
+void AddMatchPattern(std::string name, KernelInit init, FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>(name, Arity::Unary());
+  DCHECK_OK(func->AddKernel({utf8()}, boolean(), MatchPattern<StringType>::Exec, init));
+  DCHECK_OK(func->AddKernel({large_utf8()}, boolean(),
+                            MatchPattern<LargeStringType>::Exec, init));
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+// ----------------------------------------------------------------------
+// Splitting and extraction (split_pattern, extract_regex)
+
+// Evaluate `ExecArray` on an array input, or on a scalar input boxed into a
+// length-1 array.
+template <typename ExecArray>
+void ExecArrayOrScalar(KernelContext* ctx, const ExecBatch& batch, Datum* out,
+                       ExecArray&& exec_array) {
+  if (batch[0].kind() == Datum::ARRAY) {
+    exec_array(*batch[0].array());
+    return;
+  }
+  KERNEL_ASSIGN_OR_RAISE(auto boxed, ctx,
+                         MakeArrayFromScalar(*batch[0].scalar(), 1, ctx->memory_pool()));
+  exec_array(*boxed->data());
+  if (!ctx->HasError()) {
+    KERNEL_ASSIGN_OR_RAISE(out->value, ctx, out->make_array()->GetScalar(0));
+  }
+}
+
+using SplitPatternState = OptionsWrapper<SplitPatternOptions>;
+
+template <typename Type>
+struct SplitPattern {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+
+  static Status Split(util::string_view s, const SplitPatternOptions& options,
+                      BuilderType* builder) {
+    for (int64_t splits = 0; options.max_splits < 0 || splits < options.max_splits;
+         ++splits) {
+      const int64_t pos = FindSubstring(s, options.pattern);
+      if (pos < 0) {
+        break;
+      }
+      RETURN_NOT_OK(builder->Append(s.substr(0, pos)));
+      s = s.substr(pos + options.pattern.size());
+    }
+    return builder->Append(s);
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const SplitPatternOptions& options = SplitPatternState::Get(ctx);
+    if (options.pattern.empty()) {
+      ctx->SetStatus(Status::Invalid("split_pattern requires a non-empty pattern"));
+      return;
+    }
+    ExecArrayOrScalar(ctx, batch, out, [&](const ArrayData& data) {
+      ArrayType input(data.Copy());
+      auto values_builder = std::make_shared<BuilderType>(ctx->memory_pool());
+      ListBuilder list_builder(ctx->memory_pool(), values_builder, out->type());
+      KERNEL_RETURN_IF_ERROR(ctx, list_builder.Reserve(input.length()));
+      for (int64_t i = 0; i < input.length(); ++i) {
+        if (input.IsNull(i)) {
+          KERNEL_RETURN_IF_ERROR(ctx, list_builder.AppendNull());
+          continue;
+        }
+        KERNEL_RETURN_IF_ERROR(ctx, list_builder.Append());
+        KERNEL_RETURN_IF_ERROR(ctx,
+                               Split(input.GetView(i), options, values_builder.get()));
+      }
+      std::shared_ptr<ArrayData> result;
+      KERNEL_RETURN_IF_ERROR(ctx, list_builder.FinishInternal(&result));
+      out->value = std::move(result);
+    });
+  }
+};
+
+void AddSplitPattern(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("split_pattern", Arity::Unary());
+  for (const auto& ty : {utf8(), large_utf8()}) {
+    ScalarKernel kernel({ty}, list(ty),
+                        ty->id() == Type::STRING ? SplitPattern<StringType>::Exec
+                                                 : SplitPattern<LargeStringType>::Exec,
+                        SplitPatternState::Init);
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+#ifdef ARROW_WITH_RE2
+
+struct ExtractRegexState : public KernelState {
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const ExtractRegexOptions*>(args.options);
+    if (options == nullptr) {
+      ctx->SetStatus(Status::Invalid(
+          "Attempted to initialize KernelState from null FunctionOptions"));
+      return nullptr;
+    }
+    RE2::Options re2_options;
+    re2_options.set_dot_nl(true);
+    re2_options.set_log_errors(false);
+    std::unique_ptr<ExtractRegexState> state(new ExtractRegexState);
+    state->regex.reset(new RE2(options->pattern, re2_options));
+    if (!state->regex->ok()) {
+      ctx->SetStatus(Status::Invalid("Invalid regular expression '", options->pattern,
+                                     "': ", state->regex->error()));
+      return nullptr;
+    }
+    const auto& names = state->regex->CapturingGroupNames();
+    for (int group = 1; group <= state->regex->NumberOfCapturingGroups(); ++group) {
+      auto it = names.find(group);
+      if (it == names.end()) {
+        ctx->SetStatus(Status::Invalid("Regular expression '", options->pattern,
+                                       "' contains unnamed capture groups"));
+        return nullptr;
+      }
+      state->group_names.push_back(it->second);
+    }
+    return std::move(state);
+  }
+
+  std::unique_ptr<RE2> regex;
+  std::vector<std::string> group_names;
+};
+
+Result<ValueDescr> ResolveExtractRegex(KernelContext* ctx,
+                                       const std::vector<ValueDescr>& args) {
+  const auto& state = checked_cast<const ExtractRegexState&>(*ctx->state());
+  FieldVector fields;
+  for (const auto& name : state.group_names) {
+    fields.push_back(field(name, args[0].type));
+  }
+  return struct_(std::move(fields));
+}
+
+template <typename Type>
+struct ExtractRegex {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    const auto& state = checked_cast<const ExtractRegexState&>(*ctx->state());
+    const int num_groups = static_cast<int>(state.group_names.size());
+    ExecArrayOrScalar(ctx, batch, out, [&](const ArrayData& data) {
+      ArrayType input(data.Copy());
+      std::vector<std::shared_ptr<ArrayBuilder>> field_builders;
+      for (int group = 0; group < num_groups; ++group) {
+        field_builders.push_back(std::make_shared<BuilderType>(ctx->memory_pool()));
+      }
+      StructBuilder struct_builder(out->type(), ctx->memory_pool(), field_builders);
+      KERNEL_RETURN_IF_ERROR(ctx, struct_builder.Reserve(input.length()));
+
+      // Slot 0 receives the whole match
+      std::vector<re2::StringPiece> found(num_groups + 1);
+      for (int64_t i = 0; i < input.length(); ++i) {
+        if (input.IsNull(i)) {
+          KERNEL_RETURN_IF_ERROR(ctx, struct_builder.AppendNull());
+          continue;
+        }
+        const util::string_view s = input.GetView(i);
+        if (!state.regex->Match(re2::StringPiece(s.data(), s.size()), 0, s.size(),
+                                RE2::UNANCHORED, found.data(), num_groups + 1)) {
+          KERNEL_RETURN_IF_ERROR(ctx, struct_builder.AppendNull());
+          continue;
+        }
+        KERNEL_RETURN_IF_ERROR(ctx, struct_builder.Append());
+        for (int group = 0; group < num_groups; ++group) {
+          auto builder = checked_cast<BuilderType*>(field_builders[group].get());
+          const re2::StringPiece& piece = found[group + 1];
+          // A group that did not participate in the match yields null
+          KERNEL_RETURN_IF_ERROR(
+              ctx, piece.data() == nullptr
+                       ? builder->AppendNull()
+                       : builder->Append(util::string_view(piece.data(), piece.size())));
+        }
+      }
+      std::shared_ptr<ArrayData> result;
+      KERNEL_RETURN_IF_ERROR(ctx, struct_builder.FinishInternal(&result));
+      out->value = std::move(result);
+    });
+  }
+};
+
+void AddExtractRegex(FunctionRegistry* registry) {
+  auto func = std::make_shared<ScalarFunction>("extract_regex", Arity::Unary());
+  for (const auto& ty : {utf8(), large_utf8()}) {
+    ScalarKernel kernel({ty}, OutputType(ResolveExtractRegex),
+                        ty->id() == Type::STRING ? ExtractRegex<StringType>::Exec
+                                                 : ExtractRegex<LargeStringType>::Exec,
+                        ExtractRegexState::Init);
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+#endif  // ARROW_WITH_RE2
+
 // ----------------------------------------------------------------------
 // strptime string parsing
 
@@ -490,6 +965,12 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
 #endif
   AddAsciiLength(registry);
   AddBinaryContainsExact(registry);
+  AddMatchPattern("match_like", InitStringMatcher<StringMatcher::MakeLike>, registry);
+#ifdef ARROW_WITH_RE2
+  AddMatchPattern("match_regex", InitStringMatcher<StringMatcher::MakeRegex>, registry);
+  AddExtractRegex(registry);
+#endif
+  AddSplitPattern(registry);
   AddStrptime(registry);
 }
 
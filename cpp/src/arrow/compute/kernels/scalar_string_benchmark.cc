@@ -28,8 +28,25 @@ namespace compute {
 
 constexpr auto kSeed = 0x94378165;
 
+// Append a non-Ascii character to every non-null value
+static std::shared_ptr<Array> MakeNonAscii(const Array& ascii_values) {
+  const auto& values = checked_cast<const StringArray&>(ascii_values);
+  StringBuilder builder;
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append(values.GetString(i) + "\xc3\xa9"));
+    }
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
 static void UnaryStringBenchmark(benchmark::State& state, const std::string& func_name,
-                                 const FunctionOptions* options = nullptr) {
+                                 const FunctionOptions* options = nullptr,
+                                 bool ascii = true) {
   const int64_t array_length = 1 << 20;
   const int64_t value_min_size = 0;
   const int64_t value_max_size = 32;
@@ -39,6 +56,9 @@ static void UnaryStringBenchmark(benchmark::State& state, const std::string& fun
   // NOTE: this produces only-Ascii data
   auto values =
       rng.String(array_length, value_min_size, value_max_size, null_probability);
+  if (!ascii) {
+    values = MakeNonAscii(*values);
+  }
   // Make sure lookup tables are initialized before measuring
   ABORT_NOT_OK(CallFunction(func_name, {values}, options));
 
@@ -62,6 +82,33 @@ static void BinaryContainsExact(benchmark::State& state) {
   UnaryStringBenchmark(state, "binary_contains_exact", &options);
 }
 
+static void MatchLikePrefix(benchmark::State& state) {
+  MatchPatternOptions options("ab%");
+  UnaryStringBenchmark(state, "match_like", &options);
+}
+
+static void MatchLikeInfix(benchmark::State& state) {
+  MatchPatternOptions options("%abac%");
+  UnaryStringBenchmark(state, "match_like", &options);
+}
+
+static void SplitPattern(benchmark::State& state) {
+  SplitPatternOptions options("a");
+  UnaryStringBenchmark(state, "split_pattern", &options);
+}
+
+#ifdef ARROW_WITH_RE2
+static void MatchLikeWildcards(benchmark::State& state) {
+  MatchPatternOptions options("a_a%c");
+  UnaryStringBenchmark(state, "match_like", &options);
+}
+
+static void MatchRegex(benchmark::State& state) {
+  MatchPatternOptions options("a[bc]+a");
+  UnaryStringBenchmark(state, "match_regex", &options);
+}
+#endif
+
 #ifdef ARROW_WITH_UTF8PROC
 static void Utf8Upper(benchmark::State& state) {
   UnaryStringBenchmark(state, "utf8_upper");
@@ -70,14 +117,31 @@ static void Utf8Upper(benchmark::State& state) {
 static void Utf8Lower(benchmark::State& state) {
   UnaryStringBenchmark(state, "utf8_lower");
 }
+
+static void Utf8UpperNonAscii(benchmark::State& state) {
+  UnaryStringBenchmark(state, "utf8_upper", nullptr, /*ascii=*/false);
+}
+
+static void Utf8LowerNonAscii(benchmark::State& state) {
+  UnaryStringBenchmark(state, "utf8_lower", nullptr, /*ascii=*/false);
+}
 #endif
 
 BENCHMARK(AsciiLower);
 BENCHMARK(AsciiUpper);
 BENCHMARK(BinaryContainsExact);
+BENCHMARK(MatchLikePrefix);
+BENCHMARK(MatchLikeInfix);
+BENCHMARK(SplitPattern);
+#ifdef ARROW_WITH_RE2
+BENCHMARK(MatchLikeWildcards);
+BENCHMARK(MatchRegex);
+#endif
 #ifdef ARROW_WITH_UTF8PROC
 BENCHMARK(Utf8Lower);
 BENCHMARK(Utf8Upper);
+BENCHMARK(Utf8LowerNonAscii);
+BENCHMARK(Utf8UpperNonAscii);
 #endif
 
 }  // namespace compute
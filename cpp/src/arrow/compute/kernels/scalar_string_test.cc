@@ -158,6 +158,127 @@ TYPED_TEST(TestStringKernels, BinaryContainsExact) {
                    boolean(), "[true, false, true, null, false]", &options_repeated);
 }
 
+TYPED_TEST(TestStringKernels, MatchLike) {
+  auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null])";
+
+  MatchPatternOptions prefix_match{"foo%"};
+  this->CheckUnary("match_like", "[]", boolean(), "[]", &prefix_match);
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, true, false, false, false, true, null]", &prefix_match);
+
+  MatchPatternOptions suffix_match{"%foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, false, true, false, true, false, null]", &suffix_match);
+
+  MatchPatternOptions substring_match{"%foo%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, true, true, false, true, true, null]",
+                   &substring_match);
+
+  MatchPatternOptions exact_match{"foo"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, false, false, false, false, false, false, null]",
+                   &exact_match);
+
+  MatchPatternOptions match_all{"%%"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[true, true, true, true, true, true, true, null]", &match_all);
+
+  MatchPatternOptions match_empty{""};
+  this->CheckUnary("match_like", R"(["", "a", null])", boolean(), "[true, false, null]",
+                   &match_empty);
+
+  // Escaped wildcards are matched literally
+  MatchPatternOptions escaped{R"(\%\_\\%)"};
+  this->CheckUnary("match_like", R"(["%_\\", "%_\\x", "ab\\", "%a\\", null])",
+                   boolean(), "[true, true, false, false, null]", &escaped);
+
+  MatchPatternOptions trailing_escape{"foo\\"};
+  ASSERT_RAISES(Invalid, CallFunction("match_like",
+                                      {ArrayFromJSON(this->string_type(), inputs)},
+                                      &trailing_escape));
+
+#ifdef ARROW_WITH_RE2
+  // Patterns with inner wildcards go through RE2
+  MatchPatternOptions inner_wildcards{"f_o%ar"};
+  this->CheckUnary("match_like", inputs, boolean(),
+                   "[false, false, true, false, false, false, false, null]",
+                   &inner_wildcards);
+
+  // '_' matches a single character, not a single byte
+  MatchPatternOptions single_char{"_b"};
+  this->CheckUnary("match_like", R"(["ab", "éb", "abb", "b", null])", boolean(),
+                   "[true, true, false, false, null]", &single_char);
+
+  // Regex metacharacters are matched literally
+  MatchPatternOptions metacharacters{"a.c_"};
+  this->CheckUnary("match_like", R"(["a.cd", "abcd", "a.c", null])", boolean(),
+                   "[true, false, false, null]", &metacharacters);
+#endif
+}
+
+#ifdef ARROW_WITH_RE2
+TYPED_TEST(TestStringKernels, MatchRegex) {
+  MatchPatternOptions options{"ab"};
+  this->CheckUnary("match_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_regex", R"(["abc", "acb", "cab", null, "bac"])", boolean(),
+                   "[true, false, true, null, false]", &options);
+
+  MatchPatternOptions anchored{"^a.c$"};
+  this->CheckUnary("match_regex", R"(["abc", "a\nc", "abcd", "éabc", null])", boolean(),
+                   "[true, true, false, false, null]", &anchored);
+
+  MatchPatternOptions invalid{"(ab"};
+  ASSERT_RAISES(Invalid, CallFunction("match_regex",
+                                      {ArrayFromJSON(this->string_type(), "[]")},
+                                      &invalid));
+}
+
+TYPED_TEST(TestStringKernels, ExtractRegex) {
+  ExtractRegexOptions options{"(?P<letter>[ab])(?P<digit>\\d)"};
+  auto type = struct_({field("letter", this->string_type()),
+                       field("digit", this->string_type())});
+  this->CheckUnary("extract_regex", R"(["a1", "b2", "c3", null, "xa4b5"])", type,
+                   R"([{"letter": "a", "digit": "1"},
+                       {"letter": "b", "digit": "2"},
+                       null,
+                       null,
+                       {"letter": "a", "digit": "4"}])",
+                   &options);
+
+  // Groups not taking part in the match yield null
+  ExtractRegexOptions optional_group{"(?P<x>a)|(?P<y>b)"};
+  type = struct_({field("x", this->string_type()), field("y", this->string_type())});
+  this->CheckUnary("extract_regex", R"(["a", "b", "c"])", type,
+                   R"([{"x": "a", "y": null}, {"x": null, "y": "b"}, null])",
+                   &optional_group);
+
+  ExtractRegexOptions unnamed{"(?P<letter>[ab])(\\d)"};
+  ASSERT_RAISES(Invalid, CallFunction("extract_regex",
+                                      {ArrayFromJSON(this->string_type(), "[]")},
+                                      &unnamed));
+}
+#endif  // ARROW_WITH_RE2
+
+TYPED_TEST(TestStringKernels, SplitPattern) {
+  SplitPatternOptions options{"--"};
+  auto type = list(this->string_type());
+  this->CheckUnary("split_pattern", "[]", type, "[]", &options);
+  this->CheckUnary("split_pattern", R"(["a--b--c", "--", "", "abc", null, "a---b"])",
+                   type, R"([["a", "b", "c"], ["", ""], [""], ["abc"], null,
+                             ["a", "-b"]])",
+                   &options);
+
+  SplitPatternOptions max_splits{"--", 1};
+  this->CheckUnary("split_pattern", R"(["a--b--c", "abc", null])", type,
+                   R"([["a", "b--c"], ["abc"], null])", &max_splits);
+
+  SplitPatternOptions empty{""};
+  ASSERT_RAISES(Invalid, CallFunction("split_pattern",
+                                      {ArrayFromJSON(this->string_type(), "[]")},
+                                      &empty));
+}
+
 TYPED_TEST(TestStringKernels, Strptime) {
   std::string input1 = R"(["5/1/2020", null, "12/11/1900"])";
   std::string output1 = R"(["2020-05-01", null, "1900-12-11"])";
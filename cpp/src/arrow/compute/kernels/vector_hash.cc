@@ -396,7 +396,7 @@ class DictionaryHashKernel : public HashKernel {
   Status HandleDictionary(const std::shared_ptr<ArrayData>& dict) {
     if (!dictionary_) {
       dictionary_ = dict;
-    } else if (!MakeArray(dictionary_)->Equals(*MakeArray(dict))) {
+    } else if (dictionary_ != dict && !MakeArray(dictionary_)->Equals(*MakeArray(dict))) {
       return Status::Invalid(
           "Only hashing for data with equal dictionaries "
           "currently supported");
@@ -428,6 +428,105 @@ class DictionaryHashKernel : public HashKernel {
   std::shared_ptr<ArrayData> dictionary_;
 };
 
+// ----------------------------------------------------------------------
+// Unique and value counts of dictionary indices
+//
+// Dictionary indices are dense, so rather than hashing them they are counted
+// in a table with a slot per dictionary value
+
+template <typename IndexType>
+class DictionaryIndexCountingKernel : public HashKernel {
+ public:
+  using IndexCType = typename IndexType::c_type;
+
+  DictionaryIndexCountingKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : pool_(pool), type_(type) {}
+
+  Status Reset() override {
+    unique_of_index_.clear();
+    uniques_.clear();
+    counts_.clear();
+    null_unique_ = -1;
+    return Status::OK();
+  }
+
+  Status Append(const ArrayData& arr) override {
+    const auto dict_length = static_cast<size_t>(arr.dictionary->length);
+    if (unique_of_index_.size() < dict_length) {
+      unique_of_index_.resize(dict_length, -1);
+    }
+    return VisitArrayDataInline<IndexType>(
+        arr,
+        [&](IndexCType index) {
+          const auto i = static_cast<size_t>(index);
+          if (ARROW_PREDICT_FALSE(index < 0 || i >= dict_length)) {
+            return Status::IndexError("Dictionary index ", static_cast<int64_t>(index),
+                                      " out of bounds");
+          }
+          int64_t& unique = unique_of_index_[i];
+          if (unique < 0) {
+            unique = AddUnique(index);
+          }
+          ++counts_[unique];
+          return Status::OK();
+        },
+        [&]() {
+          if (null_unique_ < 0) {
+            null_unique_ = AddUnique(0);
+          }
+          ++counts_[null_unique_];
+          return Status::OK();
+        });
+  }
+
+  Status Flush(Datum* out) override { return Status::OK(); }
+
+  // Return the counts corresponding to the uniques
+  Status FlushFinal(Datum* out) override {
+    Int64Builder builder(pool_);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  // Return the unique indices, in order of first occurrence, as an array of
+  // the dictionary type
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    const auto& index_type = checked_cast<const DictionaryType&>(*type_).index_type();
+    NumericBuilder<IndexType> builder(index_type, pool_);
+    RETURN_NOT_OK(builder.Reserve(uniques_.size()));
+    for (int64_t i = 0; i < static_cast<int64_t>(uniques_.size()); ++i) {
+      if (i == null_unique_) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(uniques_[i]);
+      }
+    }
+    RETURN_NOT_OK(builder.FinishInternal(out));
+    (*out)->type = type_;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> value_type() const override { return type_; }
+
+ private:
+  int64_t AddUnique(IndexCType index) {
+    uniques_.push_back(index);
+    counts_.push_back(0);
+    return static_cast<int64_t>(uniques_.size()) - 1;
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<DataType> type_;
+  // The position in uniques_ of each dictionary index, -1 if not seen yet
+  std::vector<int64_t> unique_of_index_;
+  std::vector<IndexCType> uniques_;
+  std::vector<int64_t> counts_;
+  int64_t null_unique_ = -1;
+};
+
 // ----------------------------------------------------------------------
 
 template <typename Type, typename Action, typename Enable = void>
@@ -506,29 +605,32 @@ KernelInit GetHashInit(Type::type type_id) {
   }
 }
 
-template <typename Action>
 std::unique_ptr<KernelState> DictionaryHashInit(KernelContext* ctx,
                                                 const KernelInitArgs& args) {
-  const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0].type);
-  std::unique_ptr<HashKernel> indices_hasher;
-  switch (dict_type.index_type()->id()) {
+  const auto& type = args.inputs[0].type;
+  const auto& index_type = checked_cast<const DictionaryType&>(*type).index_type();
+  MemoryPool* pool = ctx->memory_pool();
+  std::unique_ptr<HashKernel> indices_counter;
+  switch (index_type->id()) {
     case Type::INT8:
-      indices_hasher = HashInitImpl<UInt8Type, Action>(ctx, args);
+      indices_counter.reset(new DictionaryIndexCountingKernel<Int8Type>(type, pool));
       break;
     case Type::INT16:
-      indices_hasher = HashInitImpl<UInt16Type, Action>(ctx, args);
+      indices_counter.reset(new DictionaryIndexCountingKernel<Int16Type>(type, pool));
       break;
     case Type::INT32:
-      indices_hasher = HashInitImpl<UInt32Type, Action>(ctx, args);
+      indices_counter.reset(new DictionaryIndexCountingKernel<Int32Type>(type, pool));
       break;
     case Type::INT64:
-      indices_hasher = HashInitImpl<UInt64Type, Action>(ctx, args);
+      indices_counter.reset(new DictionaryIndexCountingKernel<Int64Type>(type, pool));
       break;
     default:
-      DCHECK(false) << "Unsupported dictionary index type";
-      break;
+      ctx->SetStatus(Status::TypeError("Unsupported dictionary index type ",
+                                       *index_type));
+      return nullptr;
   }
-  return ::arrow::internal::make_unique<DictionaryHashKernel>(std::move(indices_hasher));
+  ctx->SetStatus(indices_counter->Reset());
+  return ::arrow::internal::make_unique<DictionaryHashKernel>(std::move(indices_counter));
 }
 
 void HashExec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -639,7 +741,7 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   AddHashKernels<UniqueAction>(unique.get(), base, OutputType(FirstType));
 
   // Dictionary unique
-  base.init = DictionaryHashInit<UniqueAction>;
+  base.init = DictionaryHashInit;
   base.finalize = UniqueFinalizeDictionary;
   base.signature =
       KernelSignature::Make({InputType::Array(Type::DICTIONARY)}, OutputType(FirstType));
@@ -656,7 +758,7 @@ void RegisterVectorHash(FunctionRegistry* registry) {
                                     OutputType(ValueCountsOutput));
 
   // Dictionary value counts
-  base.init = DictionaryHashInit<ValueCountsAction>;
+  base.init = DictionaryHashInit;
   base.finalize = ValueCountsFinalizeDictionary;
   base.signature = KernelSignature::Make({InputType::Array(Type::DICTIONARY)},
                                          OutputType(ValueCountsOutput));
@@ -580,6 +580,14 @@ TEST_F(TestHashKernel, DictionaryUniqueAndValueCounts) {
     CheckUnique(chunked, ex_uniques);
     CheckValueCounts(chunked, ex_uniques, ex_counts);
 
+    // Null indices are a distinct value, counted in order of first appearance
+    auto null_indices = ArrayFromJSON(index_ty, "[1, null, 3, 1, null, 1]");
+    auto null_input = std::make_shared<DictionaryArray>(dict_ty, null_indices, dict);
+    auto ex_null_uniques = std::make_shared<DictionaryArray>(
+        dict_ty, ArrayFromJSON(index_ty, "[1, null, 3]"), dict);
+    CheckUnique(null_input, ex_null_uniques);
+    CheckValueCounts(null_input, ex_null_uniques, ArrayFromJSON(int64(), "[3, 2, 1]"));
+
     // Different dictionaries not supported
     auto dict2 = ArrayFromJSON(int64(), "[30, 40, 50, 60]");
     auto input2 = std::make_shared<DictionaryArray>(dict_ty, indices, dict2);
@@ -16,13 +16,19 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <numeric>
 
+#include "arrow/array/builder_primitive.h"
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace compute {
@@ -281,6 +287,351 @@ struct SortIndices {
   }
 };
 
+namespace {
+
+// ----------------------------------------------------------------------
+// select_k_unstable implementation
+
+// Rows are scanned in segments of at most this many rows. Segments are
+// distributed between threads
+constexpr int64_t kSelectKSegmentLength = 1 << 16;
+
+// A range of rows of the input, with the sort key columns
+struct SelectKSegment {
+  // Index of the first row in the input
+  int64_t offset;
+  int64_t length;
+  // One per sort key
+  std::vector<std::shared_ptr<Array>> keys;
+};
+
+// A row of a segment
+struct SelectKCandidate {
+  int32_t segment;
+  int64_t row;
+};
+
+template <typename T>
+enable_if_t<!std::is_floating_point<T>::value, int> CompareViews(const T& left,
+                                                                 const T& right,
+                                                                 SortOrder order) {
+  const int cmp = (left < right) ? -1 : (right < left) ? 1 : 0;
+  return order == SortOrder::Descending ? -cmp : cmp;
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, int> CompareViews(T left, T right,
+                                                                SortOrder order) {
+  const bool left_nan = std::isnan(left);
+  const bool right_nan = std::isnan(right);
+  if (left_nan || right_nan) {
+    return static_cast<int>(left_nan) - static_cast<int>(right_nan);
+  }
+  const int cmp = (left < right) ? -1 : (right < left) ? 1 : 0;
+  return order == SortOrder::Descending ? -cmp : cmp;
+}
+
+// Compares rows on one sort key. Nulls sort after NaNs, which sort after all
+// other values, whatever the order
+class SelectKColumnComparator {
+ public:
+  explicit SelectKColumnComparator(SortOrder order) : order_(order) {}
+  virtual ~SelectKColumnComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_row, const Array& right,
+                      int64_t right_row) const = 0;
+
+ protected:
+  SortOrder order_;
+};
+
+template <typename ArrowType>
+class TypedSelectKColumnComparator : public SelectKColumnComparator {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SelectKColumnComparator::SelectKColumnComparator;
+
+  int Compare(const Array& left, int64_t left_row, const Array& right,
+              int64_t right_row) const override {
+    return CompareValues(checked_cast<const ArrayType&>(left), left_row,
+                         checked_cast<const ArrayType&>(right), right_row, order_);
+  }
+
+  static int CompareValues(const ArrayType& left, int64_t left_row,
+                           const ArrayType& right, int64_t right_row,
+                           SortOrder order) {
+    const bool left_null = left.IsNull(left_row);
+    const bool right_null = right.IsNull(right_row);
+    if (left_null || right_null) {
+      return static_cast<int>(left_null) - static_cast<int>(right_null);
+    }
+    return CompareViews(left.GetView(left_row), right.GetView(right_row), order);
+  }
+};
+
+class SelectKImpl {
+ public:
+  SelectKImpl(int64_t k, std::vector<SortKey> sort_keys,
+              std::vector<SelectKSegment> segments, ExecContext* ctx)
+      : k_(k),
+        sort_keys_(std::move(sort_keys)),
+        segments_(std::move(segments)),
+        ctx_(ctx) {}
+
+  Status Init(const std::vector<std::shared_ptr<DataType>>& key_types) {
+    DCHECK_EQ(key_types.size(), sort_keys_.size());
+    for (size_t i = 0; i < key_types.size(); ++i) {
+      order_ = sort_keys_[i].order;
+      RETURN_NOT_OK(VisitTypeInline(*key_types[i], this));
+      if (i == 0) {
+        scan_ = next_scan_;
+      }
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Array>> Execute() {
+    // Each task selects the best rows of a contiguous range of segments into
+    // its own heap; the heaps are merged afterwards
+    const int num_segments = static_cast<int>(segments_.size());
+    int num_tasks = std::max(1, num_segments);
+    if (ctx_->use_threads()) {
+      num_tasks = std::min(num_tasks, GetCpuThreadPoolCapacity());
+    } else {
+      num_tasks = 1;
+    }
+    std::vector<std::vector<SelectKCandidate>> heaps(num_tasks);
+    if (k_ > 0) {
+      RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+          ctx_->use_threads(), num_tasks, [&](int i) {
+            const int begin = num_segments * i / num_tasks;
+            const int end = num_segments * (i + 1) / num_tasks;
+            for (int segment = begin; segment < end; ++segment) {
+              (this->*scan_)(segment, &heaps[i]);
+            }
+            return Status::OK();
+          }));
+    }
+
+    std::vector<SelectKCandidate> selected;
+    for (const auto& heap : heaps) {
+      selected.insert(selected.end(), heap.begin(), heap.end());
+    }
+    auto less = [this](const SelectKCandidate& left, const SelectKCandidate& right) {
+      return RowLess(left, right);
+    };
+    if (static_cast<int64_t>(selected.size()) > k_) {
+      std::nth_element(selected.begin(), selected.begin() + k_, selected.end(), less);
+      selected.resize(static_cast<size_t>(k_));
+    }
+    std::sort(selected.begin(), selected.end(), less);
+
+    UInt64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(selected.size()));
+    for (const auto& candidate : selected) {
+      builder.UnsafeAppend(
+          static_cast<uint64_t>(segments_[candidate.segment].offset + candidate.row));
+    }
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(builder.Finish(&indices));
+    return indices;
+  }
+
+  template <typename Type>
+  enable_if_t<is_boolean_type<Type>::value || is_base_binary_type<Type>::value ||
+                  (is_number_type<Type>::value &&
+                   !std::is_same<Type, HalfFloatType>::value) ||
+                  (is_temporal_type<Type>::value && !is_interval_type<Type>::value),
+              Status>
+  Visit(const Type&) {
+    comparators_.emplace_back(new TypedSelectKColumnComparator<Type>(order_));
+    next_scan_ = &SelectKImpl::ScanSegment<Type>;
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("select_k_unstable does not support sort keys of type ",
+                                  type);
+  }
+
+ private:
+  using ScanFunction = void (SelectKImpl::*)(int, std::vector<SelectKCandidate>*) const;
+
+  // Whether `left` sorts before `right`. Rows equal on all sort keys are
+  // ordered by index, so that the selection is deterministic
+  bool RowLess(const SelectKCandidate& left, const SelectKCandidate& right) const {
+    const auto& left_keys = segments_[left.segment].keys;
+    const auto& right_keys = segments_[right.segment].keys;
+    for (size_t i = 0; i < comparators_.size(); ++i) {
+      const int cmp =
+          comparators_[i]->Compare(*left_keys[i], left.row, *right_keys[i], right.row);
+      if (cmp != 0) {
+        return cmp < 0;
+      }
+    }
+    return segments_[left.segment].offset + left.row <
+           segments_[right.segment].offset + right.row;
+  }
+
+  // Push the rows of a segment into a max-heap of (at most) the k best rows
+  // seen so far, whose top is the worst of them
+  template <typename ArrowType>
+  void ScanSegment(int segment, std::vector<SelectKCandidate>* heap) const {
+    using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+    using Comparator = TypedSelectKColumnComparator<ArrowType>;
+
+    auto less = [this](const SelectKCandidate& left, const SelectKCandidate& right) {
+      return RowLess(left, right);
+    };
+    const SortOrder order = sort_keys_[0].order;
+    // Rows are scanned in index order, so a row tied with the top of the heap
+    // on the only sort key sorts after it
+    const bool single_key = comparators_.size() == 1;
+    const auto& values = checked_cast<const ArrayType&>(*segments_[segment].keys[0]);
+    const int64_t length = segments_[segment].length;
+    for (int64_t row = 0; row < length; ++row) {
+      const SelectKCandidate candidate{segment, row};
+      if (static_cast<int64_t>(heap->size()) < k_) {
+        heap->push_back(candidate);
+        std::push_heap(heap->begin(), heap->end(), less);
+        continue;
+      }
+      // Most rows are rejected on the first sort key alone, without calling
+      // into the comparators
+      const SelectKCandidate& top = heap->front();
+      const auto& top_values =
+          checked_cast<const ArrayType&>(*segments_[top.segment].keys[0]);
+      const int cmp = Comparator::CompareValues(values, row, top_values, top.row, order);
+      if (cmp > 0 || (cmp == 0 && (single_key || !RowLess(candidate, top)))) {
+        continue;
+      }
+      std::pop_heap(heap->begin(), heap->end(), less);
+      heap->back() = candidate;
+      std::push_heap(heap->begin(), heap->end(), less);
+    }
+  }
+
+  const int64_t k_;
+  const std::vector<SortKey> sort_keys_;
+  const std::vector<SelectKSegment> segments_;
+  ExecContext* ctx_;
+  std::vector<std::unique_ptr<SelectKColumnComparator>> comparators_;
+  ScanFunction scan_ = NULLPTR;
+
+  // Only used while visiting the key types in Init()
+  SortOrder order_ = SortOrder::Ascending;
+  ScanFunction next_scan_ = NULLPTR;
+};
+
+// Split a table of the sort key columns into segments
+Result<std::vector<SelectKSegment>> MakeSelectKSegments(const Table& keys) {
+  std::vector<SelectKSegment> segments;
+  TableBatchReader reader(keys);
+  reader.set_chunksize(kSelectKSegmentLength);
+  int64_t offset = 0;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    if (batch->num_rows() > 0) {
+      segments.push_back({offset, batch->num_rows(), batch->columns()});
+      offset += batch->num_rows();
+    }
+  }
+  return segments;
+}
+
+Result<std::shared_ptr<Table>> SelectKKeysTable(const Datum& datum,
+                                                std::vector<SortKey>* sort_keys) {
+  switch (datum.kind()) {
+    case Datum::ARRAY:
+    case Datum::CHUNKED_ARRAY: {
+      if (sort_keys->size() > 1) {
+        return Status::Invalid("select_k_unstable takes at most one sort key for ",
+                               "array-like inputs, got ", sort_keys->size());
+      }
+      if (sort_keys->empty()) {
+        sort_keys->emplace_back("", SortOrder::Ascending);
+      }
+      std::shared_ptr<ChunkedArray> values;
+      if (datum.kind() == Datum::ARRAY) {
+        values = std::make_shared<ChunkedArray>(datum.make_array());
+      } else {
+        values = datum.chunked_array();
+      }
+      return Table::Make(schema({field("", values->type())}), {values});
+    }
+    case Datum::RECORD_BATCH:
+    case Datum::TABLE: {
+      std::shared_ptr<Table> table;
+      if (datum.kind() == Datum::RECORD_BATCH) {
+        ARROW_ASSIGN_OR_RAISE(table, Table::FromRecordBatches({datum.record_batch()}));
+      } else {
+        table = datum.table();
+      }
+      if (sort_keys->empty()) {
+        return Status::Invalid("select_k_unstable requires at least one sort key ",
+                               "for tabular inputs");
+      }
+      std::vector<std::shared_ptr<Field>> fields;
+      std::vector<std::shared_ptr<ChunkedArray>> columns;
+      for (const auto& key : *sort_keys) {
+        const int index = table->schema()->GetFieldIndex(key.name);
+        if (index < 0) {
+          return Status::Invalid("No unique column named '", key.name,
+                                 "' to sort on in ", *table->schema());
+        }
+        fields.push_back(table->schema()->field(index));
+        columns.push_back(table->column(index));
+      }
+      return Table::Make(schema(std::move(fields)), std::move(columns),
+                         table->num_rows());
+    }
+    default:
+      return Status::NotImplemented("select_k_unstable does not support input ",
+                                    datum.ToString());
+  }
+}
+
+const SelectKOptions* GetDefaultSelectKOptions() {
+  static const auto kDefaultSelectKOptions = SelectKOptions::Defaults();
+  return &kDefaultSelectKOptions;
+}
+
+// A meta function as it accepts chunked and tabular inputs, which kernels
+// don't, and returns indices into the whole input
+class SelectKUnstableMetaFunction : public MetaFunction {
+ public:
+  SelectKUnstableMetaFunction()
+      : MetaFunction("select_k_unstable", Arity::Unary(), GetDefaultSelectKOptions()) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& select_k_options = static_cast<const SelectKOptions&>(*options);
+    if (select_k_options.k < 0) {
+      return Status::Invalid("select_k_unstable requires a non-negative k, got ",
+                             select_k_options.k);
+    }
+    auto sort_keys = select_k_options.sort_keys;
+    ARROW_ASSIGN_OR_RAISE(auto keys, SelectKKeysTable(args[0], &sort_keys));
+    ARROW_ASSIGN_OR_RAISE(auto segments, MakeSelectKSegments(*keys));
+
+    SelectKImpl impl(select_k_options.k, std::move(sort_keys), std::move(segments), ctx);
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (const auto& key_field : keys->schema()->fields()) {
+      key_types.push_back(key_field->type());
+    }
+    RETURN_NOT_OK(impl.Init(key_types));
+    ARROW_ASSIGN_OR_RAISE(auto indices, impl.Execute());
+    return Datum(indices);
+  }
+};
+
+}  // namespace
+
 namespace internal {
 
 // Sort indices kernels implemented for
@@ -318,6 +669,8 @@ void RegisterVectorSort(FunctionRegistry* registry) {
   base.init = PartitionIndicesState::Init;
   AddSortingKernels<PartitionIndices>(base, part_indices.get());
   DCHECK_OK(registry->AddFunction(std::move(part_indices)));
+
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKUnstableMetaFunction>()));
 }
 
 }  // namespace internal
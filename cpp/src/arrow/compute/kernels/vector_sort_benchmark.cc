@@ -17,6 +17,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -59,6 +61,43 @@ static void SortToIndicesInt64Compare(benchmark::State& state) {
   SortToIndicesBenchmark(state, values);
 }
 
+// Top-k over a chunked array, versus concatenating and sorting it
+static void SelectKChunkedBenchmark(benchmark::State& state, bool select_k) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  const int64_t num_chunks = 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto min = std::numeric_limits<int64_t>::min();
+  auto max = std::numeric_limits<int64_t>::max();
+  ArrayVector chunks;
+  for (int64_t i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(array_size / num_chunks, min, max, args.null_proportion));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+
+  const auto options = SelectKOptions::TopKDefault(100);
+  for (auto _ : state) {
+    if (select_k) {
+      ABORT_NOT_OK(SelectKUnstable(values, options).status());
+    } else {
+      auto concatenated = *Concatenate(values->chunks());
+      auto indices = *SortToIndices(*concatenated);
+      benchmark::DoNotOptimize(indices->Slice(0, 100));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void SelectKInt64Chunked(benchmark::State& state) {
+  SelectKChunkedBenchmark(state, /*select_k=*/true);
+}
+
+static void ConcatenateSortInt64Chunked(benchmark::State& state) {
+  SelectKChunkedBenchmark(state, /*select_k=*/false);
+}
+
 BENCHMARK(SortToIndicesInt64Count)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -73,5 +112,19 @@ BENCHMARK(SortToIndicesInt64Compare)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(SelectKInt64Chunked)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 100})
+    ->Args({1 << 23, 100})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(ConcatenateSortInt64Chunked)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 100})
+    ->Args({1 << 23, 100})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
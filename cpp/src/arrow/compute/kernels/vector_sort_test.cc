@@ -15,13 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -30,6 +34,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -375,5 +380,141 @@ TYPED_TEST(TestSortToIndicesKernelRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// ----------------------------------------------------------------------
+// select_k_unstable
+
+class TestSelectKUnstable : public TestBase {
+ protected:
+  void AssertSelectK(const Datum& values, const SelectKOptions& options,
+                     const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(values, options));
+    ASSERT_OK(indices->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *indices, /*verbose=*/true);
+  }
+
+  std::shared_ptr<Table> MakeTable(const std::vector<std::string>& names,
+                                   const std::vector<std::shared_ptr<DataType>>& types,
+                                   const std::vector<std::vector<std::string>>& json) {
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (size_t i = 0; i < names.size(); ++i) {
+      fields.push_back(field(names[i], types[i]));
+      columns.push_back(ChunkedArrayFromJSON(types[i], json[i]));
+    }
+    return Table::Make(schema(fields), columns);
+  }
+};
+
+TEST_F(TestSelectKUnstable, Array) {
+  auto values = ArrayFromJSON(float64(), "[null, 1, 3.3, null, 2, 5.3]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(3), "[5, 2, 4]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(3), "[1, 4, 2]");
+  // Ascending by default
+  AssertSelectK(values, SelectKOptions(2), "[1, 4]");
+  // Nulls sort last
+  AssertSelectK(values, SelectKOptions::TopKDefault(5), "[5, 2, 4, 1, 0]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(10), "[5, 2, 4, 1, 0, 3]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(0), "[]");
+
+  // NaNs sort after other values but before nulls
+  values = ArrayFromJSON(float64(), "[NaN, null, 1, NaN, 2]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(4), "[4, 2, 0, 3]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(4), "[2, 4, 0, 3]");
+
+  // Ties are broken by index
+  values = ArrayFromJSON(utf8(), R"(["b", "a", "c", "a", "b"])");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(4), "[1, 3, 0, 4]");
+  AssertSelectK(values, SelectKOptions::TopKDefault(2), "[2, 0]");
+
+  AssertSelectK(ArrayFromJSON(int32(), "[]"), SelectKOptions::TopKDefault(3), "[]");
+}
+
+TEST_F(TestSelectKUnstable, ChunkedArray) {
+  auto values =
+      ChunkedArrayFromJSON(int64(), {"[4, null]", "[]", "[7, 1, 4]", "[null, 9]"});
+  AssertSelectK(values, SelectKOptions::TopKDefault(3), "[6, 2, 0]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(4), "[3, 0, 4, 2]");
+  AssertSelectK(values, SelectKOptions::BottomKDefault(7), "[3, 0, 4, 2, 6, 1, 5]");
+
+  values = ChunkedArrayFromJSON(int64(), {});
+  AssertSelectK(values, SelectKOptions::TopKDefault(3), "[]");
+}
+
+TEST_F(TestSelectKUnstable, Table) {
+  auto table = MakeTable({"name", "revenue", "units"}, {utf8(), float64(), int32()},
+                         {{R"(["a", "b", "c"])", R"(["d", "e", "f", "g"])"},
+                          {"[10, 20.5, null]", "[10, 30, 20.5, 5]"},
+                          {"[1, 2, 3, 4]", "[5, 6, 7]"}});
+  AssertSelectK(table, SelectKOptions::TopKDefault(3, {"revenue"}), "[4, 1, 5]");
+  AssertSelectK(table, SelectKOptions::BottomKDefault(2, {"revenue"}), "[6, 0]");
+
+  // Secondary keys break ties on the first one
+  SelectKOptions options(4, {SortKey("revenue", SortOrder::Descending),
+                             SortKey("units", SortOrder::Descending)});
+  AssertSelectK(table, options, "[4, 5, 1, 3]");
+  options.sort_keys = {SortKey("revenue"), SortKey("name", SortOrder::Descending)};
+  AssertSelectK(table, options, "[6, 3, 0, 5]");
+
+  // Record batches are supported as well
+  ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunks());
+  TableBatchReader reader(*combined);
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader.ReadNext(&batch));
+  AssertSelectK(batch, SelectKOptions::TopKDefault(3, {"revenue"}), "[4, 1, 5]");
+}
+
+TEST_F(TestSelectKUnstable, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  ASSERT_RAISES(Invalid, CallFunction("select_k_unstable", {values}));
+  ASSERT_RAISES(Invalid, SelectKUnstable(values, SelectKOptions(-1)));
+  ASSERT_RAISES(Invalid,
+                SelectKUnstable(values, SelectKOptions(1, {SortKey("a"), SortKey("b")})));
+  ASSERT_RAISES(NotImplemented,
+                SelectKUnstable(ArrayFromJSON(null(), "[null]"), SelectKOptions(1)));
+
+  auto table = MakeTable({"a"}, {int32()}, {{"[1, 2]"}});
+  ASSERT_RAISES(Invalid, SelectKUnstable(table, SelectKOptions(1)));
+  ASSERT_RAISES(Invalid, SelectKUnstable(table, SelectKOptions::TopKDefault(1, {"b"})));
+}
+
+TEST_F(TestSelectKUnstable, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487658);
+  const int64_t chunk_length = 50000;
+  const int num_chunks = 6;
+
+  ArrayVector chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rand.Int64(chunk_length, -1000, 1000, /*null_probability=*/0.1));
+  }
+  auto values = std::make_shared<ChunkedArray>(chunks);
+  ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(chunks));
+  const auto& array = checked_cast<const Int64Array&>(*concatenated);
+
+  // Reference: stable sort with nulls at the end
+  for (auto order : {SortOrder::Ascending, SortOrder::Descending}) {
+    std::vector<uint64_t> expected(array.length());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](uint64_t l, uint64_t r) {
+      if (array.IsNull(l) || array.IsNull(r)) return array.IsValid(l) && array.IsNull(r);
+      return order == SortOrder::Ascending ? array.Value(l) < array.Value(r)
+                                           : array.Value(r) < array.Value(l);
+    });
+
+    for (const int64_t k : {1, 100, 5000}) {
+      for (bool use_threads : {false, true}) {
+        ExecContext ctx;
+        ctx.set_use_threads(use_threads);
+        SelectKOptions options(k, {SortKey("", order)});
+        ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(values, options, &ctx));
+        ASSERT_EQ(indices->length(), k);
+        const auto& actual = checked_cast<const UInt64Array&>(*indices);
+        for (int64_t i = 0; i < k; ++i) {
+          ASSERT_EQ(expected[i], actual.Value(i)) << "k = " << k << ", i = " << i;
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
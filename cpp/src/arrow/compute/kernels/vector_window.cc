@@ -0,0 +1,880 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vector kernels computing running totals, sliding window aggregates and
+// shifts. The first two carry state between the batches of chunked inputs.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_writer.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+#ifndef __has_builtin
+#define __has_builtin(x) 0
+#endif
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::FirstTimeBitmapWriter;
+using internal::OptionalParallelFor;
+
+namespace compute {
+namespace internal {
+namespace {
+
+// Inputs are split into pieces of about this many values, computed in
+// parallel if the context allows threads
+constexpr int64_t kParallelPieceLength = 1 << 16;
+
+// Whether the pieces of a kernel may be computed in parallel.  Not from a CPU
+// pool task, which would block its worker waiting for tasks queued behind it.
+bool CanComputeInParallel(KernelContext* ctx) {
+  return ctx->exec_context()->use_threads() &&
+         !::arrow::internal::GetCpuThreadPool()->OwnsThisThread();
+}
+
+// Return the boundaries of the pieces of [0, length). They are multiples of 8,
+// so that the pieces of an output bitmap can be written concurrently.
+std::vector<int64_t> SplitIntoPieces(KernelContext* ctx, int64_t length) {
+  int64_t num_pieces = 1;
+  if (CanComputeInParallel(ctx)) {
+    num_pieces = std::min<int64_t>(length / kParallelPieceLength,
+                                   4 * static_cast<int64_t>(GetCpuThreadPoolCapacity()));
+    num_pieces = std::max<int64_t>(num_pieces, 1);
+  }
+  std::vector<int64_t> bounds(num_pieces + 1);
+  for (int64_t i = 0; i < num_pieces; ++i) {
+    bounds[i] = BitUtil::RoundDown(length * i / num_pieces, 8);
+  }
+  bounds[num_pieces] = length;
+  return bounds;
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, bool> IsNaN(T value) {
+  return std::isnan(value);
+}
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, bool> IsNaN(T) {
+  return false;
+}
+
+// Overflow checks for compilers without the overflow builtins
+
+template <typename T>
+enable_if_t<std::is_signed<T>::value, bool> AddOverflows(T left, T right, T result) {
+  // Overflow iff both operands have a sign different from the result's
+  return ((left ^ result) & (right ^ result)) < 0;
+}
+
+template <typename T>
+enable_if_t<std::is_unsigned<T>::value, bool> AddOverflows(T left, T, T result) {
+  return result < left;
+}
+
+template <typename T>
+bool MultiplyOverflows(T left, T right, T result) {
+  if (std::is_signed<T>::value && left == static_cast<T>(-1)) {
+    return right == std::numeric_limits<T>::min();
+  }
+  return left != 0 && result / left != right;
+}
+
+// ----------------------------------------------------------------------
+// Running totals
+
+// The operations combine a running total with the next value. Integer sums
+// and products wrap around on overflow, or set *overflow for the checked
+// variants. kOrderIndependent is true for the operations whose floating point
+// results don't depend on how the values are grouped, allowing to compute the
+// pieces of an input in parallel (integer results never depend on it).
+
+struct CumulativeSum {
+  using Unchecked = CumulativeSum;
+  static constexpr bool kOrderIndependent = false;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right, bool*) {
+    using Unsigned = typename std::make_unsigned<decltype(left + right)>::type;
+    return static_cast<T>(static_cast<Unsigned>(left) + static_cast<Unsigned>(right));
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return left + right;
+  }
+};
+
+struct CumulativeSumChecked {
+  using Unchecked = CumulativeSum;
+  static constexpr bool kOrderIndependent = false;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right,
+                                                         bool* overflow) {
+    T result;
+#if __has_builtin(__builtin_add_overflow)
+    *overflow |= __builtin_add_overflow(left, right, &result);
+#else
+    result = CumulativeSum::Call(left, right, overflow);
+    *overflow |= AddOverflows(left, right, result);
+#endif
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return left + right;
+  }
+};
+
+struct CumulativeProduct {
+  using Unchecked = CumulativeProduct;
+  static constexpr bool kOrderIndependent = false;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right, bool*) {
+    // Narrow integers are promoted to int, whose overflow is undefined
+    using Unsigned = typename std::make_unsigned<decltype(left * right)>::type;
+    return static_cast<T>(static_cast<Unsigned>(left) * static_cast<Unsigned>(right));
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return left * right;
+  }
+};
+
+struct CumulativeProductChecked {
+  using Unchecked = CumulativeProduct;
+  static constexpr bool kOrderIndependent = false;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right,
+                                                         bool* overflow) {
+    T result;
+#if __has_builtin(__builtin_mul_overflow)
+    *overflow |= __builtin_mul_overflow(left, right, &result);
+#else
+    result = CumulativeProduct::Call(left, right, overflow);
+    *overflow |= MultiplyOverflows(left, right, result);
+#endif
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return left * right;
+  }
+};
+
+// NaNs are ignored by std::fmin and std::fmax, as in the min_max aggregate
+
+struct CumulativeMin {
+  using Unchecked = CumulativeMin;
+  static constexpr bool kOrderIndependent = true;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right, bool*) {
+    return std::min(left, right);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return std::fmin(left, right);
+  }
+};
+
+struct CumulativeMax {
+  using Unchecked = CumulativeMax;
+  static constexpr bool kOrderIndependent = true;
+
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value, T> Call(T left, T right, bool*) {
+    return std::max(left, right);
+  }
+
+  template <typename T>
+  static enable_if_t<std::is_floating_point<T>::value, T> Call(T left, T right, bool*) {
+    return std::fmax(left, right);
+  }
+};
+
+template <typename T>
+struct RunningTotal {
+  T value = T(0);
+  // Whether a non-null value was accumulated
+  bool has_value = false;
+  // Whether a null was met without skip_nulls, so that all later outputs are
+  // null
+  bool poisoned = false;
+};
+
+// The running total after `prefix` followed by the values totalled in `piece`
+template <typename Op, typename T>
+RunningTotal<T> Concat(const RunningTotal<T>& prefix, const RunningTotal<T>& piece) {
+  RunningTotal<T> result = prefix;
+  if (prefix.poisoned) {
+    return result;
+  }
+  if (piece.has_value) {
+    bool ignored = false;
+    result.value =
+        prefix.has_value ? Op::Call(prefix.value, piece.value, &ignored) : piece.value;
+    result.has_value = true;
+  }
+  result.poisoned = piece.poisoned;
+  return result;
+}
+
+// Accumulate the values in [begin, end) of the input onto *total. If kEmit,
+// the running totals and their validity are written at the same positions of
+// the output.
+template <typename Op, bool kEmit, typename T>
+void Accumulate(const ArrayData& input, int64_t begin, int64_t end, bool skip_nulls,
+                RunningTotal<T>* total, T* out_values, uint8_t* out_bitmap,
+                bool* overflow) {
+  const T* values = input.GetValues<T>(1);
+  bool local_overflow = false;
+
+  if (input.GetNullCount() == 0 && !total->poisoned) {
+    int64_t i = begin;
+    if (!total->has_value && i < end) {
+      total->value = values[i];
+      total->has_value = true;
+      if (kEmit) {
+        out_values[i] = total->value;
+      }
+      ++i;
+    }
+    T value = total->value;
+    for (; i < end; ++i) {
+      value = Op::Call(value, values[i], &local_overflow);
+      if (kEmit) {
+        out_values[i] = value;
+      }
+    }
+    total->value = value;
+    if (kEmit) {
+      BitUtil::SetBitsTo(out_bitmap, begin, end - begin, true);
+    }
+    *overflow |= local_overflow;
+    return;
+  }
+
+  const uint8_t* bitmap = input.buffers[0] ? input.buffers[0]->data() : nullptr;
+  FirstTimeBitmapWriter writer(out_bitmap, begin, kEmit ? end - begin : 0);
+  for (int64_t i = begin; i < end; ++i) {
+    const bool valid = bitmap == nullptr || BitUtil::GetBit(bitmap, input.offset + i);
+    if (!valid && !skip_nulls) {
+      total->poisoned = true;
+    }
+    const bool emit_value = valid && !total->poisoned;
+    if (emit_value) {
+      total->value = total->has_value ? Op::Call(total->value, values[i], &local_overflow)
+                                      : values[i];
+      total->has_value = true;
+    }
+    if (kEmit) {
+      out_values[i] = emit_value ? total->value : T(0);
+      if (emit_value) {
+        writer.Set();
+      } else {
+        writer.Clear();
+      }
+      writer.Next();
+    }
+  }
+  if (kEmit) {
+    writer.Finish();
+  }
+  *overflow |= local_overflow;
+}
+
+template <typename T>
+struct CumulativeState : public KernelState {
+  explicit CumulativeState(CumulativeOptions options) : options(std::move(options)) {}
+
+  CumulativeOptions options;
+  // The total of the previous batches
+  RunningTotal<T> total;
+};
+
+template <typename Op, typename ArrowType>
+struct CumulativeKernel {
+  using T = typename ArrowType::c_type;
+  using State = CumulativeState<T>;
+
+  static std::unique_ptr<KernelState> Init(KernelContext*, const KernelInitArgs& args) {
+    auto options = static_cast<const CumulativeOptions*>(args.options);
+    return ::arrow::internal::make_unique<State>(options ? *options
+                                                         : CumulativeOptions::Defaults());
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+    T* out_values = output->GetMutableValues<T>(1);
+    uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+    const bool skip_nulls = state->options.skip_nulls;
+    output->null_count = kUnknownNullCount;
+
+    std::vector<int64_t> bounds = {0, input.length};
+    if (std::is_integral<T>::value || Op::kOrderIndependent) {
+      bounds = SplitIntoPieces(ctx, input.length);
+    }
+    const int num_pieces = static_cast<int>(bounds.size() - 1);
+    const bool parallel = num_pieces > 1 && CanComputeInParallel(ctx);
+    bool overflow = false;
+    if (num_pieces == 1) {
+      Accumulate<Op, /*kEmit=*/true>(input, 0, input.length, skip_nulls, &state->total,
+                                     out_values, out_bitmap, &overflow);
+    } else {
+      // A parallel prefix sum in two passes. The first one totals each piece
+      // on its own (an overflow shows in the second pass, which computes its
+      // values again).
+      std::vector<RunningTotal<T>> totals(num_pieces + 1);
+      KERNEL_RETURN_IF_ERROR(
+          ctx, OptionalParallelFor(parallel, num_pieces, [&](int i) {
+            bool ignored = false;
+            Accumulate<typename Op::Unchecked, /*kEmit=*/false>(
+                input, bounds[i], bounds[i + 1], skip_nulls, &totals[i + 1],
+                static_cast<T*>(nullptr), nullptr, &ignored);
+            return Status::OK();
+          }));
+      // Then totals[i] becomes the total before piece i
+      totals[0] = state->total;
+      for (int i = 1; i <= num_pieces; ++i) {
+        totals[i] = Concat<typename Op::Unchecked>(totals[i - 1], totals[i]);
+      }
+      std::vector<uint8_t> overflows(num_pieces, 0);
+      KERNEL_RETURN_IF_ERROR(
+          ctx, OptionalParallelFor(parallel, num_pieces, [&](int i) {
+            RunningTotal<T> total = totals[i];
+            bool piece_overflow = false;
+            Accumulate<Op, /*kEmit=*/true>(input, bounds[i], bounds[i + 1], skip_nulls,
+                                           &total, out_values, out_bitmap,
+                                           &piece_overflow);
+            overflows[i] = piece_overflow;
+            return Status::OK();
+          }));
+      state->total = totals[num_pieces];
+      overflow = std::any_of(overflows.begin(), overflows.end(),
+                             [](uint8_t piece_overflow) { return piece_overflow != 0; });
+    }
+    if (overflow) {
+      ctx->SetStatus(Status::Invalid("overflow"));
+    }
+  }
+};
+
+// ----------------------------------------------------------------------
+// Sliding windows
+
+// Integers are summed with wrap around, like in the sum aggregate, so that
+// removing a value from the window always cancels its addition
+template <typename Acc, typename Enable = void>
+struct WindowSum {
+  using Unsigned = typename std::make_unsigned<Acc>::type;
+
+  template <typename T>
+  void Add(T value) {
+    sum += static_cast<Unsigned>(static_cast<Acc>(value));
+  }
+
+  template <typename T>
+  void Remove(T value) {
+    sum -= static_cast<Unsigned>(static_cast<Acc>(value));
+  }
+
+  Acc Get() const { return static_cast<Acc>(sum); }
+
+  Unsigned sum = 0;
+};
+
+// Infinities and NaNs are counted rather than summed, so that the sum becomes
+// finite again once they leave the window
+template <typename Acc>
+struct WindowSum<Acc, enable_if_t<std::is_floating_point<Acc>::value>> {
+  template <typename T>
+  void Add(T value) {
+    Update(static_cast<Acc>(value), 1);
+  }
+
+  template <typename T>
+  void Remove(T value) {
+    Update(static_cast<Acc>(value), -1);
+  }
+
+  void Update(Acc value, int64_t sign) {
+    if (std::isnan(value)) {
+      nan_count += sign;
+    } else if (std::isinf(value)) {
+      (value > 0 ? pos_inf_count : neg_inf_count) += sign;
+    } else {
+      sum += sign > 0 ? value : -value;
+    }
+  }
+
+  Acc Get() const {
+    if (nan_count > 0 || (pos_inf_count > 0 && neg_inf_count > 0)) {
+      return std::numeric_limits<Acc>::quiet_NaN();
+    }
+    if (pos_inf_count > 0) {
+      return std::numeric_limits<Acc>::infinity();
+    }
+    if (neg_inf_count > 0) {
+      return -std::numeric_limits<Acc>::infinity();
+    }
+    return sum;
+  }
+
+  Acc sum = 0;
+  int64_t nan_count = 0;
+  int64_t pos_inf_count = 0;
+  int64_t neg_inf_count = 0;
+};
+
+// The window aggregates are updated with the non-null values entering and
+// leaving the window, identified by their position. kOrderIndependent has the
+// same meaning as for the running totals: an aggregate computed from a
+// different starting point yields the same result.
+
+template <typename ArrowType>
+struct RollingSumAgg {
+  using T = typename ArrowType::c_type;
+  using OutType = typename FindAccumulatorType<ArrowType>::Type;
+  using OutT = typename OutType::c_type;
+  static constexpr bool kOrderIndependent = std::is_integral<T>::value;
+
+  void Add(int64_t, T value) {
+    sum.Add(value);
+    ++count;
+  }
+
+  void Remove(int64_t, T value) {
+    sum.Remove(value);
+    --count;
+  }
+
+  OutT Get() const { return sum.Get(); }
+
+  WindowSum<OutT> sum;
+  int64_t count = 0;
+};
+
+template <typename ArrowType>
+struct RollingMeanAgg {
+  using T = typename ArrowType::c_type;
+  using OutType = DoubleType;
+  using OutT = double;
+  static constexpr bool kOrderIndependent = false;
+
+  void Add(int64_t, T value) {
+    sum.Add(value);
+    ++count;
+  }
+
+  void Remove(int64_t, T value) {
+    sum.Remove(value);
+    --count;
+  }
+
+  OutT Get() const { return sum.Get() / static_cast<double>(count); }
+
+  WindowSum<double> sum;
+  int64_t count = 0;
+};
+
+struct Less {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left < right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static bool Call(T left, T right) {
+    return left > right;
+  }
+};
+
+// The minimum (or maximum with Greater) in amortized constant time per value,
+// with a deque of the candidates for the result of the current and later
+// windows: the values which are smaller than all the values after them.
+template <typename ArrowType, typename Compare>
+struct RollingMinMaxAgg {
+  using T = typename ArrowType::c_type;
+  using OutType = ArrowType;
+  using OutT = T;
+  static constexpr bool kOrderIndependent = true;
+
+  void Add(int64_t position, T value) {
+    ++count;
+    if (IsNaN(value)) {
+      return;
+    }
+    while (!candidates.empty() && !Compare::Call(candidates.back().second, value)) {
+      candidates.pop_back();
+    }
+    candidates.emplace_back(position, value);
+  }
+
+  void Remove(int64_t position, T) {
+    --count;
+    if (!candidates.empty() && candidates.front().first == position) {
+      candidates.pop_front();
+    }
+  }
+
+  // The window only has NaNs if there are no candidates
+  OutT Get() const {
+    return candidates.empty() ? std::numeric_limits<T>::quiet_NaN()
+                              : candidates.front().second;
+  }
+
+  std::deque<std::pair<int64_t, T>> candidates;
+  int64_t count = 0;
+};
+
+template <typename ArrowType>
+using RollingMinAgg = RollingMinMaxAgg<ArrowType, Less>;
+
+template <typename ArrowType>
+using RollingMaxAgg = RollingMinMaxAgg<ArrowType, Greater>;
+
+template <typename T>
+struct RollingState : public KernelState {
+  RollingState(int64_t window_size, int64_t min_periods)
+      : window_size(window_size), min_periods(min_periods) {}
+
+  int64_t window_size;
+  int64_t min_periods;
+  // The last values of the previous batches which are in the windows of the
+  // next one, and their validity
+  std::vector<T> history_values;
+  std::vector<uint8_t> history_valid;
+};
+
+// The values of a batch preceded by those of the state's history, which have
+// negative positions
+template <typename T>
+struct WindowInput {
+  WindowInput(const ArrayData& input, const RollingState<T>& state)
+      : values(input.GetValues<T>(1)),
+        bitmap(input.buffers[0] ? input.buffers[0]->data() : nullptr),
+        offset(input.offset),
+        length(input.length),
+        history_values(state.history_values),
+        history_valid(state.history_valid),
+        history_length(static_cast<int64_t>(state.history_values.size())) {}
+
+  T Value(int64_t i) const {
+    return i < 0 ? history_values[history_length + i] : values[i];
+  }
+
+  bool IsValid(int64_t i) const {
+    if (i < 0) {
+      return history_valid[history_length + i] != 0;
+    }
+    return bitmap == nullptr || BitUtil::GetBit(bitmap, offset + i);
+  }
+
+  const T* values;
+  const uint8_t* bitmap;
+  int64_t offset;
+  int64_t length;
+  const std::vector<T>& history_values;
+  const std::vector<uint8_t>& history_valid;
+  int64_t history_length;
+};
+
+// Write the aggregates of the windows ending in [begin, end), starting from
+// the values of the first of these windows
+template <typename Agg, typename T, typename OutT>
+void Roll(const WindowInput<T>& input, int64_t window_size, int64_t min_periods,
+          int64_t begin, int64_t end, OutT* out_values, uint8_t* out_bitmap) {
+  Agg agg;
+  const int64_t start = std::max(begin - (window_size - 1), -input.history_length);
+  FirstTimeBitmapWriter writer(out_bitmap, begin, end - begin);
+  for (int64_t i = start; i < end; ++i) {
+    const int64_t leaving = i - window_size;
+    if (leaving >= start && input.IsValid(leaving)) {
+      agg.Remove(leaving, input.Value(leaving));
+    }
+    if (input.IsValid(i)) {
+      agg.Add(i, input.Value(i));
+    }
+    if (i >= begin) {
+      if (agg.count >= min_periods) {
+        out_values[i] = agg.Get();
+        writer.Set();
+      } else {
+        out_values[i] = OutT(0);
+        writer.Clear();
+      }
+      writer.Next();
+    }
+  }
+  writer.Finish();
+}
+
+template <typename Agg>
+struct RollingKernel {
+  using T = typename Agg::T;
+  using OutT = typename Agg::OutT;
+  using State = RollingState<T>;
+
+  static std::unique_ptr<KernelState> Init(KernelContext* ctx,
+                                           const KernelInitArgs& args) {
+    auto options = static_cast<const RollingOptions*>(args.options);
+    if (options == nullptr) {
+      ctx->SetStatus(Status::Invalid("Rolling functions require RollingOptions"));
+      return nullptr;
+    }
+    const int64_t window_size = options->window_size;
+    const int64_t min_periods =
+        options->min_periods < 0 ? window_size : options->min_periods;
+    if (window_size < 1) {
+      ctx->SetStatus(
+          Status::Invalid("Rolling window size must be positive, got ", window_size));
+      return nullptr;
+    }
+    if (min_periods < 1 || min_periods > window_size) {
+      ctx->SetStatus(Status::Invalid("Rolling min_periods must be between 1 and the ",
+                                     "window size, got ", min_periods));
+      return nullptr;
+    }
+    return ::arrow::internal::make_unique<State>(window_size, min_periods);
+  }
+
+  static void Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+    auto state = checked_cast<State*>(ctx->state());
+    const ArrayData& input = *batch[0].array();
+    ArrayData* output = out->mutable_array();
+    OutT* out_values = output->GetMutableValues<OutT>(1);
+    uint8_t* out_bitmap = output->buffers[0]->mutable_data();
+    output->null_count = kUnknownNullCount;
+
+    const WindowInput<T> window_input(input, *state);
+    const int64_t window_size = state->window_size;
+    const int64_t min_periods = state->min_periods;
+
+    std::vector<int64_t> bounds = {0, input.length};
+    if (Agg::kOrderIndependent) {
+      bounds = SplitIntoPieces(ctx, input.length);
+      // Each piece first adds the values of its first window before its
+      // start, which is only worth it if windows are much smaller than pieces
+      if (bounds.size() > 2 && 4 * window_size > bounds[1]) {
+        bounds = {0, input.length};
+      }
+    }
+    const int num_pieces = static_cast<int>(bounds.size() - 1);
+    const bool parallel = num_pieces > 1 && CanComputeInParallel(ctx);
+    KERNEL_RETURN_IF_ERROR(
+        ctx, OptionalParallelFor(parallel, num_pieces, [&](int i) {
+          Roll<Agg>(window_input, window_size, min_periods, bounds[i], bounds[i + 1],
+                    out_values, out_bitmap);
+          return Status::OK();
+        }));
+
+    // Keep the values in the windows of the next batch
+    std::vector<T> history_values;
+    std::vector<uint8_t> history_valid;
+    const int64_t history_start =
+        std::max(input.length - (window_size - 1), -window_input.history_length);
+    for (int64_t i = history_start; i < input.length; ++i) {
+      history_values.push_back(window_input.Value(i));
+      history_valid.push_back(window_input.IsValid(i));
+    }
+    state->history_values = std::move(history_values);
+    state->history_valid = std::move(history_valid);
+  }
+};
+
+// ----------------------------------------------------------------------
+// Shift (lag and lead)
+
+const ShiftOptions* GetDefaultShiftOptions() {
+  static const auto kDefaultShiftOptions = ShiftOptions::Defaults();
+  return &kDefaultShiftOptions;
+}
+
+// A meta function as it handles inputs of any type, and shifts chunked inputs
+// by slicing them rather than by executing a kernel on each chunk
+class ShiftMetaFunction : public MetaFunction {
+ public:
+  ShiftMetaFunction() : MetaFunction("shift", Arity::Unary(), GetDefaultShiftOptions()) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const int64_t periods = static_cast<const ShiftOptions&>(*options).periods;
+    const Datum& values = args[0];
+    if (!values.is_arraylike()) {
+      return Status::TypeError("shift expects an array-like input");
+    }
+    const int64_t length = values.length();
+    const int64_t num_nulls = periods >= 0 ? std::min(periods, length)
+                                           : (periods < -length ? length : -periods);
+    const int64_t kept_offset = periods >= 0 ? 0 : num_nulls;
+    ARROW_ASSIGN_OR_RAISE(auto nulls,
+                          MakeArrayOfNull(values.type(), num_nulls, ctx->memory_pool()));
+
+    if (values.kind() == Datum::ARRAY) {
+      auto kept = values.make_array()->Slice(kept_offset, length - num_nulls);
+      if (num_nulls == 0) {
+        return values;
+      }
+      if (kept->length() == 0) {
+        return nulls;
+      }
+      ArrayVector pieces =
+          periods >= 0 ? ArrayVector{nulls, kept} : ArrayVector{kept, nulls};
+      ARROW_ASSIGN_OR_RAISE(auto shifted, Concatenate(pieces, ctx->memory_pool()));
+      return shifted;
+    }
+
+    auto kept = values.chunked_array()->Slice(kept_offset, length - num_nulls);
+    ArrayVector chunks = kept->chunks();
+    if (num_nulls > 0) {
+      chunks.insert(periods >= 0 ? chunks.begin() : chunks.end(), nulls);
+    }
+    return std::make_shared<ChunkedArray>(std::move(chunks), values.type());
+  }
+};
+
+// ----------------------------------------------------------------------
+// Registration
+
+const CumulativeOptions* GetDefaultCumulativeOptions() {
+  static const auto kDefaultCumulativeOptions = CumulativeOptions::Defaults();
+  return &kDefaultCumulativeOptions;
+}
+
+// The outputs are preallocated, with a validity bitmap written by the kernels,
+// and depend on the state left by the previous batches
+VectorKernel WindowKernelBase() {
+  VectorKernel base;
+  base.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+  base.mem_allocation = MemAllocation::PREALLOCATE;
+  base.ordered_batches = true;
+  return base;
+}
+
+template <typename KernelType>
+void AddWindowKernel(std::shared_ptr<DataType> in_type,
+                     std::shared_ptr<DataType> out_type, VectorFunction* func) {
+  VectorKernel kernel = WindowKernelBase();
+  kernel.signature =
+      KernelSignature::Make({InputType::Array(std::move(in_type))}, std::move(out_type));
+  kernel.init = KernelType::Init;
+  kernel.exec = KernelType::Exec;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+template <typename Op, typename ArrowType>
+void AddCumulativeKernel(VectorFunction* func) {
+  auto type = TypeTraits<ArrowType>::type_singleton();
+  AddWindowKernel<CumulativeKernel<Op, ArrowType>>(type, type, func);
+}
+
+template <typename Op>
+void RegisterCumulativeFunction(FunctionRegistry* registry, std::string name) {
+  auto func = std::make_shared<VectorFunction>(std::move(name), Arity::Unary(),
+                                               GetDefaultCumulativeOptions());
+  AddCumulativeKernel<Op, Int8Type>(func.get());
+  AddCumulativeKernel<Op, Int16Type>(func.get());
+  AddCumulativeKernel<Op, Int32Type>(func.get());
+  AddCumulativeKernel<Op, Int64Type>(func.get());
+  AddCumulativeKernel<Op, UInt8Type>(func.get());
+  AddCumulativeKernel<Op, UInt16Type>(func.get());
+  AddCumulativeKernel<Op, UInt32Type>(func.get());
+  AddCumulativeKernel<Op, UInt64Type>(func.get());
+  AddCumulativeKernel<Op, FloatType>(func.get());
+  AddCumulativeKernel<Op, DoubleType>(func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+template <template <typename> class Agg, typename ArrowType>
+void AddRollingKernel(VectorFunction* func) {
+  using OutType = typename Agg<ArrowType>::OutType;
+  AddWindowKernel<RollingKernel<Agg<ArrowType>>>(TypeTraits<ArrowType>::type_singleton(),
+                                                 TypeTraits<OutType>::type_singleton(),
+                                                 func);
+}
+
+// Rolling functions have no default options, as there is no default window size
+template <template <typename> class Agg>
+void RegisterRollingFunction(FunctionRegistry* registry, std::string name) {
+  auto func = std::make_shared<VectorFunction>(std::move(name), Arity::Unary());
+  AddRollingKernel<Agg, Int8Type>(func.get());
+  AddRollingKernel<Agg, Int16Type>(func.get());
+  AddRollingKernel<Agg, Int32Type>(func.get());
+  AddRollingKernel<Agg, Int64Type>(func.get());
+  AddRollingKernel<Agg, UInt8Type>(func.get());
+  AddRollingKernel<Agg, UInt16Type>(func.get());
+  AddRollingKernel<Agg, UInt32Type>(func.get());
+  AddRollingKernel<Agg, UInt64Type>(func.get());
+  AddRollingKernel<Agg, FloatType>(func.get());
+  AddRollingKernel<Agg, DoubleType>(func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+}
+
+}  // namespace
+
+void RegisterVectorWindow(FunctionRegistry* registry) {
+  RegisterCumulativeFunction<CumulativeSum>(registry, "cumulative_sum");
+  RegisterCumulativeFunction<CumulativeSumChecked>(registry, "cumulative_sum_checked");
+  RegisterCumulativeFunction<CumulativeProduct>(registry, "cumulative_prod");
+  RegisterCumulativeFunction<CumulativeProductChecked>(registry,
+                                                       "cumulative_prod_checked");
+  RegisterCumulativeFunction<CumulativeMin>(registry, "cumulative_min");
+  RegisterCumulativeFunction<CumulativeMax>(registry, "cumulative_max");
+
+  RegisterRollingFunction<RollingSumAgg>(registry, "rolling_sum");
+  RegisterRollingFunction<RollingMeanAgg>(registry, "rolling_mean");
+  RegisterRollingFunction<RollingMinAgg>(registry, "rolling_min");
+  RegisterRollingFunction<RollingMaxAgg>(registry, "rolling_max");
+
+  DCHECK_OK(registry->AddFunction(std::make_shared<ShiftMetaFunction>()));
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/benchmark_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+static void WindowBenchmark(benchmark::State& state, const std::string& func_name,
+                            const FunctionOptions& options, bool use_threads) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  ExecContext ctx;
+  ctx.set_use_threads(use_threads);
+  for (auto _ : state) {
+    ABORT_NOT_OK(CallFunction(func_name, {values}, &options, &ctx).status());
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void CumulativeSumInt64(benchmark::State& state) {
+  WindowBenchmark(state, "cumulative_sum", CumulativeOptions(/*skip_nulls=*/true),
+                  /*use_threads=*/false);
+}
+
+// Split into pieces computed in parallel with two passes over the data
+static void CumulativeSumInt64Threaded(benchmark::State& state) {
+  WindowBenchmark(state, "cumulative_sum", CumulativeOptions(/*skip_nulls=*/true),
+                  /*use_threads=*/true);
+}
+
+static void RollingMeanInt64(benchmark::State& state) {
+  WindowBenchmark(state, "rolling_mean", RollingOptions(/*window_size=*/100),
+                  /*use_threads=*/false);
+}
+
+static void RollingMaxInt64(benchmark::State& state) {
+  WindowBenchmark(state, "rolling_max", RollingOptions(/*window_size=*/100),
+                  /*use_threads=*/false);
+}
+
+static void RollingMaxInt64Threaded(benchmark::State& state) {
+  WindowBenchmark(state, "rolling_max", RollingOptions(/*window_size=*/100),
+                  /*use_threads=*/true);
+}
+
+BENCHMARK(CumulativeSumInt64)->Apply(RegressionSetArgs);
+BENCHMARK(CumulativeSumInt64Threaded)->Apply(RegressionSetArgs)->UseRealTime();
+BENCHMARK(RollingMeanInt64)->Apply(RegressionSetArgs);
+BENCHMARK(RollingMaxInt64)->Apply(RegressionSetArgs);
+BENCHMARK(RollingMaxInt64Threaded)->Apply(RegressionSetArgs)->UseRealTime();
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compare.h"
+#include "arrow/compute/api.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/result.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+void AssertArraysEqualWithNaNs(const std::shared_ptr<Array>& expected,
+                               const Datum& actual) {
+  std::stringstream diff;
+  ASSERT_TRUE(expected->Equals(*actual.make_array(),
+                               EqualOptions().nans_equal(true).diff_sink(&diff)))
+      << diff.str();
+}
+
+template <typename ArrowType>
+class TestCumulative : public ::testing::Test {
+ protected:
+  std::shared_ptr<DataType> type_singleton() {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  void Check(const std::string& func_name, const std::string& input,
+             const std::string& expected,
+             const CumulativeOptions& options = CumulativeOptions::Defaults()) {
+    ASSERT_OK_AND_ASSIGN(
+        Datum actual,
+        CallFunction(func_name, {ArrayFromJSON(type_singleton(), input)}, &options));
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type_singleton(), expected), *actual.make_array(),
+                      /*verbose=*/true);
+  }
+};
+
+TYPED_TEST_SUITE(TestCumulative, NumericArrowTypes);
+
+TYPED_TEST(TestCumulative, Basics) {
+  for (std::string func_name : {"cumulative_sum", "cumulative_sum_checked"}) {
+    this->Check(func_name, "[]", "[]");
+    this->Check(func_name, "[1, 2, 3, 4]", "[1, 3, 6, 10]");
+    this->Check(func_name, "[null, 1, 2, null, 3]", "[null, null, null, null, null]");
+    this->Check(func_name, "[null, 1, 2, null, 3]", "[null, 1, 3, null, 6]",
+                CumulativeOptions(/*skip_nulls=*/true));
+  }
+  for (std::string func_name : {"cumulative_prod", "cumulative_prod_checked"}) {
+    this->Check(func_name, "[1, 2, 3, 4]", "[1, 2, 6, 24]");
+    this->Check(func_name, "[2, 1, null, 3]", "[2, 2, null, null]");
+  }
+  this->Check("cumulative_min", "[3, 4, 1, null, 2, 0]", "[3, 3, 1, null, null, null]");
+  this->Check("cumulative_min", "[3, 4, 1, null, 2, 0]", "[3, 3, 1, null, 1, 0]",
+              CumulativeOptions(/*skip_nulls=*/true));
+  this->Check("cumulative_max", "[3, 4, 1, 5]", "[3, 4, 4, 5]");
+}
+
+TEST(TestCumulative, Overflow) {
+  auto values = ArrayFromJSON(int8(), "[100, 27, 1, -5]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, CumulativeSum(values));
+  AssertDatumsEqual(ArrayFromJSON(int8(), "[100, 127, -128, 123]"), actual);
+  ASSERT_RAISES(Invalid, CumulativeSum(values, CumulativeOptions(false, true)));
+
+  // An overflow after a null is never computed
+  values = ArrayFromJSON(int8(), "[100, null, 100]");
+  ASSERT_OK(CumulativeSum(values, CumulativeOptions(false, true)));
+  ASSERT_RAISES(Invalid, CumulativeSum(values, CumulativeOptions(true, true)));
+
+  values = ArrayFromJSON(uint16(), "[256, 256]");
+  ASSERT_OK_AND_ASSIGN(actual, CumulativeProduct(values));
+  AssertDatumsEqual(ArrayFromJSON(uint16(), "[256, 0]"), actual);
+  ASSERT_RAISES(Invalid, CumulativeProduct(values, CumulativeOptions(false, true)));
+}
+
+TEST(TestCumulative, FloatingPoint) {
+  auto values = ArrayFromJSON(float64(), "[NaN, 2, 1, NaN, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, CumulativeMin(values));
+  AssertArraysEqualWithNaNs(ArrayFromJSON(float64(), "[NaN, 2, 1, 1, 1]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, CumulativeSum(ArrayFromJSON(float32(), "[0.5, 1.5, 2]")));
+  AssertDatumsEqual(ArrayFromJSON(float32(), "[0.5, 2, 4]"), actual);
+}
+
+TEST(TestCumulative, ChunkedArray) {
+  // The totals are carried over chunks, including empty ones
+  auto values = ChunkedArrayFromJSON(int32(), {"[1, 2]", "[]", "[3]", "[null, 4]"});
+  ASSERT_OK_AND_ASSIGN(Datum actual, CumulativeSum(values));
+  AssertDatumsEqual(ChunkedArrayFromJSON(int32(), {"[1, 3]", "[6]", "[null, null]"}),
+                    actual);
+  ASSERT_OK_AND_ASSIGN(actual, CumulativeSum(values, CumulativeOptions(true)));
+  AssertDatumsEqual(ChunkedArrayFromJSON(int32(), {"[1, 3]", "[6]", "[null, 10]"}),
+                    actual);
+  ASSERT_OK_AND_ASSIGN(actual, CumulativeMax(values, CumulativeOptions(true)));
+  AssertDatumsEqual(ChunkedArrayFromJSON(int32(), {"[1, 2]", "[3]", "[null, 4]"}),
+                    actual);
+}
+
+TEST(TestCumulative, Parallel) {
+  // Long enough to be split into pieces computed in two passes. The results
+  // must be those of a sequential computation.
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = (1 << 18) + 13;
+  auto values = rand.Int64(length, -1000, 1000, /*null_probability=*/0.001);
+  auto no_nulls = rand.Int64(length, -1000, 1000, /*null_probability=*/0);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 7), values->Slice(7, 100000), values->Slice(100007)});
+
+  ExecContext serial_ctx, parallel_ctx;
+  serial_ctx.set_use_threads(false);
+  parallel_ctx.set_use_threads(true);
+
+  for (std::string func_name : {"cumulative_sum_checked", "cumulative_min"}) {
+    for (bool skip_nulls : {false, true}) {
+      SCOPED_TRACE(func_name + (skip_nulls ? " skipping nulls" : ""));
+      CumulativeOptions options(skip_nulls);
+      for (const Datum& input : {Datum(values), Datum(no_nulls), Datum(chunked)}) {
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             CallFunction(func_name, {input}, &options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(Datum actual,
+                             CallFunction(func_name, {input}, &options, &parallel_ctx));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+
+  // An overflow is detected in any piece
+  auto ones = rand.Int16(length, 1, 1, /*null_probability=*/0);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("overflow"),
+      CumulativeSum(ones, CumulativeOptions(false, true), &parallel_ctx));
+}
+
+TEST(TestCumulative, FromCpuThreadPoolTask) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = (1 << 18) + 13;
+  auto values = rand.Int64(length, -1000, 1000, /*null_probability=*/0.001);
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ASSERT_OK_AND_ASSIGN(Datum expected,
+                       CumulativeSum(values, CumulativeOptions(), &serial_ctx));
+
+  // From a pool task the pieces are computed inline, so every worker can be
+  // busy at once without deadlocking
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  std::vector<Future<Datum>> futures;
+  for (int i = 0; i < pool->GetCapacity() + 1; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, pool->Submit([&]() -> Result<Datum> {
+      ExecContext ctx;
+      ctx.set_use_threads(true);
+      return CumulativeSum(values, CumulativeOptions(), &ctx);
+    }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, future.result());
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
+TEST(TestRolling, Basics) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, null, 4, 5, 6]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, RollingSum(values, RollingOptions(2)));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[null, 3, null, null, 9, 11]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingSum(values, RollingOptions(2, 1)));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 3, 2, 4, 9, 11]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMean(values, RollingOptions(3, 2)));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[null, 1.5, 1.5, 3, 4.5, 5]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMin(values, RollingOptions(3, 1)));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 1, 1, 2, 4, 4]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMax(values, RollingOptions(3, 1)));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, 2, 4, 5, 6]"), actual);
+
+  // Windows larger than the input
+  ASSERT_OK_AND_ASSIGN(actual, RollingMax(values, RollingOptions(10, 1)));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2, 2, 4, 5, 6]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMax(values, RollingOptions(10)));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[null, null, null, null, null, null]"),
+                    actual);
+
+  ASSERT_OK_AND_ASSIGN(actual, RollingSum(ArrayFromJSON(uint8(), "[200, 200, 200]"),
+                                          RollingOptions(3)));
+  AssertDatumsEqual(ArrayFromJSON(uint64(), "[null, null, 600]"), actual);
+}
+
+TEST(TestRolling, FloatingPoint) {
+  auto values = ArrayFromJSON(float64(), "[1, Inf, 2, -Inf, 3, 4, NaN, 5, 6, 7]");
+  ASSERT_OK_AND_ASSIGN(Datum actual, RollingSum(values, RollingOptions(2)));
+  // The sums become finite again when the infinities leave the windows
+  AssertArraysEqualWithNaNs(
+      ArrayFromJSON(float64(), "[null, Inf, Inf, -Inf, -Inf, 7, NaN, NaN, 11, 13]"),
+      actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingSum(values, RollingOptions(3)));
+  AssertArraysEqualWithNaNs(
+      ArrayFromJSON(float64(), "[null, null, Inf, NaN, -Inf, -Inf, NaN, NaN, NaN, 18]"),
+      actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMin(values, RollingOptions(2)));
+  AssertArraysEqualWithNaNs(
+      ArrayFromJSON(float64(), "[null, 1, 2, -Inf, -Inf, 3, 4, 5, 5, 6]"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMax(ArrayFromJSON(float32(), "[NaN, NaN, 1]"),
+                                          RollingOptions(2)));
+  AssertArraysEqualWithNaNs(ArrayFromJSON(float32(), "[null, NaN, 1]"), actual);
+}
+
+TEST(TestRolling, ChunkedArray) {
+  // Windows span several chunks
+  auto values =
+      ChunkedArrayFromJSON(int64(), {"[1]", "[2, 3]", "[]", "[null]", "[5, 6]"});
+  ASSERT_OK_AND_ASSIGN(Datum actual, RollingSum(values, RollingOptions(3, 2)));
+  AssertDatumsEqual(
+      ChunkedArrayFromJSON(int64(), {"[null]", "[3, 6]", "[5]", "[8, 11]"}), actual);
+  ASSERT_OK_AND_ASSIGN(actual, RollingMin(values, RollingOptions(4, 1)));
+  AssertDatumsEqual(ChunkedArrayFromJSON(int64(), {"[1]", "[1, 1]", "[1]", "[2, 3]"}),
+                    actual);
+}
+
+TEST(TestRolling, Parallel) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = (1 << 18) + 13;
+  auto values = rand.Int32(length, -1000, 1000, /*null_probability=*/0.01);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 100003), values->Slice(100003)});
+
+  ExecContext serial_ctx, parallel_ctx;
+  serial_ctx.set_use_threads(false);
+  parallel_ctx.set_use_threads(true);
+
+  RollingOptions options(/*window_size=*/100, /*min_periods=*/50);
+  for (std::string func_name : {"rolling_sum", "rolling_max"}) {
+    SCOPED_TRACE(func_name);
+    for (const Datum& input : {Datum(values), Datum(chunked)}) {
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(func_name, {input}, &options, &serial_ctx));
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           CallFunction(func_name, {input}, &options, &parallel_ctx));
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+}
+
+TEST(TestRolling, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, CallFunction("rolling_sum", {values}));
+  ASSERT_RAISES(Invalid, RollingSum(values, RollingOptions(0)));
+  ASSERT_RAISES(Invalid, RollingSum(values, RollingOptions(2, 0)));
+  ASSERT_RAISES(Invalid, RollingSum(values, RollingOptions(2, 3)));
+  ASSERT_RAISES(NotImplemented,
+                RollingSum(ArrayFromJSON(utf8(), "[]"), RollingOptions(2)));
+}
+
+TEST(TestShift, Array) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", null, "d"])");
+  ASSERT_OK_AND_ASSIGN(Datum actual, Shift(values));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"([null, "a", "b", null])"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, Shift(values, ShiftOptions(-3)));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["d", null, null, null])"), actual);
+  ASSERT_OK_AND_ASSIGN(actual, Shift(values, ShiftOptions(0)));
+  AssertDatumsEqual(values, actual);
+  for (int64_t periods :
+       {int64_t(4), int64_t(100), std::numeric_limits<int64_t>::min()}) {
+    ASSERT_OK_AND_ASSIGN(actual, Shift(values, ShiftOptions(periods)));
+    AssertDatumsEqual(ArrayFromJSON(utf8(), "[null, null, null, null]"), actual);
+  }
+}
+
+TEST(TestShift, ChunkedArray) {
+  auto values = ChunkedArrayFromJSON(int16(), {"[1, 2]", "[3]", "[4, 5]"});
+  ASSERT_OK_AND_ASSIGN(Datum actual, Shift(values, ShiftOptions(2)));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, actual.kind());
+  AssertChunkedEquivalent(*ChunkedArrayFromJSON(int16(), {"[null, null, 1, 2, 3]"}),
+                          *actual.chunked_array());
+  ASSERT_OK_AND_ASSIGN(actual, Shift(values, ShiftOptions(-1)));
+  AssertChunkedEquivalent(*ChunkedArrayFromJSON(int16(), {"[2, 3, 4, 5, null]"}),
+                          *actual.chunked_array());
+  ASSERT_RAISES(TypeError, Shift(Datum(int64_t(1))));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -108,12 +108,15 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
 
   // Aggregate functions
   RegisterScalarAggregateBasic(registry.get());
+  RegisterScalarAggregateApproximate(registry.get());
+  RegisterScalarAggregateQuantile(registry.get());
 
   // Vector functions
   RegisterVectorHash(registry.get());
   RegisterVectorSelection(registry.get());
   RegisterVectorNested(registry.get());
   RegisterVectorSort(registry.get());
+  RegisterVectorWindow(registry.get());
 
   return registry;
 }
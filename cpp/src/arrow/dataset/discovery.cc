@@ -175,24 +175,36 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     options.partition_base_dir = selector.base_dir;
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
-
-  // Filter out anything that's not a file or that's explicitly ignored
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile() ||
-            StartsWithAnyOf(info.path(), options.selector_ignore_prefixes)) {
-          return true;
+  // Subdirectories are listed concurrently, and the files found so far are
+  // filtered (and possibly inspected) while listing goes on.
+  ARROW_ASSIGN_OR_RAISE(auto batches, filesystem->GetFileInfoIterator(selector));
+
+  std::vector<fs::FileInfo> files;
+  for (auto maybe_batch : batches) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, maybe_batch);
+    for (auto& info : batch) {
+      // Filter out anything that's not a file or that's explicitly ignored
+      if (!info.IsFile() ||
+          StartsWithAnyOf(info.path(), options.selector_ignore_prefixes)) {
+        continue;
+      }
+      if (options.exclude_invalid_files) {
+        ARROW_ASSIGN_OR_RAISE(auto supported,
+                              format->IsSupported(FileSource(info, filesystem)));
+        if (!supported) {
+          continue;
         }
-        return false;
-      });
-  files.erase(files_end, files.end());
+      }
+      files.push_back(std::move(info));
+    }
+  }
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
 
-  return Make(std::move(filesystem), std::move(files), std::move(format),
-              std::move(options));
+  return std::shared_ptr<DatasetFactory>(
+      new FileSystemDatasetFactory(std::move(files), std::move(filesystem),
+                                   std::move(format), std::move(options)));
 }
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
@@ -203,7 +203,9 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   ///
   /// The selector will expand to a vector of FileInfo. The expansion/crawling
   /// is performed in this function call. Thus, the finalized Dataset is
-  /// working with a snapshot of the filesystem.
+  /// working with a snapshot of the filesystem.  Subdirectories are crawled
+  /// concurrently (see fs::FileSystem::GetFileInfoIterator), and files are
+  /// filtered as soon as they are listed.
   //
   /// If options.partition_base_dir is not provided, it will be overwritten
   /// with selector.base_dir.
@@ -0,0 +1,333 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/array.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+static inline Result<std::unique_ptr<adapters::orc::ORCFileReader>> OpenReader(
+    const FileSource& source, MemoryPool* pool = default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  auto status = adapters::orc::ORCFileReader::Open(std::move(input), pool, &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
+  }
+  return std::move(reader);
+}
+
+using adapters::orc::SearchArgumentBuilder;
+
+// Returns the referenced field if expr is a reference to a field of the schema
+static std::shared_ptr<Field> GetReferencedField(const Expression& expr,
+                                                 const Schema& schema) {
+  if (expr.type() != ExpressionType::FIELD) {
+    return nullptr;
+  }
+  return schema.GetFieldByName(checked_cast<const FieldExpression&>(expr).name());
+}
+
+static void AddComparison(const ComparisonExpression& expr, const Schema& schema,
+                          SearchArgumentBuilder* builder) {
+  auto op = expr.op();
+  auto field = GetReferencedField(*expr.left_operand(), schema);
+  const Expression* value_expr = expr.right_operand().get();
+  if (field == nullptr) {
+    // scalar <op> field: swap the operands
+    field = GetReferencedField(*expr.right_operand(), schema);
+    value_expr = expr.left_operand().get();
+    switch (op) {
+      case CompareOperator::LESS:
+        op = CompareOperator::GREATER;
+        break;
+      case CompareOperator::LESS_EQUAL:
+        op = CompareOperator::GREATER_EQUAL;
+        break;
+      case CompareOperator::GREATER:
+        op = CompareOperator::LESS;
+        break;
+      case CompareOperator::GREATER_EQUAL:
+        op = CompareOperator::LESS_EQUAL;
+        break;
+      default:
+        break;
+    }
+  }
+  if (field == nullptr || value_expr->type() != ExpressionType::SCALAR) {
+    builder->Unknown();
+    return;
+  }
+  const auto& value = *checked_cast<const ScalarExpression&>(*value_expr).value();
+  if (!value.type->Equals(field->type())) {
+    builder->Unknown();
+    return;
+  }
+
+  const auto& name = field->name();
+  switch (op) {
+    case CompareOperator::EQUAL:
+      builder->Equals(name, value);
+      break;
+    case CompareOperator::NOT_EQUAL:
+      builder->StartNot().Equals(name, value).End();
+      break;
+    case CompareOperator::LESS:
+      builder->LessThan(name, value);
+      break;
+    case CompareOperator::LESS_EQUAL:
+      builder->LessThanEquals(name, value);
+      break;
+    case CompareOperator::GREATER:
+      builder->StartNot().LessThanEquals(name, value).End();
+      break;
+    case CompareOperator::GREATER_EQUAL:
+      builder->StartNot().LessThan(name, value).End();
+      break;
+  }
+}
+
+// Translate a filter into an ORC search argument.  Sub-expressions which can't
+// be translated are considered satisfiable by any row.
+static void AddPredicate(const Expression& expr, const Schema& schema,
+                         SearchArgumentBuilder* builder) {
+  switch (expr.type()) {
+    case ExpressionType::AND: {
+      const auto& and_expr = checked_cast<const AndExpression&>(expr);
+      builder->StartAnd();
+      AddPredicate(*and_expr.left_operand(), schema, builder);
+      AddPredicate(*and_expr.right_operand(), schema, builder);
+      builder->End();
+      break;
+    }
+    case ExpressionType::OR: {
+      const auto& or_expr = checked_cast<const OrExpression&>(expr);
+      builder->StartOr();
+      AddPredicate(*or_expr.left_operand(), schema, builder);
+      AddPredicate(*or_expr.right_operand(), schema, builder);
+      builder->End();
+      break;
+    }
+    case ExpressionType::NOT: {
+      builder->StartNot();
+      AddPredicate(*checked_cast<const NotExpression&>(expr).operand(), schema, builder);
+      builder->End();
+      break;
+    }
+    case ExpressionType::IS_VALID: {
+      const auto& operand = *checked_cast<const IsValidExpression&>(expr).operand();
+      auto field = GetReferencedField(operand, schema);
+      if (field == nullptr) {
+        builder->Unknown();
+      } else {
+        builder->StartNot().IsNull(field->name(), *field->type()).End();
+      }
+      break;
+    }
+    case ExpressionType::IN: {
+      const auto& in_expr = checked_cast<const InExpression&>(expr);
+      auto field = GetReferencedField(*in_expr.operand(), schema);
+      if (field == nullptr || !in_expr.set()->type()->Equals(field->type())) {
+        builder->Unknown();
+      } else {
+        builder->In(field->name(), *in_expr.set());
+      }
+      break;
+    }
+    case ExpressionType::COMPARISON:
+      AddComparison(checked_cast<const ComparisonExpression&>(expr), schema, builder);
+      break;
+    default:
+      builder->Unknown();
+      break;
+  }
+}
+
+// An expression satisfied by all the rows of a stripe, given its statistics
+static std::shared_ptr<Expression> StripeStatisticsExpression(
+    const Schema& schema, const std::vector<adapters::orc::ColumnStatistics>& stats) {
+  ExpressionVector expressions;
+  for (size_t i = 0; i < stats.size(); ++i) {
+    const auto& field = schema.field(static_cast<int>(i));
+    auto field_expr = field_ref(field->name());
+    if (stats[i].num_values == 0) {
+      if (stats[i].has_null) {
+        expressions.push_back(equal(std::move(field_expr),
+                                    scalar(MakeNullScalar(field->type()))));
+      }
+    } else if (stats[i].min != nullptr && stats[i].max != nullptr) {
+      expressions.push_back(and_(greater_equal(field_expr, scalar(stats[i].min)),
+                                 less_equal(field_expr, scalar(stats[i].max))));
+    }
+  }
+  return and_(std::move(expressions));
+}
+
+/// \brief A ScanTask reading a single stripe of an ORC file
+///
+/// The tasks of a file share its reader, whose ReadStripe() with a search
+/// argument can be called concurrently.
+class OrcScanTask : public ScanTask {
+ public:
+  OrcScanTask(std::shared_ptr<adapters::orc::ORCFileReader> reader,
+              std::shared_ptr<Schema> physical_schema, int64_t stripe,
+              std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        reader_(std::move(reader)),
+        physical_schema_(std::move(physical_schema)),
+        stripe_(stripe) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Virtual columns, e.g. partition fields, are not in the file
+    std::vector<std::string> include_names;
+    for (const auto& name : options_->MaterializedFields()) {
+      if (physical_schema_->GetFieldByName(name) != nullptr) {
+        include_names.push_back(name);
+      }
+    }
+
+    std::unique_ptr<adapters::orc::SearchArgument> search_argument;
+    if (!options_->filter->Equals(true)) {
+      SearchArgumentBuilder builder;
+      AddPredicate(*options_->filter, *physical_schema_, &builder);
+      RETURN_NOT_OK(builder.Finish(&search_argument));
+    }
+
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(
+        reader_->ReadStripe(stripe_, include_names, std::move(search_argument), &batch));
+    return MakeVectorIterator<std::shared_ptr<RecordBatch>>({std::move(batch)});
+  }
+
+ private:
+  std::shared_ptr<adapters::orc::ORCFileReader> reader_;
+  std::shared_ptr<Schema> physical_schema_;
+  int64_t stripe_;
+};
+
+Result<bool> OrcFileFormat::IsSupported(const FileSource& source) const {
+  RETURN_NOT_OK(source.Open().status());
+  return OpenReader(source).ok();
+}
+
+Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(reader->ReadSchema(&schema));
+  return schema;
+}
+
+Result<ScanTaskIterator> OrcFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
+                                                 std::shared_ptr<ScanContext> context,
+                                                 FileFragment* fragment) const {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<adapters::orc::ORCFileReader> reader,
+                        OpenReader(fragment->source(), context->pool));
+  std::shared_ptr<Schema> physical_schema;
+  RETURN_NOT_OK(reader->ReadSchema(&physical_schema));
+  RETURN_NOT_OK(options->filter->Validate(*physical_schema));
+
+  // One task per stripe, skipping those whose statistics exclude the filter
+  std::vector<std::shared_ptr<ScanTask>> tasks;
+  for (int64_t stripe = 0; stripe < reader->NumberOfStripes(); ++stripe) {
+    std::vector<adapters::orc::ColumnStatistics> stats;
+    RETURN_NOT_OK(reader->ReadStripeStatistics(stripe, &stats));
+    if (!stats.empty() && !options->filter->IsSatisfiableWith(
+                              StripeStatisticsExpression(*physical_schema, stats))) {
+      continue;
+    }
+    tasks.push_back(std::make_shared<OrcScanTask>(reader, physical_schema, stripe,
+                                                  options, context));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+class OrcWriteTask : public WriteTask {
+ public:
+  OrcWriteTask(WritableFileSource destination, std::shared_ptr<FileFormat> format,
+               std::shared_ptr<Fragment> fragment,
+               std::shared_ptr<ScanOptions> scan_options,
+               std::shared_ptr<ScanContext> scan_context)
+      : WriteTask(std::move(destination), std::move(format)),
+        fragment_(std::move(fragment)),
+        scan_options_(std::move(scan_options)),
+        scan_context_(std::move(scan_context)) {}
+
+  Status Execute() override {
+    RETURN_NOT_OK(CreateDestinationParentDir());
+
+    auto schema = scan_options_->schema();
+    const auto& writer_options =
+        checked_cast<const OrcFileFormat&>(*format_).writer_options;
+
+    ARROW_ASSIGN_OR_RAISE(auto out_stream, destination_.Open());
+    std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+    RETURN_NOT_OK(adapters::orc::ORCFileWriter::Open(schema, out_stream.get(),
+                                                     writer_options, &writer));
+    ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
+                          fragment_->Scan(scan_options_, scan_context_));
+
+    for (auto maybe_scan_task : scan_task_it) {
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, maybe_scan_task);
+
+      ARROW_ASSIGN_OR_RAISE(auto batch_it, scan_task->Execute());
+
+      for (auto maybe_batch : batch_it) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, std::move(maybe_batch));
+        RETURN_NOT_OK(writer->Write(*batch));
+      }
+    }
+
+    RETURN_NOT_OK(writer->Close());
+    // The ORC writer doesn't close its sink
+    return out_stream->Close();
+  }
+
+ private:
+  std::shared_ptr<Fragment> fragment_;
+  std::shared_ptr<ScanOptions> scan_options_;
+  std::shared_ptr<ScanContext> scan_context_;
+};
+
+Result<std::shared_ptr<WriteTask>> OrcFileFormat::WriteFragment(
+    WritableFileSource destination, std::shared_ptr<Fragment> fragment,
+    std::shared_ptr<ScanOptions> scan_options,
+    std::shared_ptr<ScanContext> scan_context) {
+  return std::make_shared<OrcWriteTask>(std::move(destination), shared_from_this(),
+                                        std::move(fragment), std::move(scan_options),
+                                        std::move(scan_context));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,305 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_orc.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/adapters/orc/adapter.h"
+#include "arrow/builder.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr int64_t kBatchSize = 1UL << 12;
+constexpr int64_t kBatchRepetitions = 1 << 5;
+constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
+
+class TestOrcFileFormat : public ::testing::Test {
+ public:
+  std::shared_ptr<Buffer> Write(
+      RecordBatchReader* reader,
+      const adapters::orc::WriteOptions& options = adapters::orc::WriteOptions()) {
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+
+    std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+    ARROW_EXPECT_OK(adapters::orc::ORCFileWriter::Open(reader->schema(), sink.get(),
+                                                       options, &writer));
+
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ARROW_EXPECT_OK(reader->ReadAll(&batches));
+    for (auto batch : batches) {
+      ARROW_EXPECT_OK(writer->Write(*batch));
+    }
+
+    ARROW_EXPECT_OK(writer->Close());
+
+    EXPECT_OK_AND_ASSIGN(auto out, sink->Finish());
+    return out;
+  }
+
+  std::unique_ptr<FileSource> GetFileSource(RecordBatchReader* reader) {
+    auto buffer = Write(reader);
+    return internal::make_unique<FileSource>(std::move(buffer));
+  }
+
+  std::unique_ptr<RecordBatchReader> GetRecordBatchReader(
+      std::shared_ptr<Schema> schema = nullptr) {
+    return MakeGeneratedRecordBatch(schema ? schema : schema_, kBatchSize,
+                                    kBatchRepetitions);
+  }
+
+  Result<WritableFileSource> GetFileSink() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buffer,
+                          AllocateResizableBuffer(0));
+    return WritableFileSource(std::move(buffer));
+  }
+
+  RecordBatchIterator Batches(ScanTaskIterator scan_task_it) {
+    return MakeFlattenIterator(MakeMaybeMapIterator(
+        [](std::shared_ptr<ScanTask> scan_task) { return scan_task->Execute(); },
+        std::move(scan_task_it)));
+  }
+
+  RecordBatchIterator Batches(Fragment* fragment) {
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    return Batches(std::move(scan_task_it));
+  }
+
+  std::shared_ptr<Table> ReadTable(Fragment* fragment) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (auto maybe_batch : Batches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      batches.push_back(std::move(batch));
+    }
+    EXPECT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema_, batches));
+    return table;
+  }
+
+ protected:
+  std::shared_ptr<OrcFileFormat> format_ = std::make_shared<OrcFileFormat>();
+  std::shared_ptr<ScanOptions> opts_;
+  std::shared_ptr<ScanContext> ctx_ = std::make_shared<ScanContext>();
+  std::shared_ptr<Schema> schema_ = schema({field("f64", float64())});
+};
+
+TEST_F(TestOrcFileFormat, ScanRecordBatchReader) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  int64_t row_count = 0;
+
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    row_count += batch->num_rows();
+  }
+
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestOrcFileFormat, ScanOnlyVirtualColumns) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  // Only a partition field is projected, so no column is read from the file
+  auto dataset_schema = schema({field("f64", float64()), field("part", int32())});
+  opts_ = ScanOptions::Make(dataset_schema);
+  opts_->projector =
+      RecordBatchProjector(SchemaFromColumnNames(dataset_schema, {"part"}));
+  auto partition_expression = equal(field_ref("part"), scalar(1));
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format_->MakeFragment(*source, partition_expression));
+
+  int64_t row_count = 0;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    ASSERT_EQ(batch->num_columns(), 0);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, kNumRows);
+}
+
+TEST_F(TestOrcFileFormat, ScanWithPredicatePushdown) {
+  schema_ = schema({field("i64", int64()), field("f64", float64())});
+  Int64Builder builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(builder.Append(i));
+  }
+  std::shared_ptr<Array> ints;
+  ASSERT_OK(builder.Finish(&ints));
+  auto batch = RecordBatch::Make(
+      schema_, kNumRows, {ints, ConstantArrayGenerator::Zeroes(kNumRows, float64())});
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}));
+
+  adapters::orc::WriteOptions options;
+  options.stripe_size = 64 * 1024;
+  options.row_index_stride = 1000;
+  FileSource source(Write(reader.get(), options));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  auto CountTasksAndRows = [&](int64_t* num_tasks, int64_t* num_rows) {
+    ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+    *num_tasks = *num_rows = 0;
+    for (auto maybe_task : scan_task_it) {
+      ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      ++*num_tasks;
+      ASSERT_OK_AND_ASSIGN(auto batch_it, task->Execute());
+      for (auto maybe_batch : batch_it) {
+        ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        ASSERT_OK(batch->ValidateFull());
+        *num_rows += batch->num_rows();
+      }
+    }
+  };
+
+  int64_t num_stripes, num_rows;
+  opts_ = ScanOptions::Make(schema_);
+  CountTasksAndRows(&num_stripes, &num_rows);
+  ASSERT_GT(num_stripes, 2);
+  ASSERT_EQ(num_rows, kNumRows);
+
+  // The stripes and row groups which can't match are skipped
+  int64_t num_tasks;
+  opts_->filter = ("i64"_ < int64_t(500)).Copy();
+  CountTasksAndRows(&num_tasks, &num_rows);
+  ASSERT_EQ(num_tasks, 1);
+  ASSERT_EQ(num_rows, 1000);
+
+  opts_->filter = ("i64"_ >= int64_t(kNumRows - 10) or "i64"_ == int64_t(10)).Copy();
+  CountTasksAndRows(&num_tasks, &num_rows);
+  ASSERT_EQ(num_tasks, 2);
+  ASSERT_LE(num_rows, 2000);
+
+  opts_->filter = ("i64"_ < int64_t(0)).Copy();
+  CountTasksAndRows(&num_tasks, &num_rows);
+  ASSERT_EQ(num_tasks, 0);
+
+  opts_->filter = ("f64"_ > 1.0).Copy();
+  CountTasksAndRows(&num_tasks, &num_rows);
+  ASSERT_EQ(num_tasks, 0);
+}
+
+TEST_F(TestOrcFileFormat, WriteRecordBatchReader) {
+  schema_ = schema({field("f64", float64()), field("i32", int32()),
+                    field("str", utf8())});
+  std::shared_ptr<RecordBatchReader> reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  // Small stripes, so that the written file differs from the source
+  format_->writer_options.stripe_size = 16 * 1024;
+  EXPECT_OK_AND_ASSIGN(auto sink, GetFileSink());
+  EXPECT_OK_AND_ASSIGN(auto write_task,
+                       format_->WriteFragment(sink, fragment, opts_, ctx_));
+
+  ASSERT_OK(write_task->Execute());
+
+  ASSERT_OK_AND_ASSIGN(auto written_fragment,
+                       format_->MakeFragment(FileSource(sink.buffer())));
+  auto expected = ReadTable(fragment.get());
+  auto actual = ReadTable(written_fragment.get());
+  ASSERT_OK(actual->ValidateFull());
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+class TestOrcFileSystemDataset : public TestOrcFileFormat,
+                                 public MakeFileSystemDatasetMixin {};
+
+TEST_F(TestOrcFileSystemDataset, Write) {
+  std::string paths = R"(
+    old_root/i32=0/str=aaa/dat
+    old_root/i32=0/str=bbb/dat
+    old_root/i32=1/str=aaa/dat
+    old_root/i32=1/str=bbb/dat
+  )";
+
+  ExpressionVector partitions{
+      ("i32"_ == 0 and "str"_ == "aaa").Copy(), ("i32"_ == 0 and "str"_ == "bbb").Copy(),
+      ("i32"_ == 1 and "str"_ == "aaa").Copy(), ("i32"_ == 1 and "str"_ == "bbb").Copy(),
+  };
+
+  MakeDatasetFromPathlist(paths, scalar(true), partitions);
+
+  auto schema = arrow::schema({field("i32", int32()), field("str", utf8())});
+  opts_ = ScanOptions::Make(schema);
+
+  auto partitioning_factory = DirectoryPartitioning::MakeFactory({"str", "i32"});
+  ASSERT_OK_AND_ASSIGN(
+      auto plan, partitioning_factory->MakeWritePlan(schema, dataset_->GetFragments()));
+
+  plan.format = format_;
+  plan.filesystem = fs_;
+  plan.partition_base_dir = "new_root/";
+
+  ASSERT_OK_AND_ASSIGN(auto written, FileSystemDataset::Write(plan, opts_, ctx_));
+
+  auto parent_directories = written->files();
+  for (auto& path : parent_directories) {
+    EXPECT_EQ(fs::internal::GetAbstractPathExtension(path), "orc");
+    path = fs::internal::GetAbstractPathParent(path).first;
+  }
+
+  EXPECT_THAT(parent_directories,
+              testing::ElementsAre("new_root/aaa/0", "new_root/aaa/1", "new_root/bbb/0",
+                                   "new_root/bbb/1"));
+}
+
+TEST_F(TestOrcFileFormat, Inspect) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format_->Inspect(*source.get()));
+  EXPECT_EQ(*actual, *schema_);
+}
+
+TEST_F(TestOrcFileFormat, IsSupported) {
+  auto reader = GetRecordBatchReader();
+  auto source = GetFileSource(reader.get());
+
+  bool supported = false;
+
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  buf = std::make_shared<Buffer>(util::string_view("corrupted"));
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  ASSERT_OK_AND_ASSIGN(supported, format_->IsSupported(*source));
+  EXPECT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
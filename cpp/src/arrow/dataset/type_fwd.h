@@ -54,6 +54,8 @@ class CsvFileFormat;
 
 class IpcFileFormat;
 
+class OrcFileFormat;
+
 class ParquetFileFormat;
 class ParquetFileFragment;
 
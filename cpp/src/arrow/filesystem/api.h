@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "arrow/filesystem/cachingfs.h"   // IWYU pragma: export
 #include "arrow/filesystem/filesystem.h"  // IWYU pragma: export
 #include "arrow/filesystem/hdfs.h"        // IWYU pragma: export
 #include "arrow/filesystem/localfs.h"     // IWYU pragma: export
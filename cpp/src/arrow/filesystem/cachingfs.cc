@@ -0,0 +1,731 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+namespace internal {
+
+namespace {
+
+// Identity of a base file, used to validate cached blocks
+struct FileIdentity {
+  int64_t size;
+  TimePoint mtime;
+
+  bool operator==(const FileIdentity& other) const {
+    return size == other.size && mtime == other.mtime;
+  }
+  bool operator!=(const FileIdentity& other) const { return !(*this == other); }
+};
+
+bool IsCacheable(const FileInfo& info) {
+  return info.IsFile() && info.size() != kNoSize && info.mtime() != kNoTime;
+}
+
+// Marks a directory as holding the blocks of CachingFileSystems
+constexpr const char* kCacheMarker = ".arrow_caching_fs";
+
+// Each block file starts with a header identifying the cached block, so that
+// the blocks of an earlier run can be reused: the magic, the base file size
+// and modification time, the block index, the block length and the length of
+// the base path (all little-endian int64), then the base path itself.
+constexpr char kBlockMagic[8] = {'A', 'R', 'R', 'O', 'W', 'B', 'L', 'K'};
+constexpr int kNumHeaderFields = 5;
+constexpr int64_t kBlockHeaderSize = sizeof(kBlockMagic) + kNumHeaderFields * 8;
+
+std::string EncodeBlockHeader(const std::string& path, const FileIdentity& identity,
+                              int64_t block_index, int64_t block_size) {
+  const int64_t fields[kNumHeaderFields] = {
+      identity.size, identity.mtime.time_since_epoch().count(), block_index,
+      block_size, static_cast<int64_t>(path.size())};
+  std::string header(kBlockMagic, sizeof(kBlockMagic));
+  for (int64_t field : fields) {
+    field = BitUtil::ToLittleEndian(field);
+    header.append(reinterpret_cast<const char*>(&field), sizeof(field));
+  }
+  return header + path;
+}
+
+int64_t DecodeHeaderField(const Buffer& header, int i) {
+  int64_t field;
+  std::memcpy(&field, header.data() + sizeof(kBlockMagic) + i * 8, sizeof(field));
+  return BitUtil::FromLittleEndian(field);
+}
+
+// A random prefix for the names of the block files written by a BlockCache,
+// so that caches sharing a directory don't overwrite each other's blocks
+std::string MakeBlockPrefix() {
+  static const char chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  std::random_device gen;
+  std::uniform_int_distribution<int> dist(0, sizeof(chars) - 2);
+  std::string prefix;
+  for (int i = 0; i < 12; ++i) {
+    prefix += chars[dist(gen)];
+  }
+  return prefix + "-";
+}
+
+}  // namespace
+
+// A LRU cache of file blocks, stored as individual files on a cache filesystem.
+//
+// The index of cached blocks is held in memory, and rebuilt by Load() from the
+// headers of the block files.  Block contents are only read and written
+// outside of the lock.
+class BlockCache {
+ public:
+  BlockCache(std::shared_ptr<FileSystem> cache_fs, std::string cache_dir,
+             int64_t capacity)
+      : cache_fs_(std::move(cache_fs)),
+        cache_dir_(std::move(cache_dir)),
+        capacity_(capacity),
+        block_prefix_(MakeBlockPrefix()) {}
+
+  // Index the blocks found in the cache directory.  They are validated against
+  // the base filesystem when read, like the blocks inserted by this cache.
+  Status Load() {
+    FileSelector selector;
+    selector.base_dir = cache_dir_;
+    ARROW_ASSIGN_OR_RAISE(auto infos, cache_fs_->GetFileInfo(selector));
+    // Oldest first, so that they end up least recently used
+    std::stable_sort(infos.begin(), infos.end(),
+                     [](const FileInfo& a, const FileInfo& b) {
+                       return a.mtime() < b.mtime();
+                     });
+
+    std::vector<std::string> deleted;
+    for (const auto& info : infos) {
+      if (!info.IsFile() || info.base_name() == kCacheMarker) {
+        continue;
+      }
+      std::string path;
+      FileIdentity identity;
+      Block block;
+      bool is_block;
+      RETURN_NOT_OK(ReadBlockHeader(info, &is_block, &path, &identity, &block));
+      if (!is_block) {
+        // Not a block file: leave it alone
+        continue;
+      }
+      if (block.cache_path.empty()) {
+        // Truncated or corrupt, for example by a crash while writing it
+        deleted.push_back(info.path());
+        continue;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& entry = files_[path];
+      if (entry.identity != identity) {
+        // Newer blocks of a changed file supersede the older ones
+        DropBlocks(&entry, &deleted);
+        entry.identity = identity;
+      }
+      auto block_it = entry.blocks.find(block.index);
+      if (block_it != entry.blocks.end()) {
+        // Also cached by another instance
+        cached_bytes_ -= block_it->second->size;
+        deleted.push_back(std::move(block_it->second->cache_path));
+        lru_.erase(block_it->second);
+      }
+      cached_bytes_ += block.size;
+      lru_.push_front(std::move(block));
+      entry.blocks[lru_.front().index] = lru_.begin();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      EvictBlocks(&deleted);
+    }
+    return DeleteCacheFiles(deleted);
+  }
+
+  // Return the given cached block, or null if not in the cache
+  Result<std::shared_ptr<Buffer>> Get(const std::string& path,
+                                      const FileIdentity& identity,
+                                      int64_t block_index) {
+    std::string cache_path;
+    int64_t block_size, data_offset;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto file_it = files_.find(path);
+      if (file_it == files_.end() || file_it->second.identity != identity) {
+        return nullptr;
+      }
+      auto block_it = file_it->second.blocks.find(block_index);
+      if (block_it == file_it->second.blocks.end()) {
+        return nullptr;
+      }
+      // Mark as most recently used
+      lru_.splice(lru_.begin(), lru_, block_it->second);
+      cache_path = block_it->second->cache_path;
+      block_size = block_it->second->size;
+      data_offset = block_it->second->data_offset;
+    }
+
+    // The block may be evicted concurrently, in which case it's a cache miss
+    auto maybe_file = cache_fs_->OpenInputFile(cache_path);
+    if (!maybe_file.ok()) {
+      return nullptr;
+    }
+    auto maybe_buffer = (*maybe_file)->ReadAt(data_offset, block_size);
+    ARROW_UNUSED((*maybe_file)->Close());
+    if (!maybe_buffer.ok() || (*maybe_buffer)->size() != block_size) {
+      return nullptr;
+    }
+    hits_ += 1;
+    bytes_from_cache_ += block_size;
+    return maybe_buffer;
+  }
+
+  // Insert the given block in the cache, evicting other blocks if necessary
+  Status Put(const std::string& path, const FileIdentity& identity, int64_t block_index,
+             const std::shared_ptr<Buffer>& data) {
+    std::string cache_path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cache_path = ConcatAbstractPath(cache_dir_,
+                                      block_prefix_ + std::to_string(next_block_id_++));
+    }
+    const std::string header =
+        EncodeBlockHeader(path, identity, block_index, data->size());
+    {
+      ARROW_ASSIGN_OR_RAISE(auto out, cache_fs_->OpenOutputStream(cache_path));
+      RETURN_NOT_OK(out->Write(header));
+      RETURN_NOT_OK(out->Write(data));
+      RETURN_NOT_OK(out->Close());
+    }
+
+    std::vector<std::string> deleted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& entry = files_[path];
+      if (entry.identity != identity) {
+        // The file changed on the base filesystem
+        DropBlocks(&entry, &deleted);
+        entry.identity = identity;
+      }
+      if (entry.blocks.find(block_index) != entry.blocks.end()) {
+        // Concurrently inserted by another reader
+        deleted.push_back(cache_path);
+      } else {
+        lru_.push_front(Block{path, block_index, cache_path, data->size(),
+                              static_cast<int64_t>(header.size())});
+        entry.blocks[block_index] = lru_.begin();
+        cached_bytes_ += data->size();
+      }
+      EvictBlocks(&deleted);
+    }
+    return DeleteCacheFiles(deleted);
+  }
+
+  // Drop cached blocks for the given path, or any path below it
+  Status Invalidate(const std::string& path) {
+    std::vector<std::string> deleted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = files_.find(path);
+      if (it != files_.end()) {
+        DropBlocks(&it->second, &deleted);
+        files_.erase(it);
+      }
+      const std::string prefix = path.empty() ? "" : EnsureTrailingSlash(path);
+      it = files_.lower_bound(prefix);
+      while (it != files_.end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+        DropBlocks(&it->second, &deleted);
+        it = files_.erase(it);
+      }
+    }
+    return DeleteCacheFiles(deleted);
+  }
+
+  Status Clear() { return Invalidate(""); }
+
+  void RecordMiss(int64_t nbytes) {
+    misses_ += 1;
+    bytes_from_base_ += nbytes;
+  }
+
+  CachingFileSystemMetrics metrics() {
+    CachingFileSystemMetrics metrics;
+    metrics.hits = hits_.load();
+    metrics.misses = misses_.load();
+    metrics.bytes_from_cache = bytes_from_cache_.load();
+    metrics.bytes_from_base = bytes_from_base_.load();
+    std::lock_guard<std::mutex> lock(mutex_);
+    metrics.evictions = evictions_;
+    metrics.cached_bytes = cached_bytes_;
+    return metrics;
+  }
+
+ private:
+  struct Block {
+    std::string path;
+    int64_t index;
+    std::string cache_path;
+    int64_t size;
+    // Offset of the block contents in the cache file, after the header
+    int64_t data_offset;
+  };
+  using BlockList = std::list<Block>;
+
+  struct FileEntry {
+    FileIdentity identity{kNoSize, kNoTime};
+    std::unordered_map<int64_t, BlockList::iterator> blocks;
+  };
+
+  // Should be called with the lock held
+  void DropBlocks(FileEntry* entry, std::vector<std::string>* deleted) {
+    for (const auto& index_block : entry->blocks) {
+      cached_bytes_ -= index_block.second->size;
+      deleted->push_back(std::move(index_block.second->cache_path));
+      lru_.erase(index_block.second);
+    }
+    entry->blocks.clear();
+  }
+
+  // Should be called with the lock held
+  void EvictBlocks(std::vector<std::string>* deleted) {
+    while (cached_bytes_ > capacity_ && !lru_.empty()) {
+      Block& block = lru_.back();
+      auto file_it = files_.find(block.path);
+      DCHECK(file_it != files_.end());
+      file_it->second.blocks.erase(block.index);
+      if (file_it->second.blocks.empty()) {
+        files_.erase(file_it);
+      }
+      cached_bytes_ -= block.size;
+      ++evictions_;
+      deleted->push_back(std::move(block.cache_path));
+      lru_.pop_back();
+    }
+  }
+
+  // Read the header of a cache file.  `is_block` is false if the file isn't a
+  // block file, and `block->cache_path` is left empty if it is corrupt.
+  Status ReadBlockHeader(const FileInfo& info, bool* is_block, std::string* path,
+                         FileIdentity* identity, Block* block) {
+    *is_block = false;
+    block->cache_path.clear();
+    if (info.size() < static_cast<int64_t>(sizeof(kBlockMagic))) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto file, cache_fs_->OpenInputFile(info));
+    ARROW_ASSIGN_OR_RAISE(auto header, file->ReadAt(0, kBlockHeaderSize));
+    if (std::memcmp(header->data(), kBlockMagic, sizeof(kBlockMagic)) != 0) {
+      return file->Close();
+    }
+    *is_block = true;
+    if (header->size() < kBlockHeaderSize) {
+      return file->Close();
+    }
+    const int64_t path_length = DecodeHeaderField(*header, 4);
+    block->size = DecodeHeaderField(*header, 3);
+    block->data_offset = kBlockHeaderSize + path_length;
+    if (path_length < 0 || block->size <= 0 ||
+        info.size() != block->data_offset + block->size) {
+      return file->Close();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto path_buffer, file->ReadAt(kBlockHeaderSize, path_length));
+    RETURN_NOT_OK(file->Close());
+    *path = path_buffer->ToString();
+    identity->size = DecodeHeaderField(*header, 0);
+    identity->mtime = TimePoint(TimePoint::duration(DecodeHeaderField(*header, 1)));
+    block->path = *path;
+    block->index = DecodeHeaderField(*header, 2);
+    block->cache_path = info.path();
+    return Status::OK();
+  }
+
+  Status DeleteCacheFiles(const std::vector<std::string>& cache_paths) {
+    if (cache_paths.empty()) {
+      return Status::OK();
+    }
+    return cache_fs_->DeleteFiles(cache_paths);
+  }
+
+  std::shared_ptr<FileSystem> cache_fs_;
+  const std::string cache_dir_;
+  const int64_t capacity_;
+  const std::string block_prefix_;
+
+  std::mutex mutex_;
+  // Most recently used blocks first
+  BlockList lru_;
+  // Ordered by path, for prefix lookups
+  std::map<std::string, FileEntry> files_;
+  int64_t next_block_id_ = 0;
+  int64_t cached_bytes_ = 0;
+  int64_t evictions_ = 0;
+
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+  std::atomic<int64_t> bytes_from_cache_{0};
+  std::atomic<int64_t> bytes_from_base_{0};
+};
+
+namespace {
+
+// A RandomAccessFile reading block-aligned ranges through a BlockCache.
+//
+// The base file is only opened on the first cache miss.
+class CachedInputFile : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<BlockCache> cache, std::shared_ptr<FileSystem> base_fs,
+                  FileInfo info, int64_t block_size)
+      : cache_(std::move(cache)),
+        base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        identity_{info_.size(), info_.mtime()},
+        block_size_(block_size) {}
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > identity_.size) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  // RandomAccessFile APIs
+
+  Status Close() override {
+    closed_ = true;
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ != nullptr) {
+      return base_file_->Close();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return identity_.size;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, identity_.size - position);
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      const int64_t offset = position + bytes_read;
+      const int64_t block_index = offset / block_size_;
+      const int64_t offset_in_block = offset - block_index * block_size_;
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(block_index));
+      if (block->size() <= offset_in_block) {
+        // Short block: the base file was truncated
+        break;
+      }
+      const int64_t chunk_size =
+          std::min(nbytes - bytes_read, block->size() - offset_in_block);
+      std::memcpy(out_data + bytes_read, block->data() + offset_in_block, chunk_size);
+      bytes_read += chunk_size;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, identity_.size - position);
+    if (nbytes > 0) {
+      // Avoid a copy if the range is entirely inside one block
+      const int64_t block_index = position / block_size_;
+      if ((position + nbytes - 1) / block_size_ == block_index) {
+        ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(block_index));
+        const int64_t offset_in_block = position - block_index * block_size_;
+        if (offset_in_block + nbytes <= block->size()) {
+          return SliceBuffer(std::move(block), offset_in_block, nbytes);
+        }
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadAt(position, nbytes, buf->mutable_data()));
+      DCHECK_LE(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return std::move(buf);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return std::move(buffer);
+  }
+
+ protected:
+  Result<std::shared_ptr<Buffer>> GetBlock(int64_t block_index) {
+    ARROW_ASSIGN_OR_RAISE(auto cached, cache_->Get(info_.path(), identity_, block_index));
+    if (cached != nullptr) {
+      return cached;
+    }
+
+    const int64_t offset = block_index * block_size_;
+    const int64_t nbytes = std::min(block_size_, identity_.size - offset);
+    ARROW_ASSIGN_OR_RAISE(auto base_file, GetBaseFile());
+    ARROW_ASSIGN_OR_RAISE(auto block, base_file->ReadAt(offset, nbytes));
+    cache_->RecordMiss(block->size());
+    if (block->size() == nbytes) {
+      // Failing to populate the cache shouldn't fail the read
+      Status st = cache_->Put(info_.path(), identity_, block_index, block);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to cache block of '" << info_.path()
+                           << "': " << st.ToString();
+      }
+    }
+    return block;
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBaseFile() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  std::shared_ptr<BlockCache> cache_;
+  std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const FileIdentity identity_;
+  const int64_t block_size_;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  bool closed_ = false;
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+}  // namespace internal
+
+CachingFileSystemOptions CachingFileSystemOptions::Defaults() {
+  return CachingFileSystemOptions();
+}
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     std::shared_ptr<FileSystem> cache_fs,
+                                     const CachingFileSystemOptions& options)
+    : base_fs_(std::move(base_fs)),
+      cache_fs_(std::move(cache_fs)),
+      options_(options),
+      cache_(std::make_shared<internal::BlockCache>(cache_fs_, options.cache_dir,
+                                                    options.capacity)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options) {
+  return Make(std::move(base_fs), std::make_shared<LocalFileSystem>(), options);
+}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+    const CachingFileSystemOptions& options) {
+  if (options.cache_dir.empty()) {
+    return Status::Invalid("CachingFileSystem needs a cache directory");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("CachingFileSystem block size must be positive");
+  }
+  if (options.capacity < 0) {
+    return Status::Invalid("CachingFileSystem capacity must be non-negative");
+  }
+  RETURN_NOT_OK(cache_fs->CreateDir(options.cache_dir));
+
+  // Only use an empty directory, or one used by an earlier CachingFileSystem,
+  // so that unrelated files are never deleted
+  const auto marker = internal::ConcatAbstractPath(options.cache_dir,
+                                                         internal::kCacheMarker);
+  ARROW_ASSIGN_OR_RAISE(auto marker_info, cache_fs->GetFileInfo(marker));
+  if (!marker_info.IsFile()) {
+    FileSelector selector;
+    selector.base_dir = options.cache_dir;
+    ARROW_ASSIGN_OR_RAISE(auto infos, cache_fs->GetFileInfo(selector));
+    if (!infos.empty()) {
+      return Status::Invalid("Cache directory '", options.cache_dir,
+                             "' is not empty and was not created by a "
+                             "CachingFileSystem");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto out, cache_fs->OpenOutputStream(marker));
+    RETURN_NOT_OK(out->Close());
+  }
+
+  std::shared_ptr<CachingFileSystem> caching_fs(
+      new CachingFileSystem(std::move(base_fs), std::move(cache_fs), options));
+  RETURN_NOT_OK(caching_fs->cache_->Load());
+  return caching_fs;
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return options_.cache_dir == caching.options_.cache_dir &&
+         base_fs_->Equals(caching.base_fs_) && cache_fs_->Equals(caching.cache_fs_);
+}
+
+CachingFileSystemMetrics CachingFileSystem::metrics() const { return cache_->metrics(); }
+
+Status CachingFileSystem::ClearCache() { return cache_->Clear(); }
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  RETURN_NOT_OK(base_fs_->DeleteDir(path));
+  return cache_->Invalidate(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  RETURN_NOT_OK(base_fs_->DeleteDirContents(path));
+  return cache_->Invalidate(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  RETURN_NOT_OK(base_fs_->DeleteFile(path));
+  return cache_->Invalidate(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  RETURN_NOT_OK(base_fs_->Move(src, dest));
+  RETURN_NOT_OK(cache_->Invalidate(src));
+  return cache_->Invalidate(dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  RETURN_NOT_OK(base_fs_->CopyFile(src, dest));
+  return cache_->Invalidate(dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputStream(info);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  if (!internal::IsCacheable(info)) {
+    return base_fs_->OpenInputStream(info);
+  }
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  if (!internal::IsCacheable(info)) {
+    // Let the base filesystem deal with non-existent paths, directories, etc.
+    return base_fs_->OpenInputFile(info);
+  }
+  return std::make_shared<internal::CachedInputFile>(cache_, base_fs_, info,
+                                                     options_.block_size);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  RETURN_NOT_OK(cache_->Invalidate(path));
+  return base_fs_->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  RETURN_NOT_OK(cache_->Invalidate(path));
+  return base_fs_->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
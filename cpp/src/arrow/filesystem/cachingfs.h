@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/util/windows_fixup.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+class BlockCache;
+
+}  // namespace internal
+
+/// Options for the CachingFileSystem
+struct ARROW_EXPORT CachingFileSystemOptions {
+  /// Directory holding the cached blocks
+  ///
+  /// The directory is created if necessary.  It must either be empty or have
+  /// been used by an earlier CachingFileSystem, whose blocks are then reused
+  /// after being validated against the base filesystem.  Other files are never
+  /// deleted.
+  std::string cache_dir;
+  /// Size of a cached block
+  ///
+  /// Reads are widened to block boundaries, so that subsequent reads of
+  /// neighbouring ranges can be served from the cache.
+  int64_t block_size = 1 << 22;  // 4 MB
+  /// Maximum total size of the cached blocks
+  ///
+  /// When exceeded, least recently used blocks are evicted.
+  int64_t capacity = int64_t(1) << 32;  // 4 GB
+
+  static CachingFileSystemOptions Defaults();
+};
+
+/// Cache usage statistics of a CachingFileSystem
+struct ARROW_EXPORT CachingFileSystemMetrics {
+  /// Number of blocks read from the cache
+  int64_t hits = 0;
+  /// Number of blocks read from the base filesystem
+  int64_t misses = 0;
+  /// Number of bytes read from the cache
+  int64_t bytes_from_cache = 0;
+  /// Number of bytes read from the base filesystem
+  int64_t bytes_from_base = 0;
+  /// Number of blocks evicted from the cache
+  int64_t evictions = 0;
+  /// Current total size of the cached blocks
+  int64_t cached_bytes = 0;
+
+  /// The fraction of block reads served from the cache
+  double hit_rate() const {
+    return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses);
+  }
+};
+
+/// \brief A FileSystem implementation that delegates to another
+/// implementation, caching random-access reads on another filesystem.
+///
+/// This is useful to avoid repeatedly downloading the same byte ranges from
+/// a remote filesystem (such as S3 or HDFS), by caching them on local disk.
+///
+/// Files opened with OpenInputFile() or OpenInputStream() are read in
+/// block-aligned ranges of CachingFileSystemOptions::block_size bytes.
+/// Cached blocks are keyed by path and validated against the size and
+/// modification time reported by the base filesystem, so that a file
+/// changed on the base filesystem is not read from stale cache contents.
+/// Files without a known modification time are not cached.
+///
+/// Writes and other mutating operations are forwarded to the base filesystem
+/// and invalidate the cached blocks of the affected paths.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// Create a CachingFileSystem caching blocks under a local directory
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, const CachingFileSystemOptions& options);
+
+  /// Create a CachingFileSystem caching blocks under a directory of `cache_fs`
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+      const CachingFileSystemOptions& options);
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const { return base_fs_; }
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// Return a snapshot of the cache usage statistics
+  CachingFileSystemMetrics metrics() const;
+
+  /// Drop all cached blocks
+  Status ClearCache();
+
+  using FileSystem::GetFileInfo;
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    std::shared_ptr<FileSystem> cache_fs,
+                    const CachingFileSystemOptions& options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<FileSystem> cache_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<internal::BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
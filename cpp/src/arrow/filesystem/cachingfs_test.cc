@@ -0,0 +1,399 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using internal::MockFileSystem;
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    cache_fs_ = std::make_shared<MockFileSystem>(time_);
+    CachingFileSystemOptions options;
+    options.cache_dir = "cache";
+    options.block_size = 3;
+    ASSERT_OK_AND_ASSIGN(caching_fs_, CachingFileSystem::Make(fs_, cache_fs_, options));
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return caching_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<FileSystem> fs_;
+  std::shared_ptr<FileSystem> cache_fs_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Concrete CachingFileSystem tests
+
+class TestCachingFS : public ::testing::Test {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    cache_fs_ = std::make_shared<MockFileSystem>(time_);
+    options_.cache_dir = "cache";
+    options_.block_size = 4;
+    options_.capacity = 1000;
+    MakeCachingFS();
+  }
+
+  void MakeCachingFS() {
+    ASSERT_OK_AND_ASSIGN(caching_fs_,
+                         CachingFileSystem::Make(fs_, cache_fs_, options_));
+  }
+
+  void CreateFile(const std::string& path, const std::string& data) {
+    ::arrow::fs::CreateFile(fs_.get(), path, data);
+  }
+
+  void AssertReadAt(io::RandomAccessFile* file, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+
+    std::string out(static_cast<size_t>(nbytes), '\0');
+    ASSERT_OK_AND_ASSIGN(auto bytes_read, file->ReadAt(position, nbytes, &out[0]));
+    out.resize(static_cast<size_t>(bytes_read));
+    ASSERT_EQ(out, expected);
+  }
+
+  // Number of block files, not counting the cache directory marker
+  int64_t NumCacheFiles() {
+    FileSelector selector;
+    selector.base_dir = "cache";
+    EXPECT_OK_AND_ASSIGN(auto infos, cache_fs_->GetFileInfo(selector));
+    return std::count_if(infos.begin(), infos.end(), [](const FileInfo& info) {
+      return info.base_name() != ".arrow_caching_fs";
+    });
+  }
+
+ protected:
+  TimePoint time_;
+  std::shared_ptr<FileSystem> fs_;
+  std::shared_ptr<FileSystem> cache_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+TEST_F(TestCachingFS, Make) {
+  ASSERT_EQ(caching_fs_->type_name(), "caching");
+  ASSERT_TRUE(caching_fs_->Equals(*caching_fs_));
+  ASSERT_FALSE(caching_fs_->Equals(*fs_));
+  AssertFileInfo(cache_fs_.get(), "cache", FileType::Directory);
+
+  // An earlier cache directory can be reused, unrelated files are left alone
+  ::arrow::fs::CreateFile(cache_fs_.get(), "cache/other", "xxx");
+  MakeCachingFS();
+  AssertFileInfo(cache_fs_.get(), "cache/other", FileType::File);
+
+  // A non-empty directory not created by a CachingFileSystem is refused
+  ASSERT_OK(cache_fs_->CreateDir("not-a-cache"));
+  ::arrow::fs::CreateFile(cache_fs_.get(), "not-a-cache/file", "xxx");
+  options_.cache_dir = "not-a-cache";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, cache_fs_, options_));
+  AssertFileInfo(cache_fs_.get(), "not-a-cache/file", FileType::File);
+
+  options_.cache_dir = "";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, cache_fs_, options_));
+  options_.cache_dir = "cache";
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, cache_fs_, options_));
+}
+
+TEST_F(TestCachingFS, ReadAt) {
+  ASSERT_OK(fs_->CreateDir("AB"));
+  CreateFile("AB/data", "some data to be cached");
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("AB/data"));
+  ASSERT_OK_AND_ASSIGN(auto size, file->GetSize());
+  ASSERT_EQ(size, 22);
+
+  // Within a block, then straddling blocks
+  AssertReadAt(file.get(), 5, 2, "da");
+  AssertReadAt(file.get(), 2, 9, "me data t");
+  // Past the end of file
+  AssertReadAt(file.get(), 20, 10, "ed");
+  AssertReadAt(file.get(), 22, 10, "");
+  ASSERT_RAISES(IOError, file->ReadAt(23, 1));
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 1));
+
+  auto metrics = caching_fs_->metrics();
+  // Blocks 0, 1, 2 and 5 were fetched from the base filesystem once each
+  ASSERT_EQ(metrics.misses, 4);
+  ASSERT_EQ(metrics.bytes_from_base, 14);
+  ASSERT_EQ(metrics.cached_bytes, 14);
+  ASSERT_GT(metrics.hits, 0);
+  ASSERT_EQ(NumCacheFiles(), 4);
+
+  // A fresh file handle reads from the cache
+  ASSERT_OK_AND_ASSIGN(file, caching_fs_->OpenInputFile("AB/data"));
+  auto hits_before = caching_fs_->metrics().hits;
+  AssertReadAt(file.get(), 0, 12, "some data to");
+  metrics = caching_fs_->metrics();
+  ASSERT_EQ(metrics.misses, 4);
+  ASSERT_EQ(metrics.hits, hits_before + 6);
+  ASSERT_GT(metrics.hit_rate(), 0.5);
+
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->closed());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+}
+
+TEST_F(TestCachingFS, Read) {
+  CreateFile("data", "some data");
+  ASSERT_OK_AND_ASSIGN(auto stream, caching_fs_->OpenInputStream("data"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(5));
+  AssertBufferEqual(*buf, "some ");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(10));
+  AssertBufferEqual(*buf, "data");
+  ASSERT_OK(stream->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+  ASSERT_OK(file->Seek(5));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
+  AssertBufferEqual(*buf, "da");
+  ASSERT_OK_AND_ASSIGN(auto pos, file->Tell());
+  ASSERT_EQ(pos, 7);
+  ASSERT_EQ(caching_fs_->metrics().misses, 3);
+}
+
+TEST_F(TestCachingFS, NotFound) {
+  ASSERT_RAISES(IOError, caching_fs_->OpenInputFile("nonexistent"));
+  ASSERT_RAISES(IOError, caching_fs_->OpenInputStream("nonexistent"));
+  ASSERT_OK(fs_->CreateDir("dir"));
+  ASSERT_RAISES(IOError, caching_fs_->OpenInputFile("dir"));
+}
+
+TEST_F(TestCachingFS, Validation) {
+  CreateFile("data", "0123456789");
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 10, "0123456789");
+  ASSERT_EQ(caching_fs_->metrics().misses, 3);
+
+  // The file is changed behind the caching filesystem's back: a different size
+  // is detected when opening it again.
+  CreateFile("data", "abcdefghijkl");
+  ASSERT_OK_AND_ASSIGN(file, caching_fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 12, "abcdefghijkl");
+  auto metrics = caching_fs_->metrics();
+  ASSERT_EQ(metrics.misses, 6);
+  // Stale blocks were dropped
+  ASSERT_EQ(metrics.cached_bytes, 12);
+  ASSERT_EQ(NumCacheFiles(), 3);
+
+  // A different modification time is detected as well
+  ASSERT_OK_AND_ASSIGN(auto info, fs_->GetFileInfo("data"));
+  info.set_mtime(TimePoint(TimePoint::duration(43)));
+  ASSERT_OK_AND_ASSIGN(file, caching_fs_->OpenInputFile(info));
+  AssertReadAt(file.get(), 0, 4, "abcd");
+  ASSERT_EQ(caching_fs_->metrics().misses, 7);
+
+  // Without a modification time, the file is not cached
+  info.set_mtime(kNoTime);
+  ASSERT_OK_AND_ASSIGN(file, caching_fs_->OpenInputFile(info));
+  AssertReadAt(file.get(), 0, 4, "abcd");
+  ASSERT_EQ(caching_fs_->metrics().misses, 7);
+}
+
+TEST_F(TestCachingFS, Reuse) {
+  CreateFile("data", "0123456789");
+  CreateFile("other", "abcdefgh");
+  for (const auto& path : {"data", "other"}) {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 10));
+  }
+  ASSERT_EQ(NumCacheFiles(), 5);
+
+  // Truncate the last block of "data" (the only 2-byte block, so the only
+  // 54-byte block file with its header), as after a crash while writing it
+  FileSelector selector;
+  selector.base_dir = "cache";
+  ASSERT_OK_AND_ASSIGN(auto infos, cache_fs_->GetFileInfo(selector));
+  std::string truncated;
+  for (const auto& info : infos) {
+    if (info.size() == 54) {
+      truncated = info.path();
+    }
+  }
+  ASSERT_NE(truncated, "");
+  {
+    ASSERT_OK_AND_ASSIGN(auto file, cache_fs_->OpenInputFile(truncated));
+    ASSERT_OK_AND_ASSIGN(auto contents, file->ReadAt(0, 53));
+    ::arrow::fs::CreateFile(cache_fs_.get(), truncated, contents->ToString());
+  }
+
+  // A new CachingFileSystem picks up the blocks of the earlier one, and deletes
+  // the truncated block
+  MakeCachingFS();
+  AssertFileInfo(cache_fs_.get(), truncated, FileType::NotFound);
+  ASSERT_EQ(NumCacheFiles(), 4);
+  ASSERT_EQ(caching_fs_->metrics().cached_bytes, 16);
+  {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+    AssertReadAt(file.get(), 0, 10, "0123456789");
+    ASSERT_OK_AND_ASSIGN(file, caching_fs_->OpenInputFile("other"));
+    AssertReadAt(file.get(), 0, 8, "abcdefgh");
+  }
+  // Only the truncated block was fetched again
+  ASSERT_EQ(caching_fs_->metrics().misses, 1);
+  ASSERT_EQ(NumCacheFiles(), 5);
+
+  // Reused blocks are validated against the base filesystem
+  CreateFile("data", "abcdefghijkl");
+  MakeCachingFS();
+  {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+    AssertReadAt(file.get(), 0, 12, "abcdefghijkl");
+  }
+  ASSERT_EQ(caching_fs_->metrics().misses, 3);
+  ASSERT_EQ(NumCacheFiles(), 5);
+}
+
+TEST_F(TestCachingFS, Invalidation) {
+  ASSERT_OK(fs_->CreateDir("AB/CD"));
+  CreateFile("AB/data", "0123456789");
+  CreateFile("AB/CD/data", "0123456789");
+  CreateFile("AB-other", "0123456789");
+  for (const auto& path : {"AB/data", "AB/CD/data", "AB-other"}) {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile(path));
+    AssertReadAt(file.get(), 0, 10, "0123456789");
+  }
+  ASSERT_EQ(caching_fs_->metrics().cached_bytes, 30);
+
+  // Writing through the caching filesystem invalidates cached blocks
+  {
+    ASSERT_OK_AND_ASSIGN(auto stream, caching_fs_->OpenOutputStream("AB-other"));
+    ASSERT_OK(stream->Write("9876543210"));
+    ASSERT_OK(stream->Close());
+  }
+  ASSERT_EQ(caching_fs_->metrics().cached_bytes, 20);
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("AB-other"));
+  AssertReadAt(file.get(), 0, 10, "9876543210");
+
+  ASSERT_OK(caching_fs_->DeleteDir("AB"));
+  ASSERT_EQ(caching_fs_->metrics().cached_bytes, 10);
+  ASSERT_EQ(NumCacheFiles(), 3);
+
+  ASSERT_OK(caching_fs_->ClearCache());
+  ASSERT_EQ(caching_fs_->metrics().cached_bytes, 0);
+  ASSERT_EQ(NumCacheFiles(), 0);
+}
+
+TEST_F(TestCachingFS, Eviction) {
+  options_.capacity = 8;
+  MakeCachingFS();
+  CreateFile("data", "0123456789ab");
+
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+  AssertReadAt(file.get(), 0, 4, "0123");
+  AssertReadAt(file.get(), 4, 4, "4567");
+  AssertReadAt(file.get(), 0, 4, "0123");
+  // Evicts the least recently used block (4567)
+  AssertReadAt(file.get(), 8, 4, "89ab");
+  auto metrics = caching_fs_->metrics();
+  ASSERT_EQ(metrics.evictions, 1);
+  ASSERT_EQ(metrics.cached_bytes, 8);
+  ASSERT_EQ(NumCacheFiles(), 2);
+
+  AssertReadAt(file.get(), 0, 4, "0123");
+  ASSERT_EQ(caching_fs_->metrics().misses, 3);
+  AssertReadAt(file.get(), 4, 4, "4567");
+  ASSERT_EQ(caching_fs_->metrics().misses, 4);
+}
+
+TEST_F(TestCachingFS, SlowBaseFileSystem) {
+  fs_ = std::make_shared<SlowFileSystem>(fs_, 0.001);
+  MakeCachingFS();
+  CreateFile("data", "some data");
+
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs_->OpenInputFile("data"));
+    AssertReadAt(file.get(), 0, 9, "some data");
+  }
+  auto metrics = caching_fs_->metrics();
+  ASSERT_EQ(metrics.misses, 3);
+  ASSERT_EQ(metrics.bytes_from_base, 9);
+  ASSERT_EQ(metrics.bytes_from_cache, 9 * 5);
+}
+
+TEST(CachingFileSystem, LocalCacheDir) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, arrow::internal::TemporaryDir::Make("cachingfs-"));
+  auto base_fs = std::make_shared<MockFileSystem>(TimePoint(TimePoint::duration(42)));
+  CreateFile(base_fs.get(), "data", "some data");
+
+  CachingFileSystemOptions options;
+  options.cache_dir = temp_dir->path().ToString() + "cache";
+  options.block_size = 4;
+  ASSERT_OK_AND_ASSIGN(auto caching_fs, CachingFileSystem::Make(base_fs, options));
+
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto file, caching_fs->OpenInputFile("data"));
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 9));
+    AssertBufferEqual(*buf, "some data");
+  }
+  auto metrics = caching_fs->metrics();
+  ASSERT_EQ(metrics.misses, 3);
+  ASSERT_EQ(metrics.hits, 3);
+
+  // Blocks are stored as local files
+  LocalFileSystem local_fs;
+  FileSelector selector;
+  selector.base_dir = options.cache_dir;
+  ASSERT_OK_AND_ASSIGN(auto infos, local_fs.GetFileInfo(selector));
+  // Including the cache directory marker
+  ASSERT_EQ(infos.size(), 4);
+
+  // They are reused by another CachingFileSystem
+  ASSERT_OK_AND_ASSIGN(caching_fs, CachingFileSystem::Make(base_fs, options));
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs->OpenInputFile("data"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 9));
+  AssertBufferEqual(*buf, "some data");
+  ASSERT_EQ(caching_fs->metrics().misses, 0);
+
+  // The temporary directory isn't a cache directory
+  options.cache_dir = temp_dir->path().ToString();
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs, options));
+}
+
+}  // namespace fs
+}  // namespace arrow
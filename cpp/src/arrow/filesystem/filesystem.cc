@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -30,11 +33,13 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/slow.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/windows_fixup.h"
 
@@ -129,6 +134,166 @@ Result<std::vector<FileInfo>> FileSystem::GetFileInfo(
   return res;
 }
 
+namespace {
+
+// Shared state of a concurrent recursive listing.  Each task lists one
+// directory and spawns tasks for its subdirectories.
+class ConcurrentListing : public std::enable_shared_from_this<ConcurrentListing> {
+ public:
+  ConcurrentListing(FileSystem* fs, const FileSelector& select)
+      : fs_(fs), select_(select), executor_(io::internal::GetIOThreadPool()) {}
+
+  void Start() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++pending_;
+    }
+    SpawnListing(select_.base_dir, 0, select_.allow_not_found);
+  }
+
+  Result<std::vector<FileInfo>> Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return !batches_.empty() || !status_.ok() || pending_ == 0; });
+    RETURN_NOT_OK(status_);
+    if (batches_.empty()) {
+      return IterationTraits<std::vector<FileInfo>>::End();
+    }
+    auto batch = std::move(batches_.front());
+    batches_.pop_front();
+    return batch;
+  }
+
+  // Stop issuing listings and wait until the filesystem isn't accessed anymore.
+  // Queued listings are not waited for, as they may be queued behind the caller
+  // on the thread pool.
+  void Stop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    cv_.wait(lock, [&] { return running_ == 0; });
+  }
+
+ protected:
+  // The caller must have incremented `pending_`
+  void SpawnListing(std::string dir, int32_t depth, bool allow_not_found) {
+    auto self = shared_from_this();
+    auto st = executor_->Spawn([self, dir, depth, allow_not_found] {
+      self->ListDirectory(dir, depth, allow_not_found);
+    });
+    if (!st.ok()) {
+      Finish({}, std::move(st));
+    }
+  }
+
+  void ListDirectory(const std::string& dir, int32_t depth, bool allow_not_found) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopped_ || !status_.ok()) {
+        --pending_;
+        cv_.notify_all();
+        return;
+      }
+      ++running_;
+    }
+    FileSelector select;
+    select.base_dir = dir;
+    select.allow_not_found = allow_not_found;
+    auto result = fs_->GetFileInfo(select);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --running_;
+      if (stopped_) {
+        --pending_;
+        cv_.notify_all();
+        return;
+      }
+    }
+    if (!result.ok()) {
+      Finish({}, result.status());
+      return;
+    }
+    auto infos = *std::move(result);
+    if (select_.recursive && depth < select_.max_recursion) {
+      std::vector<std::string> subdirs;
+      for (const auto& info : infos) {
+        if (info.IsDirectory()) {
+          subdirs.push_back(info.path());
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ += static_cast<int64_t>(subdirs.size());
+      }
+      // A subdirectory may have been deleted since it was listed
+      for (auto& subdir : subdirs) {
+        SpawnListing(std::move(subdir), depth + 1, /*allow_not_found=*/true);
+      }
+    }
+    Finish(std::move(infos), Status::OK());
+  }
+
+  void Finish(std::vector<FileInfo> infos, Status st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!st.ok()) {
+      if (status_.ok()) {
+        status_ = std::move(st);
+      }
+    } else if (!infos.empty()) {
+      batches_.push_back(std::move(infos));
+    }
+    --pending_;
+    cv_.notify_all();
+  }
+
+  FileSystem* fs_;
+  const FileSelector select_;
+  ::arrow::internal::Executor* executor_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::vector<FileInfo>> batches_;
+  // Number of directory listings spawned and not yet finished
+  int64_t pending_ = 0;
+  // Number of directory listings currently accessing the filesystem
+  int64_t running_ = 0;
+  bool stopped_ = false;
+  Status status_;
+};
+
+class ConcurrentListingIterator {
+ public:
+  explicit ConcurrentListingIterator(std::shared_ptr<ConcurrentListing> listing)
+      : listing_(std::move(listing)) {}
+
+  ConcurrentListingIterator(ConcurrentListingIterator&&) = default;
+  ConcurrentListingIterator& operator=(ConcurrentListingIterator&&) = default;
+
+  ~ConcurrentListingIterator() {
+    if (listing_) {
+      listing_->Stop();
+    }
+  }
+
+  Result<std::vector<FileInfo>> Next() { return listing_->Next(); }
+
+ private:
+  std::shared_ptr<ConcurrentListing> listing_;
+};
+
+}  // namespace
+
+Result<FileInfoIterator> FileSystem::GetFileInfoIterator(const FileSelector& select) {
+  if (!select.recursive) {
+    ARROW_ASSIGN_OR_RAISE(auto infos, GetFileInfo(select));
+    if (infos.empty()) {
+      return MakeEmptyIterator<std::vector<FileInfo>>();
+    }
+    return MakeVectorIterator(std::vector<std::vector<FileInfo>>{std::move(infos)});
+  }
+  auto listing = std::make_shared<ConcurrentListing>(this, select);
+  listing->Start();
+  return FileInfoIterator(ConcurrentListingIterator(std::move(listing)));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
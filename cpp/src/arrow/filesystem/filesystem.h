@@ -29,6 +29,7 @@
 #include "arrow/io/type_fwd.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "arrow/util/windows_fixup.h"
@@ -134,6 +135,20 @@ struct ARROW_EXPORT FileSelector {
   FileSelector() {}
 };
 
+}  // namespace fs
+
+template <>
+struct IterationTraits<std::vector<fs::FileInfo>> {
+  static std::vector<fs::FileInfo> End() { return {}; }
+};
+
+namespace fs {
+
+/// \brief An iterator over batches of FileInfo
+///
+/// Batches are never empty; an empty batch signals the end of iteration.
+using FileInfoIterator = Iterator<std::vector<FileInfo>>;
+
 /// \brief Abstract file system API
 class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem> {
  public:
@@ -170,6 +185,17 @@ class ARROW_EXPORT FileSystem : public std::enable_shared_from_this<FileSystem>
   /// If it doesn't exist, see `FileSelector::allow_not_found`.
   virtual Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) = 0;
 
+  /// \brief Same, returning batches of results as they become available.
+  ///
+  /// For a recursive selector, the default implementation lists the base
+  /// directory and then its subdirectories concurrently on the I/O thread pool,
+  /// using non-recursive GetFileInfo() calls.  Batches are therefore returned
+  /// in no particular order, and the first ones can be consumed while the
+  /// rest of the tree is still being listed.
+  ///
+  /// The filesystem must outlive the returned iterator.
+  virtual Result<FileInfoIterator> GetFileInfoIterator(const FileSelector& select);
+
   /// Create a directory and subdirectories.
   ///
   /// This function succeeds if the directory already exists.
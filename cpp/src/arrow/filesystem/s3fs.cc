@@ -266,6 +266,8 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          max_background_write_bytes == other.max_background_write_bytes &&
+          max_background_write_parts == other.max_background_write_parts &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey());
 }
@@ -546,6 +548,10 @@ class ObjectInputFile : public io::RandomAccessFile {
 // so I chose the safer value.
 // (see https://docs.aws.amazon.com/AmazonS3/latest/API/mpUploadUploadPart.html)
 static constexpr int64_t kMinimumPartUpload = 5 * 1024 * 1024;
+// Maximum size for each part of a multipart upload
+static constexpr int64_t kMaximumPartUpload = int64_t(5) * 1024 * 1024 * 1024;
+// Number of part buffers kept by an output stream for reuse
+static constexpr size_t kMaxFreePartBuffers = 4;
 
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream : public io::OutputStream {
@@ -681,8 +687,7 @@ class ObjectOutputStream : public io::OutputStream {
     }
     // Can't upload data on its own, need to buffer it
     if (!current_part_) {
-      ARROW_ASSIGN_OR_RAISE(current_part_,
-                            io::BufferOutputStream::Create(part_upload_threshold_));
+      ARROW_ASSIGN_OR_RAISE(current_part_, MakePartStream());
       current_part_size_ = 0;
     }
     RETURN_NOT_OK(current_part_->Write(data, nbytes));
@@ -710,19 +715,40 @@ class ObjectOutputStream : public io::OutputStream {
 
   // Upload-related helpers
 
+  // Create a stream buffering the next part, reusing the buffer of an
+  // already uploaded part if possible
+  Result<std::shared_ptr<io::BufferOutputStream>> MakePartStream() {
+    std::shared_ptr<ResizableBuffer> buffer;
+    {
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (!upload_state_->free_buffers.empty()) {
+        buffer = std::move(upload_state_->free_buffers.back());
+        upload_state_->free_buffers.pop_back();
+      }
+    }
+    if (buffer == nullptr) {
+      return io::BufferOutputStream::Create(part_upload_threshold_);
+    }
+    RETURN_NOT_OK(buffer->Resize(part_upload_threshold_, /*shrink_to_fit=*/false));
+    return std::make_shared<io::BufferOutputStream>(buffer);
+  }
+
   Status CommitCurrentPart() {
     ARROW_ASSIGN_OR_RAISE(auto buf, current_part_->Finish());
     current_part_.reset();
     current_part_size_ = 0;
-    return UploadPart(buf);
+    return UploadPart(buf->data(), buf->size(), buf, /*recycle_buffer=*/true);
   }
 
   Status UploadPart(std::shared_ptr<Buffer> buffer) {
     return UploadPart(buffer->data(), buffer->size(), buffer);
   }
 
+  // If `recycle_buffer` is true, `owned_buffer` is a ResizableBuffer that
+  // can be reused for another part once uploaded.
   Status UploadPart(const void* data, int64_t nbytes,
-                    std::shared_ptr<Buffer> owned_buffer = nullptr) {
+                    std::shared_ptr<Buffer> owned_buffer = nullptr,
+                    bool recycle_buffer = false) {
     S3Model::UploadPartRequest req;
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
@@ -736,10 +762,18 @@ class ObjectOutputStream : public io::OutputStream {
       if (!outcome.IsSuccess()) {
         return UploadPartError(req, outcome);
       } else {
+        std::unique_lock<std::mutex> lock(upload_state_->mutex);
         AddCompletedPart(upload_state_, part_number_, outcome.GetResult());
+        if (recycle_buffer) {
+          RecyclePartBuffer(upload_state_, std::move(owned_buffer));
+        }
       }
     } else {
       std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      // Apply backpressure: wait for enough uploads to finish if too many
+      // are already in progress
+      WaitForUploadCapacity(&lock, nbytes);
+      RETURN_NOT_OK(upload_state_->status);
       auto state = upload_state_;  // Keep upload state alive in closure
       auto part_number = part_number_;
 
@@ -755,7 +789,7 @@ class ObjectOutputStream : public io::OutputStream {
           std::make_shared<StringViewStream>(owned_buffer->data(), owned_buffer->size()));
 
       auto handler =
-          [state, owned_buffer, part_number](
+          [state, owned_buffer, part_number, nbytes, recycle_buffer](
               const Aws::S3::S3Client*, const S3Model::UploadPartRequest& req,
               const S3Model::UploadPartOutcome& outcome,
               const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) -> void {
@@ -764,35 +798,62 @@ class ObjectOutputStream : public io::OutputStream {
           state->status &= UploadPartError(req, outcome);
         } else {
           AddCompletedPart(state, part_number, outcome.GetResult());
+          if (recycle_buffer) {
+            RecyclePartBuffer(state, owned_buffer);
+          }
         }
         // Notify completion, regardless of success / error status
-        if (--state->parts_in_progress == 0) {
-          state->cv.notify_all();
-        }
+        --state->parts_in_progress;
+        state->bytes_in_progress -= nbytes;
+        state->cv.notify_all();
       };
       ++upload_state_->parts_in_progress;
+      upload_state_->bytes_in_progress += nbytes;
       client_->UploadPartAsync(req, handler);
     }
 
     ++part_number_;
     // With up to 10000 parts in an upload (S3 limit), a stream writing chunks
-    // of exactly 5MB would be limited to 50GB total.  To avoid that, we bump
-    // the upload threshold every 100 parts.  So the pattern is:
-    // - part 1 to 99: 5MB threshold
-    // - part 100 to 199: 10MB threshold
-    // - part 200 to 299: 15MB threshold
+    // of exactly 5MB would be limited to 50GB total.  To avoid that, we double
+    // the upload threshold every 1000 parts.  So the pattern is:
+    // - part 1 to 999: 5MB threshold (up to ~5GB total)
+    // - part 1000 to 1999: 10MB threshold (up to ~15GB total)
+    // - part 2000 to 2999: 20MB threshold (up to ~35GB total)
     // ...
-    // - part 9900 to 9999: 500MB threshold
-    // So the total size limit is 2475000MB or ~2.4TB, while keeping manageable
-    // chunk sizes and avoiding too much buffering in the common case of a small-ish
-    // stream.  If the limit's not enough, we can revisit.
-    if (part_number_ % 100 == 0) {
-      part_upload_threshold_ += kMinimumPartUpload;
+    // - part 9000 to 9999: 2560MB threshold
+    // So the total size limit is ~5TB, the maximum size of a S3 object, while
+    // keeping small parts (and therefore little buffering) for all but very
+    // large streams.
+    if (part_number_ % 1000 == 0) {
+      part_upload_threshold_ = std::min(part_upload_threshold_ * 2, kMaximumPartUpload);
     }
 
     return Status::OK();
   }
 
+  // Wait until a part of `nbytes` bytes may be uploaded in the background
+  // without exceeding the configured limits.  A part is always allowed if no
+  // other upload is in progress.
+  void WaitForUploadCapacity(std::unique_lock<std::mutex>* lock, int64_t nbytes) {
+    const int64_t max_bytes = options_.max_background_write_bytes;
+    const int32_t max_parts = options_.max_background_write_parts;
+    upload_state_->cv.wait(*lock, [&]() {
+      const auto& state = *upload_state_;
+      return state.parts_in_progress == 0 || !state.status.ok() ||
+             ((max_parts <= 0 || state.parts_in_progress < max_parts) &&
+              (max_bytes <= 0 || state.bytes_in_progress + nbytes <= max_bytes));
+    });
+  }
+
+  // Keep the buffer of an uploaded part for reuse.  The state mutex must be held.
+  static void RecyclePartBuffer(const std::shared_ptr<UploadState>& state,
+                                std::shared_ptr<Buffer> buffer) {
+    if (state->free_buffers.size() < kMaxFreePartBuffers) {
+      state->free_buffers.push_back(
+          ::arrow::internal::checked_pointer_cast<ResizableBuffer>(std::move(buffer)));
+    }
+  }
+
   static void AddCompletedPart(const std::shared_ptr<UploadState>& state, int part_number,
                                const S3Model::UploadPartResult& result) {
     S3Model::CompletedPart part;
@@ -835,6 +896,9 @@ class ObjectOutputStream : public io::OutputStream {
     std::condition_variable cv;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
+    // Buffers of uploaded parts, available for reuse
+    std::vector<std::shared_ptr<ResizableBuffer>> free_buffers;
     Status status;
 
     UploadState() : status(Status::OK()) {}
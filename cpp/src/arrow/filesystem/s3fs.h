@@ -55,6 +55,18 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Maximum number of bytes of background writes in progress, per OutputStream.
+  ///
+  /// When this limit or `max_background_write_parts` would be exceeded, writes
+  /// block until enough uploads have completed.  A non-positive value means
+  /// no limit.
+  int64_t max_background_write_bytes = 256 * 1024 * 1024;
+
+  /// Maximum number of parts of background writes in progress, per OutputStream.
+  ///
+  /// A non-positive value means no limit.
+  int32_t max_background_write_parts = 32;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -386,6 +387,58 @@ BENCHMARK_DEFINE_F(MinioFixture, ReadCoalesced500Mib)(benchmark::State& st) {
 }
 BENCHMARK_REGISTER_F(MinioFixture, ReadCoalesced500Mib)->UseRealTime();
 
+/// Write an object in chunks of `chunk_size` bytes, to measure upload bandwidth
+/// for the given limit on background writes in progress.
+static void ChunkedWrite(benchmark::State& st, S3Options options,
+                         const std::string& path, int64_t size, int64_t chunk_size,
+                         int64_t max_background_write_bytes) {
+  options.max_background_write_bytes = max_background_write_bytes;
+  std::shared_ptr<S3FileSystem> fs;
+  ASSERT_OK_AND_ASSIGN(fs, S3FileSystem::Make(options));
+  const std::string data(chunk_size, 'a');
+
+  int64_t total_bytes = 0;
+  int total_items = 0;
+  for (auto _ : st) {
+    std::shared_ptr<io::OutputStream> stream;
+    ASSERT_OK_AND_ASSIGN(stream, fs->OpenOutputStream(path));
+    int64_t written = 0;
+    while (written < size) {
+      const int64_t nbytes = std::min(chunk_size, size - written);
+      ASSERT_OK(stream->Write(data.data(), nbytes));
+      written += nbytes;
+    }
+    ASSERT_OK(stream->Close());
+    total_bytes += written;
+    total_items += 1;
+  }
+  st.SetBytesProcessed(total_bytes);
+  st.SetItemsProcessed(total_items);
+  std::cerr << "Wrote the file " << total_items << " times" << std::endl;
+}
+
+constexpr int64_t kWriteChunkSize = 1024 * 1024;
+
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked100Mib)(benchmark::State& st) {
+  ChunkedWrite(st, options_, bucket_ + "/written_100mib", 100 * 1024 * 1024,
+               kWriteChunkSize, st.range(0) * 1024 * 1024);
+}
+// Argument: maximum MiB of background writes in progress (0 = unlimited)
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked100Mib)
+    ->Arg(0)
+    ->Arg(16)
+    ->Arg(64)
+    ->UseRealTime();
+BENCHMARK_DEFINE_F(MinioFixture, WriteChunked500Mib)(benchmark::State& st) {
+  ChunkedWrite(st, options_, bucket_ + "/written_500mib", 500 * 1024 * 1024,
+               kWriteChunkSize, st.range(0) * 1024 * 1024);
+}
+BENCHMARK_REGISTER_F(MinioFixture, WriteChunked500Mib)
+    ->Arg(0)
+    ->Arg(16)
+    ->Arg(64)
+    ->UseRealTime();
+
 // Helpers to generate various multiple benchmarks for a given Parquet file.
 
 // NAME: the base name of the benchmark.
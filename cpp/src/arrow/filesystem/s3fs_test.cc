@@ -685,6 +685,26 @@ TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   TestOpenOutputStream();
 }
 
+TEST_F(TestS3FS, OpenOutputStreamLimitedBackgroundWrites) {
+  // Only one part upload in progress at a time
+  options_.max_background_write_parts = 1;
+  options_.max_background_write_bytes = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  // Many buffered parts, whose buffers are reused
+  std::string expected;
+  std::shared_ptr<io::OutputStream> stream;
+  ASSERT_OK_AND_ASSIGN(stream, fs_->OpenOutputStream("bucket/newfile5"));
+  for (int i = 0; i < 20; ++i) {
+    auto chunk = random_string(1000000, /*seed =*/i);
+    ASSERT_OK(stream->Write(chunk));
+    expected += chunk;
+  }
+  ASSERT_OK(stream->Close());
+  AssertObjectContents(client_.get(), "bucket", "newfile5", expected);
+}
+
 TEST_F(TestS3FS, OpenOutputStreamAbortBackgroundWrites) { TestOpenOutputStreamAbort(); }
 
 TEST_F(TestS3FS, OpenOutputStreamAbortSyncWrites) {
@@ -727,6 +727,85 @@ void GenericFileSystemTest::TestGetFileInfoSelectorWithRecursion(FileSystem* fs)
                          File("AA/AA.file")));
 }
 
+void GetSortedInfosFromIterator(FileSystem* fs, FileSelector s,
+                                std::vector<FileInfo>& infos) {
+  ASSERT_OK_AND_ASSIGN(auto it, fs->GetFileInfoIterator(s));
+  infos.clear();
+  for (auto maybe_batch : it) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    ASSERT_FALSE(batch.empty());
+    infos.insert(infos.end(), batch.begin(), batch.end());
+  }
+  for_each(infos.begin(), infos.end(), [](FileInfo& info) {
+    info.set_mtime(kNoTime);
+    info.set_size(kNoSize);
+  });
+  SortInfos(&infos);
+}
+
+// The error may be returned either when creating the iterator or when consuming it
+void AssertFileInfoIteratorRaises(FileSystem* fs, FileSelector s) {
+  auto maybe_it = fs->GetFileInfoIterator(s);
+  if (maybe_it.ok()) {
+    auto it = std::move(maybe_it).ValueOrDie();
+    ASSERT_RAISES(IOError, it.Next());
+  } else {
+    ASSERT_RAISES(IOError, maybe_it.status());
+  }
+}
+
+void GenericFileSystemTest::TestGetFileInfoIterator(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03/04"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  ASSERT_OK(fs->CreateDir("BB"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "AA/AA.file", "aa");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+  CreateFile(fs, "01/02/03/04/04.file", "04");
+
+  std::vector<FileInfo> expected, infos;
+  FileSelector s;
+
+  // Same results as GetFileInfo(FileSelector)
+  for (const std::string base_dir : {"", "01", "BB"}) {
+    s.base_dir = base_dir;
+    for (const bool recursive : {false, true}) {
+      s.recursive = recursive;
+      for (const int32_t max_recursion : {0, 1, 2, INT32_MAX}) {
+        s.max_recursion = max_recursion;
+        SCOPED_TRACE("base_dir = '" + base_dir + "', recursive = " +
+                     std::to_string(recursive) +
+                     ", max_recursion = " + std::to_string(max_recursion));
+        GetSortedInfos(fs, s, expected);
+        GetSortedInfosFromIterator(fs, s, infos);
+        ASSERT_EQ(infos, expected);
+      }
+    }
+  }
+
+  // Doesn't exist
+  s.base_dir = "XX";
+  s.recursive = true;
+  s.max_recursion = INT32_MAX;
+  AssertFileInfoIteratorRaises(fs, s);
+  s.allow_not_found = true;
+  GetSortedInfosFromIterator(fs, s, infos);
+  ASSERT_EQ(infos.size(), 0);
+  s.allow_not_found = false;
+
+  // Not a dir
+  s.base_dir = "00.file";
+  AssertFileInfoIteratorRaises(fs, s);
+
+  // Iterator destroyed before exhaustion
+  s.base_dir = "";
+  ASSERT_OK_AND_ASSIGN(auto it, fs->GetFileInfoIterator(s));
+  ASSERT_OK_AND_ASSIGN(auto batch, it.Next());
+  ASSERT_FALSE(batch.empty());
+}
+
 void GenericFileSystemTest::TestOpenOutputStream(FileSystem* fs) {
   std::shared_ptr<io::OutputStream> stream;
 
@@ -926,6 +1005,7 @@ GENERIC_FS_TEST_DEFINE(TestGetFileInfo)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoVector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelector)
 GENERIC_FS_TEST_DEFINE(TestGetFileInfoSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetFileInfoIterator)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
@@ -42,6 +42,7 @@ struct FileSelector;
 class FileSystem;
 class SubTreeFileSystem;
 class SlowFileSystem;
+class CachingFileSystem;
 class LocalFileSystem;
 
 #if defined(ARROW_R_WITH_S3)
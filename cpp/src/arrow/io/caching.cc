@@ -163,11 +163,12 @@ ReadRangeCache::~ReadRangeCache() {}
 Status ReadRangeCache::Cache(std::vector<ReadRange> ranges) {
   ranges = internal::CoalesceReadRanges(std::move(ranges), impl_->options.hole_size_limit,
                                         impl_->options.range_size_limit);
+  auto futures = impl_->file->ReadManyAsync(impl_->ctx, ranges);
+  DCHECK_EQ(futures.size(), ranges.size());
   std::vector<RangeCacheEntry> entries;
   entries.reserve(ranges.size());
-  for (const auto& range : ranges) {
-    auto fut = impl_->file->ReadAsync(impl_->ctx, range.offset, range.length);
-    entries.push_back({range, std::move(fut)});
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    entries.push_back({ranges[i], std::move(futures[i])});
   }
 
   impl_->AddEntries(std::move(entries));
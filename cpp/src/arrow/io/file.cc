@@ -47,6 +47,7 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
@@ -233,6 +234,53 @@ class OSFile {
   std::atomic<bool> need_seeking_;
 };
 
+// ----------------------------------------------------------------------
+// io_uring support
+
+namespace {
+
+std::atomic<bool>* IOUringEnabledFlag() {
+  static std::atomic<bool> flag([] {
+    auto maybe_env = ::arrow::internal::GetEnvVar("ARROW_IO_URING");
+    if (!maybe_env.ok() || *maybe_env != "1") {
+      return false;
+    }
+    auto maybe_uring = internal::IOUring::GetInstance();
+    if (!maybe_uring.ok()) {
+      ARROW_LOG(WARNING) << "ARROW_IO_URING is set but io_uring is unavailable: "
+                         << maybe_uring.status().ToString();
+      return false;
+    }
+    return true;
+  }());
+  return &flag;
+}
+
+// A duplicate of a file descriptor, kept open until the io_uring requests
+// referring to it have completed, so that closing the original file doesn't
+// let them read from a recycled descriptor.
+struct DuplicateFileDescriptor {
+  explicit DuplicateFileDescriptor(int fd) : fd(fd) {}
+  ~DuplicateFileDescriptor() {
+    auto st = ::arrow::internal::FileClose(fd);
+    ARROW_UNUSED(st);
+  }
+
+  int fd;
+};
+
+}  // namespace
+
+bool IsIOUringEnabled() { return IOUringEnabledFlag()->load(); }
+
+Status SetIOUringEnabled(bool enabled) {
+  if (enabled) {
+    RETURN_NOT_OK(internal::IOUring::GetInstance());
+  }
+  IOUringEnabledFlag()->store(enabled);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
@@ -287,7 +335,46 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyWithIOUring(
+      const std::vector<ReadRange>& ranges) {
+    auto maybe_fd = DuplicateDescriptor();
+    if (!maybe_fd.ok()) {
+      return std::vector<Future<std::shared_ptr<Buffer>>>(
+          ranges.size(),
+          Future<std::shared_ptr<Buffer>>::MakeFinished(maybe_fd.status()));
+    }
+    auto dup_fd = *std::move(maybe_fd);
+    const int fd = dup_fd->fd;
+    auto uring = internal::IOUring::GetInstance().ValueOrDie();
+    return uring->SubmitReads(std::move(dup_fd), fd, pool_, ranges);
+  }
+
+  Status WillNeedWithIOUring(const std::vector<ReadRange>& ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto dup_fd, DuplicateDescriptor());
+    const int fd = dup_fd->fd;
+    ARROW_ASSIGN_OR_RAISE(auto uring, internal::IOUring::GetInstance());
+    auto st = uring->SubmitWillNeed(std::move(dup_fd), fd, ranges);
+    if (st.IsNotImplemented()) {
+      // Kernel doesn't support asynchronous fadvise
+      return WillNeed(ranges);
+    }
+    return st;
+  }
+
  private:
+  Result<std::shared_ptr<DuplicateFileDescriptor>> DuplicateDescriptor() {
+    RETURN_NOT_OK(CheckClosed());
+#ifdef _WIN32
+    return Status::NotImplemented("Duplicating file descriptors on Windows");
+#else
+    int new_fd = fcntl(fd_, F_DUPFD_CLOEXEC, 0);
+    if (new_fd == -1) {
+      return IOErrorFromErrno(errno, "Failed to duplicate file descriptor");
+    }
+    return std::make_shared<DuplicateFileDescriptor>(new_fd);
+#endif
+  }
+
   MemoryPool* pool_;
 };
 
@@ -312,7 +399,27 @@ Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const AsyncContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+  if (IsIOUringEnabled()) {
+    return impl_->ReadManyWithIOUring({{position, nbytes}})[0];
+  }
+  return RandomAccessFile::ReadAsync(ctx, position, nbytes);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  if (IsIOUringEnabled()) {
+    return impl_->ReadManyWithIOUring(ranges);
+  }
+  return RandomAccessFile::ReadManyAsync(ctx, ranges);
+}
+
 Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
+  if (IsIOUringEnabled()) {
+    return impl_->WillNeedWithIOUring(ranges);
+  }
   return impl_->WillNeed(ranges);
 }
 
@@ -80,6 +80,20 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   std::unique_ptr<FileOutputStreamImpl> impl_;
 };
 
+/// \brief Return whether ReadableFile uses io_uring for asynchronous reads
+///
+/// This is disabled by default, unless the ARROW_IO_URING environment variable
+/// is set to "1" and io_uring is available.
+ARROW_EXPORT bool IsIOUringEnabled();
+
+/// \brief Set whether ReadableFile uses io_uring for asynchronous reads
+///
+/// When enabled on Linux, ReadAsync(), ReadManyAsync() and WillNeed() hand
+/// their requests to the kernel in a single batch, instead of issuing one
+/// blocking read per range on the AsyncContext's executor.  An error is
+/// returned if enabling is requested but io_uring isn't available.
+ARROW_EXPORT Status SetIOUringEnabled(bool enabled);
+
 /// \brief An operating system file open in read-only mode.
 ///
 /// Reads through this implementation are unbuffered.  If many small reads
@@ -111,6 +125,12 @@ class ARROW_EXPORT ReadableFile
 
   int file_descriptor() const;
 
+  Future<std::shared_ptr<Buffer>> ReadAsync(const AsyncContext&, int64_t position,
+                                            int64_t nbytes) override;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const AsyncContext&, const std::vector<ReadRange>& ranges) override;
+
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
  private:
@@ -27,6 +27,7 @@
 #include <cstring>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/test_common.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -377,6 +379,143 @@ TEST_F(TestReadableFile, ReadAsync) {
   AssertBufferEqual(*buf2, "test");
 }
 
+TEST_F(TestReadableFile, ReadManyAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  auto futures = file_->ReadManyAsync({}, {{1, 10}, {0, 4}, {6, 0}});
+  ASSERT_EQ(futures.size(), 3);
+  ASSERT_OK_AND_ASSIGN(auto buf1, futures[0].result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, futures[1].result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, futures[2].result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+}
+
+class TestReadableFileIOUring : public TestReadableFile {
+ public:
+  void SetUp() override {
+    TestReadableFile::SetUp();
+    was_enabled_ = IsIOUringEnabled();
+    available_ = SetIOUringEnabled(true).ok();
+  }
+
+  void TearDown() override {
+    ASSERT_OK(SetIOUringEnabled(was_enabled_));
+    TestReadableFile::TearDown();
+  }
+
+ protected:
+  bool was_enabled_ = false;
+  bool available_ = false;
+};
+
+TEST_F(TestReadableFileIOUring, ReadAsync) {
+  if (!available_) return;
+  MakeTestFile();
+  OpenFile();
+
+  auto fut1 = file_->ReadAsync({}, 1, 10);
+  auto fut2 = file_->ReadAsync({}, 0, 4);
+  auto fut3 = file_->ReadAsync({}, 100, 4);
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.result());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.result());
+  ASSERT_OK_AND_ASSIGN(auto buf3, fut3.result());
+  AssertBufferEqual(*buf1, "estdata");
+  AssertBufferEqual(*buf2, "test");
+  AssertBufferEqual(*buf3, "");
+
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, -1, 1).result());
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAsync({}, 0, 1).result());
+}
+
+TEST_F(TestReadableFileIOUring, ReadManyAsync) {
+  if (!available_) return;
+  MakeTestFile();
+  OpenFile();
+
+  // More reads than the ring can hold at once
+  std::vector<ReadRange> ranges;
+  for (int i = 0; i < 2000; ++i) {
+    ranges.push_back({i % 8, 4});
+  }
+  auto futures = file_->ReadManyAsync({}, ranges);
+  ASSERT_EQ(futures.size(), ranges.size());
+  // Reads can outlive the file
+  ASSERT_OK(file_->Close());
+  const std::string data = "testdata";
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futures[i].result());
+    AssertBufferEqual(*buf, data.substr(ranges[i].offset, ranges[i].length));
+  }
+}
+
+// Reads issued from the thread reaping completions, here by releasing the
+// owner of completed reads, mustn't wait for the ring to have capacity
+class ChainedReads {
+ public:
+  ChainedReads(internal::IOUring* uring, int fd) : uring_(uring), fd_(fd) {}
+
+  void Submit(int remaining) {
+    std::shared_ptr<void> owner(this, [remaining](void* self) {
+      if (remaining > 0) {
+        static_cast<ChainedReads*>(self)->Submit(remaining - 1);
+      } else {
+        static_cast<ChainedReads*>(self)->all_submitted_.MarkFinished();
+      }
+    });
+    // With a single-entry ring, the second read can only be issued once the
+    // first one has been reaped
+    auto futures = uring_->SubmitReads(owner, fd_, default_memory_pool(),
+                                       {{0, 4}, {4, 4}});
+    std::lock_guard<std::mutex> lock(mutex_);
+    futures_.insert(futures_.end(), futures.begin(), futures.end());
+  }
+
+  void AssertFinished(int num_steps) {
+    ASSERT_TRUE(all_submitted_.Wait(30.0)) << "chained reads are stuck";
+    std::lock_guard<std::mutex> lock(mutex_);
+    ASSERT_EQ(futures_.size(), 2 * static_cast<size_t>(num_steps + 1));
+    for (size_t i = 0; i < futures_.size(); ++i) {
+      ASSERT_OK_AND_ASSIGN(auto buf, futures_[i].result());
+      AssertBufferEqual(*buf, i % 2 == 0 ? "test" : "data");
+    }
+  }
+
+ protected:
+  internal::IOUring* uring_;
+  int fd_;
+  Future<void> all_submitted_ = Future<void>::Make();
+  std::mutex mutex_;
+  std::vector<Future<std::shared_ptr<Buffer>>> futures_;
+};
+
+TEST_F(TestReadableFileIOUring, ChainedReadsFullRing) {
+  if (!available_) return;
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK_AND_ASSIGN(auto uring, internal::IOUring::Make(/*queue_depth=*/1));
+  const int num_steps = 20;
+  ChainedReads reads(uring.get(), file_->file_descriptor());
+  reads.Submit(num_steps);
+  reads.AssertFinished(num_steps);
+}
+
+TEST_F(TestReadableFileIOUring, WillNeed) {
+  if (!available_) return;
+  MakeTestFile();
+  OpenFile();
+
+  ASSERT_OK(file_->WillNeed({}));
+  ASSERT_OK(file_->WillNeed({{0, 3}, {4, 6}}));
+  ASSERT_OK(file_->WillNeed({{10, 0}}));
+
+  ASSERT_RAISES(Invalid, file_->WillNeed({{-1, -1}}));
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
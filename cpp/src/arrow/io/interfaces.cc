@@ -137,6 +137,17 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(const AsyncContext&
   return *std::move(maybe_fut);
 }
 
+// Default ReadManyAsync() implementation: issue each read separately
+std::vector<Future<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAsync(
+    const AsyncContext& ctx, const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    futures.push_back(ReadAsync(ctx, range.offset, range.length));
+  }
+  return futures;
+}
+
 // Default WillNeed() implementation: no-op
 Status RandomAccessFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return Status::OK();
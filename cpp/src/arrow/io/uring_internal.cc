@@ -0,0 +1,615 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+// io_uring is driven through raw system calls, so as not to depend on liburing.
+// IORING_FEAT_FAST_POLL was added in the same kernel release (5.7) as
+// IORING_OP_READ and IORING_OP_FADVISE, so it's used to check the headers are
+// recent enough.
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(IORING_FEAT_FAST_POLL) && defined(__NR_io_uring_setup) && \
+    defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define ARROW_HAVE_IO_URING
+#endif
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using ::arrow::internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// Number of submission queue entries of the global instance, which is also
+// the maximum number of requests in flight.
+constexpr unsigned kQueueDepth = 256;
+
+// Maximum number of bytes asked for in a single read request (the kernel
+// would do a short read anyway above 0x7ffff000 bytes)
+constexpr int64_t kMaxReadSize = int64_t(1) << 30;
+
+int SysSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int SysEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int SysRegister(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+struct Request {
+  std::shared_ptr<void> owner;
+  int fd;
+  uint8_t opcode;
+  int64_t offset;
+  int64_t length;
+  // Number of bytes read so far
+  int64_t bytes_read = 0;
+  std::shared_ptr<ResizableBuffer> buffer;
+  Future<std::shared_ptr<Buffer>> future;
+};
+
+// A request that has completed, to be finished outside of the ring lock
+struct Completion {
+  Request* request;
+  Status status;
+};
+
+void FinishRequest(Request* request, Status status) {
+  if (request == nullptr) {
+    // Shutdown request
+    return;
+  }
+  if (request->opcode == IORING_OP_READ) {
+    if (status.ok() && request->bytes_read < request->length) {
+      // Reached EOF
+      status = request->buffer->Resize(request->bytes_read);
+      if (status.ok()) {
+        request->buffer->ZeroPadding();
+      }
+    }
+    if (status.ok()) {
+      request->future.MarkFinished(std::shared_ptr<Buffer>(std::move(request->buffer)));
+    } else {
+      request->future.MarkFinished(std::move(status));
+    }
+  } else if (!status.ok()) {
+    ARROW_LOG(DEBUG) << "io_uring request failed: " << status.ToString();
+  }
+  delete request;
+}
+
+}  // namespace
+
+struct IOUring::Impl {
+  explicit Impl(unsigned queue_depth) : queue_depth_(queue_depth) {}
+
+  ~Impl() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+      munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ != -1) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init() {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ring_fd_ = SysSetup(queue_depth_, &params);
+    if (ring_fd_ < 0) {
+      ring_fd_ = -1;
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    RETURN_NOT_OK(CheckSupport());
+
+    sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+    }
+    ARROW_ASSIGN_OR_RAISE(sq_ptr_, Map(sq_size_, IORING_OFF_SQ_RING));
+    if (single_mmap) {
+      cq_ptr_ = sq_ptr_;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(cq_ptr_, Map(cq_size_, IORING_OFF_CQ_RING));
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    ARROW_ASSIGN_OR_RAISE(void* sqes, Map(sqes_size_, IORING_OFF_SQES));
+    sqes_ = reinterpret_cast<io_uring_sqe*>(sqes);
+
+    auto sq_base = reinterpret_cast<uint8_t*>(sq_ptr_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+    auto cq_base = reinterpret_cast<uint8_t*>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+    // The completion queue is at least as large as the submission queue,
+    // so bounding the requests in flight by the latter ensures it never overflows.
+    capacity_ = params.sq_entries;
+
+    reaper_ = std::thread([this] { ReapLoop(); });
+    return Status::OK();
+  }
+
+  void Shutdown() {
+    Status st;
+    std::vector<Completion> failed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      WaitForCapacity(&lock);
+      io_uring_sqe* sqe = NextSqe();
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = 0;
+      unsubmitted_.push_back(nullptr);
+      ++in_flight_;
+      st = Flush();
+      failed.swap(failed_);
+    }
+    FinishAll(&failed);
+    if (!st.ok()) {
+      // The reaper can't be woken up, let it go
+      ARROW_LOG(WARNING) << "Failed to shut down io_uring: " << st.ToString();
+      reaper_.detach();
+      return;
+    }
+    reaper_.join();
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      std::shared_ptr<void> owner, int fd, MemoryPool* pool,
+      const std::vector<ReadRange>& ranges) {
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    std::vector<Request*> requests;
+    futures.reserve(ranges.size());
+    requests.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      auto fut = Future<std::shared_ptr<Buffer>>::Make();
+      futures.push_back(fut);
+      auto st = ValidateRange(range.offset, range.length);
+      if (!st.ok()) {
+        fut.MarkFinished(std::move(st));
+        continue;
+      }
+      auto maybe_buffer = AllocateResizableBuffer(range.length, pool);
+      if (!maybe_buffer.ok()) {
+        fut.MarkFinished(maybe_buffer.status());
+        continue;
+      }
+      std::shared_ptr<ResizableBuffer> buffer = *std::move(maybe_buffer);
+      if (range.length == 0) {
+        fut.MarkFinished(std::shared_ptr<Buffer>(std::move(buffer)));
+        continue;
+      }
+      auto request = new Request;
+      request->owner = owner;
+      request->fd = fd;
+      request->opcode = IORING_OP_READ;
+      request->offset = range.offset;
+      request->length = range.length;
+      request->buffer = std::move(buffer);
+      request->future = std::move(fut);
+      requests.push_back(request);
+    }
+    Submit(requests);
+    return futures;
+  }
+
+  Status SubmitWillNeed(std::shared_ptr<void> owner, int fd,
+                        const std::vector<ReadRange>& ranges) {
+    if (!supports_fadvise_) {
+      return Status::NotImplemented("IORING_OP_FADVISE not supported by kernel");
+    }
+    std::vector<Request*> requests;
+    requests.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(ValidateRange(range.offset, range.length));
+    }
+    for (const auto& range : ranges) {
+      auto request = new Request;
+      request->owner = owner;
+      request->fd = fd;
+      request->opcode = IORING_OP_FADVISE;
+      request->offset = range.offset;
+      request->length = range.length;
+      requests.push_back(request);
+    }
+    return Submit(requests);
+  }
+
+ protected:
+  Result<void*> Map(size_t size, off_t offset) {
+    void* ptr =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+             offset);
+    if (ptr == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring queue");
+    }
+    return ptr;
+  }
+
+  Status CheckSupport() {
+    // A probe is followed by one io_uring_probe_op per opcode
+    constexpr int kNumProbeOps = 256;
+    std::vector<uint8_t> storage(sizeof(io_uring_probe) +
+                                 kNumProbeOps * sizeof(io_uring_probe_op));
+    auto probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    if (SysRegister(ring_fd_, IORING_REGISTER_PROBE, probe, kNumProbeOps) < 0) {
+      return IOErrorFromErrno(errno, "Failed to probe io_uring capabilities");
+    }
+    auto supports = [&](int op) {
+      return op < probe->ops_len && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+    };
+    if (!supports(IORING_OP_READ)) {
+      return Status::NotImplemented("IORING_OP_READ not supported by kernel");
+    }
+    supports_fadvise_ = supports(IORING_OP_FADVISE);
+    return Status::OK();
+  }
+
+  // Submit requests, waiting for capacity if necessary.  Requests which can't
+  // be submitted are finished with an error.
+  Status Submit(const std::vector<Request*>& requests) {
+    Status st;
+    std::vector<Completion> failed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (reaping_ring_ == this) {
+        // Called from a completion callback: waiting for capacity would wait
+        // for the reaper itself, so let it issue the requests later on
+        deferred_.insert(deferred_.end(), requests.begin(), requests.end());
+        return Status::OK();
+      }
+      for (auto request : requests) {
+        WaitForCapacity(&lock);
+        PrepareSqe(request);
+        ++in_flight_;
+      }
+      st = Flush();
+      failed.swap(failed_);
+    }
+    FinishAll(&failed);
+    return st;
+  }
+
+  // Issue the requests submitted by completion callbacks, as far as capacity
+  // allows, and hand all queued entries to the kernel.  The lock must be held.
+  void IssueDeferred() {
+    while (!deferred_.empty() && in_flight_ < capacity_) {
+      PrepareSqe(deferred_.front());
+      deferred_.pop_front();
+      ++in_flight_;
+    }
+    Status st = Flush();
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << st.ToString();
+    }
+  }
+
+  // Wait until a new request may be issued.  The lock must be held.
+  void WaitForCapacity(std::unique_lock<std::mutex>* lock) {
+    while (in_flight_ >= capacity_) {
+      // Make sure the requests we're waiting for were handed to the kernel
+      Status st = Flush();
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << st.ToString();
+      }
+      capacity_cv_.wait(*lock);
+    }
+  }
+
+  // Return the next free submission queue entry.  The lock must be held.
+  io_uring_sqe* NextSqe() {
+    const unsigned index = sq_local_tail_ & sq_mask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    ++sq_local_tail_;
+    return sqe;
+  }
+
+  // Queue the next step of a request.  The lock must be held.
+  void PrepareSqe(Request* request) {
+    io_uring_sqe* sqe = NextSqe();
+    sqe->opcode = request->opcode;
+    sqe->fd = request->fd;
+    sqe->off = static_cast<uint64_t>(request->offset + request->bytes_read);
+    const int64_t remaining = request->length - request->bytes_read;
+    sqe->len = static_cast<uint32_t>(std::min(remaining, kMaxReadSize));
+    if (request->opcode == IORING_OP_READ) {
+      sqe->addr = reinterpret_cast<uint64_t>(request->buffer->mutable_data() +
+                                             request->bytes_read);
+    } else {
+      sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+    }
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    unsubmitted_.push_back(request);
+  }
+
+  // Hand queued entries to the kernel.  The lock must be held.  Requests which
+  // can't be submitted are moved to failed_, to be finished by the caller once
+  // the lock is released.
+  Status Flush() {
+    if (unsubmitted_.empty()) {
+      return Status::OK();
+    }
+    __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+    size_t submitted = 0;
+    int ret = 0;
+    while (submitted < unsubmitted_.size()) {
+      ret = SysEnter(ring_fd_, static_cast<unsigned>(unsubmitted_.size() - submitted),
+                     0, 0);
+      if (ret < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+          continue;
+        }
+        break;
+      }
+      submitted += ret;
+    }
+    if (submitted == unsubmitted_.size()) {
+      unsubmitted_.clear();
+      return Status::OK();
+    }
+    // The kernel didn't consume the remaining entries: take them back
+    // and fail the corresponding requests.
+    Status st = IOErrorFromErrno(errno, "io_uring_enter failed");
+    const auto remaining = static_cast<unsigned>(unsubmitted_.size() - submitted);
+    sq_local_tail_ -= remaining;
+    __atomic_store_n(sq_tail_, sq_local_tail_, __ATOMIC_RELEASE);
+    for (size_t i = submitted; i < unsubmitted_.size(); ++i) {
+      failed_.push_back({unsubmitted_[i], st});
+    }
+    in_flight_ -= remaining;
+    unsubmitted_.clear();
+    capacity_cv_.notify_all();
+    return st;
+  }
+
+  static void FinishAll(std::vector<Completion>* completions) {
+    for (auto& completion : *completions) {
+      FinishRequest(completion.request, std::move(completion.status));
+    }
+    completions->clear();
+  }
+
+  void ReapLoop() {
+    reaping_ring_ = this;
+    bool shutting_down = false;
+    std::vector<Completion> completions;
+    while (!shutting_down) {
+      int ret = SysEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        ARROW_LOG(ERROR) << IOErrorFromErrno(errno, "io_uring_enter failed").ToString();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        unsigned head = *cq_head_;
+        const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+          const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+          if (cqe.user_data == 0) {
+            --in_flight_;
+            shutting_down = true;
+            continue;
+          }
+          auto request = reinterpret_cast<Request*>(cqe.user_data);
+          if (!OnCompletion(request, cqe.res)) {
+            // Request is done
+            Status st;
+            if (cqe.res < 0) {
+              st = IOErrorFromErrno(-cqe.res, request->opcode == IORING_OP_READ
+                                                   ? "Error reading from file"
+                                                   : "Error advising file");
+            }
+            completions.push_back({request, std::move(st)});
+            --in_flight_;
+          }
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        // Issue follow-up reads, if any
+        IssueDeferred();
+        MoveFailed(&completions);
+      }
+      while (!completions.empty()) {
+        capacity_cv_.notify_all();
+        FinishAll(&completions);
+        // Issue the requests submitted by the completion callbacks
+        std::lock_guard<std::mutex> lock(mutex_);
+        IssueDeferred();
+        MoveFailed(&completions);
+      }
+    }
+    // Requests submitted by the last completion callbacks can't be issued anymore
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto request : deferred_) {
+        completions.push_back({request, Status::IOError("io_uring was shut down")});
+      }
+      deferred_.clear();
+    }
+    FinishAll(&completions);
+  }
+
+  // Append the requests which failed to be submitted.  The lock must be held.
+  void MoveFailed(std::vector<Completion>* completions) {
+    completions->insert(completions->end(), failed_.begin(), failed_.end());
+    failed_.clear();
+  }
+
+  // Process a completion entry, returning true if the request was requeued.
+  // The lock must be held.
+  bool OnCompletion(Request* request, int res) {
+    if (res == -EAGAIN || res == -EINTR) {
+      PrepareSqe(request);
+      return true;
+    }
+    if (request->opcode != IORING_OP_READ || res <= 0) {
+      return false;
+    }
+    request->bytes_read += res;
+    if (request->bytes_read < request->length) {
+      // Short read, try to read the remaining bytes
+      PrepareSqe(request);
+      return true;
+    }
+    return false;
+  }
+
+  // The ring whose completions the current thread is reaping, and therefore
+  // whose completion callbacks it runs, if any
+  static thread_local Impl* reaping_ring_;
+
+  const unsigned queue_depth_;
+  int ring_fd_ = -1;
+  bool supports_fadvise_ = false;
+
+  void* sq_ptr_ = nullptr;
+  size_t sq_size_ = 0;
+  void* cq_ptr_ = nullptr;
+  size_t cq_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+
+  // Protects the fields below, and writing to the submission queue
+  std::mutex mutex_;
+  std::condition_variable capacity_cv_;
+  unsigned capacity_ = 0;
+  unsigned in_flight_ = 0;
+  unsigned sq_local_tail_ = 0;
+  std::vector<Request*> unsubmitted_;
+  // Requests submitted from the reaper thread and not issued yet
+  std::deque<Request*> deferred_;
+  // Requests which failed to be submitted and must be finished
+  std::vector<Completion> failed_;
+
+  std::thread reaper_;
+};
+
+thread_local IOUring::Impl* IOUring::Impl::reaping_ring_ = nullptr;
+
+IOUring::IOUring(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+IOUring::~IOUring() { impl_->Shutdown(); }
+
+Result<IOUring*> IOUring::GetInstance() {
+  static Result<std::unique_ptr<IOUring>> instance = Make(kQueueDepth);
+  RETURN_NOT_OK(instance.status());
+  return instance.ValueUnsafe().get();
+}
+
+Result<std::unique_ptr<IOUring>> IOUring::Make(unsigned queue_depth) {
+  std::unique_ptr<Impl> impl(new Impl(queue_depth));
+  RETURN_NOT_OK(impl->Init());
+  return std::unique_ptr<IOUring>(new IOUring(std::move(impl)));
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IOUring::SubmitReads(
+    std::shared_ptr<void> owner, int fd, MemoryPool* pool,
+    const std::vector<ReadRange>& ranges) {
+  return impl_->SubmitReads(std::move(owner), fd, pool, ranges);
+}
+
+Status IOUring::SubmitWillNeed(std::shared_ptr<void> owner, int fd,
+                               const std::vector<ReadRange>& ranges) {
+  return impl_->SubmitWillNeed(std::move(owner), fd, ranges);
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+struct IOUring::Impl {};
+
+IOUring::IOUring(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+IOUring::~IOUring() {}
+
+Result<IOUring*> IOUring::GetInstance() {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+Result<std::unique_ptr<IOUring>> IOUring::Make(unsigned queue_depth) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> IOUring::SubmitReads(
+    std::shared_ptr<void> owner, int fd, MemoryPool* pool,
+    const std::vector<ReadRange>& ranges) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures(
+      ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(
+                         Status::NotImplemented("io_uring is not supported")));
+  return futures;
+}
+
+Status IOUring::SubmitWillNeed(std::shared_ptr<void> owner, int fd,
+                               const std::vector<ReadRange>& ranges) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous file reads using Linux io_uring
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief A process-wide io_uring instance servicing asynchronous file reads
+///
+/// Reads submitted together are handed to the kernel in a single system call.
+/// Completions are reaped by one dedicated thread, so outstanding reads don't
+/// each occupy a thread.  The number of reads in flight is bounded by the
+/// ring size; submitters block when it is reached, except for completion
+/// callbacks (which run on the reaping thread) whose reads are queued until
+/// capacity is available.
+class ARROW_EXPORT IOUring {
+ public:
+  ~IOUring();
+
+  /// \brief Return the global IOUring instance
+  ///
+  /// An error is returned if io_uring is not supported on this platform or
+  /// by the running kernel (or is denied, e.g. by a seccomp filter).
+  static Result<IOUring*> GetInstance();
+
+  /// \brief Create a separate IOUring instance allowing `queue_depth` requests
+  /// in flight
+  ///
+  /// This is mostly useful for testing.
+  static Result<std::unique_ptr<IOUring>> Make(unsigned queue_depth);
+
+  /// \brief Read the given ranges of file descriptor `fd`
+  ///
+  /// `owner` is kept alive until all reads have completed; it should own `fd`.
+  std::vector<Future<std::shared_ptr<Buffer>>> SubmitReads(
+      std::shared_ptr<void> owner, int fd, MemoryPool* pool,
+      const std::vector<ReadRange>& ranges);
+
+  /// \brief Advise the kernel that the given ranges of `fd` will be needed soon
+  ///
+  /// This returns without waiting for the advice to be processed.
+  Status SubmitWillNeed(std::shared_ptr<void> owner, int fd,
+                        const std::vector<ReadRange>& ranges);
+
+ protected:
+  struct Impl;
+
+  explicit IOUring(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
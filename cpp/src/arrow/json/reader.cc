@@ -17,6 +17,7 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -29,8 +30,10 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -45,6 +48,148 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// A block of JSON data, cut along object boundaries by the Chunker
+struct ChunkedBlock {
+  // Incomplete object at the end of the previous block
+  std::shared_ptr<Buffer> partial;
+  // Remainder of that object at the start of this block
+  std::shared_ptr<Buffer> completion;
+  // Whole objects entirely inside this block
+  std::shared_ptr<Buffer> whole;
+  int64_t index;
+};
+
+// Split a stream of buffers into ChunkedBlocks
+class ChunkedBlockReader {
+ public:
+  ChunkedBlockReader(Iterator<std::shared_ptr<Buffer>> buffer_iterator,
+                     std::unique_ptr<Chunker> chunker)
+      : buffer_iterator_(std::move(buffer_iterator)),
+        chunker_(std::move(chunker)),
+        partial_(std::make_shared<Buffer>("")) {}
+
+  Status Init() { return buffer_iterator_.Next().Value(&block_); }
+
+  /// Whether the input stream was empty
+  bool empty() const { return block_ == nullptr && block_index_ == 0; }
+
+  /// Return the next ChunkedBlock, or an empty optional at end of stream
+  Result<util::optional<ChunkedBlock>> Next() {
+    if (block_ == nullptr) {
+      return util::nullopt;
+    }
+
+    std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+
+    ARROW_ASSIGN_OR_RAISE(next_block, buffer_iterator_.Next());
+
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    }
+
+    ChunkedBlock out{std::move(partial_), std::move(completion), std::move(whole),
+                     block_index_++};
+    partial_ = std::move(next_partial);
+    block_ = std::move(next_block);
+    return out;
+  }
+
+ private:
+  Iterator<std::shared_ptr<Buffer>> buffer_iterator_;
+  std::unique_ptr<Chunker> chunker_;
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+  int64_t block_index_ = 0;
+};
+
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool,
+                                          const ParseOptions& parse_options,
+                                          const ChunkedBlock& block) {
+  const auto& partial = block.partial;
+  const auto& completion = block.completion;
+  const auto& whole = block.whole;
+
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+Status MakeBuilder(const std::shared_ptr<TaskGroup>& task_group, MemoryPool* pool,
+                   const ParseOptions& parse_options,
+                   std::shared_ptr<ChunkedArrayBuilder>* out) {
+  auto type = parse_options.explicit_schema
+                  ? struct_(parse_options.explicit_schema->fields())
+                  : struct_({});
+
+  auto promotion_graph =
+      parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+          ? GetPromotionGraph()
+          : nullptr;
+
+  return MakeChunkedArrayBuilder(task_group, pool, promotion_graph, type, out);
+}
+
+// Convert a single parsed block to a RecordBatch
+Result<std::shared_ptr<RecordBatch>> ConvertBlock(MemoryPool* pool,
+                                                  const ParseOptions& parse_options,
+                                                  const std::shared_ptr<Array>& parsed) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(TaskGroup::MakeSerial(), pool, parse_options, &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
+
+  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
+  for (int i = 0; i < converted->num_fields(); ++i) {
+    columns[i] = converted->field(i);
+  }
+  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
+                           std::move(columns));
+}
+
+Result<std::shared_ptr<RecordBatch>> DecodeBlock(MemoryPool* pool,
+                                                 const ParseOptions& parse_options,
+                                                 const ChunkedBlock& block) {
+  ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool, parse_options, block));
+  return ConvertBlock(pool, parse_options, parsed);
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -54,56 +199,35 @@ class TableReaderImpl : public TableReader,
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
-        chunker_(MakeChunker(parse_options_)),
         task_group_(std::move(task_group)) {}
 
   Status Init(std::shared_ptr<io::InputStream> input) {
     ARROW_ASSIGN_OR_RAISE(auto it,
                           io::MakeInputStreamIterator(input, read_options_.block_size));
-    return MakeReadaheadIterator(std::move(it), task_group_->parallelism())
-        .Value(&block_iterator_);
+    ARROW_ASSIGN_OR_RAISE(it,
+                          MakeReadaheadIterator(std::move(it), task_group_->parallelism()));
+    block_reader_ = std::make_shared<ChunkedBlockReader>(std::move(it),
+                                                         MakeChunker(parse_options_));
+    return block_reader_->Init();
   }
 
   Result<std::shared_ptr<Table>> Read() override {
-    RETURN_NOT_OK(MakeBuilder());
+    RETURN_NOT_OK(MakeBuilder(task_group_, pool_, parse_options_, &builder_));
 
-    ARROW_ASSIGN_OR_RAISE(auto block, block_iterator_.Next());
-    if (block == nullptr) {
+    if (block_reader_->empty()) {
       return Status::Invalid("Empty JSON file");
     }
 
     auto self = shared_from_this();
-    auto empty = std::make_shared<Buffer>("");
-
-    int64_t block_index = 0;
-    std::shared_ptr<Buffer> partial = empty;
-
-    while (block != nullptr) {
-      std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
-
-      ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
-
-      if (next_block == nullptr) {
-        // End of file reached => compute completion from penultimate block
-        RETURN_NOT_OK(chunker_->ProcessFinal(partial, block, &completion, &whole));
-      } else {
-        std::shared_ptr<Buffer> starts_with_whole;
-        // Get completion of partial from previous block.
-        RETURN_NOT_OK(chunker_->ProcessWithPartial(partial, block, &completion,
-                                                   &starts_with_whole));
-
-        // Get all whole objects entirely inside the current buffer
-        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        break;
       }
-
       // Launch parse task
-      task_group_->Append([self, partial, completion, whole, block_index] {
-        return self->ParseAndInsert(partial, completion, whole, block_index);
+      task_group_->Append([self, maybe_block] {
+        return self->ParseAndInsert(*maybe_block);
       });
-      block_index++;
-
-      partial = next_partial;
-      block = next_block;
     }
 
     std::shared_ptr<ChunkedArray> array;
@@ -112,57 +236,142 @@ class TableReaderImpl : public TableReader,
   }
 
  private:
-  Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
+  Status ParseAndInsert(const ChunkedBlock& block) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, parse_options_, block));
+    builder_->Insert(block.index, field("", parsed->type()), parsed);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::shared_ptr<TaskGroup> task_group_;
+  std::shared_ptr<ChunkedBlockReader> block_reader_;
+  std::shared_ptr<ChunkedArrayBuilder> builder_;
+};
 
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        thread_pool_(thread_pool),
+        max_blocks_in_flight_(thread_pool ? thread_pool->GetCapacity() : 1) {}
 
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+  ~StreamingReaderImpl() override {
+    // Parse tasks may still be running on the thread pool
+    for (const auto& batch : pending_batches_) {
+      batch.Wait();
+    }
   }
 
-  Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
-                        const std::shared_ptr<Buffer>& completion,
-                        const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(it, MakeReadaheadIterator(std::move(it), max_blocks_in_flight_));
+    block_reader_ = std::make_shared<ChunkedBlockReader>(std::move(it),
+                                                         MakeChunker(parse_options_));
+    RETURN_NOT_OK(block_reader_->Init());
+    if (block_reader_->empty()) {
+      return Status::Invalid("Empty JSON file");
+    }
+
+    // Convert the first blocks synchronously to determine the schema.  A block
+    // may hold no complete object (if block_size is smaller than a row), so
+    // skip empty batches until one has rows or the input is exhausted.
+    std::shared_ptr<RecordBatch> first_batch;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(first_batch,
+                            DecodeBlock(pool_, parse_options_, *maybe_block));
+      if (first_batch->num_rows() > 0) {
+        break;
       }
-      RETURN_NOT_OK(parser->Parse(straddling));
+    }
+    schema_ = first_batch->schema();
+    pending_batches_.push_back(
+        Future<std::shared_ptr<RecordBatch>>::MakeFinished(std::move(first_batch)));
+
+    // Further blocks are converted to the same schema
+    parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    do {
+      RETURN_NOT_OK(ReadNext().Value(batch));
+    } while (*batch != nullptr && (*batch)->num_rows() == 0);
+    return Status::OK();
+  }
+
+ private:
+  Result<std::shared_ptr<RecordBatch>> ReadNext() {
+    if (eof_) {
+      return nullptr;
+    }
+    Status st = SubmitBlocks();
+    if (!st.ok()) {
+      eof_ = true;
+      return st;
+    }
+    if (pending_batches_.empty()) {
+      eof_ = true;
+      return nullptr;
     }
 
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
+    auto next = std::move(pending_batches_.front());
+    pending_batches_.pop_front();
+    auto maybe_batch = std::move(next).result();
+    if (!maybe_batch.ok()) {
+      // Conversion error => bail out
+      eof_ = true;
     }
+    return maybe_batch;
+  }
 
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
-    builder_->Insert(block_index, field("", parsed->type()), parsed);
+  // Keep up to max_blocks_in_flight_ blocks being parsed
+  Status SubmitBlocks() {
+    while (!source_eof_ &&
+           static_cast<int>(pending_batches_.size()) < max_blocks_in_flight_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      if (thread_pool_ == nullptr) {
+        pending_batches_.push_back(Future<std::shared_ptr<RecordBatch>>::MakeFinished(
+            DecodeBlock(pool_, parse_options_, *maybe_block)));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(auto fut, thread_pool_->Submit(DecodeBlock, pool_,
+                                                             parse_options_,
+                                                             std::move(*maybe_block)));
+        pending_batches_.push_back(std::move(fut));
+      }
+    }
     return Status::OK();
   }
 
   MemoryPool* pool_;
   ReadOptions read_options_;
   ParseOptions parse_options_;
-  std::unique_ptr<Chunker> chunker_;
-  std::shared_ptr<TaskGroup> task_group_;
-  Iterator<std::shared_ptr<Buffer>> block_iterator_;
-  std::shared_ptr<ChunkedArrayBuilder> builder_;
+  ThreadPool* thread_pool_;
+  const int max_blocks_in_flight_;
+  std::shared_ptr<ChunkedBlockReader> block_reader_;
+  std::shared_ptr<Schema> schema_;
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_batches_;
+  bool source_eof_ = false;
+  bool eof_ = false;
 };
 
 Status TableReader::Read(std::shared_ptr<Table>* out) { return Read().Value(out); }
@@ -189,6 +398,16 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto reader = std::make_shared<StreamingReaderImpl>(
+      pool, read_options, parse_options,
+      read_options.use_threads ? GetCpuThreadPool() : nullptr);
+  RETURN_NOT_OK(reader->Init(std::move(input)));
+  return reader;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -196,29 +415,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
-
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
-                           std::move(columns));
+  return ConvertBlock(default_memory_pool(), options, parsed);
 }
 
 }  // namespace json
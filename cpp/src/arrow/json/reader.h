@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,33 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file incrementally, one RecordBatch at a time
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Each block of ReadOptions::block_size bytes is converted into one RecordBatch,
+/// so memory use is bounded by the block size times the number of blocks in flight.
+///
+/// The schema is determined by the first block: either inferred from its contents
+/// or taken from ParseOptions::explicit_schema.  All subsequent blocks are converted
+/// to that schema.  If unexpected fields are inferred (the default), a field which
+/// does not appear in the first block is an error in later blocks, as is a value
+/// which cannot be converted to the type inferred from the first block.
+///
+/// If ReadOptions::use_threads is true, several blocks are parsed concurrently
+/// on the global CPU thread pool; batches are still returned in file order.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// This reads and converts the first block of the file in order to
+  /// determine the schema.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
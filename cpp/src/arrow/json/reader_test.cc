@@ -284,5 +284,162 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    ASSERT_OK(MakeStream(input, &input_));
+    ASSERT_OK_AND_ASSIGN(reader_, StreamingReader::Make(default_memory_pool(), input_,
+                                                        read_options_, parse_options_));
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> ReadAllBatches() {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ARROW_EXPECT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+    return batches;
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_OK(MakeStream("", &input_));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input_,
+                                               read_options_, parse_options_));
+}
+
+TEST_P(StreamingReaderTest, Basics) {
+  SetUpReader(scalars_only_src());
+
+  auto expected_schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+
+  auto batches = ReadAllBatches();
+  ASSERT_EQ(batches.size(), 1);
+  auto expected_batch = RecordBatchFromJSON(expected_schema, R"([
+      {"hello": 3.5, "world": false, "yo": "thing"},
+      {"hello": 3.25, "world": null, "yo": null},
+      {"hello": 3.125, "world": null, "yo": "\u5fcd"},
+      {"hello": 0.0, "world": true, "yo": null}
+    ])");
+  AssertBatchesEqual(*expected_batch, *batches[0]);
+
+  // Further reads return end of stream
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, MultipleBlocks) {
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+  SetUpReader(src);
+
+  auto expected_schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+
+  // Empty batches (such as from the trailing "  " block) are skipped
+  auto batches = ReadAllBatches();
+  ASSERT_EQ(batches.size(), 3);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(expected_schema,
+                           R"([{"hello": 3.5, "world": false, "yo": "thing"}])"),
+      *batches[0]);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(expected_schema,
+                           R"([{"hello": 3.25, "world": null, "yo": null}])"),
+      *batches[1]);
+  AssertBatchesEqual(*RecordBatchFromJSON(expected_schema, R"([
+      {"hello": 3.125, "world": null, "yo": "\u5fcd"},
+      {"hello": 0.0, "world": true, "yo": null}
+    ])"),
+                     *batches[2]);
+}
+
+TEST_P(StreamingReaderTest, ManyBlocksInOrder) {
+  int64_t count = 1 << 10;
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  read_options_.block_size = static_cast<int>(count / 2);
+  SetUpReader(json);
+
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+  int expected = 0;
+  for (const auto& batch : ReadAllBatches()) {
+    const auto& column = checked_cast<const Int64Array&>(*batch->column(0));
+    for (int64_t i = 0; i < column.length(); ++i) {
+      ASSERT_EQ(column.GetView(i), expected) << " at index " << i;
+      ++expected;
+    }
+  }
+  ASSERT_EQ(expected, count);
+}
+
+TEST_P(StreamingReaderTest, ExplicitSchema) {
+  parse_options_.explicit_schema = schema({field("hello", float32())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  SetUpReader(scalars_only_src());
+
+  auto expected_schema = schema({field("hello", float32())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+  auto batches = ReadAllBatches();
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(expected_schema,
+                           R"([{"hello": 3.5}, {"hello": 3.25}, {"hello": 3.125},
+                               {"hello": 0.0}])"),
+      *batches[0]);
+}
+
+TEST_P(StreamingReaderTest, FieldNotInFirstBlock) {
+  std::string first = "{\"a\": 1}\n";
+  std::string second = "{\"a\": 2, \"b\": true}\n";
+  read_options_.block_size = static_cast<int>(first.length());
+  SetUpReader(first + second);
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+
+  // The reader is exhausted after an error
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, BlockSmallerThanRow) {
+  std::string row = "{\"a\": 1, \"b\": \"xyz\"}\n";
+  // The first block holds no complete row
+  read_options_.block_size = static_cast<int>(row.length() - 1);
+  SetUpReader(row + row + row);
+
+  auto expected_schema = schema({field("a", int64()), field("b", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader_->schema());
+  int64_t num_rows = 0;
+  for (const auto& batch : ReadAllBatches()) {
+    AssertSchemaEqual(*expected_schema, *batch->schema());
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(num_rows, 3);
+}
+
 }  // namespace json
 }  // namespace arrow
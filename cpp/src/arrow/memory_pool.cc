@@ -18,13 +18,20 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <condition_variable>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 
 #ifdef ARROW_JEMALLOC
@@ -38,6 +45,12 @@
 #include <mimalloc.h>
 #endif
 
+#ifdef __linux__
+#define ARROW_HAVE_MREMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #ifdef ARROW_JEMALLOC
 
 // Compile-time configuration for jemalloc options.
@@ -92,6 +105,135 @@ namespace {
 // an aligned non-null pointer.
 alignas(kAlignment) static uint8_t zero_size_area[1];
 
+#ifdef ARROW_HAVE_MREMAP
+
+// Allocations above this size can be backed by anonymous memory mappings
+// (whatever the configured threshold), so that smaller ones can be freed
+// without looking up the registry of mappings.
+constexpr int64_t kMinMmapThreshold = 1 << 20;
+
+std::atomic<int64_t> mmap_threshold(64 << 20);
+std::atomic<bool> mmap_huge_pages(false);
+
+// Large allocations backed by anonymous memory mappings, which can be grown
+// with mremap() instead of copying their contents.
+class MmapAllocator {
+ public:
+  static bool UseFor(int64_t size) {
+    const int64_t threshold = mmap_threshold.load();
+    return threshold >= 0 && size >= threshold;
+  }
+
+  static Status Allocate(int64_t size, uint8_t** out) {
+    const int64_t length = MappingLength(size);
+    void* data = mmap(nullptr, static_cast<size_t>(length), PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", size, " failed");
+    }
+    AdviseHugePages(data, length);
+    *out = reinterpret_cast<uint8_t*>(data);
+    Instance()->Register(*out, length);
+    return Status::OK();
+  }
+
+  // Return true and set `out` if the allocation was found and resized
+  // in place or moved by the kernel
+  static bool Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr,
+                         Status* out) {
+    // If shrinking below the minimum threshold, let the regular allocator
+    // take over (it will free the mapping)
+    if (old_size < kMinMmapThreshold || new_size < kMinMmapThreshold) {
+      return false;
+    }
+    auto self = Instance();
+    int64_t old_length;
+    if (!self->Lookup(*ptr, &old_length)) {
+      return false;
+    }
+    const int64_t new_length = MappingLength(new_size);
+    void* data = mremap(*ptr, static_cast<size_t>(old_length),
+                        static_cast<size_t>(new_length), MREMAP_MAYMOVE);
+    if (data == MAP_FAILED) {
+      *out = Status::OutOfMemory("mremap of size ", new_size, " failed");
+      return true;
+    }
+    AdviseHugePages(data, new_length);
+    self->Unregister(*ptr);
+    *ptr = reinterpret_cast<uint8_t*>(data);
+    self->Register(*ptr, new_length);
+    *out = Status::OK();
+    return true;
+  }
+
+  // Return true if the allocation was found and freed
+  static bool Free(uint8_t* ptr, int64_t size) {
+    if (size < kMinMmapThreshold) {
+      return false;
+    }
+    int64_t length;
+    if (!Instance()->Unregister(ptr, &length)) {
+      return false;
+    }
+    munmap(ptr, static_cast<size_t>(length));
+    return true;
+  }
+
+ private:
+  static int64_t MappingLength(int64_t size) {
+    static const int64_t page_size = sysconf(_SC_PAGESIZE);
+    return (size + page_size - 1) / page_size * page_size;
+  }
+
+  static void AdviseHugePages(void* data, int64_t length) {
+#ifdef MADV_HUGEPAGE
+    if (mmap_huge_pages.load()) {
+      // Purely advisory, ignore failures (e.g. if THP is disabled)
+      madvise(data, static_cast<size_t>(length), MADV_HUGEPAGE);
+    }
+#endif
+  }
+
+  static MmapAllocator* Instance() {
+    // Leaked on purpose: buffers may be freed during static destruction
+    static auto instance = new MmapAllocator;
+    return instance;
+  }
+
+  void Register(uint8_t* ptr, int64_t length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mappings_.emplace(ptr, length);
+  }
+
+  bool Lookup(uint8_t* ptr, int64_t* length) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = mappings_.find(ptr);
+    if (it == mappings_.end()) {
+      return false;
+    }
+    *length = it->second;
+    return true;
+  }
+
+  bool Unregister(uint8_t* ptr, int64_t* length = nullptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = mappings_.find(ptr);
+    if (it == mappings_.end()) {
+      return false;
+    }
+    if (length != nullptr) {
+      *length = it->second;
+    }
+    mappings_.erase(it);
+    return true;
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<uint8_t*, int64_t> mappings_;
+};
+
+#endif  // ARROW_HAVE_MREMAP
+
 // Helper class directing allocations to the standard system allocator.
 class SystemAllocator {
  public:
@@ -102,6 +244,11 @@ class SystemAllocator {
       *out = zero_size_area;
       return Status::OK();
     }
+#ifdef ARROW_HAVE_MREMAP
+    if (MmapAllocator::UseFor(size)) {
+      return MmapAllocator::Allocate(size, out);
+    }
+#endif
 #ifdef _WIN32
     // Special code path for Windows
     *out = reinterpret_cast<uint8_t*>(
@@ -134,6 +281,12 @@ class SystemAllocator {
       *ptr = zero_size_area;
       return Status::OK();
     }
+#ifdef ARROW_HAVE_MREMAP
+    Status st;
+    if (MmapAllocator::Reallocate(old_size, new_size, ptr, &st)) {
+      return st;
+    }
+#endif
     // Note: We cannot use realloc() here as it doesn't guarantee alignment.
 
     // Allocate new chunk
@@ -142,11 +295,7 @@ class SystemAllocator {
     DCHECK(out);
     // Copy contents and release old memory chunk
     memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
-#ifdef _WIN32
-    _aligned_free(*ptr);
-#else
-    free(*ptr);
-#endif  // defined(_WIN32)
+    DeallocateAligned(*ptr, old_size);
     *ptr = out;
     return Status::OK();
   }
@@ -154,6 +303,10 @@ class SystemAllocator {
   static void DeallocateAligned(uint8_t* ptr, int64_t size) {
     if (ptr == zero_size_area) {
       DCHECK_EQ(size, 0);
+#ifdef ARROW_HAVE_MREMAP
+    } else if (MmapAllocator::Free(ptr, size)) {
+      return;
+#endif
     } else {
 #ifdef _WIN32
       _aligned_free(ptr);
@@ -442,6 +595,28 @@ Status jemalloc_set_decay_ms(int ms) {
 #endif
 }
 
+Status system_memory_pool_set_mmap_threshold(int64_t threshold) {
+#ifdef ARROW_HAVE_MREMAP
+  if (threshold >= 0 && threshold < kMinMmapThreshold) {
+    return Status::Invalid("mmap threshold should be at least ", kMinMmapThreshold,
+                           " bytes, got ", threshold);
+  }
+  mmap_threshold = threshold;
+  return Status::OK();
+#else
+  return Status::NotImplemented("mremap is not available on this platform");
+#endif
+}
+
+Status system_memory_pool_set_huge_pages(bool enabled) {
+#if defined(ARROW_HAVE_MREMAP) && defined(MADV_HUGEPAGE)
+  mmap_huge_pages = enabled;
+  return Status::OK();
+#else
+  return Status::NotImplemented("transparent huge pages are not available");
+#endif
+}
+
 ///////////////////////////////////////////////////////////////////////
 // LoggingMemoryPool implementation
 
@@ -538,4 +713,551 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+// Sizes beyond this would overflow once rounded up to the alignment
+static constexpr int64_t kMaxArenaSize =
+    std::numeric_limits<int64_t>::max() - static_cast<int64_t>(kAlignment) + 1;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* parent, int64_t slab_size, bool huge_fallback)
+      : parent_(parent),
+        slab_size_(BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(slab_size, 64))),
+        huge_threshold_(slab_size_ / 4),
+        huge_fallback_(huge_fallback) {}
+
+  ~ArenaMemoryPoolImpl() {
+    Rewind();
+    for (const auto& slab : slabs_) {
+      parent_->Free(slab.data, slab.size);
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size > kMaxArenaSize) {
+      return Status::OutOfMemory("malloc of size ", size, " failed");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateUnlocked(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (new_size > kMaxArenaSize) {
+      return Status::OutOfMemory("realloc of size ", new_size, " failed");
+    }
+    if (*ptr == zero_size_area) {
+      DCHECK_EQ(old_size, 0);
+      return Allocate(new_size, ptr);
+    }
+    if (new_size == 0) {
+      Free(*ptr, old_size);
+      *ptr = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = huge_allocations_.find(*ptr);
+    if (it != huge_allocations_.end()) {
+      // Huge allocations stay with the parent pool until freed
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+      huge_allocations_.erase(it);
+      huge_allocations_.emplace(*ptr, new_size);
+      huge_bytes_ += new_size - old_size;
+    } else if (IsTail(*ptr, old_size) &&
+               *ptr + BitUtil::RoundUpToMultipleOf64(new_size) <= SlabEnd()) {
+      // Grow or shrink in place
+      slabs_.back().used = *ptr + BitUtil::RoundUpToMultipleOf64(new_size) -
+                           slabs_.back().data;
+    } else if (new_size > old_size) {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+      memcpy(out, *ptr, static_cast<size_t>(old_size));
+      FreeUnlocked(*ptr, old_size);
+      *ptr = out;
+    }
+    // (shrinking an allocation that is not at the tail leaves it as is)
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      DCHECK_EQ(size, 0);
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    FreeUnlocked(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+    if (stats_.bytes_allocated() == 0) {
+      Rewind();
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t total = huge_bytes_;
+    for (const auto& slab : slabs_) {
+      total += slab.size;
+    }
+    for (const auto& slab : dedicated_slabs_) {
+      total += slab.size;
+    }
+    return total;
+  }
+
+ private:
+  struct Slab {
+    uint8_t* data;
+    int64_t size;
+    int64_t used;
+  };
+
+  uint8_t* SlabEnd() const { return slabs_.back().data + slabs_.back().size; }
+
+  // Whether the allocation is the last one carved from the current slab
+  bool IsTail(const uint8_t* ptr, int64_t size) const {
+    if (slabs_.empty()) {
+      return false;
+    }
+    const Slab& slab = slabs_.back();
+    return ptr >= slab.data &&
+           ptr + BitUtil::RoundUpToMultipleOf64(size) == slab.data + slab.used;
+  }
+
+  Status AllocateUnlocked(int64_t size, uint8_t** out) {
+    const int64_t aligned_size = BitUtil::RoundUpToMultipleOf64(size);
+    if (aligned_size > huge_threshold_) {
+      if (huge_fallback_) {
+        RETURN_NOT_OK(parent_->Allocate(size, out));
+        huge_allocations_.emplace(*out, size);
+        huge_bytes_ += size;
+      } else {
+        RETURN_NOT_OK(parent_->Allocate(aligned_size, out));
+        dedicated_slabs_.push_back({*out, aligned_size, aligned_size});
+      }
+      return Status::OK();
+    }
+    if (slabs_.empty() || slabs_.back().used + aligned_size > slabs_.back().size) {
+      uint8_t* data;
+      RETURN_NOT_OK(parent_->Allocate(slab_size_, &data));
+      slabs_.push_back({data, slab_size_, 0});
+    }
+    Slab& slab = slabs_.back();
+    *out = slab.data + slab.used;
+    slab.used += aligned_size;
+    return Status::OK();
+  }
+
+  void FreeUnlocked(uint8_t* buffer, int64_t size) {
+    if (!huge_allocations_.empty()) {
+      auto it = huge_allocations_.find(buffer);
+      if (it != huge_allocations_.end()) {
+        DCHECK_EQ(it->second, size);
+        parent_->Free(buffer, it->second);
+        huge_bytes_ -= it->second;
+        huge_allocations_.erase(it);
+        return;
+      }
+    }
+    if (IsTail(buffer, size)) {
+      slabs_.back().used = buffer - slabs_.back().data;
+    }
+  }
+
+  // Reclaim all memory, keeping the first slab around for reuse
+  void Rewind() {
+    for (const auto& pair : huge_allocations_) {
+      parent_->Free(pair.first, pair.second);
+    }
+    huge_allocations_.clear();
+    huge_bytes_ = 0;
+    for (const auto& slab : dedicated_slabs_) {
+      parent_->Free(slab.data, slab.size);
+    }
+    dedicated_slabs_.clear();
+    if (!slabs_.empty()) {
+      for (size_t i = 1; i < slabs_.size(); ++i) {
+        parent_->Free(slabs_[i].data, slabs_[i].size);
+      }
+      slabs_.resize(1);
+      slabs_[0].used = 0;
+    }
+  }
+
+  MemoryPool* parent_;
+  const int64_t slab_size_;
+  const int64_t huge_threshold_;
+  const bool huge_fallback_;
+
+  mutable std::mutex mutex_;
+  std::vector<Slab> slabs_;
+  std::vector<Slab> dedicated_slabs_;
+  std::unordered_map<uint8_t*, int64_t> huge_allocations_;
+  int64_t huge_bytes_ = 0;
+  internal::MemoryPoolStats stats_;
+};
+
+constexpr int64_t ArenaMemoryPool::kDefaultSlabSize;
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t slab_size,
+                                 bool huge_fallback) {
+  impl_.reset(new ArenaMemoryPoolImpl(parent, slab_size, huge_fallback));
+}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+std::string ArenaMemoryPool::backend_name() const { return "arena"; }
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+class LimitedMemoryPool::LimitedMemoryPoolImpl {
+ public:
+  LimitedMemoryPoolImpl(MemoryPool* pool, LimitedMemoryPoolImpl* parent, int64_t limit,
+                        std::string name)
+      : pool_(pool), parent_(parent), limit_(limit), name_(std::move(name)) {
+    if (parent_ != nullptr) {
+      std::lock_guard<std::mutex> lock(parent_->mutex_);
+      parent_->children_.push_back(this);
+    }
+  }
+
+  ~LimitedMemoryPoolImpl() {
+    DCHECK(children_.empty()) << "LimitedMemoryPool destroyed before its children";
+    Uncharge(reserved_);
+    if (parent_ != nullptr) {
+      std::lock_guard<std::mutex> lock(parent_->mutex_);
+      auto& siblings = parent_->children_;
+      siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    int64_t from_reservation;
+    RETURN_NOT_OK(ChargeAllocation(size, &from_reservation));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      UnchargeAllocation(size, from_reservation);
+      return st;
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      int64_t from_reservation;
+      RETURN_NOT_OK(ChargeAllocation(diff, &from_reservation));
+      Status st = pool_->Reallocate(old_size, new_size, ptr);
+      if (!st.ok()) {
+        UnchargeAllocation(diff, from_reservation);
+        return st;
+      }
+    } else {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+      Uncharge(-diff);
+    }
+    stats_.UpdateAllocatedBytes(diff);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    Uncharge(size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  Status Reserve(int64_t bytes) {
+    if (bytes < 0) {
+      return Status::Invalid("negative reservation size");
+    }
+    RETURN_NOT_OK(Charge(bytes));
+    std::lock_guard<std::mutex> lock(mutex_);
+    reserved_ += bytes;
+    return Status::OK();
+  }
+
+  void Unreserve(int64_t bytes) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes = std::min(bytes, reserved_);
+      reserved_ -= bytes;
+    }
+    Uncharge(bytes);
+  }
+
+  int RegisterSpillCallback(SpillCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int id = next_callback_id_++;
+    callbacks_.emplace_back(id, std::move(callback));
+    return id;
+  }
+
+  void UnregisterSpillCallback(int id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
+      if (it->first == id) {
+        callbacks_.erase(it);
+        return;
+      }
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reserved_;
+  }
+
+  int64_t bytes_used() const { return used_.load(); }
+
+  int64_t limit() const { return limit_; }
+
+  const std::string& name() const { return name_; }
+
+  std::string backend_name() const { return pool_->backend_name(); }
+
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  // Charge an allocation, consuming the reservation first
+  Status ChargeAllocation(int64_t bytes, int64_t* from_reservation) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      *from_reservation = std::min(bytes, reserved_);
+      reserved_ -= *from_reservation;
+    }
+    Status st = Charge(bytes - *from_reservation);
+    if (!st.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reserved_ += *from_reservation;
+    }
+    return st;
+  }
+
+  // Undo ChargeAllocation after the underlying pool failed to allocate,
+  // giving the consumed part back to the reservation
+  void UnchargeAllocation(int64_t bytes, int64_t from_reservation) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reserved_ += from_reservation;
+    }
+    Uncharge(bytes - from_reservation);
+  }
+
+  // Charge bytes to this budget and all its ancestors
+  Status Charge(int64_t bytes) {
+    if (bytes == 0) {
+      return Status::OK();
+    }
+    if (!TryCharge(bytes) && !SpillAndCharge(bytes)) {
+      return Status::OutOfMemory("Memory limit of ", limit_, " bytes exceeded",
+                                 name_.empty() ? "" : " in pool '", name_,
+                                 name_.empty() ? "" : "'", ": requested ", bytes,
+                                 " bytes with ", used_.load(), " bytes in use");
+    }
+    if (parent_ != nullptr) {
+      Status st = parent_->Charge(bytes);
+      if (!st.ok()) {
+        used_ -= bytes;
+        return st;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Ask for memory to be spilled and retry the charge.  Only one spill runs at
+  // a time: other threads wait for it to finish and retry before spilling in
+  // turn.
+  bool SpillAndCharge(int64_t bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (spilling_) {
+      if (spilling_thread_ == std::this_thread::get_id()) {
+        // The callbacks should not allocate, but don't recurse endlessly if
+        // they do
+        return false;
+      }
+      spill_done_.wait(lock);
+      if (TryCharge(bytes)) {
+        return true;
+      }
+    }
+    spilling_ = true;
+    spilling_thread_ = std::this_thread::get_id();
+    lock.unlock();
+
+    Spill(used_.load() + bytes - limit_);
+    const bool charged = TryCharge(bytes);
+
+    lock.lock();
+    spilling_ = false;
+    lock.unlock();
+    spill_done_.notify_all();
+    return charged;
+  }
+
+  bool TryCharge(int64_t bytes) {
+    int64_t used = used_.load();
+    do {
+      if (used + bytes > limit_) {
+        return false;
+      }
+    } while (!used_.compare_exchange_weak(used, used + bytes));
+    return true;
+  }
+
+  void Uncharge(int64_t bytes) {
+    for (auto impl = this; impl != nullptr; impl = impl->parent_) {
+      impl->used_ -= bytes;
+    }
+  }
+
+  // Invoke the spill callbacks of this pool and its descendants until at least
+  // `bytes_needed` bytes have been freed.  Returns the number of bytes freed.
+  int64_t Spill(int64_t bytes_needed) {
+    std::vector<SpillCallback> callbacks;
+    std::vector<LimitedMemoryPoolImpl*> children;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& pair : callbacks_) {
+        callbacks.push_back(pair.second);
+      }
+      children = children_;
+    }
+    // Callbacks are called without holding the lock, since they will
+    // typically free memory from this pool.
+    int64_t freed = 0;
+    for (const auto& callback : callbacks) {
+      if (freed >= bytes_needed) {
+        return freed;
+      }
+      freed += callback(bytes_needed - freed);
+    }
+    for (auto child : children) {
+      if (freed >= bytes_needed) {
+        return freed;
+      }
+      freed += child->Spill(bytes_needed - freed);
+    }
+    return freed;
+  }
+
+  MemoryPool* pool_;
+  LimitedMemoryPoolImpl* parent_;
+  const int64_t limit_;
+  const std::string name_;
+
+  std::atomic<int64_t> used_{0};
+  internal::MemoryPoolStats stats_;
+
+  // Protects the members below
+  mutable std::mutex mutex_;
+  int64_t reserved_ = 0;
+  bool spilling_ = false;
+  std::thread::id spilling_thread_;
+  std::condition_variable spill_done_;
+  int next_callback_id_ = 0;
+  std::vector<std::pair<int, SpillCallback>> callbacks_;
+  std::vector<LimitedMemoryPoolImpl*> children_;
+};
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* pool, int64_t limit, std::string name)
+    : impl_(new LimitedMemoryPoolImpl(pool, nullptr, limit, std::move(name))) {}
+
+LimitedMemoryPool::LimitedMemoryPool(std::unique_ptr<LimitedMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+LimitedMemoryPool::~LimitedMemoryPool() {}
+
+std::unique_ptr<LimitedMemoryPool> LimitedMemoryPool::MakeChild(int64_t limit,
+                                                                std::string name) {
+  std::unique_ptr<LimitedMemoryPoolImpl> impl(
+      new LimitedMemoryPoolImpl(impl_->pool(), impl_.get(), limit, std::move(name)));
+  return std::unique_ptr<LimitedMemoryPool>(new LimitedMemoryPool(std::move(impl)));
+}
+
+Status LimitedMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+Status LimitedMemoryPool::Reserve(int64_t bytes) { return impl_->Reserve(bytes); }
+
+void LimitedMemoryPool::Unreserve(int64_t bytes) { impl_->Unreserve(bytes); }
+
+int LimitedMemoryPool::RegisterSpillCallback(SpillCallback callback) {
+  return impl_->RegisterSpillCallback(std::move(callback));
+}
+
+void LimitedMemoryPool::UnregisterSpillCallback(int id) {
+  impl_->UnregisterSpillCallback(id);
+}
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t LimitedMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+int64_t LimitedMemoryPool::bytes_used() const { return impl_->bytes_used(); }
+
+int64_t LimitedMemoryPool::limit() const { return impl_->limit(); }
+
+const std::string& LimitedMemoryPool::name() const { return impl_->name(); }
+
+std::string LimitedMemoryPool::backend_name() const { return impl_->backend_name(); }
+
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -149,9 +150,151 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief Memory pool carving allocations out of large slabs
+///
+/// Allocations are bump-allocated, 64-byte aligned, from slabs obtained from a
+/// parent pool, which avoids a round-trip to the underlying allocator for each
+/// buffer.  This suits short-lived, query-scoped allocations such as the
+/// per-batch builders of a filter/project pipeline.
+///
+/// Freeing the most recent allocation of the current slab gives its memory back
+/// immediately, and reallocating it grows or shrinks it in place if the slab
+/// has room.  Other freed memory is only reclaimed in bulk: when no allocation
+/// is outstanding anymore or when the pool is destroyed.  The arena then
+/// rewinds to its first slab and releases the others to the parent pool.
+///
+/// Allocations larger than a quarter of the slab size are "huge": if
+/// `huge_fallback` is true they are served and freed individually by the parent
+/// pool, otherwise they get a dedicated slab reclaimed in bulk as above.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultSlabSize = 1 << 20;
+
+  explicit ArenaMemoryPool(MemoryPool* parent = default_memory_pool(),
+                           int64_t slab_size = kDefaultSlabSize,
+                           bool huge_fallback = true);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes currently obtained from the parent pool, including
+  /// slab space not handed out yet.
+  int64_t bytes_reserved() const;
+
+  std::string backend_name() const override;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief Memory pool enforcing a memory budget
+///
+/// Allocations are delegated to another pool, but fail with OutOfMemory once
+/// the bytes allocated and reserved through this pool would exceed its limit.
+///
+/// Pools can be nested with MakeChild() to form a hierarchy of budgets (for
+/// example process, query and operator levels): the memory used by a child
+/// is charged to all its ancestors, so an allocation must fit in every budget
+/// along the chain.
+///
+/// Before failing, a pool invokes the spill callbacks registered on itself and
+/// on its descendants, so that e.g. a sort or a hash table may release memory
+/// by spilling to disk.  Spill callbacks may run on any thread allocating
+/// from the hierarchy.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  /// \brief A callback asked to free at least `bytes_needed` bytes
+  ///
+  /// It should return the number of bytes actually freed.
+  using SpillCallback = std::function<int64_t(int64_t bytes_needed)>;
+
+  /// Create a root pool allocating from `pool` within `limit` bytes.
+  LimitedMemoryPool(MemoryPool* pool, int64_t limit, std::string name = "");
+  ~LimitedMemoryPool() override;
+
+  /// \brief Create a pool whose budget is nested in this one's
+  ///
+  /// The child allocates from the same underlying pool.  It must be destroyed
+  /// before its parent.
+  std::unique_ptr<LimitedMemoryPool> MakeChild(int64_t limit, std::string name = "");
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// \brief Reserve memory ahead of large allocations
+  ///
+  /// The reserved bytes are charged to the budget immediately, and consumed
+  /// by subsequent allocations from this pool.  This allows e.g. an operator to
+  /// check that its working set fits before starting to build it.
+  Status Reserve(int64_t bytes);
+
+  /// \brief Give back reserved bytes not consumed by allocations
+  void Unreserve(int64_t bytes);
+
+  /// \brief Register a callback invoked when memory is needed
+  ///
+  /// Returns an id for UnregisterSpillCallback().  The callback must not
+  /// allocate from this pool's hierarchy.
+  int RegisterSpillCallback(SpillCallback callback);
+  void UnregisterSpillCallback(int id);
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes reserved and not yet consumed by allocations
+  int64_t bytes_reserved() const;
+
+  /// The number of bytes charged to this budget, including reservations and
+  /// the memory used by descendant pools
+  int64_t bytes_used() const;
+
+  int64_t limit() const;
+
+  const std::string& name() const;
+
+  std::string backend_name() const override;
+
+ private:
+  class LimitedMemoryPoolImpl;
+  explicit LimitedMemoryPool(std::unique_ptr<LimitedMemoryPoolImpl> impl);
+
+  std::unique_ptr<LimitedMemoryPoolImpl> impl_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
+/// \brief Set the size above which the system allocator backs allocations with
+/// anonymous memory mappings.
+///
+/// Such allocations are grown and shrunk with mremap(), which avoids copying
+/// their contents, e.g. when a builder doubles its capacity.  The threshold
+/// should be at least 1 MiB; a negative value disables memory mappings.
+/// The default is 64 MiB.
+///
+/// Returns NotImplemented on platforms without mremap().
+ARROW_EXPORT
+Status system_memory_pool_set_mmap_threshold(int64_t threshold);
+
+/// \brief Enable or disable transparent huge pages for the memory mappings
+/// of the system allocator (see system_memory_pool_set_mmap_threshold).
+///
+/// This is disabled by default.  Returns NotImplemented on platforms without
+/// support for madvise(MADV_HUGEPAGE).
+ARROW_EXPORT
+Status system_memory_pool_set_huge_pages(bool enabled);
+
 /// Return a process-wide memory pool based on jemalloc.
 ///
 /// May return NotImplemented if jemalloc is not available.
@@ -47,6 +47,13 @@ struct Mimalloc {
 };
 #endif
 
+struct Arena {
+  static Result<MemoryPool*> GetAllocator() {
+    static ArenaMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -105,6 +112,52 @@ static void AllocateTouchDeallocate(
   }
 }
 
+// Benchmark allocating a batch of small buffers, then freeing them all.
+// This mimics the short-lived buffers of per-batch builders in a pipeline.
+template <typename Alloc>
+static void AllocateDeallocateBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t nbytes = state.range(0);
+  constexpr int kBatchSize = 64;
+  MemoryPool* pool = *Alloc::GetAllocator();
+
+  for (auto _ : state) {
+    uint8_t* data[kBatchSize];
+    for (int i = 0; i < kBatchSize; ++i) {
+      ARROW_CHECK_OK(pool->Allocate(nbytes, &data[i]));
+    }
+    for (int i = 0; i < kBatchSize; ++i) {
+      pool->Free(data[i], nbytes);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+// Benchmark growing an allocation by doubling, as builders do, with the
+// system allocator backing large allocations with memory mappings or not.
+static void ReallocateDoubling(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t max_size = state.range(0);
+  const bool use_mmap = state.range(1) != 0;
+  MemoryPool* pool = system_memory_pool();
+  ARROW_CHECK_OK(system_memory_pool_set_mmap_threshold(use_mmap ? 1 << 20 : -1));
+
+  for (auto _ : state) {
+    int64_t size = 1 << 20;
+    uint8_t* data;
+    ARROW_CHECK_OK(pool->Allocate(size, &data));
+    TouchCacheLines(data, size);
+    for (; size < max_size; size *= 2) {
+      ARROW_CHECK_OK(pool->Reallocate(size, size * 2, &data));
+      // Touch the new half, as a builder appending to it would
+      TouchCacheLines(data + size, size);
+    }
+    pool->Free(data, size);
+  }
+  state.SetBytesProcessed(state.iterations() * max_size);
+
+  ARROW_CHECK_OK(system_memory_pool_set_mmap_threshold(64 << 20));
+}
+
 #define BENCHMARK_ALLOCATE_ARGS \
   ->RangeMultiplier(16)->Range(4096, 16 * 1024 * 1024)->ArgName("size")->UseRealTime()
 
@@ -115,6 +168,24 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
+#ifdef __linux__
+BENCHMARK(ReallocateDoubling)
+    ->Args({16 << 20, 0})
+    ->Args({16 << 20, 1})
+    ->Args({256 << 20, 0})
+    ->Args({256 << 20, 1})
+    ->ArgNames({"size", "mmap"})
+    ->UseRealTime();
+#endif
+
+BENCHMARK_ALLOCATE(AllocateDeallocate, Arena);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Arena);
+
+#define BENCHMARK_ALLOCATE_BATCH_ARGS \
+  ->RangeMultiplier(4)->Range(64, 16 * 1024)->ArgName("size")->UseRealTime()
+
+BENCHMARK_TEMPLATE(AllocateDeallocateBatch, SystemAlloc) BENCHMARK_ALLOCATE_BATCH_ARGS;
+BENCHMARK_TEMPLATE(AllocateDeallocateBatch, Arena) BENCHMARK_ALLOCATE_BATCH_ARGS;
 
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
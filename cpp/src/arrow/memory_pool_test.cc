@@ -15,8 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
 #include "arrow/memory_pool.h"
@@ -54,6 +60,21 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct ArenaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static ArenaMemoryPool pool;
+    return &pool;
+  }
+};
+
+struct LimitedMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    static LimitedMemoryPool pool(default_memory_pool(),
+                                  std::numeric_limits<int64_t>::max());
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +97,8 @@ REGISTER_TYPED_TEST_SUITE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_SUITE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Arena, TestMemoryPool, ArenaMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_SUITE_P(Limited, TestMemoryPool, LimitedMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_SUITE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -145,6 +168,462 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(ArenaMemoryPool, BumpAllocation) {
+  ProxyMemoryPool parent(default_memory_pool());
+  {
+    ArenaMemoryPool arena(&parent, /*slab_size=*/4096);
+    ASSERT_EQ("arena", arena.backend_name());
+
+    uint8_t *data1, *data2, *data3;
+    ASSERT_OK(arena.Allocate(100, &data1));
+    ASSERT_OK(arena.Allocate(1, &data2));
+    ASSERT_OK(arena.Allocate(64, &data3));
+    // Allocations are contiguous in the slab, each padded to 64 bytes
+    ASSERT_EQ(data1 + 128, data2);
+    ASSERT_EQ(data2 + 64, data3);
+    ASSERT_EQ(165, arena.bytes_allocated());
+    ASSERT_EQ(4096, arena.bytes_reserved());
+    ASSERT_EQ(4096, parent.bytes_allocated());
+
+    // Freeing the tail allocation makes its memory available again
+    arena.Free(data3, 64);
+    uint8_t* data4;
+    ASSERT_OK(arena.Allocate(10, &data4));
+    ASSERT_EQ(data3, data4);
+
+    // Freeing other allocations does not
+    arena.Free(data1, 100);
+    uint8_t* data5;
+    ASSERT_OK(arena.Allocate(10, &data5));
+    ASSERT_EQ(data4 + 64, data5);
+    arena.Free(data2, 1);
+    arena.Free(data4, 10);
+    arena.Free(data5, 10);
+    ASSERT_EQ(0, arena.bytes_allocated());
+    ASSERT_EQ(165, arena.max_memory());
+  }
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, ReallocateInPlace) {
+  ArenaMemoryPool arena(default_memory_pool(), /*slab_size=*/4096);
+
+  uint8_t *data1, *data2;
+  ASSERT_OK(arena.Allocate(10, &data1));
+  ASSERT_OK(arena.Allocate(10, &data2));
+  data2[0] = 42;
+  uint8_t* orig_data2 = data2;
+
+  // The tail allocation grows and shrinks in place
+  ASSERT_OK(arena.Reallocate(10, 500, &data2));
+  ASSERT_EQ(orig_data2, data2);
+  ASSERT_OK(arena.Reallocate(500, 20, &data2));
+  ASSERT_EQ(orig_data2, data2);
+  uint8_t* data3;
+  ASSERT_OK(arena.Allocate(10, &data3));
+  ASSERT_EQ(data2 + 64, data3);
+
+  // Other allocations are moved when growing
+  data1[9] = 43;
+  ASSERT_OK(arena.Reallocate(10, 100, &data1));
+  ASSERT_EQ(data3 + 64, data1);
+  ASSERT_EQ(43, data1[9]);
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(130, arena.bytes_allocated());
+
+  // Running out of room in the slab moves the allocation to a new slab
+  uint8_t* orig_data1 = data1;
+  ASSERT_OK(arena.Reallocate(100, 1000, &data1));
+  ASSERT_EQ(orig_data1, data1);
+  ASSERT_EQ(4096, arena.bytes_reserved());
+  uint8_t* data4;
+  ASSERT_OK(arena.Allocate(1000, &data4));
+  ASSERT_OK(arena.Allocate(1000, &data4));
+  ASSERT_OK(arena.Allocate(700, &data4));
+  ASSERT_EQ(4096, arena.bytes_reserved());
+  ASSERT_OK(arena.Reallocate(700, 1000, &data4));
+  ASSERT_EQ(8192, arena.bytes_reserved());
+  ASSERT_EQ(43, data1[9]);
+}
+
+TEST(ArenaMemoryPool, RewindWhenEmpty) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool arena(&parent, /*slab_size=*/4096);
+
+  std::vector<uint8_t*> buffers(20);
+  for (auto& data : buffers) {
+    ASSERT_OK(arena.Allocate(1000, &data));
+  }
+  ASSERT_EQ(20 * 1000, arena.bytes_allocated());
+  ASSERT_EQ(5 * 4096, parent.bytes_allocated());
+  const uint8_t* first = buffers[0];
+
+  // Release in allocation order, the slabs are only reclaimed at the end
+  for (auto data : buffers) {
+    ASSERT_EQ(5 * 4096, parent.bytes_allocated());
+    arena.Free(data, 1000);
+  }
+  ASSERT_EQ(0, arena.bytes_allocated());
+  // The first slab is kept around for reuse
+  ASSERT_EQ(4096, parent.bytes_allocated());
+  uint8_t* data;
+  ASSERT_OK(arena.Allocate(1000, &data));
+  ASSERT_EQ(first, data);
+  arena.Free(data, 1000);
+}
+
+TEST(ArenaMemoryPool, HugeAllocations) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool arena(&parent, /*slab_size=*/4096);
+
+  uint8_t *small, *huge;
+  ASSERT_OK(arena.Allocate(100, &small));
+  ASSERT_OK(arena.Allocate(5000, &huge));
+  ASSERT_EQ(4096 + 5000, parent.bytes_allocated());
+  ASSERT_EQ(4096 + 5000, arena.bytes_reserved());
+
+  // Huge allocations are reallocated and freed by the parent pool
+  huge[4999] = 42;
+  ASSERT_OK(arena.Reallocate(5000, 10000, &huge));
+  ASSERT_EQ(42, huge[4999]);
+  ASSERT_EQ(4096 + 10000, parent.bytes_allocated());
+  ASSERT_OK(arena.Reallocate(10000, 100, &huge));
+  ASSERT_EQ(4096 + 100, parent.bytes_allocated());
+  arena.Free(huge, 100);
+  ASSERT_EQ(4096, parent.bytes_allocated());
+
+  // Growing a small allocation past the threshold moves it to the parent pool
+  // (unless it can grow in place)
+  uint8_t* other;
+  ASSERT_OK(arena.Allocate(100, &other));
+  small[99] = 43;
+  ASSERT_OK(arena.Reallocate(100, 2000, &small));
+  ASSERT_EQ(43, small[99]);
+  ASSERT_EQ(4096 + 2000, parent.bytes_allocated());
+  arena.Free(small, 2000);
+  ASSERT_EQ(4096, parent.bytes_allocated());
+  arena.Free(other, 100);
+}
+
+TEST(ArenaMemoryPool, DedicatedSlabs) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool arena(&parent, /*slab_size=*/4096, /*huge_fallback=*/false);
+
+  uint8_t *small, *huge1, *huge2;
+  ASSERT_OK(arena.Allocate(100, &small));
+  ASSERT_OK(arena.Allocate(5000, &huge1));
+  ASSERT_OK(arena.Allocate(1500, &huge2));
+  ASSERT_EQ(4096 + 5056 + 1536, parent.bytes_allocated());
+
+  // Dedicated slabs are reclaimed in bulk
+  arena.Free(huge1, 5000);
+  ASSERT_EQ(4096 + 5056 + 1536, parent.bytes_allocated());
+  arena.Free(huge2, 1500);
+  arena.Free(small, 100);
+  ASSERT_EQ(4096, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, DestroyWithOutstandingAllocations) {
+  ProxyMemoryPool parent(default_memory_pool());
+  {
+    ArenaMemoryPool arena(&parent, /*slab_size=*/4096);
+
+    uint8_t* data;
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(arena.Allocate(1000, &data));
+    }
+    ASSERT_OK(arena.Allocate(100000, &data));
+    ASSERT_EQ(10 * 1000 + 100000, arena.bytes_allocated());
+    ASSERT_EQ(3 * 4096 + 100000, parent.bytes_allocated());
+  }
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Limit) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000, "process");
+  ASSERT_EQ(1000, pool.limit());
+  ASSERT_EQ("process", pool.name());
+  ASSERT_EQ(default_memory_pool()->backend_name(), pool.backend_name());
+
+  uint8_t *data1, *data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_OK(pool.Allocate(400, &data2));
+  ASSERT_EQ(1000, pool.bytes_used());
+  uint8_t* data3;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      OutOfMemory, ::testing::HasSubstr("Memory limit of 1000 bytes exceeded in pool "
+                                        "'process'"),
+      pool.Allocate(1, &data3));
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(400, 401, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+
+  pool.Free(data1, 600);
+  ASSERT_OK(pool.Reallocate(400, 1000, &data2));
+  ASSERT_OK(pool.Reallocate(1000, 10, &data2));
+  ASSERT_EQ(10, pool.bytes_used());
+  pool.Free(data2, 10);
+  ASSERT_EQ(0, pool.bytes_used());
+  ASSERT_EQ(1000, pool.max_memory());
+}
+
+TEST(LimitedMemoryPool, Reservation) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000);
+
+  ASSERT_OK(pool.Reserve(800));
+  ASSERT_EQ(800, pool.bytes_reserved());
+  ASSERT_EQ(800, pool.bytes_used());
+  ASSERT_RAISES(OutOfMemory, pool.Reserve(201));
+
+  // Allocations consume the reservation first
+  uint8_t *data1, *data2;
+  ASSERT_OK(pool.Allocate(500, &data1));
+  ASSERT_EQ(300, pool.bytes_reserved());
+  ASSERT_EQ(800, pool.bytes_used());
+  ASSERT_OK(pool.Allocate(400, &data2));
+  ASSERT_EQ(0, pool.bytes_reserved());
+  ASSERT_EQ(900, pool.bytes_used());
+
+  ASSERT_OK(pool.Reserve(100));
+  pool.Unreserve(1000);
+  ASSERT_EQ(0, pool.bytes_reserved());
+  ASSERT_EQ(900, pool.bytes_used());
+
+  pool.Free(data1, 500);
+  pool.Free(data2, 400);
+  ASSERT_EQ(0, pool.bytes_used());
+}
+
+TEST(LimitedMemoryPool, Hierarchy) {
+  LimitedMemoryPool process(default_memory_pool(), 1000, "process");
+  auto query1 = process.MakeChild(800, "query1");
+  auto query2 = process.MakeChild(800, "query2");
+  auto op = query1->MakeChild(500, "sort");
+
+  uint8_t *data1, *data2;
+  ASSERT_OK(op->Allocate(400, &data1));
+  ASSERT_EQ(400, op->bytes_used());
+  ASSERT_EQ(400, query1->bytes_used());
+  ASSERT_EQ(400, process.bytes_used());
+  ASSERT_EQ(0, query1->bytes_allocated());
+
+  // The operator budget is exceeded
+  EXPECT_RAISES_WITH_MESSAGE_THAT(OutOfMemory, ::testing::HasSubstr("'sort'"),
+                                  op->Reserve(101));
+  // The process budget is exceeded
+  ASSERT_OK(query2->Reserve(550));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(OutOfMemory, ::testing::HasSubstr("'process'"),
+                                  op->Allocate(100, &data2));
+  // A failed charge leaves all levels unchanged
+  ASSERT_EQ(400, op->bytes_used());
+  ASSERT_EQ(400, query1->bytes_used());
+  ASSERT_EQ(950, process.bytes_used());
+
+  // The query's reservation is released when it is destroyed
+  query2.reset();
+  ASSERT_EQ(400, process.bytes_used());
+  ASSERT_OK(op->Allocate(100, &data2));
+  ASSERT_EQ(500, process.bytes_used());
+
+  op->Free(data1, 400);
+  op->Free(data2, 100);
+  ASSERT_EQ(0, query1->bytes_used());
+  ASSERT_EQ(0, process.bytes_used());
+}
+
+TEST(LimitedMemoryPool, SpillCallbacks) {
+  LimitedMemoryPool query(default_memory_pool(), 1000, "query");
+  auto sort = query.MakeChild(1000, "sort");
+  auto join = query.MakeChild(2000, "join");
+
+  // The sort keeps its data in spillable buffers
+  std::vector<std::pair<uint8_t*, int64_t>> sort_buffers;
+  int sort_spills = 0;
+  const int id = sort->RegisterSpillCallback([&](int64_t bytes_needed) {
+    ++sort_spills;
+    int64_t freed = 0;
+    while (freed < bytes_needed && !sort_buffers.empty()) {
+      sort->Free(sort_buffers.back().first, sort_buffers.back().second);
+      freed += sort_buffers.back().second;
+      sort_buffers.pop_back();
+    }
+    return freed;
+  });
+  for (int i = 0; i < 8; ++i) {
+    uint8_t* data;
+    ASSERT_OK(sort->Allocate(100, &data));
+    sort_buffers.emplace_back(data, 100);
+  }
+  ASSERT_EQ(800, query.bytes_used());
+
+  // The join needs more memory than available: the sort spills just enough
+  uint8_t* data;
+  ASSERT_OK(join->Allocate(450, &data));
+  ASSERT_EQ(1, sort_spills);
+  ASSERT_EQ(5U, sort_buffers.size());
+  ASSERT_EQ(950, query.bytes_used());
+
+  // Not enough memory can be freed
+  ASSERT_RAISES(OutOfMemory, join->Reserve(600));
+  ASSERT_EQ(2, sort_spills);
+  ASSERT_EQ(0U, sort_buffers.size());
+  ASSERT_EQ(450, query.bytes_used());
+
+  sort->UnregisterSpillCallback(id);
+  ASSERT_OK(sort->Reserve(550));
+  ASSERT_RAISES(OutOfMemory, join->Reserve(1));
+  ASSERT_EQ(2, sort_spills);
+
+  join->Free(data, 450);
+}
+
+TEST(LimitedMemoryPool, ConcurrentSpill) {
+  LimitedMemoryPool pool(default_memory_pool(), 1000);
+  uint8_t* spillable;
+  ASSERT_OK(pool.Allocate(800, &spillable));
+
+  std::atomic<bool> spill_started{false};
+  pool.RegisterSpillCallback([&](int64_t) -> int64_t {
+    if (spillable == nullptr) {
+      return 0;
+    }
+    spill_started = true;
+    // Let the main thread find the spill running
+    SleepFor(0.1);
+    pool.Free(spillable, 800);
+    spillable = nullptr;
+    return 800;
+  });
+
+  uint8_t *data1, *data2;
+  std::thread thread([&] { ASSERT_OK(pool.Allocate(500, &data1)); });
+  while (!spill_started) {
+    std::this_thread::yield();
+  }
+  // The allocation waits for the running spill instead of failing
+  Status st = pool.Allocate(300, &data2);
+  thread.join();
+  ASSERT_OK(st);
+  ASSERT_EQ(800, pool.bytes_used());
+
+  pool.Free(data1, 500);
+  pool.Free(data2, 300);
+  ASSERT_EQ(0, pool.bytes_used());
+}
+
+TEST(LimitedMemoryPool, FailedAllocation) {
+  // The underlying pool has a smaller limit than the budget
+  LimitedMemoryPool backend(default_memory_pool(), 100);
+  LimitedMemoryPool pool(&backend, 1000);
+
+  // A failed allocation leaves the reservation untouched
+  ASSERT_OK(pool.Reserve(50));
+  uint8_t* data;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(200, &data));
+  ASSERT_EQ(50, pool.bytes_reserved());
+  ASSERT_EQ(50, pool.bytes_used());
+
+  ASSERT_OK(pool.Allocate(80, &data));
+  ASSERT_EQ(0, pool.bytes_reserved());
+  ASSERT_EQ(80, pool.bytes_used());
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(80, 200, &data));
+  ASSERT_EQ(80, pool.bytes_used());
+
+  pool.Free(data, 80);
+  ASSERT_EQ(0, pool.bytes_used());
+  ASSERT_EQ(0, backend.bytes_used());
+}
+
+#ifdef __linux__
+
+class TestSystemMemoryPoolMmap : public ::testing::Test {
+ public:
+  void SetUp() override { ASSERT_OK(system_memory_pool_set_mmap_threshold(1 << 20)); }
+
+  void TearDown() override {
+    ASSERT_OK(system_memory_pool_set_mmap_threshold(64 << 20));
+    ASSERT_OK(system_memory_pool_set_huge_pages(false));
+  }
+
+  void Fill(uint8_t* data, int64_t size) {
+    for (int64_t i = 0; i < size; i += 4096) {
+      data[i] = static_cast<uint8_t>(i / 4096);
+    }
+  }
+
+  void Check(const uint8_t* data, int64_t size) {
+    for (int64_t i = 0; i < size; i += 4096) {
+      ASSERT_EQ(static_cast<uint8_t>(i / 4096), data[i]) << "at offset " << i;
+    }
+  }
+
+  void TestReallocate() {
+    MemoryPool* pool = system_memory_pool();
+    const int64_t orig_bytes = pool->bytes_allocated();
+
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(2 << 20, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+    Fill(data, 2 << 20);
+    // Grow by doubling, like builders do
+    for (int64_t size = 2 << 20; size < (64 << 20); size *= 2) {
+      ASSERT_OK(pool->Reallocate(size, size * 2, &data));
+      ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+      Check(data, 2 << 20);
+      data[size * 2 - 1] = 42;
+    }
+    ASSERT_EQ(orig_bytes + (64 << 20), pool->bytes_allocated());
+    // Shrink, staying above the threshold
+    ASSERT_OK(pool->Reallocate(64 << 20, (1 << 20) + 10, &data));
+    Check(data, 1 << 20);
+    // Shrink below the threshold, moving to the regular allocator
+    ASSERT_OK(pool->Reallocate((1 << 20) + 10, 1000, &data));
+    Check(data, 1000);
+    // Grow above the threshold again
+    ASSERT_OK(pool->Reallocate(1000, 3 << 20, &data));
+    Check(data, 1000);
+    pool->Free(data, 3 << 20);
+    ASSERT_EQ(orig_bytes, pool->bytes_allocated());
+  }
+};
+
+TEST_F(TestSystemMemoryPoolMmap, Reallocate) { TestReallocate(); }
+
+TEST_F(TestSystemMemoryPoolMmap, HugePages) {
+  ASSERT_OK(system_memory_pool_set_huge_pages(true));
+  TestReallocate();
+}
+
+TEST_F(TestSystemMemoryPoolMmap, MixedThresholds) {
+  MemoryPool* pool = system_memory_pool();
+  uint8_t *mapped, *not_mapped;
+  ASSERT_OK(pool->Allocate(2 << 20, &mapped));
+  ASSERT_OK(system_memory_pool_set_mmap_threshold(-1));
+  ASSERT_OK(pool->Allocate(2 << 20, &not_mapped));
+  Fill(mapped, 2 << 20);
+  Fill(not_mapped, 2 << 20);
+
+  // Allocations keep their backing when the threshold changes
+  ASSERT_OK(pool->Reallocate(2 << 20, 4 << 20, &mapped));
+  ASSERT_OK(pool->Reallocate(2 << 20, 4 << 20, &not_mapped));
+  Check(mapped, 2 << 20);
+  Check(not_mapped, 2 << 20);
+  pool->Free(mapped, 4 << 20);
+  pool->Free(not_mapped, 4 << 20);
+}
+
+TEST_F(TestSystemMemoryPoolMmap, InvalidThreshold) {
+  ASSERT_RAISES(Invalid, system_memory_pool_set_mmap_threshold(0));
+  ASSERT_RAISES(Invalid, system_memory_pool_set_mmap_threshold(4096));
+}
+
+#else
+
+TEST(SystemMemoryPool, MmapNotImplemented) {
+  ASSERT_RAISES(NotImplemented, system_memory_pool_set_mmap_threshold(1 << 20));
+}
+
+#endif  // __linux__
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
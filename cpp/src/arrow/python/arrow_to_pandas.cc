@@ -1569,6 +1569,16 @@ class ExtensionWriter : public PandasWriter {
     return TransferSingle(data, nullptr);
   }
 
+  // The chunks are always passed through as is, whether or not zero-copy blocks
+  // are allowed
+  Status Write(std::shared_ptr<ChunkedArray> data, int64_t abs_placement,
+               int64_t rel_placement) override {
+    RETURN_NOT_OK(EnsurePlacementAllocated());
+    RETURN_NOT_OK(TransferSingle(std::move(data), /*py_ref=*/nullptr));
+    placement_data_[rel_placement] = abs_placement;
+    return Status::OK();
+  }
+
   Status GetDataFrameResult(PyObject** out) override {
     PyAcquireGIL lock;
     PyObject* result = PyDict_New();
@@ -1665,6 +1675,15 @@ static Status GetPandasWriterType(const ChunkedArray& data, const PandasOptions&
           : PandasWriter::NAME;                                                        \
   break;
 
+  if (options.arrow_extension_arrays) {
+    const Type::type type_id = data.type()->id();
+    if (is_base_binary_like(type_id) || (is_integer(type_id) && data.null_count() > 0)) {
+      // Zero-copy: the chunks are handed over as is, see ExtensionWriter
+      *output_type = PandasWriter::EXTENSION;
+      return Status::OK();
+    }
+  }
+
   switch (data.type()->id()) {
     case Type::BOOL:
       *output_type = data.null_count() > 0 ? PandasWriter::OBJECT : PandasWriter::BOOL;
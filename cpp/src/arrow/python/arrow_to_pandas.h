@@ -89,6 +89,13 @@ struct PandasOptions {
   /// conversions
   bool self_destruct = false;
 
+  /// \brief If true, pass string and binary columns, as well as integer
+  /// columns with nulls, through as Arrow chunked arrays (see
+  /// PandasWriter::EXTENSION) instead of converting them to NumPy arrays. The
+  /// caller can then wrap them in pandas extension arrays backed by the Arrow
+  /// buffers, without creating Python objects or concatenating the chunks.
+  bool arrow_extension_arrays = false;
+
   // Columns that should be casted to categorical
   std::unordered_set<std::string> categorical_columns;
 
@@ -41,6 +41,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
@@ -61,6 +62,7 @@ namespace arrow {
 using internal::checked_cast;
 using internal::CopyBitmap;
 using internal::GenerateBitsUnrolled;
+using internal::OptionalParallelFor;
 
 namespace py {
 
@@ -232,6 +234,9 @@ class NumPyConverter {
   Status Visit(const DataType& type) { return TypeNotImplemented(type.ToString()); }
 
  protected:
+  // Fast path for object arrays of strings, see definition
+  Status ConvertObjectStrings(bool* converted);
+
   Status InitNullBitmap() {
     RETURN_NOT_OK(AllocateNullBitmap(pool_, length_, &null_bitmap_));
     null_bitmap_data_ = null_bitmap_->mutable_data();
@@ -310,6 +315,13 @@ Status NumPyConverter::Convert() {
   }
 
   if (dtype_->type_num == NPY_OBJECT) {
+    if (type_ == nullptr || type_->id() == Type::STRING) {
+      bool converted;
+      RETURN_NOT_OK(ConvertObjectStrings(&converted));
+      if (converted) {
+        return Status::OK();
+      }
+    }
     // If an object array, convert it like a normal Python sequence
     PyConversionOptions py_options;
     py_options.type = type_;
@@ -716,6 +728,122 @@ Status NumPyConverter::Visit(const StringType& type) {
   return Status::OK();
 }
 
+namespace {
+
+// Length of the chunks in which object arrays of strings are converted
+constexpr int64_t kObjectChunkLength = 1 << 16;
+
+// Strong references to Python objects, released with the GIL held
+class ObjectReferences {
+ public:
+  ~ObjectReferences() {
+    if (!objects_.empty()) {
+      PyAcquireGIL lock;
+      Clear();
+    }
+  }
+
+  void Add(PyObject* obj) {
+    Py_INCREF(obj);
+    objects_.push_back(obj);
+  }
+
+  // The GIL must be held
+  void Clear() {
+    for (PyObject* obj : objects_) {
+      Py_DECREF(obj);
+    }
+    objects_.clear();
+  }
+
+ private:
+  std::vector<PyObject*> objects_;
+};
+
+}  // namespace
+
+// Convert an object array of str (and nulls) chunk by chunk: the GIL is only
+// held to extract pointers to the UTF8 data of each chunk's values, which are
+// then copied without it.  *converted is false if the array holds other
+// values, in which case the generic sequence conversion should be used.
+Status NumPyConverter::ConvertObjectStrings(bool* converted) {
+  *converted = false;
+
+  struct StringValue {
+    // null for null values
+    const char* data;
+    Py_ssize_t size;
+  };
+
+  ::arrow::internal::ChunkedStringBuilder builder(kBinaryChunksize, pool_);
+  std::vector<StringValue> values;
+  ObjectReferences references;
+  bool seen_string = false;
+
+  const auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
+  const uint8_t* mask_data = nullptr;
+  int64_t mask_stride = 0;
+  if (mask_ != nullptr) {
+    mask_data = reinterpret_cast<const uint8_t*>(PyArray_DATA(mask_));
+    mask_stride = static_cast<int64_t>(PyArray_STRIDES(mask_)[0]);
+  }
+
+  for (int64_t offset = 0; offset < length_; offset += kObjectChunkLength) {
+    const int64_t chunk_end = std::min(length_, offset + kObjectChunkLength);
+    values.clear();
+    {
+      PyAcquireGIL lock;
+      references.Clear();
+      for (int64_t i = offset; i < chunk_end; ++i) {
+        if (mask_data != nullptr && mask_data[i * mask_stride]) {
+          values.push_back({nullptr, 0});
+          continue;
+        }
+        PyObject* obj = *reinterpret_cast<PyObject* const*>(data + i * stride_);
+        if (PyUnicode_Check(obj)) {
+          Py_ssize_t size;
+          const char* utf8 = PyUnicode_AsUTF8AndSize(obj, &size);
+          if (utf8 == nullptr || size > std::numeric_limits<int32_t>::max()) {
+            // Let the generic conversion report the error
+            PyErr_Clear();
+            return Status::OK();
+          }
+          // Keep the value alive (and its UTF8 data valid) until copied
+          references.Add(obj);
+          values.push_back({utf8, size});
+          seen_string = true;
+        } else if (from_pandas_ ? internal::PandasObjectIsNull(obj) : obj == Py_None) {
+          values.push_back({nullptr, 0});
+        } else {
+          return Status::OK();
+        }
+      }
+    }
+
+    for (const auto& value : values) {
+      if (value.data == nullptr) {
+        RETURN_NOT_OK(builder.AppendNull());
+      } else {
+        RETURN_NOT_OK(builder.Append(reinterpret_cast<const uint8_t*>(value.data),
+                                     static_cast<int32_t>(value.size)));
+      }
+    }
+  }
+
+  if (type_ == nullptr && !seen_string) {
+    // Let type inference decide the type of all-null arrays
+    return Status::OK();
+  }
+
+  ArrayVector result;
+  RETURN_NOT_OK(builder.Finish(&result));
+  for (auto arr : result) {
+    RETURN_NOT_OK(PushArray(arr->data()));
+  }
+  *converted = true;
+  return Status::OK();
+}
+
 Status NumPyConverter::Visit(const StructType& type) {
   std::vector<NumPyConverter> sub_converters;
   std::vector<OwnedRefNoGIL> sub_arrays;
@@ -849,5 +977,54 @@ Status NdarrayToArrow(MemoryPool* pool, PyObject* ao, PyObject* mo, bool from_pa
   return NdarrayToArrow(pool, ao, mo, from_pandas, type, compute::CastOptions(), out);
 }
 
+Status NdarraysToTable(MemoryPool* pool, const std::vector<PyObject*>& arrays,
+                       const std::vector<PyObject*>& masks,
+                       const std::vector<std::string>& names,
+                       const std::vector<std::shared_ptr<DataType>>& types,
+                       bool from_pandas, const compute::CastOptions& cast_options,
+                       bool use_threads, std::shared_ptr<Table>* out) {
+  const int num_columns = static_cast<int>(arrays.size());
+  if (names.size() != arrays.size() || types.size() != arrays.size() ||
+      (!masks.empty() && masks.size() != arrays.size())) {
+    return Status::Invalid("Expected as many column names, types and masks as arrays");
+  }
+  {
+    PyAcquireGIL lock;
+    for (PyObject* ao : arrays) {
+      if (!PyArray_Check(ao)) {
+        return Status::TypeError("Input object was not a NumPy array");
+      }
+      if (PyArray_NDIM(reinterpret_cast<PyArrayObject*>(ao)) != 1) {
+        return Status::Invalid("only handle 1-dimensional arrays");
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_columns);
+  auto ConvertColumn = [&](int i) {
+    PyObject* ao = arrays[i];
+    std::shared_ptr<DataType> type = types[i];
+    PyArray_Descr* dtype = PyArray_DESCR(reinterpret_cast<PyArrayObject*>(ao));
+    if (type == nullptr && dtype->type_num != NPY_OBJECT) {
+      PyAcquireGIL lock;
+      RETURN_NOT_OK(NumPyDtypeToArrow(reinterpret_cast<PyObject*>(dtype), &type));
+    }
+    NumPyConverter converter(pool, ao, masks.empty() ? nullptr : masks[i], type,
+                             from_pandas, cast_options);
+    RETURN_NOT_OK(converter.Convert());
+    DCHECK_GT(converter.result().size(), 0);
+    columns[i] = std::make_shared<ChunkedArray>(converter.result());
+    return Status::OK();
+  };
+  RETURN_NOT_OK(OptionalParallelFor(use_threads, num_columns, ConvertColumn));
+
+  std::vector<std::shared_ptr<Field>> fields(num_columns);
+  for (int i = 0; i < num_columns; ++i) {
+    fields[i] = field(names[i], columns[i]->type());
+  }
+  *out = Table::Make(schema(std::move(fields)), std::move(columns));
+  return Status::OK();
+}
+
 }  // namespace py
 }  // namespace arrow
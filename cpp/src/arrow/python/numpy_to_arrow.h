@@ -22,6 +22,8 @@
 #include "arrow/python/platform.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/compute/api.h"
 #include "arrow/python/visibility.h"
@@ -33,6 +35,7 @@ class ChunkedArray;
 class DataType;
 class MemoryPool;
 class Status;
+class Table;
 
 namespace py {
 
@@ -68,5 +71,32 @@ Status NdarrayToArrow(MemoryPool* pool, PyObject* ao, PyObject* mo, bool from_pa
                       const std::shared_ptr<DataType>& type,
                       std::shared_ptr<ChunkedArray>* out);
 
+/// Convert several NumPy arrays, e.g. the columns of a pandas.DataFrame, to a
+/// Table, converting the arrays in parallel.
+///
+/// This must be called without holding the GIL: it is only acquired by the
+/// conversions that need it, e.g. of object arrays.  Object arrays of strings
+/// are converted in chunks, only holding the GIL while extracting the string
+/// data of each chunk.
+///
+/// \param[in] pool Memory pool for any memory allocations
+/// \param[in] arrays 1-dimensional ndarrays with the column data
+/// \param[in] masks ndarrays with null masks (True is null), one per column (or
+/// nullptr), or empty
+/// \param[in] names the column names
+/// \param[in] types the column types, null ones are inferred
+/// \param[in] from_pandas If true, use pandas's null sentinels to determine
+/// whether values are null
+/// \param[in] cast_options casting options
+/// \param[in] use_threads If true, convert the columns in parallel
+/// \param[out] out the resulting Table
+ARROW_PYTHON_EXPORT
+Status NdarraysToTable(MemoryPool* pool, const std::vector<PyObject*>& arrays,
+                       const std::vector<PyObject*>& masks,
+                       const std::vector<std::string>& names,
+                       const std::vector<std::shared_ptr<DataType>>& types,
+                       bool from_pandas, const compute::CastOptions& cast_options,
+                       bool use_threads, std::shared_ptr<Table>* out);
+
 }  // namespace py
 }  // namespace arrow
@@ -32,6 +32,8 @@
 #include "arrow/python/arrow_to_pandas.h"
 #include "arrow/python/decimal.h"
 #include "arrow/python/helpers.h"
+#include "arrow/python/numpy_interop.h"
+#include "arrow/python/numpy_to_arrow.h"
 #include "arrow/python/python_to_arrow.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -308,6 +310,108 @@ TEST(PandasConversionTest, TestObjectBlockWriteFails) {
   ASSERT_RAISES(UnknownError, st);
 }
 
+class NdarraysToTableTest : public ::testing::Test {
+ public:
+  // Make an object array of strings, with every 7th value null
+  OwnedRef MakeStringArray(int64_t length) {
+    OwnedRef arr(PyArray_SimpleNew(1, &length, NPY_OBJECT));
+    auto data = reinterpret_cast<PyObject**>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(arr.obj())));
+    for (int64_t i = 0; i < length; ++i) {
+      if (i % 7 == 0) {
+        Py_INCREF(Py_None);
+        data[i] = Py_None;
+      } else {
+        data[i] = PyUnicode_FromString(std::to_string(i).c_str());
+      }
+    }
+    return arr;
+  }
+
+  OwnedRef MakeInt64Array(int64_t length) {
+    OwnedRef arr(PyArray_SimpleNew(1, &length, NPY_INT64));
+    auto data = reinterpret_cast<int64_t*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(arr.obj())));
+    for (int64_t i = 0; i < length; ++i) {
+      data[i] = i;
+    }
+    return arr;
+  }
+
+  Status Convert(const std::vector<PyObject*>& arrays,
+                 const std::vector<std::shared_ptr<DataType>>& types, bool use_threads,
+                 std::shared_ptr<Table>* out) {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      names.push_back("f" + std::to_string(i));
+    }
+    Status st;
+    Py_BEGIN_ALLOW_THREADS;
+    st = NdarraysToTable(default_memory_pool(), arrays, {}, names, types,
+                         /*from_pandas=*/true, compute::CastOptions(), use_threads, out);
+    Py_END_ALLOW_THREADS;
+    return st;
+  }
+
+  void CheckStringColumn(const ChunkedArray& column, int64_t length) {
+    ASSERT_EQ(length, column.length());
+    ASSERT_TRUE(column.type()->Equals(utf8()));
+    int64_t i = 0;
+    for (const auto& chunk : column.chunks()) {
+      const auto& strings = checked_cast<const StringArray&>(*chunk);
+      for (int64_t j = 0; j < strings.length(); ++j, ++i) {
+        if (i % 7 == 0) {
+          ASSERT_TRUE(strings.IsNull(j));
+        } else {
+          ASSERT_EQ(std::to_string(i), strings.GetString(j));
+        }
+      }
+    }
+  }
+};
+
+TEST_F(NdarraysToTableTest, ConvertColumns) {
+  // Larger than a conversion chunk for object arrays
+  const int64_t length = 100000;
+  auto strings = MakeStringArray(length);
+  auto ints = MakeInt64Array(length);
+  auto more_strings = MakeStringArray(length);
+
+  for (bool use_threads : {false, true}) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(Convert({strings.obj(), ints.obj(), more_strings.obj()},
+                      {nullptr, nullptr, utf8()}, use_threads, &table));
+    ASSERT_OK(table->ValidateFull());
+    ASSERT_EQ(3, table->num_columns());
+    ASSERT_EQ("f1", table->field(1)->name());
+    CheckStringColumn(*table->column(0), length);
+    CheckStringColumn(*table->column(2), length);
+    ASSERT_TRUE(table->column(1)->type()->Equals(int64()));
+    ASSERT_EQ(length - 1, checked_cast<const Int64Array&>(*table->column(1)->chunk(0))
+                              .Value(length - 1));
+  }
+}
+
+TEST_F(NdarraysToTableTest, FallbackConversion) {
+  // Non-string objects are converted by the generic conversion
+  auto mixed = MakeStringArray(100);
+  auto data = reinterpret_cast<PyObject**>(
+      PyArray_DATA(reinterpret_cast<PyArrayObject*>(mixed.obj())));
+  Py_DECREF(data[50]);
+  data[50] = PyLong_FromLong(50);
+
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(TypeError, Convert({mixed.obj()}, {nullptr}, true, &table));
+
+  // The type of all-null arrays is inferred as usual
+  auto nulls = MakeStringArray(1);
+  ASSERT_OK(Convert({nulls.obj()}, {nullptr}, true, &table));
+  ASSERT_TRUE(table->column(0)->type()->Equals(null()));
+  ASSERT_OK(Convert({nulls.obj()}, {utf8()}, true, &table));
+  ASSERT_TRUE(table->column(0)->type()->Equals(utf8()));
+  ASSERT_EQ(1, table->column(0)->null_count());
+}
+
 TEST(BuiltinConversionTest, TestMixedTypeFails) {
   OwnedRef list_ref(PyList_New(3));
   PyObject* list = list_ref.obj();
@@ -29,6 +29,7 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/iterator.h"
@@ -184,6 +185,15 @@ Result<std::shared_ptr<Array>> RecordBatch::ToStructArray() const {
                                        /*offset=*/0);
 }
 
+Result<std::shared_ptr<Tensor>> RecordBatch::ToTensor(bool null_to_nan, bool row_major,
+                                                      bool use_threads,
+                                                      MemoryPool* pool) const {
+  std::shared_ptr<Tensor> tensor;
+  RETURN_NOT_OK(internal::RecordBatchToTensor(*this, null_to_nan, row_major, use_threads,
+                                              pool, &tensor));
+  return tensor;
+}
+
 std::vector<std::shared_ptr<Array>> RecordBatch::columns() const {
   std::vector<std::shared_ptr<Array>> children(num_columns());
   for (int i = 0; i < num_columns(); ++i) {
@@ -75,6 +75,28 @@ class ARROW_EXPORT RecordBatch {
   static Result<std::shared_ptr<RecordBatch>> FromStructArray(
       const std::shared_ptr<Array>& array);
 
+  /// \brief Convert record batch to a two-dimensional Tensor
+  ///
+  /// The tensor has one row per record and one column per field.  All columns
+  /// must be integers, floats or doubles; they are converted to a common type:
+  /// the type of the columns if they all have the same, double if any is
+  /// floating point, otherwise the smallest integer type able to represent
+  /// them (int64 for uint64 mixed with signed integers, which may overflow).
+  ///
+  /// A batch with a single column without nulls is converted without copying.
+  /// Otherwise the columns are copied in a single pass, in parallel for large
+  /// batches if `use_threads` is true (but inline from a CPU thread pool task).
+  ///
+  /// \param[in] null_to_nan if true, nulls are converted to NaN, and integer
+  /// columns with nulls to double; otherwise nulls are an error
+  /// \param[in] row_major if true, the tensor is row-major, otherwise
+  /// column-major
+  /// \param[in] use_threads whether to copy the columns in parallel
+  /// \param[in] pool the memory pool used for the tensor data
+  Result<std::shared_ptr<Tensor>> ToTensor(
+      bool null_to_nan = false, bool row_major = true, bool use_threads = true,
+      MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Determine if two record batches are exactly equal
   ///
   /// \param[in] other the RecordBatch to compare with
@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -29,10 +31,13 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -249,4 +254,150 @@ TEST_F(TestRecordBatch, FromStructArrayInvalidNullCount) {
   ASSERT_RAISES(Invalid, RecordBatch::FromStructArray(struct_array));
 }
 
+TEST_F(TestRecordBatch, ToTensor) {
+  auto schema = ::arrow::schema(
+      {field("a", int32()), field("b", int32()), field("c", int32())});
+  auto batch = RecordBatch::Make(schema, 2,
+                                 {ArrayFromJSON(int32(), "[1, 4]"),
+                                  ArrayFromJSON(int32(), "[2, 5]"),
+                                  ArrayFromJSON(int32(), "[3, 6]")});
+
+  ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+  ASSERT_EQ(int32(), tensor->type());
+  ASSERT_EQ(std::vector<int64_t>({2, 3}), tensor->shape());
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_EQ(1, tensor->Value<Int32Type>({0, 0}));
+  ASSERT_EQ(3, tensor->Value<Int32Type>({0, 2}));
+  ASSERT_EQ(4, tensor->Value<Int32Type>({1, 0}));
+  ASSERT_EQ(6, tensor->Value<Int32Type>({1, 2}));
+
+  ASSERT_OK_AND_ASSIGN(auto column_major, batch->ToTensor(false, /*row_major=*/false));
+  ASSERT_TRUE(column_major->is_column_major());
+  ASSERT_TRUE(tensor->Equals(*column_major));
+
+  // Sliced batch
+  ASSERT_OK_AND_ASSIGN(tensor, batch->Slice(1)->ToTensor());
+  ASSERT_EQ(std::vector<int64_t>({1, 3}), tensor->shape());
+  ASSERT_EQ(5, tensor->Value<Int32Type>({0, 1}));
+}
+
+TEST_F(TestRecordBatch, ToTensorSingleColumnZeroCopy) {
+  auto array = ArrayFromJSON(float64(), "[1, 2, 3, 4]");
+  auto batch = RecordBatch::Make(::arrow::schema({field("a", float64())}), 3,
+                                 {array->Slice(1)});
+
+  for (bool row_major : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(false, row_major));
+    ASSERT_EQ(std::vector<int64_t>({3, 1}), tensor->shape());
+    ASSERT_EQ(array->data()->buffers[1]->data() + sizeof(double), tensor->raw_data());
+    ASSERT_EQ(2, tensor->Value<DoubleType>({0, 0}));
+    ASSERT_EQ(4, tensor->Value<DoubleType>({2, 0}));
+  }
+}
+
+TEST_F(TestRecordBatch, ToTensorUnifyTypes) {
+  auto check = [](const std::vector<std::shared_ptr<DataType>>& types,
+                  const std::shared_ptr<DataType>& expected) {
+    FieldVector fields;
+    ArrayVector columns;
+    for (const auto& type : types) {
+      fields.push_back(field("f" + std::to_string(fields.size()), type));
+      columns.push_back(ArrayFromJSON(type, "[1, 2]"));
+    }
+    auto batch = RecordBatch::Make(::arrow::schema(fields), 2, columns);
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+    AssertTypeEqual(*expected, *tensor->type());
+
+    std::string expected_json = "[";
+    for (const auto& row : {"1", "2"}) {
+      for (size_t i = 0; i < types.size(); ++i) {
+        expected_json += std::string(expected_json.size() > 1 ? ", " : "") + row;
+      }
+    }
+    auto expected_values = ArrayFromJSON(expected, expected_json + "]");
+    ASSERT_OK_AND_ASSIGN(
+        auto expected_tensor,
+        Tensor::Make(expected, expected_values->data()->buffers[1],
+                     {2, static_cast<int64_t>(types.size())}));
+    ASSERT_TRUE(expected_tensor->Equals(*tensor));
+  };
+
+  check({int8(), int16()}, int16());
+  check({uint8(), uint32()}, uint32());
+  check({int8(), uint8()}, int16());
+  check({int32(), uint16()}, int32());
+  check({int16(), uint32()}, int64());
+  check({int8(), uint64()}, int64());
+  check({float32(), float32()}, float32());
+  check({float32(), int8()}, float64());
+  check({float64(), uint64(), int16()}, float64());
+}
+
+TEST_F(TestRecordBatch, ToTensorNulls) {
+  auto schema = ::arrow::schema({field("a", int16()), field("b", float32())});
+  auto batch = RecordBatch::Make(schema, 3,
+                                 {ArrayFromJSON(int16(), "[1, null, 5]"),
+                                  ArrayFromJSON(float32(), "[2, 4, null]")});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+
+  for (bool row_major : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(/*null_to_nan=*/true, row_major));
+    ASSERT_EQ(float64(), tensor->type());
+    ASSERT_EQ(1, tensor->Value<DoubleType>({0, 0}));
+    ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({1, 0})));
+    ASSERT_EQ(4, tensor->Value<DoubleType>({1, 1}));
+    ASSERT_EQ(5, tensor->Value<DoubleType>({2, 0}));
+    ASSERT_TRUE(std::isnan(tensor->Value<DoubleType>({2, 1})));
+  }
+
+  // Floating point columns keep their type
+  auto floats = RecordBatch::Make(::arrow::schema({field("b", float32())}), 3,
+                                  {batch->column(1)});
+  ASSERT_OK_AND_ASSIGN(auto tensor, floats->ToTensor(/*null_to_nan=*/true));
+  ASSERT_EQ(float32(), tensor->type());
+  ASSERT_TRUE(std::isnan(tensor->Value<FloatType>({2, 0})));
+}
+
+TEST_F(TestRecordBatch, ToTensorLarge) {
+  // Large enough to be converted by several tasks
+  const int64_t length = 100000;
+  auto a = ConstantArrayGenerator::Int64(length, 7);
+  auto b = ConstantArrayGenerator::Float64(length, 0.5);
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("a", int64()), field("b", float64())}), length, {a, b});
+
+  for (bool row_major : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor(false, row_major));
+    ASSERT_EQ(float64(), tensor->type());
+    for (int64_t i : {int64_t(0), length / 2, length - 1}) {
+      ASSERT_EQ(7, tensor->Value<DoubleType>({i, 0}));
+      ASSERT_EQ(0.5, tensor->Value<DoubleType>({i, 1}));
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto expected, batch->ToTensor(false, true, /*use_threads=*/false));
+  // From pool tasks, the columns are copied inline, so every worker can be
+  // busy at once without deadlocking
+  auto pool = internal::GetCpuThreadPool();
+  std::vector<Future<std::shared_ptr<Tensor>>> futures;
+  for (int i = 0; i < pool->GetCapacity() + 1; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future,
+                         pool->Submit([&]() { return batch->ToTensor(); }));
+    futures.push_back(std::move(future));
+  }
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(auto actual, future.result());
+    ASSERT_TRUE(expected->Equals(*actual));
+  }
+}
+
+TEST_F(TestRecordBatch, ToTensorUnsupported) {
+  auto batch = RecordBatch::Make(::arrow::schema({field("a", utf8())}), 1,
+                                 {ArrayFromJSON(utf8(), R"(["x"])")});
+  ASSERT_RAISES(TypeError, batch->ToTensor());
+
+  auto empty = RecordBatch::Make(::arrow::schema({}), 0, ArrayVector{});
+  ASSERT_RAISES(TypeError, empty->ToTensor());
+}
+
 }  // namespace arrow
@@ -20,18 +20,25 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/data.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -285,4 +292,183 @@ Result<int64_t> Tensor::CountNonZero() const {
   return counter.result;
 }
 
+// ----------------------------------------------------------------------
+// RecordBatch to Tensor conversion
+
+namespace {
+
+// The minimum number of values worth a separate task
+constexpr int64_t kMinValuesPerTask = 1 << 16;
+
+std::shared_ptr<DataType> IntegerTypeOfWidth(bool is_signed, int bit_width) {
+  switch (bit_width) {
+    case 8:
+      return is_signed ? int8() : uint8();
+    case 16:
+      return is_signed ? int16() : uint16();
+    case 32:
+      return is_signed ? int32() : uint32();
+    default:
+      return is_signed ? int64() : uint64();
+  }
+}
+
+Result<std::shared_ptr<DataType>> RecordBatchTensorType(const RecordBatch& batch,
+                                                        bool null_to_nan) {
+  bool all_equal = true;
+  bool has_nulls = false;
+  bool has_floating = false;
+  int signed_width = 0;
+  int unsigned_width = 0;
+  const auto& first_type = batch.schema()->field(0)->type();
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& type = batch.schema()->field(i)->type();
+    if (type->id() == Type::FLOAT || type->id() == Type::DOUBLE) {
+      has_floating = true;
+    } else if (is_integer(type->id())) {
+      const auto& int_type = checked_cast<const IntegerType&>(*type);
+      int& width = int_type.is_signed() ? signed_width : unsigned_width;
+      width = std::max(width, int_type.bit_width());
+    } else {
+      return Status::TypeError("Cannot convert column '", batch.column_name(i),
+                               "' of type ", *type, " to a tensor");
+    }
+    all_equal &= type->Equals(*first_type);
+    has_nulls |= batch.column(i)->null_count() > 0;
+  }
+  if (has_nulls && !null_to_nan) {
+    return Status::TypeError(
+        "Cannot convert a record batch with nulls to a tensor, unless nulls are "
+        "converted to NaN");
+  }
+
+  if (all_equal && (has_floating || !has_nulls)) {
+    return first_type;
+  }
+  if (has_floating || has_nulls) {
+    return float64();
+  }
+  if (unsigned_width == 0) {
+    return IntegerTypeOfWidth(true, signed_width);
+  }
+  if (signed_width == 0) {
+    return IntegerTypeOfWidth(false, unsigned_width);
+  }
+  // A signed type twice as wide holds all the unsigned values, except for uint64
+  return IntegerTypeOfWidth(true,
+                            std::min(64, std::max(signed_width, 2 * unsigned_width)));
+}
+
+// Write values [begin, end) of a column to out[begin * stride], ...,
+// out[(end - 1) * stride]
+template <typename OutType>
+struct ColumnToTensorWriter {
+  template <typename InType>
+  enable_if_number<InType, Status> Visit(const InType&) {
+    using InCType = typename InType::c_type;
+    const auto in = data.GetValues<InCType>(1);
+    if (data.GetNullCount() > 0) {
+      const uint8_t* null_bitmap = data.buffers[0]->data();
+      for (int64_t i = begin; i < end; ++i) {
+        out[i * stride] = BitUtil::GetBit(null_bitmap, data.offset + i)
+                              ? static_cast<OutType>(in[i])
+                              : std::numeric_limits<OutType>::quiet_NaN();
+      }
+    } else if (std::is_same<InCType, OutType>::value && stride == 1) {
+      std::memcpy(out + begin, in + begin, (end - begin) * sizeof(OutType));
+    } else {
+      for (int64_t i = begin; i < end; ++i) {
+        out[i * stride] = static_cast<OutType>(in[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Cannot convert ", type, " values to a tensor");
+  }
+
+  const ArrayData& data;
+  int64_t begin;
+  int64_t end;
+  int64_t stride;
+  OutType* out;
+};
+
+struct RecordBatchToTensorConverter {
+  template <typename OutType>
+  enable_if_number<OutType, Status> Visit(const OutType&) {
+    using OutCType = typename OutType::c_type;
+    const int64_t num_rows = batch.num_rows();
+    const int64_t num_columns = batch.num_columns();
+    ARROW_ASSIGN_OR_RAISE(
+        data, AllocateBuffer(num_rows * num_columns * sizeof(OutCType), pool));
+    auto out = reinterpret_cast<OutCType*>(data->mutable_data());
+
+    // Each task writes a range of rows of all the columns.  From a CPU pool
+    // task, run inline rather than block the worker on nested tasks.
+    int num_tasks = 1;
+    if (use_threads && !internal::GetCpuThreadPool()->OwnsThisThread()) {
+      num_tasks = static_cast<int>(std::max<int64_t>(
+          1, std::min<int64_t>(GetCpuThreadPoolCapacity(),
+                               num_rows * num_columns / kMinValuesPerTask)));
+    }
+    return internal::OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+      const int64_t begin = num_rows * task / num_tasks;
+      const int64_t end = num_rows * (task + 1) / num_tasks;
+      for (int64_t i = 0; i < num_columns; ++i) {
+        ColumnToTensorWriter<OutCType> writer{
+            *batch.column_data(static_cast<int>(i)), begin, end,
+            row_major ? num_columns : 1, row_major ? out + i : out + i * num_rows};
+        RETURN_NOT_OK(VisitTypeInline(*writer.data.type, &writer));
+      }
+      return Status::OK();
+    });
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Cannot convert a record batch to a tensor of ", type);
+  }
+
+  const RecordBatch& batch;
+  bool row_major;
+  bool use_threads;
+  MemoryPool* pool;
+  std::shared_ptr<Buffer> data;
+};
+
+}  // namespace
+
+namespace internal {
+
+Status RecordBatchToTensor(const RecordBatch& batch, bool null_to_nan, bool row_major,
+                           bool use_threads, MemoryPool* pool,
+                           std::shared_ptr<Tensor>* tensor) {
+  if (batch.num_columns() == 0) {
+    return Status::TypeError("Cannot convert a record batch without columns to a tensor");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto type, RecordBatchTensorType(batch, null_to_nan));
+  const std::vector<int64_t> shape = {batch.num_rows(), batch.num_columns()};
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+
+  // A single column is already laid out as a row-major and column-major tensor
+  const auto& first_column = *batch.column_data(0);
+  if (batch.num_columns() == 1 && first_column.type->Equals(*type) &&
+      first_column.GetNullCount() == 0) {
+    auto data = SliceBuffer(first_column.buffers[1], first_column.offset * byte_width,
+                            batch.num_rows() * byte_width);
+    return Tensor::Make(type, std::move(data), shape).Value(tensor);
+  }
+
+  RecordBatchToTensorConverter converter{batch, row_major, use_threads, pool, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(*type, &converter));
+  std::vector<int64_t> strides;
+  if (!row_major) {
+    strides = {byte_width, byte_width * batch.num_rows()};
+  }
+  return Tensor::Make(type, std::move(converter.data), shape, strides).Value(tensor);
+}
+
+}  // namespace internal
+
 }  // namespace arrow
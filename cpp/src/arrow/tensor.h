@@ -71,6 +71,12 @@ Status ValidateTensorParameters(const std::shared_ptr<DataType>& type,
                                 const std::vector<int64_t>& strides,
                                 const std::vector<std::string>& dim_names);
 
+/// \brief Convert a record batch to a tensor, see RecordBatch::ToTensor
+ARROW_EXPORT
+Status RecordBatchToTensor(const RecordBatch& batch, bool null_to_nan, bool row_major,
+                           bool use_threads, MemoryPool* pool,
+                           std::shared_ptr<Tensor>* tensor);
+
 }  // namespace internal
 
 class ARROW_EXPORT Tensor {
@@ -0,0 +1,812 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/tensor/sparse_compute.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/tensor.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Type dispatch
+
+// Call visitor->Visit<CType>() with the C type of the values
+template <typename Visitor>
+Status VisitValueType(const DataType& type, Visitor* visitor) {
+  switch (type.id()) {
+#define VISIT_VALUE_TYPE(TYPE_ID, C_TYPE) \
+  case Type::TYPE_ID:                     \
+    return visitor->template Visit<C_TYPE>();
+
+    VISIT_VALUE_TYPE(INT8, int8_t)
+    VISIT_VALUE_TYPE(INT16, int16_t)
+    VISIT_VALUE_TYPE(INT32, int32_t)
+    VISIT_VALUE_TYPE(INT64, int64_t)
+    VISIT_VALUE_TYPE(UINT8, uint8_t)
+    VISIT_VALUE_TYPE(UINT16, uint16_t)
+    VISIT_VALUE_TYPE(UINT32, uint32_t)
+    VISIT_VALUE_TYPE(UINT64, uint64_t)
+    VISIT_VALUE_TYPE(FLOAT, float)
+    VISIT_VALUE_TYPE(DOUBLE, double)
+
+#undef VISIT_VALUE_TYPE
+
+    default:
+      return Status::NotImplemented("Sparse tensor computations on ", type.ToString(),
+                                    " values");
+  }
+}
+
+// The type in which values are summed
+template <typename CType>
+using SumType = typename std::conditional<
+    std::is_floating_point<CType>::value, double,
+    typename std::conditional<std::is_signed<CType>::value, int64_t,
+                              uint64_t>::type>::type;
+
+// ----------------------------------------------------------------------
+// CSR and CSC matrices
+
+// A CSR or CSC matrix, seen along its compressed ("major") axis
+struct CSXMatrix {
+  int major_axis;
+  int64_t n_major;
+  int64_t n_minor;
+  std::shared_ptr<Tensor> indptr;
+  std::shared_ptr<Tensor> indices;
+  const uint8_t* values;
+
+  int64_t non_zero_length() const { return indices->size(); }
+
+  template <typename IndexType>
+  const IndexType* indptr_data() const {
+    return reinterpret_cast<const IndexType*>(indptr->raw_data());
+  }
+
+  template <typename IndexType>
+  const IndexType* indices_data() const {
+    return reinterpret_cast<const IndexType*>(indices->raw_data());
+  }
+
+  template <typename ValueType>
+  const ValueType* values_data() const {
+    return reinterpret_cast<const ValueType*>(values);
+  }
+};
+
+template <typename SparseIndexType>
+CSXMatrix GetCSXMatrix(const SparseTensorImpl<SparseIndexType>& sparse) {
+  const auto& index = checked_cast<const SparseIndexType&>(*sparse.sparse_index());
+  const int major_axis = static_cast<int>(SparseIndexType::kCompressedAxis);
+  return CSXMatrix{major_axis,       sparse.shape()[major_axis],
+                   sparse.shape()[1 - major_axis], index.indptr(),
+                   index.indices(),  sparse.raw_data()};
+}
+
+Result<std::shared_ptr<Tensor>> WidenIndex(const std::shared_ptr<Tensor>& index,
+                                           MemoryPool* pool) {
+  if (index->type_id() == Type::INT64) {
+    return index;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        AllocateBuffer(index->size() * sizeof(int64_t), pool));
+  auto out = reinterpret_cast<int64_t*>(buffer->mutable_data());
+  switch (index->type_id()) {
+#define WIDEN_INDEX(TYPE_ID, C_TYPE)                                  \
+  case Type::TYPE_ID: {                                               \
+    auto data = reinterpret_cast<const C_TYPE*>(index->raw_data());   \
+    std::copy(data, data + index->size(), out);                       \
+    break;                                                            \
+  }
+
+    WIDEN_INDEX(INT8, int8_t)
+    WIDEN_INDEX(INT16, int16_t)
+    WIDEN_INDEX(INT32, int32_t)
+    WIDEN_INDEX(UINT8, uint8_t)
+    WIDEN_INDEX(UINT16, uint16_t)
+    WIDEN_INDEX(UINT32, uint32_t)
+    WIDEN_INDEX(UINT64, uint64_t)
+
+#undef WIDEN_INDEX
+
+    default:
+      return Status::TypeError("Invalid sparse index type: ", *index->type());
+  }
+  return std::make_shared<Tensor>(int64(), std::move(buffer), index->shape());
+}
+
+// The kernels are instantiated for int32 and int64 indices only.  Returns
+// whether all the indices are int32, otherwise widens them to int64.
+Result<bool> PrepareIndices(const std::vector<CSXMatrix*>& matrices, MemoryPool* pool) {
+  bool all_int32 = true;
+  for (const auto matrix : matrices) {
+    all_int32 &= matrix->indptr->type_id() == Type::INT32 &&
+                 matrix->indices->type_id() == Type::INT32;
+  }
+  if (!all_int32) {
+    for (const auto matrix : matrices) {
+      ARROW_ASSIGN_OR_RAISE(matrix->indptr, WidenIndex(matrix->indptr, pool));
+      ARROW_ASSIGN_OR_RAISE(matrix->indices, WidenIndex(matrix->indices, pool));
+    }
+  }
+  return all_int32;
+}
+
+// ----------------------------------------------------------------------
+// Parallel execution
+
+// The minimum number of multiply-adds worth a separate task
+constexpr int64_t kMinTaskWork = 1 << 16;
+
+// Tasks are run inline when called from the CPU thread pool, as blocking one
+// of its workers on other tasks may deadlock it
+int NumTasks(bool use_threads, int64_t work) {
+  if (!use_threads || internal::GetCpuThreadPool()->OwnsThisThread()) {
+    return 1;
+  }
+  const int64_t max_tasks = GetCpuThreadPoolCapacity();
+  return static_cast<int>(std::max<int64_t>(1, std::min(max_tasks, work / kMinTaskWork)));
+}
+
+// Split the major axis in ranges with about the same number of non-zero values
+template <typename IndexType>
+std::vector<int64_t> SplitMajorAxis(const IndexType* indptr, int64_t n_major,
+                                    int num_tasks) {
+  std::vector<int64_t> bounds(num_tasks + 1, n_major);
+  bounds[0] = 0;
+  const int64_t first = indptr[0];
+  const int64_t non_zero_length = indptr[n_major] - first;
+  for (int i = 1; i < num_tasks; ++i) {
+    const int64_t target = first + non_zero_length * i / num_tasks;
+    const int64_t bound = std::lower_bound(indptr, indptr + n_major + 1, target) - indptr;
+    bounds[i] = std::max(bounds[i - 1], std::min(bound, n_major));
+  }
+  return bounds;
+}
+
+// Call func(begin, end) over ranges of the major axis, in parallel if
+// num_tasks > 1
+template <typename IndexType, typename Func>
+Status ForMajorRanges(const IndexType* indptr, int64_t n_major, int num_tasks,
+                      Func&& func) {
+  const auto bounds = SplitMajorAxis(indptr, n_major, num_tasks);
+  return internal::OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    return func(bounds[task], bounds[task + 1]);
+  });
+}
+
+// Like ForMajorRanges, for scatter operations: func(begin, end, out) adds to
+// the zero-initialized `out`, whose `out_length` values are summed by all the
+// tasks.  Each task but the first one accumulates into its own buffer, so
+// the number of tasks is bounded by the ratio of the work to the output size.
+template <typename OutType, typename IndexType, typename Func>
+Status ScatterMajorRanges(const IndexType* indptr, int64_t n_major, bool use_threads,
+                          int64_t work, int64_t out_length, OutType* out,
+                          MemoryPool* pool, Func&& func) {
+  if (out_length == 0) {
+    return Status::OK();
+  }
+  const int num_tasks = std::min<int64_t>(NumTasks(use_threads, work),
+                                          std::max<int64_t>(1, work / out_length));
+  const auto bounds = SplitMajorAxis(indptr, n_major, num_tasks);
+  std::vector<std::shared_ptr<Buffer>> partials(num_tasks);
+
+  RETURN_NOT_OK(
+      internal::OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) -> Status {
+        OutType* task_out = out;
+        if (task > 0) {
+          ARROW_ASSIGN_OR_RAISE(partials[task],
+                                AllocateBuffer(out_length * sizeof(OutType), pool));
+          task_out = reinterpret_cast<OutType*>(partials[task]->mutable_data());
+          std::fill_n(task_out, out_length, static_cast<OutType>(0));
+        }
+        func(bounds[task], bounds[task + 1], task_out);
+        return Status::OK();
+      }));
+
+  // Sum the partial results, in parallel over ranges of the output
+  return internal::OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    const int64_t begin = out_length * task / num_tasks;
+    const int64_t end = out_length * (task + 1) / num_tasks;
+    for (int i = 1; i < num_tasks; ++i) {
+      const auto partial = reinterpret_cast<const OutType*>(partials[i]->data());
+      for (int64_t j = begin; j < end; ++j) {
+        out[j] = static_cast<OutType>(out[j] + partial[j]);
+      }
+    }
+    return Status::OK();
+  });
+}
+
+template <typename CType>
+Result<std::shared_ptr<Buffer>> AllocateZeroed(int64_t length, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                        AllocateBuffer(length * sizeof(CType), pool));
+  std::fill_n(reinterpret_cast<CType*>(buffer->mutable_data()), length,
+              static_cast<CType>(0));
+  return buffer;
+}
+
+// ----------------------------------------------------------------------
+// Sparse-dense products
+
+class MatMulImpl {
+ public:
+  MatMulImpl(CSXMatrix matrix, const Tensor& dense, bool use_threads, MemoryPool* pool)
+      : matrix_(std::move(matrix)),
+        dense_(dense),
+        use_threads_(use_threads),
+        pool_(pool) {}
+
+  Status Validate(const DataType& type) {
+    if (!dense_.type()->Equals(type)) {
+      return Status::TypeError("Cannot multiply a sparse matrix of ", type,
+                               " by a dense tensor of ", *dense_.type());
+    }
+    const int64_t n_cols = matrix_.major_axis == 0 ? matrix_.n_minor : matrix_.n_major;
+    if ((dense_.ndim() != 1 && dense_.ndim() != 2) || dense_.shape()[0] != n_cols) {
+      return Status::Invalid("Cannot multiply a sparse matrix with ", n_cols,
+                             " columns by a dense tensor of shape (",
+                             dense_.ndim() > 0 ? dense_.shape()[0] : 0,
+                             dense_.ndim() > 1 ? ", ..." : "", ")");
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Tensor>> Run(const std::shared_ptr<DataType>& type) {
+    RETURN_NOT_OK(Validate(*type));
+    ARROW_ASSIGN_OR_RAISE(index_is_int32_, PrepareIndices({&matrix_}, pool_));
+
+    const int64_t n_rows = matrix_.major_axis == 0 ? matrix_.n_major : matrix_.n_minor;
+    num_columns_ = dense_.ndim() == 2 ? dense_.shape()[1] : 1;
+    dense_row_stride_ = dense_.strides()[0];
+    dense_column_stride_ = dense_.ndim() == 2 ? dense_.strides()[1] : 0;
+
+    out_length_ = n_rows * num_columns_;
+    RETURN_NOT_OK(VisitValueType(*type, this));
+
+    std::vector<int64_t> shape{n_rows};
+    if (dense_.ndim() == 2) {
+      shape.push_back(num_columns_);
+    }
+    return Tensor::Make(type, std::move(out_), shape);
+  }
+
+  template <typename ValueType>
+  Status Visit() {
+    ARROW_ASSIGN_OR_RAISE(out_, AllocateZeroed<ValueType>(out_length_, pool_));
+    auto out = reinterpret_cast<ValueType*>(out_->mutable_data());
+    if (index_is_int32_) {
+      return Compute<int32_t, ValueType>(out);
+    }
+    return Compute<int64_t, ValueType>(out);
+  }
+
+ private:
+  // out[0:num_columns] += value * dense[row, :]
+  template <typename ValueType>
+  void MultiplyAdd(ValueType value, int64_t row, ValueType* out) const {
+    const uint8_t* dense_row = dense_.raw_data() + row * dense_row_stride_;
+    if (dense_column_stride_ == sizeof(ValueType) || num_columns_ == 1) {
+      const auto dense_values = reinterpret_cast<const ValueType*>(dense_row);
+      for (int64_t c = 0; c < num_columns_; ++c) {
+        out[c] = static_cast<ValueType>(out[c] + value * dense_values[c]);
+      }
+    } else {
+      for (int64_t c = 0; c < num_columns_; ++c) {
+        const auto dense_value =
+            *reinterpret_cast<const ValueType*>(dense_row + c * dense_column_stride_);
+        out[c] = static_cast<ValueType>(out[c] + value * dense_value);
+      }
+    }
+  }
+
+  template <typename IndexType, typename ValueType>
+  Status Compute(ValueType* out) {
+    const auto indptr = matrix_.indptr_data<IndexType>();
+    const auto indices = matrix_.indices_data<IndexType>();
+    const auto values = matrix_.values_data<ValueType>();
+    const int64_t work = matrix_.non_zero_length() * num_columns_;
+
+    if (matrix_.major_axis == 0) {
+      // CSR: each task computes a range of rows of the result
+      return ForMajorRanges(indptr, matrix_.n_major, NumTasks(use_threads_, work),
+                            [&](int64_t begin, int64_t end) {
+                              for (int64_t i = begin; i < end; ++i) {
+                                ValueType* out_row = out + i * num_columns_;
+                                for (int64_t p = indptr[i]; p < indptr[i + 1]; ++p) {
+                                  MultiplyAdd(values[p], indices[p], out_row);
+                                }
+                              }
+                              return Status::OK();
+                            });
+    }
+
+    // CSC: each task adds the products of a range of columns
+    return ScatterMajorRanges(indptr, matrix_.n_major, use_threads_, work, out_length_,
+                              out, pool_,
+                              [&](int64_t begin, int64_t end, ValueType* task_out) {
+                                for (int64_t j = begin; j < end; ++j) {
+                                  for (int64_t p = indptr[j]; p < indptr[j + 1]; ++p) {
+                                    MultiplyAdd(values[p], j,
+                                                task_out + indices[p] * num_columns_);
+                                  }
+                                }
+                              });
+  }
+
+  CSXMatrix matrix_;
+  const Tensor& dense_;
+  bool use_threads_;
+  MemoryPool* pool_;
+
+  bool index_is_int32_ = false;
+  int64_t num_columns_ = 0;
+  int64_t dense_row_stride_ = 0;
+  int64_t dense_column_stride_ = 0;
+  int64_t out_length_ = 0;
+  std::shared_ptr<Buffer> out_;
+};
+
+template <typename SparseIndexType>
+Result<std::shared_ptr<Tensor>> MatMul(const SparseTensorImpl<SparseIndexType>& sparse,
+                                       const Tensor& dense, bool use_threads,
+                                       MemoryPool* pool) {
+  MatMulImpl impl(GetCSXMatrix(sparse), dense, use_threads, pool);
+  return impl.Run(sparse.type());
+}
+
+// ----------------------------------------------------------------------
+// Elementwise operations
+
+class ScaleImpl {
+ public:
+  ScaleImpl(const SparseTensor& sparse, const Scalar& factor, MemoryPool* pool)
+      : sparse_(sparse), factor_(factor), pool_(pool) {}
+
+  Result<std::shared_ptr<Buffer>> Run() {
+    if (!factor_.is_valid) {
+      return Status::Invalid("Cannot scale a sparse tensor by a null factor");
+    }
+    RETURN_NOT_OK(VisitValueType(*sparse_.type(), this));
+    return std::move(out_);
+  }
+
+  template <typename ValueType>
+  Status Visit() {
+    using ScalarType = typename CTypeTraits<ValueType>::ScalarType;
+    ARROW_ASSIGN_OR_RAISE(auto factor, factor_.CastTo(sparse_.type()));
+    const ValueType factor_value = checked_cast<const ScalarType&>(*factor).value;
+
+    const int64_t length = sparse_.non_zero_length();
+    ARROW_ASSIGN_OR_RAISE(out_, AllocateBuffer(length * sizeof(ValueType), pool_));
+    const auto values = reinterpret_cast<const ValueType*>(sparse_.raw_data());
+    auto out = reinterpret_cast<ValueType*>(out_->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = static_cast<ValueType>(values[i] * factor_value);
+    }
+    return Status::OK();
+  }
+
+ private:
+  const SparseTensor& sparse_;
+  const Scalar& factor_;
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> out_;
+};
+
+template <typename SparseIndexType>
+Result<std::shared_ptr<SparseTensorImpl<SparseIndexType>>> Scale(
+    const SparseTensorImpl<SparseIndexType>& sparse, const Scalar& factor,
+    MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(auto data, ScaleImpl(sparse, factor, pool).Run());
+  return SparseTensorImpl<SparseIndexType>::Make(
+      internal::checked_pointer_cast<SparseIndexType>(sparse.sparse_index()),
+      sparse.type(), std::move(data), sparse.shape(), sparse.dim_names());
+}
+
+struct AddOp {
+  // Values present in only one operand are kept
+  static constexpr bool kUnion = true;
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left + right);
+  }
+};
+
+struct MultiplyOp {
+  static constexpr bool kUnion = false;
+
+  template <typename T>
+  static T Call(T left, T right) {
+    return static_cast<T>(left * right);
+  }
+};
+
+template <typename Op>
+class ElementwiseImpl {
+ public:
+  ElementwiseImpl(CSXMatrix left, CSXMatrix right, bool use_threads, MemoryPool* pool)
+      : left_(std::move(left)),
+        right_(std::move(right)),
+        use_threads_(use_threads),
+        pool_(pool) {}
+
+  Status Run(const DataType& type) {
+    ARROW_ASSIGN_OR_RAISE(index_is_int32_, PrepareIndices({&left_, &right_}, pool_));
+    return VisitValueType(type, this);
+  }
+
+  template <typename ValueType>
+  Status Visit() {
+    if (index_is_int32_) {
+      return Compute<int32_t, ValueType>();
+    }
+    return Compute<int64_t, ValueType>();
+  }
+
+  std::shared_ptr<Tensor> indptr;
+  std::shared_ptr<Tensor> indices;
+  std::shared_ptr<Buffer> data;
+
+ private:
+  template <typename IndexType>
+  static bool IsSorted(const CSXMatrix& matrix, int64_t i) {
+    const auto indptr = matrix.indptr_data<IndexType>();
+    const auto indices = matrix.indices_data<IndexType>();
+    for (int64_t p = indptr[i] + 1; p < indptr[i + 1]; ++p) {
+      if (indices[p - 1] >= indices[p]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Call emit(index, value) with the result of the operation along the i-th
+  // major index, in increasing minor index order
+  template <typename IndexType, typename ValueType, typename Emit>
+  void Merge(int64_t i, Emit&& emit) const {
+    const auto left_indptr = left_.indptr_data<IndexType>();
+    const auto left_indices = left_.indices_data<IndexType>();
+    const auto left_values = left_.values_data<ValueType>();
+    const auto right_indptr = right_.indptr_data<IndexType>();
+    const auto right_indices = right_.indices_data<IndexType>();
+    const auto right_values = right_.values_data<ValueType>();
+    const ValueType zero = 0;
+
+    int64_t p = left_indptr[i];
+    int64_t q = right_indptr[i];
+    const int64_t p_end = left_indptr[i + 1];
+    const int64_t q_end = right_indptr[i + 1];
+    while (p < p_end && q < q_end) {
+      if (left_indices[p] < right_indices[q]) {
+        if (Op::kUnion) {
+          emit(left_indices[p], Op::Call(left_values[p], zero));
+        }
+        ++p;
+      } else if (right_indices[q] < left_indices[p]) {
+        if (Op::kUnion) {
+          emit(right_indices[q], Op::Call(zero, right_values[q]));
+        }
+        ++q;
+      } else {
+        emit(left_indices[p], Op::Call(left_values[p], right_values[q]));
+        ++p;
+        ++q;
+      }
+    }
+    if (Op::kUnion) {
+      for (; p < p_end; ++p) {
+        emit(left_indices[p], Op::Call(left_values[p], zero));
+      }
+      for (; q < q_end; ++q) {
+        emit(right_indices[q], Op::Call(zero, right_values[q]));
+      }
+    }
+  }
+
+  template <typename IndexType, typename ValueType>
+  Status Compute() {
+    const int64_t n_major = left_.n_major;
+    const auto left_indptr = left_.indptr_data<IndexType>();
+    const int num_tasks =
+        NumTasks(use_threads_, left_.non_zero_length() + right_.non_zero_length());
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indptr_buffer,
+                          AllocateBuffer((n_major + 1) * sizeof(int64_t), pool_));
+    auto out_indptr = reinterpret_cast<int64_t*>(indptr_buffer->mutable_data());
+    out_indptr[0] = 0;
+
+    // First pass: count the non-zero results along each major index
+    RETURN_NOT_OK(ForMajorRanges(
+        left_indptr, n_major, num_tasks, [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            if (!IsSorted<IndexType>(left_, i) || !IsSorted<IndexType>(right_, i)) {
+              return Status::Invalid(
+                  "Sparse matrix indices must be sorted along the compressed axis");
+            }
+            int64_t count = 0;
+            Merge<IndexType, ValueType>(
+                i, [&](IndexType, ValueType value) { count += value != 0; });
+            out_indptr[i + 1] = count;
+          }
+          return Status::OK();
+        }));
+    for (int64_t i = 0; i < n_major; ++i) {
+      out_indptr[i + 1] += out_indptr[i];
+    }
+
+    // Second pass: fill the indices and values
+    const int64_t non_zero_length = out_indptr[n_major];
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices_buffer,
+                          AllocateBuffer(non_zero_length * sizeof(int64_t), pool_));
+    ARROW_ASSIGN_OR_RAISE(data,
+                          AllocateBuffer(non_zero_length * sizeof(ValueType), pool_));
+    auto out_indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+    auto out_values = reinterpret_cast<ValueType*>(data->mutable_data());
+    RETURN_NOT_OK(ForMajorRanges(
+        left_indptr, n_major, num_tasks, [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            int64_t k = out_indptr[i];
+            Merge<IndexType, ValueType>(i, [&](IndexType index, ValueType value) {
+              if (value != 0) {
+                out_indices[k] = index;
+                out_values[k] = value;
+                ++k;
+              }
+            });
+          }
+          return Status::OK();
+        }));
+
+    indptr = std::make_shared<Tensor>(int64(), std::move(indptr_buffer),
+                                      std::vector<int64_t>{n_major + 1});
+    indices = std::make_shared<Tensor>(int64(), std::move(indices_buffer),
+                                       std::vector<int64_t>{non_zero_length});
+    return Status::OK();
+  }
+
+  CSXMatrix left_;
+  CSXMatrix right_;
+  bool use_threads_;
+  MemoryPool* pool_;
+  bool index_is_int32_ = false;
+};
+
+template <typename Op, typename SparseIndexType>
+Result<std::shared_ptr<SparseTensorImpl<SparseIndexType>>> Elementwise(
+    const SparseTensorImpl<SparseIndexType>& left,
+    const SparseTensorImpl<SparseIndexType>& right, bool use_threads,
+    MemoryPool* pool) {
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Sparse matrices have different value types: ",
+                             *left.type(), " and ", *right.type());
+  }
+  if (left.shape() != right.shape()) {
+    return Status::Invalid("Sparse matrices have different shapes");
+  }
+
+  ElementwiseImpl<Op> impl(GetCSXMatrix(left), GetCSXMatrix(right), use_threads, pool);
+  RETURN_NOT_OK(impl.Run(*left.type()));
+  auto sparse_index = std::make_shared<SparseIndexType>(impl.indptr, impl.indices);
+  return SparseTensorImpl<SparseIndexType>::Make(sparse_index, left.type(), impl.data,
+                                                 left.shape(), left.dim_names());
+}
+
+// ----------------------------------------------------------------------
+// Reductions
+
+class SumImpl {
+ public:
+  explicit SumImpl(const SparseTensor& sparse) : sparse_(sparse) {}
+
+  Result<std::shared_ptr<Scalar>> Run() {
+    RETURN_NOT_OK(VisitValueType(*sparse_.type(), this));
+    return std::move(out_);
+  }
+
+  template <typename ValueType>
+  Status Visit() {
+    const auto values = reinterpret_cast<const ValueType*>(sparse_.raw_data());
+    SumType<ValueType> sum = 0;
+    for (int64_t i = 0; i < sparse_.non_zero_length(); ++i) {
+      sum += values[i];
+    }
+    out_ = MakeScalar(sum);
+    return Status::OK();
+  }
+
+ private:
+  const SparseTensor& sparse_;
+  std::shared_ptr<Scalar> out_;
+};
+
+class SumAxisImpl {
+ public:
+  SumAxisImpl(CSXMatrix matrix, int axis, bool use_threads, MemoryPool* pool)
+      : matrix_(std::move(matrix)), axis_(axis), use_threads_(use_threads), pool_(pool) {}
+
+  Result<std::shared_ptr<Tensor>> Run(const DataType& type) {
+    if (axis_ != 0 && axis_ != 1) {
+      return Status::Invalid("Invalid axis for a sparse matrix: ", axis_);
+    }
+    ARROW_ASSIGN_OR_RAISE(index_is_int32_, PrepareIndices({&matrix_}, pool_));
+    // Summing along the minor axis gives one sum per major index
+    out_length_ = axis_ != matrix_.major_axis ? matrix_.n_major : matrix_.n_minor;
+    RETURN_NOT_OK(VisitValueType(type, this));
+    return Tensor::Make(out_type_, std::move(out_), {out_length_});
+  }
+
+  template <typename ValueType>
+  Status Visit() {
+    using OutType = SumType<ValueType>;
+    out_type_ = CTypeTraits<OutType>::type_singleton();
+    ARROW_ASSIGN_OR_RAISE(out_, AllocateZeroed<OutType>(out_length_, pool_));
+    auto out = reinterpret_cast<OutType*>(out_->mutable_data());
+    if (index_is_int32_) {
+      return Compute<int32_t, ValueType>(out);
+    }
+    return Compute<int64_t, ValueType>(out);
+  }
+
+ private:
+  template <typename IndexType, typename ValueType, typename OutType>
+  Status Compute(OutType* out) {
+    const auto indptr = matrix_.indptr_data<IndexType>();
+    const auto indices = matrix_.indices_data<IndexType>();
+    const auto values = matrix_.values_data<ValueType>();
+    const int64_t work = matrix_.non_zero_length();
+
+    if (axis_ != matrix_.major_axis) {
+      return ForMajorRanges(indptr, matrix_.n_major, NumTasks(use_threads_, work),
+                            [&](int64_t begin, int64_t end) {
+                              for (int64_t i = begin; i < end; ++i) {
+                                OutType sum = 0;
+                                for (int64_t p = indptr[i]; p < indptr[i + 1]; ++p) {
+                                  sum += values[p];
+                                }
+                                out[i] = sum;
+                              }
+                              return Status::OK();
+                            });
+    }
+    return ScatterMajorRanges(indptr, matrix_.n_major, use_threads_, work, out_length_,
+                              out, pool_,
+                              [&](int64_t begin, int64_t end, OutType* task_out) {
+                                for (int64_t p = indptr[begin]; p < indptr[end]; ++p) {
+                                  task_out[indices[p]] += values[p];
+                                }
+                              });
+  }
+
+  CSXMatrix matrix_;
+  int axis_;
+  bool use_threads_;
+  MemoryPool* pool_;
+
+  bool index_is_int32_ = false;
+  int64_t out_length_ = 0;
+  std::shared_ptr<DataType> out_type_;
+  std::shared_ptr<Buffer> out_;
+};
+
+template <typename SparseIndexType>
+Result<std::shared_ptr<Tensor>> SumAxis(const SparseTensorImpl<SparseIndexType>& sparse,
+                                        int axis, bool use_threads, MemoryPool* pool) {
+  SumAxisImpl impl(GetCSXMatrix(sparse), axis, use_threads, pool);
+  return impl.Run(*sparse.type());
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> SparseMatMul(const SparseCSRMatrix& sparse,
+                                             const Tensor& dense, bool use_threads,
+                                             MemoryPool* pool) {
+  return MatMul(sparse, dense, use_threads, pool);
+}
+
+Result<std::shared_ptr<Tensor>> SparseMatMul(const SparseCSCMatrix& sparse,
+                                             const Tensor& dense, bool use_threads,
+                                             MemoryPool* pool) {
+  return MatMul(sparse, dense, use_threads, pool);
+}
+
+Result<std::shared_ptr<SparseCOOTensor>> SparseScale(const SparseCOOTensor& sparse,
+                                                     const Scalar& factor,
+                                                     MemoryPool* pool) {
+  return Scale(sparse, factor, pool);
+}
+
+Result<std::shared_ptr<SparseCSRMatrix>> SparseScale(const SparseCSRMatrix& sparse,
+                                                     const Scalar& factor,
+                                                     MemoryPool* pool) {
+  return Scale(sparse, factor, pool);
+}
+
+Result<std::shared_ptr<SparseCSCMatrix>> SparseScale(const SparseCSCMatrix& sparse,
+                                                     const Scalar& factor,
+                                                     MemoryPool* pool) {
+  return Scale(sparse, factor, pool);
+}
+
+Result<std::shared_ptr<SparseCSFTensor>> SparseScale(const SparseCSFTensor& sparse,
+                                                     const Scalar& factor,
+                                                     MemoryPool* pool) {
+  return Scale(sparse, factor, pool);
+}
+
+Result<std::shared_ptr<SparseCSRMatrix>> SparseAdd(const SparseCSRMatrix& left,
+                                                   const SparseCSRMatrix& right,
+                                                   bool use_threads, MemoryPool* pool) {
+  return Elementwise<AddOp>(left, right, use_threads, pool);
+}
+
+Result<std::shared_ptr<SparseCSCMatrix>> SparseAdd(const SparseCSCMatrix& left,
+                                                   const SparseCSCMatrix& right,
+                                                   bool use_threads, MemoryPool* pool) {
+  return Elementwise<AddOp>(left, right, use_threads, pool);
+}
+
+Result<std::shared_ptr<SparseCSRMatrix>> SparseMultiply(const SparseCSRMatrix& left,
+                                                        const SparseCSRMatrix& right,
+                                                        bool use_threads,
+                                                        MemoryPool* pool) {
+  return Elementwise<MultiplyOp>(left, right, use_threads, pool);
+}
+
+Result<std::shared_ptr<SparseCSCMatrix>> SparseMultiply(const SparseCSCMatrix& left,
+                                                        const SparseCSCMatrix& right,
+                                                        bool use_threads,
+                                                        MemoryPool* pool) {
+  return Elementwise<MultiplyOp>(left, right, use_threads, pool);
+}
+
+Result<std::shared_ptr<Scalar>> SparseSum(const SparseTensor& sparse) {
+  return SumImpl(sparse).Run();
+}
+
+Result<std::shared_ptr<Tensor>> SparseSum(const SparseCSRMatrix& sparse, int axis,
+                                          bool use_threads, MemoryPool* pool) {
+  return SumAxis(sparse, axis, use_threads, pool);
+}
+
+Result<std::shared_ptr<Tensor>> SparseSum(const SparseCSCMatrix& sparse, int axis,
+                                          bool use_threads, MemoryPool* pool) {
+  return SumAxis(sparse, axis, use_threads, pool);
+}
+
+}  // namespace arrow
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Computations operating directly on sparse tensors, without densifying them.
+//
+// The values of the tensors must be integers or floating point numbers, other
+// than half floats.  Functions taking a `use_threads` argument may run in
+// parallel on the CPU thread pool.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+// ----------------------------------------------------------------------
+// Products with dense tensors
+
+/// \brief EXPERIMENTAL: Multiply a sparse matrix by a dense vector or matrix
+///
+/// `dense` must have the value type of `sparse`.  It is either a vector with
+/// as many elements as `sparse` has columns, or a matrix with as many rows as
+/// `sparse` has columns, and may have any strides.  The result is a row-major
+/// vector or matrix of the same value type, with as many rows as `sparse`.
+///
+/// \param[in] sparse the sparse matrix
+/// \param[in] dense the dense vector or matrix
+/// \param[in] use_threads whether to compute the product in parallel
+/// \param[in] pool the memory pool used for the result
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> SparseMatMul(const SparseCSRMatrix& sparse,
+                                             const Tensor& dense, bool use_threads = true,
+                                             MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply a sparse matrix by a dense vector or matrix
+///
+/// See the CSR overload.  Threads accumulate partial products in their own
+/// buffer, so parallelism is limited when the result is large compared to the
+/// number of non-zero values.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> SparseMatMul(const SparseCSCMatrix& sparse,
+                                             const Tensor& dense, bool use_threads = true,
+                                             MemoryPool* pool = default_memory_pool());
+
+// ----------------------------------------------------------------------
+// Elementwise operations
+
+/// \brief EXPERIMENTAL: Multiply the values of a sparse tensor by a scalar
+///
+/// `factor` is cast to the value type of the tensor.  The result shares the
+/// sparse index of `sparse`; zeros resulting from the multiplication are kept.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCOOTensor>> SparseScale(
+    const SparseCOOTensor& sparse, const Scalar& factor,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply the values of a sparse tensor by a scalar
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> SparseScale(
+    const SparseCSRMatrix& sparse, const Scalar& factor,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply the values of a sparse tensor by a scalar
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSCMatrix>> SparseScale(
+    const SparseCSCMatrix& sparse, const Scalar& factor,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply the values of a sparse tensor by a scalar
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSFTensor>> SparseScale(
+    const SparseCSFTensor& sparse, const Scalar& factor,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Add two sparse matrices elementwise
+///
+/// Both matrices must have the same shape and value type, and their indices
+/// must be sorted within each row.  Zeros resulting from the addition are not
+/// stored.  The result has int64 indices.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> SparseAdd(
+    const SparseCSRMatrix& left, const SparseCSRMatrix& right, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Add two sparse matrices elementwise
+///
+/// The indices must be sorted within each column.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSCMatrix>> SparseAdd(
+    const SparseCSCMatrix& left, const SparseCSCMatrix& right, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply two sparse matrices elementwise
+///
+/// Both matrices must have the same shape and value type, and their indices
+/// must be sorted within each row.  The result only stores the non-zero
+/// products, with int64 indices.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> SparseMultiply(
+    const SparseCSRMatrix& left, const SparseCSRMatrix& right, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Multiply two sparse matrices elementwise
+///
+/// The indices must be sorted within each column.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSCMatrix>> SparseMultiply(
+    const SparseCSCMatrix& left, const SparseCSCMatrix& right, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+// ----------------------------------------------------------------------
+// Reductions
+
+/// \brief EXPERIMENTAL: Sum the values of a sparse tensor of any format
+///
+/// Integers are summed as an Int64Scalar or a UInt64Scalar, floating point
+/// values as a DoubleScalar.
+ARROW_EXPORT
+Result<std::shared_ptr<Scalar>> SparseSum(const SparseTensor& sparse);
+
+/// \brief EXPERIMENTAL: Sum a sparse matrix along an axis
+///
+/// Summing along axis 0 gives a vector with one element per column, along
+/// axis 1 a vector with one element per row.  The sums have the types
+/// described in the overload for any sparse tensor.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> SparseSum(const SparseCSRMatrix& sparse, int axis,
+                                          bool use_threads = true,
+                                          MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Sum a sparse matrix along an axis
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> SparseSum(const SparseCSCMatrix& sparse, int axis,
+                                          bool use_threads = true,
+                                          MemoryPool* pool = default_memory_pool());
+
+}  // namespace arrow
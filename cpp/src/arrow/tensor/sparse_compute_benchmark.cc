@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor/sparse_compute.h"
+#include "arrow/testing/gtest_util.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace arrow {
+
+constexpr int64_t kNumRows = 20000;
+constexpr int64_t kNumColumns = 5000;
+// The average gap between the non-zero values of a row or column
+constexpr int kMeanGap = 100;
+
+// A dense row-major vector or matrix of doubles
+static std::shared_ptr<Tensor> MakeDenseTensor(const std::vector<int64_t>& shape,
+                                               uint32_t seed) {
+  std::default_random_engine engine(seed);
+  std::uniform_real_distribution<double> dist;
+  const int64_t size = shape.size() == 2 ? shape[0] * shape[1] : shape[0];
+  std::shared_ptr<Buffer> data;
+  ABORT_NOT_OK(AllocateBuffer(size * sizeof(double)).Value(&data));
+  auto values = reinterpret_cast<double*>(data->mutable_data());
+  for (int64_t i = 0; i < size; ++i) {
+    values[i] = dist(engine);
+  }
+  std::shared_ptr<Tensor> tensor;
+  ABORT_NOT_OK(Tensor::Make(float64(), data, shape).Value(&tensor));
+  return tensor;
+}
+
+// A random kNumRows x kNumColumns matrix, built directly in compressed form
+// since densifying it would dominate the setup time
+template <typename SparseIndexType>
+static std::shared_ptr<SparseTensorImpl<SparseIndexType>> MakeSparseMatrix(
+    uint32_t seed) {
+  const int major_axis = static_cast<int>(SparseIndexType::kCompressedAxis);
+  const std::vector<int64_t> shape = {kNumRows, kNumColumns};
+  const int64_t n_major = shape[major_axis];
+  const int64_t n_minor = shape[1 - major_axis];
+
+  std::default_random_engine engine(seed);
+  std::uniform_int_distribution<int32_t> gap(1, 2 * kMeanGap - 1);
+  std::uniform_real_distribution<double> dist;
+  std::vector<int32_t> indptr = {0}, indices;
+  std::vector<double> values;
+  for (int64_t i = 0; i < n_major; ++i) {
+    for (int32_t j = gap(engine) - 1; j < n_minor; j += gap(engine)) {
+      indices.push_back(j);
+      values.push_back(dist(engine));
+    }
+    indptr.push_back(static_cast<int32_t>(indices.size()));
+  }
+
+  const int64_t non_zero_length = static_cast<int64_t>(indices.size());
+  std::shared_ptr<Buffer> indptr_data, indices_data, data;
+  ABORT_NOT_OK(Buffer::Wrap(indptr)->CopySlice(0, indptr.size() * sizeof(int32_t))
+                   .Value(&indptr_data));
+  ABORT_NOT_OK(Buffer::Wrap(indices)->CopySlice(0, non_zero_length * sizeof(int32_t))
+                   .Value(&indices_data));
+  ABORT_NOT_OK(Buffer::Wrap(values)->CopySlice(0, non_zero_length * sizeof(double))
+                   .Value(&data));
+  auto sparse_index = std::make_shared<SparseIndexType>(
+      std::make_shared<Tensor>(int32(), indptr_data, std::vector<int64_t>{n_major + 1}),
+      std::make_shared<Tensor>(int32(), indices_data,
+                               std::vector<int64_t>{non_zero_length}));
+  std::shared_ptr<SparseTensorImpl<SparseIndexType>> sparse;
+  ABORT_NOT_OK(SparseTensorImpl<SparseIndexType>::Make(sparse_index, float64(), data,
+                                                       shape, {})
+                   .Value(&sparse));
+  return sparse;
+}
+
+// Multiply by a vector (state.range(1) == 0) or a matrix with state.range(1)
+// columns, without (state.range(0) == 0) or with threads
+template <typename SparseIndexType>
+static void SparseMatMulBenchmark(benchmark::State& state) {  // NOLINT non-const ref
+  const bool use_threads = state.range(0) != 0;
+  const int64_t num_columns = state.range(1);
+  auto sparse = MakeSparseMatrix<SparseIndexType>(42);
+  auto dense = num_columns == 0 ? MakeDenseTensor({kNumColumns}, 43)
+                                : MakeDenseTensor({kNumColumns, num_columns}, 43);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseMatMul(*sparse, *dense, use_threads).status());
+  }
+  state.SetItemsProcessed(state.iterations() * sparse->non_zero_length() *
+                          std::max<int64_t>(1, num_columns));
+}
+
+template <typename SparseIndexType>
+static void SparseAddBenchmark(benchmark::State& state) {  // NOLINT non-const ref
+  const bool use_threads = state.range(0) != 0;
+  auto left = MakeSparseMatrix<SparseIndexType>(42);
+  auto right = MakeSparseMatrix<SparseIndexType>(43);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseAdd(*left, *right, use_threads).status());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          (left->non_zero_length() + right->non_zero_length()));
+}
+
+template <typename SparseIndexType>
+static void SparseMultiplyBenchmark(benchmark::State& state) {  // NOLINT non-const ref
+  const bool use_threads = state.range(0) != 0;
+  auto left = MakeSparseMatrix<SparseIndexType>(42);
+  auto right = MakeSparseMatrix<SparseIndexType>(43);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseMultiply(*left, *right, use_threads).status());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          (left->non_zero_length() + right->non_zero_length()));
+}
+
+// Sum along axis state.range(1)
+template <typename SparseIndexType>
+static void SparseSumAxisBenchmark(benchmark::State& state) {  // NOLINT non-const ref
+  const bool use_threads = state.range(0) != 0;
+  const int axis = static_cast<int>(state.range(1));
+  auto sparse = MakeSparseMatrix<SparseIndexType>(42);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseSum(*sparse, axis, use_threads).status());
+  }
+  state.SetItemsProcessed(state.iterations() * sparse->non_zero_length());
+}
+
+static void SparseScaleBenchmark(benchmark::State& state) {  // NOLINT non-const ref
+  auto sparse = MakeSparseMatrix<SparseCSRIndex>(42);
+  const DoubleScalar factor(2.5);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(SparseScale(*sparse, factor).status());
+  }
+  state.SetItemsProcessed(state.iterations() * sparse->non_zero_length());
+}
+
+static void MatMulArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t use_threads : {0, 1}) {
+    for (int64_t num_columns : {0, 16}) {
+      bench->Args({use_threads, num_columns});
+    }
+  }
+  bench->ArgNames({"threads", "columns"})->UseRealTime();
+}
+
+static void SumAxisArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t use_threads : {0, 1}) {
+    for (int64_t axis : {0, 1}) {
+      bench->Args({use_threads, axis});
+    }
+  }
+  bench->ArgNames({"threads", "axis"})->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(SparseMatMulBenchmark, SparseCSRIndex)->Apply(MatMulArgs);
+BENCHMARK_TEMPLATE(SparseMatMulBenchmark, SparseCSCIndex)->Apply(MatMulArgs);
+BENCHMARK_TEMPLATE(SparseAddBenchmark, SparseCSRIndex)
+    ->ArgName("threads")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(SparseMultiplyBenchmark, SparseCSRIndex)
+    ->ArgName("threads")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(SparseSumAxisBenchmark, SparseCSRIndex)->Apply(SumAxisArgs);
+BENCHMARK_TEMPLATE(SparseSumAxisBenchmark, SparseCSCIndex)->Apply(SumAxisArgs);
+BENCHMARK(SparseScaleBenchmark);
+
+}  // namespace arrow
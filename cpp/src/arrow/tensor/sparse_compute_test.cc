@@ -0,0 +1,361 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/scalar.h"
+#include "arrow/sparse_tensor.h"
+#include "arrow/tensor.h"
+#include "arrow/tensor/sparse_compute.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+namespace {
+
+// A tensor owning a copy of `values`
+template <typename T>
+std::shared_ptr<Tensor> MakeTensor(const std::shared_ptr<DataType>& type,
+                                   const std::vector<T>& values,
+                                   const std::vector<int64_t>& shape,
+                                   const std::vector<int64_t>& strides = {}) {
+  std::shared_ptr<Buffer> data;
+  ABORT_NOT_OK(
+      Buffer::Wrap(values)->CopySlice(0, values.size() * sizeof(T)).Value(&data));
+  std::shared_ptr<Tensor> tensor;
+  ABORT_NOT_OK(Tensor::Make(type, data, shape, strides).Value(&tensor));
+  return tensor;
+}
+
+// A dense row-major matrix of doubles, with about `density` non-zero values
+std::shared_ptr<Tensor> RandomMatrix(int64_t n_rows, int64_t n_cols, double density,
+                                     uint32_t seed) {
+  std::default_random_engine engine(seed);
+  std::uniform_real_distribution<double> dist;
+  std::vector<double> values(n_rows * n_cols, 0);
+  for (auto& value : values) {
+    if (dist(engine) < density) {
+      // Small integers keep the sums exact
+      value = static_cast<double>(static_cast<int>(dist(engine) * 10) - 5);
+    }
+  }
+  return MakeTensor(float64(), values, {n_rows, n_cols});
+}
+
+void AssertTensorEqual(const Tensor& expected, const Tensor& actual) {
+  ASSERT_TRUE(expected.Equals(actual));
+}
+
+double Get(const Tensor& tensor, int64_t i, int64_t j) {
+  return tensor.Value<DoubleType>({i, j});
+}
+
+// The product of two dense matrices, or a matrix and a vector
+std::shared_ptr<Tensor> DenseMatMul(const Tensor& left, const Tensor& right) {
+  const int64_t n_rows = left.shape()[0];
+  const int64_t n_inner = left.shape()[1];
+  const int64_t n_cols = right.ndim() == 2 ? right.shape()[1] : 1;
+  std::vector<double> values(n_rows * n_cols, 0);
+  for (int64_t i = 0; i < n_rows; ++i) {
+    for (int64_t j = 0; j < n_cols; ++j) {
+      for (int64_t k = 0; k < n_inner; ++k) {
+        const double right_value = right.ndim() == 2 ? Get(right, k, j)
+                                                     : right.Value<DoubleType>({k});
+        values[i * n_cols + j] += Get(left, i, k) * right_value;
+      }
+    }
+  }
+  std::vector<int64_t> shape{n_rows};
+  if (right.ndim() == 2) {
+    shape.push_back(n_cols);
+  }
+  return MakeTensor(float64(), values, shape);
+}
+
+}  // namespace
+
+template <typename SparseMatrixType>
+class TestSparseMatrixCompute : public ::testing::Test {
+ public:
+  void SetUp() override {
+    left_ = RandomMatrix(67, 43, 0.1, 42);
+    right_ = RandomMatrix(67, 43, 0.1, 43);
+    ASSERT_OK_AND_ASSIGN(sparse_left_, SparseMatrixType::Make(*left_, int32()));
+    ASSERT_OK_AND_ASSIGN(sparse_right_, SparseMatrixType::Make(*right_, int64()));
+  }
+
+  void AssertSparseEquals(const Tensor& expected, const SparseMatrixType& actual) {
+    ASSERT_OK_AND_ASSIGN(auto dense, actual.ToTensor());
+    AssertTensorEqual(expected, *dense);
+    // Only non-zero values are stored
+    ASSERT_OK_AND_ASSIGN(auto resparsified, SparseMatrixType::Make(expected));
+    ASSERT_EQ(resparsified->non_zero_length(), actual.non_zero_length());
+  }
+
+ protected:
+  std::shared_ptr<Tensor> left_;
+  std::shared_ptr<Tensor> right_;
+  std::shared_ptr<SparseMatrixType> sparse_left_;
+  std::shared_ptr<SparseMatrixType> sparse_right_;
+};
+
+using SparseMatrixTypes = ::testing::Types<SparseCSRMatrix, SparseCSCMatrix>;
+
+TYPED_TEST_SUITE(TestSparseMatrixCompute, SparseMatrixTypes);
+
+TYPED_TEST(TestSparseMatrixCompute, MatMulVector) {
+  auto vector = MakeTensor(float64(), std::vector<double>(43, 0.5), {43});
+  auto expected = DenseMatMul(*this->left_, *vector);
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         SparseMatMul(*this->sparse_left_, *vector, use_threads));
+    AssertTensorEqual(*expected, *actual);
+  }
+}
+
+TYPED_TEST(TestSparseMatrixCompute, MatMulMatrix) {
+  auto dense = RandomMatrix(43, 7, 0.8, 44);
+  auto expected = DenseMatMul(*this->left_, *dense);
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         SparseMatMul(*this->sparse_left_, *dense, use_threads));
+    AssertTensorEqual(*expected, *actual);
+  }
+
+  // Column-major dense operand
+  std::vector<double> values(43 * 7);
+  for (int64_t i = 0; i < 43; ++i) {
+    for (int64_t j = 0; j < 7; ++j) {
+      values[j * 43 + i] = Get(*dense, i, j);
+    }
+  }
+  auto column_major =
+      MakeTensor(float64(), values, {43, 7}, {sizeof(double), 43 * sizeof(double)});
+  ASSERT_OK_AND_ASSIGN(auto actual, SparseMatMul(*this->sparse_left_, *column_major));
+  AssertTensorEqual(*expected, *actual);
+}
+
+TYPED_TEST(TestSparseMatrixCompute, MatMulInvalid) {
+  auto wrong_shape = RandomMatrix(42, 7, 0.8, 44);
+  ASSERT_RAISES(Invalid, SparseMatMul(*this->sparse_left_, *wrong_shape));
+
+  auto wrong_type = MakeTensor(float32(), std::vector<float>(43, 0.5), {43});
+  ASSERT_RAISES(TypeError, SparseMatMul(*this->sparse_left_, *wrong_type));
+}
+
+TYPED_TEST(TestSparseMatrixCompute, Scale) {
+  std::vector<double> values(67 * 43);
+  for (int64_t i = 0; i < 67; ++i) {
+    for (int64_t j = 0; j < 43; ++j) {
+      values[i * 43 + j] = Get(*this->left_, i, j) * 3;
+    }
+  }
+  auto expected = MakeTensor(float64(), values, {67, 43});
+
+  ASSERT_OK_AND_ASSIGN(auto actual, SparseScale(*this->sparse_left_, Int32Scalar(3)));
+  this->AssertSparseEquals(*expected, *actual);
+  ASSERT_EQ(this->sparse_left_->sparse_index(), actual->sparse_index());
+
+  ASSERT_RAISES(Invalid, SparseScale(*this->sparse_left_, DoubleScalar()));
+}
+
+TYPED_TEST(TestSparseMatrixCompute, AddAndMultiply) {
+  std::vector<double> sums(67 * 43), products(67 * 43);
+  for (int64_t i = 0; i < 67; ++i) {
+    for (int64_t j = 0; j < 43; ++j) {
+      sums[i * 43 + j] = Get(*this->left_, i, j) + Get(*this->right_, i, j);
+      // Adding zero turns negative zeros into (non-stored) positive zeros
+      products[i * 43 + j] = Get(*this->left_, i, j) * Get(*this->right_, i, j) + 0.0;
+    }
+  }
+  auto expected_sum = MakeTensor(float64(), sums, {67, 43});
+  auto expected_product = MakeTensor(float64(), products, {67, 43});
+
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(
+        auto sum, SparseAdd(*this->sparse_left_, *this->sparse_right_, use_threads));
+    this->AssertSparseEquals(*expected_sum, *sum);
+    ASSERT_OK_AND_ASSIGN(auto product, SparseMultiply(*this->sparse_left_,
+                                                      *this->sparse_right_, use_threads));
+    this->AssertSparseEquals(*expected_product, *product);
+  }
+
+  // Values cancelling out are not stored
+  ASSERT_OK_AND_ASSIGN(auto negated, SparseScale(*this->sparse_left_, DoubleScalar(-1)));
+  ASSERT_OK_AND_ASSIGN(auto zero, SparseAdd(*this->sparse_left_, *negated));
+  ASSERT_EQ(0, zero->non_zero_length());
+}
+
+TYPED_TEST(TestSparseMatrixCompute, AddInvalid) {
+  auto other = RandomMatrix(43, 67, 0.1, 45);
+  ASSERT_OK_AND_ASSIGN(auto wrong_shape, TypeParam::Make(*other));
+  ASSERT_RAISES(Invalid, SparseAdd(*this->sparse_left_, *wrong_shape));
+
+  auto ints = MakeTensor(int64(), std::vector<int64_t>(67 * 43, 1), {67, 43});
+  ASSERT_OK_AND_ASSIGN(auto wrong_type, TypeParam::Make(*ints));
+  ASSERT_RAISES(TypeError, SparseMultiply(*this->sparse_left_, *wrong_type));
+}
+
+TYPED_TEST(TestSparseMatrixCompute, Sum) {
+  double total = 0;
+  std::vector<double> row_sums(67, 0), column_sums(43, 0);
+  for (int64_t i = 0; i < 67; ++i) {
+    for (int64_t j = 0; j < 43; ++j) {
+      total += Get(*this->left_, i, j);
+      row_sums[i] += Get(*this->left_, i, j);
+      column_sums[j] += Get(*this->left_, i, j);
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto sum, SparseSum(*this->sparse_left_));
+  AssertScalarsEqual(DoubleScalar(total), *sum);
+
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto actual, SparseSum(*this->sparse_left_, 0, use_threads));
+    AssertTensorEqual(*MakeTensor(float64(), column_sums, {43}), *actual);
+    ASSERT_OK_AND_ASSIGN(actual, SparseSum(*this->sparse_left_, 1, use_threads));
+    AssertTensorEqual(*MakeTensor(float64(), row_sums, {67}), *actual);
+  }
+
+  ASSERT_RAISES(Invalid, SparseSum(*this->sparse_left_, 2));
+}
+
+TYPED_TEST(TestSparseMatrixCompute, EmptyShapes) {
+  for (auto shape : std::vector<std::vector<int64_t>>{{0, 5}, {5, 0}, {0, 0}}) {
+    auto dense = MakeTensor(float64(), std::vector<double>{}, shape);
+    ASSERT_OK_AND_ASSIGN(auto sparse, TypeParam::Make(*dense));
+    for (bool use_threads : {false, true}) {
+      for (int64_t n_cols : {3, 0}) {
+        auto right = MakeTensor(float64(), std::vector<double>(shape[1] * n_cols, 1.0),
+                                {shape[1], n_cols});
+        ASSERT_OK_AND_ASSIGN(auto actual, SparseMatMul(*sparse, *right, use_threads));
+        AssertTensorEqual(*DenseMatMul(*dense, *right), *actual);
+      }
+      for (int axis : {0, 1}) {
+        const int64_t length = shape[1 - axis];
+        auto expected = MakeTensor(float64(), std::vector<double>(length, 0), {length});
+        ASSERT_OK_AND_ASSIGN(auto actual, SparseSum(*sparse, axis, use_threads));
+        AssertTensorEqual(*expected, *actual);
+      }
+    }
+  }
+
+  // A product without columns
+  auto right = MakeTensor(float64(), std::vector<double>{}, {43, 0});
+  ASSERT_OK_AND_ASSIGN(auto actual, SparseMatMul(*this->sparse_left_, *right));
+  AssertTensorEqual(*MakeTensor(float64(), std::vector<double>{}, {67, 0}), *actual);
+}
+
+TYPED_TEST(TestSparseMatrixCompute, Parallel) {
+  // Large enough to be split in several tasks
+  auto left = RandomMatrix(2000, 1000, 0.1, 46);
+  auto right = RandomMatrix(2000, 1000, 0.1, 47);
+  ASSERT_OK_AND_ASSIGN(auto sparse_left, TypeParam::Make(*left));
+  ASSERT_OK_AND_ASSIGN(auto sparse_right, TypeParam::Make(*right));
+  auto dense = RandomMatrix(1000, 3, 0.8, 48);
+
+  ASSERT_OK_AND_ASSIGN(auto expected, SparseMatMul(*sparse_left, *dense, false));
+  ASSERT_OK_AND_ASSIGN(auto actual, SparseMatMul(*sparse_left, *dense, true));
+  AssertTensorEqual(*expected, *actual);
+
+  for (int axis : {0, 1}) {
+    ASSERT_OK_AND_ASSIGN(expected, SparseSum(*sparse_left, axis, false));
+    ASSERT_OK_AND_ASSIGN(actual, SparseSum(*sparse_left, axis, true));
+    AssertTensorEqual(*expected, *actual);
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto expected_sum, SparseAdd(*sparse_left, *sparse_right, false));
+  ASSERT_OK_AND_ASSIGN(auto actual_sum, SparseAdd(*sparse_left, *sparse_right, true));
+  ASSERT_TRUE(expected_sum->Equals(*actual_sum));
+
+  // Called from CPU thread pool tasks, the computations run inline rather
+  // than waiting for tasks queued behind them
+  auto pool = internal::GetCpuThreadPool();
+  std::vector<Future<std::shared_ptr<Tensor>>> futures;
+  for (int i = 0; i < pool->GetCapacity() + 1; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto future, pool->Submit([&]() {
+      return SparseMatMul(*sparse_left, *dense, /*use_threads=*/true);
+    }));
+    futures.push_back(std::move(future));
+  }
+  ASSERT_OK_AND_ASSIGN(expected, SparseMatMul(*sparse_left, *dense, false));
+  for (auto& future : futures) {
+    ASSERT_OK_AND_ASSIGN(actual, future.result());
+    AssertTensorEqual(*expected, *actual);
+  }
+}
+
+TEST(TestSparseCompute, IntegerValues) {
+  std::vector<int16_t> values = {1, 0, 2, 0, 0, 3, 4, 5, 0, 0, 0, 6};
+  auto dense = MakeTensor(int16(), values, {3, 4});
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*dense, int8()));
+
+  ASSERT_OK_AND_ASSIGN(auto sum, SparseSum(*csr));
+  AssertScalarsEqual(Int64Scalar(21), *sum);
+
+  ASSERT_OK_AND_ASSIGN(auto row_sums, SparseSum(*csr, 1));
+  AssertTensorEqual(*MakeTensor(int64(), std::vector<int64_t>{3, 12, 6}, {3}),
+                    *row_sums);
+
+  auto vector = MakeTensor(int16(), std::vector<int16_t>{1, 2, 3, 4}, {4});
+  ASSERT_OK_AND_ASSIGN(auto product, SparseMatMul(*csr, *vector));
+  AssertTensorEqual(*MakeTensor(int16(), std::vector<int16_t>{7, 38, 24}, {3}),
+                    *product);
+
+  ASSERT_OK_AND_ASSIGN(auto squared, SparseMultiply(*csr, *csr));
+  ASSERT_OK_AND_ASSIGN(auto squared_sum, SparseSum(*squared));
+  AssertScalarsEqual(Int64Scalar(91), *squared_sum);
+}
+
+TEST(TestSparseCompute, SparseTensors) {
+  std::vector<float> values = {1, 0, 0, 2, 0, 0, 0, 3, 4, 0, 0, 0,
+                               0, 5, 0, 0, 0, 0, 6, 0, 0, 0, 0, 7};
+  auto dense = MakeTensor(float32(), values, {2, 3, 4});
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(*dense));
+  ASSERT_OK_AND_ASSIGN(auto csf, SparseCSFTensor::Make(*dense));
+
+  ASSERT_OK_AND_ASSIGN(auto sum, SparseSum(*coo));
+  AssertScalarsEqual(DoubleScalar(28), *sum);
+  ASSERT_OK_AND_ASSIGN(sum, SparseSum(*csf));
+  AssertScalarsEqual(DoubleScalar(28), *sum);
+
+  ASSERT_OK_AND_ASSIGN(auto scaled_coo, SparseScale(*coo, DoubleScalar(0.5)));
+  ASSERT_OK_AND_ASSIGN(auto scaled_csf, SparseScale(*csf, DoubleScalar(0.5)));
+  for (auto& value : values) {
+    value /= 2;
+  }
+  auto expected = MakeTensor(float32(), values, {2, 3, 4});
+  ASSERT_OK_AND_ASSIGN(auto actual, scaled_coo->ToTensor());
+  AssertTensorEqual(*expected, *actual);
+  ASSERT_OK_AND_ASSIGN(actual, scaled_csf->ToTensor());
+  AssertTensorEqual(*expected, *actual);
+}
+
+TEST(TestSparseCompute, UnsupportedValueType) {
+  auto dense = MakeTensor(float16(), std::vector<uint16_t>{1, 0, 0, 1}, {2, 2});
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*dense));
+  ASSERT_RAISES(NotImplemented, SparseSum(*csr));
+}
+
+}  // namespace arrow
@@ -125,6 +125,7 @@ static struct {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
     {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -235,6 +236,13 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+
+  // AVX2 also needs AVX to be enabled by the OS (OSXSAVE and AVX bits)
+  if (highest_valid_id >= 7 && features_ECX[27] && features_ECX[28]) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    std::bitset<32> features_EBX = cpu_info[1];
+    if (features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  }
   return true;
 }
 #endif
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace internal {
+
+constexpr int HyperLogLog::kMinPrecision;
+constexpr int HyperLogLog::kMaxPrecision;
+
+HyperLogLog::HyperLogLog(int precision)
+    : precision_(precision), registers_(size_t(1) << precision, 0) {
+  DCHECK_GE(precision, kMinPrecision);
+  DCHECK_LE(precision, kMaxPrecision);
+}
+
+void HyperLogLog::Merge(const HyperLogLog& other) {
+  DCHECK_EQ(precision_, other.precision_);
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+}
+
+int64_t HyperLogLog::Estimate() const {
+  const double m = static_cast<double>(registers_.size());
+  double alpha;
+  switch (precision_) {
+    case 4:
+      alpha = 0.673;
+      break;
+    case 5:
+      alpha = 0.697;
+      break;
+    case 6:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1 + 1.079 / m);
+      break;
+  }
+
+  double sum = 0;
+  int64_t num_zeros = 0;
+  for (uint8_t reg : registers_) {
+    sum += std::ldexp(1.0, -reg);
+    num_zeros += reg == 0;
+  }
+  double estimate = alpha * m * m / sum;
+  if (estimate <= 2.5 * m && num_zeros > 0) {
+    // Small range correction: linear counting
+    estimate = m * std::log(m / static_cast<double>(num_zeros));
+  }
+  // With 64-bit hashes, no large range correction is needed
+  return static_cast<int64_t>(std::llround(estimate));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// HyperLogLog sketch for approximate distinct counting
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A HyperLogLog sketch estimating the number of distinct values
+///
+/// Values are added as 64-bit hashes (for instance as computed by
+/// ScalarHelper::ComputeHash or ComputeStringHash), which are further mixed so
+/// that hashes with poor dispersion in their high bits can be used.  The
+/// sketch uses 2^precision one-byte registers, and the standard error of the
+/// estimate is about 1.04 / sqrt(2^precision).  Sketches with the same
+/// precision can be merged.
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+
+  explicit HyperLogLog(int precision);
+
+  int precision() const { return precision_; }
+
+  void Add(uint64_t hash) {
+    hash = Mix(hash);
+    const uint64_t index = hash >> (64 - precision_);
+    // Set a sentinel bit so that the rank is at most 64 - precision + 1
+    const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    const auto rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  /// \brief Merge another sketch of the same precision into this one
+  void Merge(const HyperLogLog& other);
+
+  /// \brief Estimate the number of distinct values added
+  int64_t Estimate() const;
+
+ private:
+  // The finalizer of MurmurHash3
+  static uint64_t Mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace internal
+}  // namespace arrow
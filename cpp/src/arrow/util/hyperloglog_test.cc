@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(HyperLogLogTest, Empty) {
+  HyperLogLog hll(12);
+  ASSERT_EQ(12, hll.precision());
+  ASSERT_EQ(0, hll.Estimate());
+}
+
+TEST(HyperLogLogTest, SmallCardinality) {
+  HyperLogLog hll(12);
+  for (int rep = 0; rep < 3; ++rep) {
+    for (int64_t i = 0; i < 10; ++i) {
+      hll.Add(ScalarHelper<int64_t, 0>::ComputeHash(i));
+    }
+  }
+  // Linear counting is exact in practice for so few values
+  ASSERT_EQ(10, hll.Estimate());
+}
+
+TEST(HyperLogLogTest, LargeCardinality) {
+  for (int precision : {8, 12, 16}) {
+    // Standard error is 1.04 / sqrt(2^precision); allow 4 standard errors
+    const double tolerance = 4 * 1.04 / std::sqrt(1 << precision);
+    for (int64_t n : {1000, 50000, 1000000}) {
+      HyperLogLog hll(precision);
+      for (int64_t i = 0; i < n; ++i) {
+        hll.Add(ScalarHelper<int64_t, 0>::ComputeHash(i));
+      }
+      ASSERT_NEAR(n, hll.Estimate(), tolerance * n)
+          << "precision = " << precision << ", n = " << n;
+    }
+  }
+}
+
+TEST(HyperLogLogTest, Merge) {
+  HyperLogLog left(14), right(14), both(14);
+  for (int64_t i = 0; i < 30000; ++i) {
+    const auto hash = ScalarHelper<int64_t, 0>::ComputeHash(i);
+    (i < 20000 ? left : right).Add(hash);
+    both.Add(hash);
+  }
+  // Overlapping values are only counted once
+  for (int64_t i = 10000; i < 20000; ++i) {
+    right.Add(ScalarHelper<int64_t, 0>::ComputeHash(i));
+  }
+  left.Merge(right);
+  ASSERT_EQ(both.Estimate(), left.Estimate());
+}
+
+}  // namespace internal
+}  // namespace arrow
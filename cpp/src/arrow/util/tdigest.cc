@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tdigest.h"
+
+#include <algorithm>
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// The k1 scale function of the t-digest paper and its inverse.  Centroids
+// may only span a unit of k, which keeps them small near q = 0 and q = 1
+double ScaleK(double q, uint32_t delta) {
+  return delta / (2 * kPi) * std::asin(2 * q - 1);
+}
+
+double ScaleQ(double k, uint32_t delta) {
+  return (std::sin(std::min(k * 2 * kPi / delta, kPi / 2)) + 1) / 2;
+}
+
+}  // namespace
+
+TDigest::TDigest(uint32_t delta, uint32_t buffer_size)
+    : delta_(delta), buffer_size_(std::max<uint32_t>(buffer_size, 1)) {
+  DCHECK_GE(delta, 10);
+}
+
+void TDigest::MergeBuffer() {
+  if (buffer_.empty()) {
+    return;
+  }
+  buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+  std::sort(buffer_.begin(), buffer_.end(),
+            [](const Centroid& l, const Centroid& r) { return l.mean < r.mean; });
+
+  double total_weight = 0;
+  for (const auto& c : buffer_) {
+    total_weight += c.weight;
+  }
+
+  centroids_.clear();
+  Centroid current = buffer_[0];
+  double weight_so_far = 0;
+  double q_limit = ScaleQ(ScaleK(0, delta_) + 1, delta_);
+  for (size_t i = 1; i < buffer_.size(); ++i) {
+    const Centroid& next = buffer_[i];
+    const double q = (weight_so_far + current.weight + next.weight) / total_weight;
+    if (q <= q_limit) {
+      // Absorb the next point into the current centroid
+      current.weight += next.weight;
+      current.mean += (next.mean - current.mean) * next.weight / current.weight;
+    } else {
+      centroids_.push_back(current);
+      weight_so_far += current.weight;
+      q_limit = ScaleQ(ScaleK(weight_so_far / total_weight, delta_) + 1, delta_);
+      current = next;
+    }
+  }
+  centroids_.push_back(current);
+  total_weight_ = total_weight;
+  buffer_.clear();
+}
+
+void TDigest::Merge(const TDigest& other) {
+  buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+  buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+  min_ = std::fmin(min_, other.min_);
+  max_ = std::fmax(max_, other.max_);
+  MergeBuffer();
+}
+
+double TDigest::Quantile(double q) {
+  MergeBuffer();
+  if (centroids_.empty()) {
+    return NAN;
+  }
+  if (q <= 0) {
+    return min_;
+  }
+  if (q >= 1) {
+    return max_;
+  }
+  if (centroids_.size() == 1) {
+    return centroids_[0].mean;
+  }
+
+  // Each centroid's weight is centered on its mean; interpolate linearly
+  // between the centers of the neighbouring centroids, and between the
+  // outermost centroids and the extreme values
+  const double index = q * total_weight_;
+  const Centroid& first = centroids_.front();
+  if (index < first.weight / 2) {
+    return min_ + (first.mean - min_) * index / (first.weight / 2);
+  }
+  double center = first.weight / 2;
+  for (size_t i = 1; i < centroids_.size(); ++i) {
+    const Centroid& left = centroids_[i - 1];
+    const Centroid& right = centroids_[i];
+    const double next_center = center + (left.weight + right.weight) / 2;
+    if (index < next_center) {
+      return left.mean + (right.mean - left.mean) * (index - center) /
+                             (next_center - center);
+    }
+    center = next_center;
+  }
+  const Centroid& last = centroids_.back();
+  const double remaining = total_weight_ - center;
+  if (remaining <= 0) {
+    return last.mean;
+  }
+  return last.mean + (max_ - last.mean) * (index - center) / remaining;
+}
+
+}  // namespace internal
+}  // namespace arrow
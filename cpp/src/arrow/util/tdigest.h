@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// t-digest sketch for approximate quantiles
+//
+// See "Computing Extremely Accurate Quantiles Using t-Digests"
+// by Ted Dunning and Otmar Ertl.
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief A merging t-digest estimating quantiles of a stream of values
+///
+/// Values are buffered and periodically merged into a sorted list of
+/// centroids, whose number is bounded by about `delta` (the compression
+/// parameter).  Centroids near the tails are kept small, so that extreme
+/// quantiles are more accurate than central ones.  Digests can be merged.
+class ARROW_EXPORT TDigest {
+ public:
+  explicit TDigest(uint32_t delta = 100, uint32_t buffer_size = 500);
+
+  /// \brief Add a value, which must not be NaN
+  void Add(double value) {
+    DCHECK(!std::isnan(value));
+    if (buffer_.size() >= buffer_size_) {
+      MergeBuffer();
+    }
+    buffer_.push_back({value, 1.0});
+    min_ = std::fmin(min_, value);
+    max_ = std::fmax(max_, value);
+  }
+
+  /// \brief Merge another digest into this one
+  void Merge(const TDigest& other);
+
+  /// \brief Estimate the q-th quantile, for q in [0, 1]
+  ///
+  /// Returns NaN if no values were added.
+  double Quantile(double q);
+
+  bool is_empty() const { return centroids_.empty() && buffer_.empty(); }
+
+  /// \brief The number of centroids after merging all buffered values
+  size_t num_centroids() {
+    MergeBuffer();
+    return centroids_.size();
+  }
+
+ private:
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  // Merge the buffered values (and centroids) into the centroids
+  void MergeBuffer();
+
+  uint32_t delta_;
+  size_t buffer_size_;
+  std::vector<Centroid> centroids_;
+  std::vector<Centroid> buffer_;
+  double total_weight_ = 0;
+  double min_ = INFINITY;
+  double max_ = -INFINITY;
+};
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace internal {
+
+TEST(TDigestTest, Empty) {
+  TDigest td;
+  ASSERT_TRUE(td.is_empty());
+  ASSERT_TRUE(std::isnan(td.Quantile(0.5)));
+}
+
+TEST(TDigestTest, Basics) {
+  TDigest td;
+  for (double value : {3.0, 1.0, 5.0, 2.0, 4.0}) {
+    td.Add(value);
+  }
+  ASSERT_FALSE(td.is_empty());
+  ASSERT_EQ(1.0, td.Quantile(0));
+  ASSERT_EQ(5.0, td.Quantile(1));
+  ASSERT_EQ(3.0, td.Quantile(0.5));
+}
+
+TEST(TDigestTest, RandomValues) {
+  std::default_random_engine rng(42);
+  std::normal_distribution<double> dist(0, 1);
+  std::vector<double> values(100000);
+  std::generate(values.begin(), values.end(), [&] { return dist(rng); });
+
+  // Split the values between several digests, then merge them
+  TDigest td;
+  std::vector<TDigest> parts(4);
+  for (size_t i = 0; i < values.size(); ++i) {
+    parts[i % parts.size()].Add(values[i]);
+  }
+  for (const auto& part : parts) {
+    td.Merge(part);
+  }
+  // The number of centroids is bounded by delta
+  ASSERT_LE(td.num_centroids(), static_cast<size_t>(100));
+
+  std::sort(values.begin(), values.end());
+  for (double q : {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999}) {
+    const double expected = values[static_cast<size_t>(q * (values.size() - 1))];
+    // Compare ranks rather than values, the error being bounded in rank
+    const double estimate = td.Quantile(q);
+    const auto rank = std::lower_bound(values.begin(), values.end(), estimate) -
+                      values.begin();
+    const double rank_error =
+        std::abs(static_cast<double>(rank) / values.size() - q);
+    ASSERT_LT(rank_error, 0.005) << "q = " << q << ", expected " << expected
+                                 << ", got " << estimate;
+  }
+  ASSERT_EQ(values.front(), td.Quantile(0));
+  ASSERT_EQ(values.back(), td.Quantile(1));
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -181,6 +181,11 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // match this value.
   int GetCapacity() override;
 
+  // Return whether the calling thread is a worker of this pool.  Tasks
+  // running on the pool should not block on other tasks submitted to it,
+  // as all workers could end up waiting.
+  bool OwnsThisThread();
+
   // Dynamically change the number of worker threads.
   // This function returns quickly, but it may take more time before the
   // thread count is fully adjusted.
@@ -16,14 +16,18 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <utility>
 
 #include "arrow/result.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/utf8.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/vendored/utf8cpp/checked.h"
 
 namespace arrow {
@@ -75,6 +79,100 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+#if defined(ARROW_HAVE_SSE4_2)
+namespace {
+
+// See utf8_internal.h for a description of the algorithm
+class UTF8ValidatorSse42 {
+ public:
+  static constexpr int64_t kBlockSize = 16;
+
+  UTF8ValidatorSse42()
+      : byte_1_high_(Load(kUTF8Byte1High)),
+        byte_1_low_(Load(kUTF8Byte1Low)),
+        byte_2_high_(Load(kUTF8Byte2High)),
+        max_incomplete_(Load(kUTF8MaxIncomplete + 32 - kBlockSize)),
+        error_(_mm_setzero_si128()),
+        prev_input_(_mm_setzero_si128()),
+        prev_incomplete_(_mm_setzero_si128()) {}
+
+  void Consume(const uint8_t* data) {
+    const __m128i input = Load(data);
+    if (_mm_movemask_epi8(input) == 0) {
+      // Only ASCII: the previous block must not end with an incomplete sequence
+      error_ = _mm_or_si128(error_, prev_incomplete_);
+    } else {
+      const __m128i low_nibble_mask = _mm_set1_epi8(0x0F);
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input_, kBlockSize - 1);
+      const __m128i prev1_high =
+          _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble_mask);
+      const __m128i input_high = _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask);
+      const __m128i prev1_low = _mm_and_si128(prev1, low_nibble_mask);
+      const __m128i special_cases =
+          _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(byte_1_high_, prev1_high),
+                                      _mm_shuffle_epi8(byte_1_low_, prev1_low)),
+                        _mm_shuffle_epi8(byte_2_high_, input_high));
+
+      // Bytes following a 3- or 4-byte lead must be continuations, which the
+      // tables above report as "two continuations" (the 0x80 bit)
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input_, kBlockSize - 2);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input_, kBlockSize - 3);
+      const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+      const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+      const __m128i must_be_continuation = _mm_and_si128(
+          _mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(-0x80));
+      error_ = _mm_or_si128(error_, _mm_xor_si128(must_be_continuation, special_cases));
+
+      prev_incomplete_ = _mm_subs_epu8(input, max_incomplete_);
+    }
+    prev_input_ = input;
+  }
+
+  bool Finish(const uint8_t* tail, int64_t tail_size) {
+    DCHECK_LT(tail_size, kBlockSize);
+    // Padding with zeros also flags any sequence left incomplete
+    uint8_t block[kBlockSize] = {};
+    std::memcpy(block, tail, static_cast<size_t>(tail_size));
+    Consume(block);
+    return _mm_testz_si128(error_, error_) != 0;
+  }
+
+ private:
+  static __m128i Load(const uint8_t* data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  const __m128i byte_1_high_, byte_1_low_, byte_2_high_, max_incomplete_;
+  __m128i error_, prev_input_, prev_incomplete_;
+};
+
+bool ValidateUTF8Sse42(const uint8_t* data, int64_t size) {
+  UTF8ValidatorSse42 validator;
+  while (size >= UTF8ValidatorSse42::kBlockSize) {
+    validator.Consume(data);
+    data += UTF8ValidatorSse42::kBlockSize;
+    size -= UTF8ValidatorSse42::kBlockSize;
+  }
+  return validator.Finish(data, size);
+}
+
+}  // namespace
+#endif  // ARROW_HAVE_SSE4_2
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  using ::arrow::internal::CpuInfo;
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    return ValidateUTF8Avx2(data, size);
+  }
+#endif
+#if defined(ARROW_HAVE_SSE4_2)
+  return ValidateUTF8Sse42(data, size);
+#else
+  return ValidateUTF8Inline(data, size);
+#endif
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This file is compiled with AVX2 enabled, and its functions must only be
+// called after checking for AVX2 support at runtime.
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/utf8_internal.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+namespace {
+
+// See utf8_internal.h for a description of the algorithm
+class UTF8ValidatorAvx2 {
+ public:
+  static constexpr int64_t kBlockSize = 32;
+
+  UTF8ValidatorAvx2()
+      : byte_1_high_(LoadTable(kUTF8Byte1High)),
+        byte_1_low_(LoadTable(kUTF8Byte1Low)),
+        byte_2_high_(LoadTable(kUTF8Byte2High)),
+        max_incomplete_(Load(kUTF8MaxIncomplete)),
+        error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()) {}
+
+  void Consume(const uint8_t* data) {
+    const __m256i input = Load(data);
+    if (_mm256_movemask_epi8(input) == 0) {
+      // Only ASCII: the previous block must not end with an incomplete sequence
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+    } else {
+      const __m256i low_nibble_mask = _mm256_set1_epi8(0x0F);
+      // The previous block's high lane followed by this block's low lane, to
+      // shift bytes in from the previous block
+      const __m256i prev_lanes = _mm256_permute2x128_si256(prev_input_, input, 0x21);
+      const __m256i prev1 = _mm256_alignr_epi8(input, prev_lanes, 16 - 1);
+      const __m256i prev1_high =
+          _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble_mask);
+      const __m256i prev1_low = _mm256_and_si256(prev1, low_nibble_mask);
+      const __m256i input_high =
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask);
+      const __m256i special_cases = _mm256_and_si256(
+          _mm256_and_si256(_mm256_shuffle_epi8(byte_1_high_, prev1_high),
+                           _mm256_shuffle_epi8(byte_1_low_, prev1_low)),
+          _mm256_shuffle_epi8(byte_2_high_, input_high));
+
+      // Bytes following a 3- or 4-byte lead must be continuations, which the
+      // tables above report as "two continuations" (the 0x80 bit)
+      const __m256i prev2 = _mm256_alignr_epi8(input, prev_lanes, 16 - 2);
+      const __m256i prev3 = _mm256_alignr_epi8(input, prev_lanes, 16 - 3);
+      const __m256i is_third_byte =
+          _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80));
+      const __m256i is_fourth_byte =
+          _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80));
+      const __m256i must_be_continuation = _mm256_and_si256(
+          _mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(-0x80));
+      error_ =
+          _mm256_or_si256(error_, _mm256_xor_si256(must_be_continuation, special_cases));
+
+      prev_incomplete_ = _mm256_subs_epu8(input, max_incomplete_);
+    }
+    prev_input_ = input;
+  }
+
+  bool Finish(const uint8_t* tail, int64_t tail_size) {
+    DCHECK_LT(tail_size, kBlockSize);
+    // Padding with zeros also flags any sequence left incomplete
+    uint8_t block[kBlockSize] = {};
+    std::memcpy(block, tail, static_cast<size_t>(tail_size));
+    Consume(block);
+    return _mm256_testz_si256(error_, error_) != 0;
+  }
+
+ private:
+  static __m256i Load(const uint8_t* data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+  }
+
+  // Load a 16-entry table into both lanes
+  static __m256i LoadTable(const uint8_t* table) {
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+  }
+
+  const __m256i byte_1_high_, byte_1_low_, byte_2_high_, max_incomplete_;
+  __m256i error_, prev_input_, prev_incomplete_;
+};
+
+}  // namespace
+
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  UTF8ValidatorAvx2 validator;
+  while (size >= UTF8ValidatorAvx2::kBlockSize) {
+    validator.Consume(data);
+    data += UTF8ValidatorAvx2::kBlockSize;
+    size -= UTF8ValidatorAvx2::kBlockSize;
+  }
+  return validator.Finish(data, size);
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Lookup tables shared by the SIMD UTF8 validators
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// The SIMD validators implement the "lookup" algorithm from
+// J. Keiser, D. Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"
+// (https://arxiv.org/abs/2010.03090).
+//
+// Each pair of consecutive bytes is classified through three 16-entry tables,
+// indexed by the high nibble of the first byte, the low nibble of the first
+// byte and the high nibble of the second byte.  Each table entry is a bitmask
+// of the errors the pair could be part of; the pair is invalid if the three
+// masks have a bit in common.  Missing or extraneous continuation bytes after
+// 3- and 4-byte leads are then checked separately.
+
+// 11______ 0_______ or 11______ 11______
+static constexpr uint8_t kUTF8TooShort = 1 << 0;
+// 0_______ 10______
+static constexpr uint8_t kUTF8TooLong = 1 << 1;
+// 11100000 100_____
+static constexpr uint8_t kUTF8Overlong3 = 1 << 2;
+// 11110100 1001____, 11110100 101_____, 111101__ 1001____, ...
+static constexpr uint8_t kUTF8TooLarge = 1 << 3;
+// 11101101 101_____
+static constexpr uint8_t kUTF8Surrogate = 1 << 4;
+// 1100000_ 10______
+static constexpr uint8_t kUTF8Overlong2 = 1 << 5;
+// 11110101 1000____, 1111011_ 1000____, 11111___ 1000____
+static constexpr uint8_t kUTF8TooLarge1000 = 1 << 6;
+// 11110000 1000____
+static constexpr uint8_t kUTF8Overlong4 = 1 << 6;
+// 10______ 10______
+static constexpr uint8_t kUTF8TwoConts = 1 << 7;
+// These errors don't depend on the low nibble of the first byte
+static constexpr uint8_t kUTF8Carry = kUTF8TooShort | kUTF8TooLong | kUTF8TwoConts;
+
+// Indexed by the high nibble of the first byte
+static constexpr uint8_t kUTF8Byte1High[16] = {
+    // 0_______ ________
+    kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong, kUTF8TooLong,
+    kUTF8TooLong, kUTF8TooLong,
+    // 10______ ________
+    kUTF8TwoConts, kUTF8TwoConts, kUTF8TwoConts, kUTF8TwoConts,
+    // 1100____ ________
+    kUTF8TooShort | kUTF8Overlong2,
+    // 1101____ ________
+    kUTF8TooShort,
+    // 1110____ ________
+    kUTF8TooShort | kUTF8Overlong3 | kUTF8Surrogate,
+    // 1111____ ________
+    kUTF8TooShort | kUTF8TooLarge | kUTF8TooLarge1000 | kUTF8Overlong4};
+
+// Indexed by the low nibble of the first byte
+static constexpr uint8_t kUTF8Byte1Low[16] = {
+    // ____0000 ________
+    kUTF8Carry | kUTF8Overlong3 | kUTF8Overlong2 | kUTF8Overlong4,
+    // ____0001 ________
+    kUTF8Carry | kUTF8Overlong2,
+    // ____001_ ________
+    kUTF8Carry, kUTF8Carry,
+    // ____0100 ________
+    kUTF8Carry | kUTF8TooLarge,
+    // ____0101 ________ to ____1100 ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    // ____1101 ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000 | kUTF8Surrogate,
+    // ____111_ ________
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000,
+    kUTF8Carry | kUTF8TooLarge | kUTF8TooLarge1000};
+
+// Indexed by the high nibble of the second byte
+static constexpr uint8_t kUTF8Byte2High[16] = {
+    // ________ 0_______
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort,
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort,
+    // ________ 1000____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Overlong3 | kUTF8TooLarge1000 |
+        kUTF8Overlong4,
+    // ________ 1001____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Overlong3 | kUTF8TooLarge,
+    // ________ 101_____
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Surrogate | kUTF8TooLarge,
+    kUTF8TooLong | kUTF8Overlong2 | kUTF8TwoConts | kUTF8Surrogate | kUTF8TooLarge,
+    // ________ 11______
+    kUTF8TooShort, kUTF8TooShort, kUTF8TooShort, kUTF8TooShort};
+
+// A block ends with an incomplete sequence if its third to last, second to last
+// or last byte is a lead byte of a 4-, 3-or-more or 2-or-more byte sequence,
+// i.e. if any byte is larger than the corresponding entry of this table.
+static constexpr uint8_t kUTF8MaxIncomplete[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// Defined in utf8_avx2.cc, compiled for AVX2.  Only call this if
+// CpuInfo reports AVX2 support.
+bool ValidateUTF8Avx2(const uint8_t* data, int64_t size);
+#endif
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
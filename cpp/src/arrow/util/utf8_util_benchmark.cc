@@ -50,6 +50,7 @@ static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   return s;
 }
 
+template <bool (*Validate)(const uint8_t*, int64_t) = ValidateUTF8>
 static void BenchmarkUTF8Validation(
     benchmark::State& state,  // NOLINT non-const reference
     const std::string& s, bool expected) {
@@ -57,14 +58,14 @@ static void BenchmarkUTF8Validation(
   auto data_size = static_cast<int64_t>(s.size());
 
   InitializeUTF8();
-  bool b = ValidateUTF8(data, data_size);
+  bool b = Validate(data, data_size);
   if (b != expected) {
     std::cerr << "Unexpected validation result" << std::endl;
     std::abort();
   }
 
   while (state.KeepRunning()) {
-    bool b = ValidateUTF8(data, data_size);
+    bool b = Validate(data, data_size);
     benchmark::DoNotOptimize(b);
   }
   state.SetBytesProcessed(state.iterations() * s.size());
@@ -129,6 +130,27 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+// Same as above, but using the scalar state machine regardless of input size,
+// for comparison with the SIMD validators
+static void ValidateLargeAlmostAsciiScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_almost_ascii, 100000);
+  BenchmarkUTF8Validation<internal::ValidateUTF8Inline>(state, s, true);
+}
+
+static void ValidateLargeNonAsciiScalar(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_non_ascii, 100000);
+  BenchmarkUTF8Validation<internal::ValidateUTF8Inline>(state, s, true);
+}
+
+static void ValidateLargeInvalid(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Error at the very end, so that the whole input is scanned
+  auto s = MakeLargeString(valid_non_ascii, 100000) + "\xff";
+  BenchmarkUTF8Validation(state, s, false);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
@@ -137,6 +159,9 @@ BENCHMARK(ValidateSmallNonAscii);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateLargeAlmostAsciiScalar);
+BENCHMARK(ValidateLargeNonAsciiScalar);
+BENCHMARK(ValidateLargeInvalid);
 
 }  // namespace util
 }  // namespace arrow
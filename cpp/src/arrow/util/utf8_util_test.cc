@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 
@@ -297,6 +298,81 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+// Check the SIMD validators around block boundaries, by embedding each
+// sequence at every position of an ASCII string long enough to take the
+// vectorized path.
+void CheckEmbeddedSequences(const std::vector<std::string>& valid,
+                            const std::vector<std::string>& invalid) {
+  const std::string padding(2 * internal::kUTF8SimdMinSize, 'x');
+  for (size_t pos = 0; pos <= padding.size(); ++pos) {
+    for (const auto& v : valid) {
+      ASSERT_TRUE(IsValidUTF8(padding.substr(0, pos) + v + padding.substr(pos)));
+    }
+    for (const auto& v : invalid) {
+      ASSERT_TRUE(IsInvalidUTF8(padding.substr(0, pos) + v + padding.substr(pos)));
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, EmbeddedSequences) {
+  std::vector<std::string> truncated;
+  for (const auto& s : all_valid_sequences) {
+    if (s.size() > 1) {
+      truncated.push_back(s.substr(0, s.size() - 1));
+    }
+  }
+  std::vector<std::string> invalid = all_invalid_sequences;
+  invalid.insert(invalid.end(), truncated.begin(), truncated.end());
+
+  CheckEmbeddedSequences(all_valid_sequences, invalid);
+
+  // Truncated sequences at the very end of the input
+  const std::string padding(internal::kUTF8SimdMinSize + 13, 'x');
+  for (const auto& s : truncated) {
+    AssertInvalidUTF8(padding + s);
+  }
+}
+
+TEST_F(UTF8ValidationTest, EmbeddedSequencesNoAvx2) {
+  auto cpu_info = ::arrow::internal::CpuInfo::GetInstance();
+  if (!cpu_info->IsSupported(::arrow::internal::CpuInfo::AVX2)) {
+    return;
+  }
+  // Exercise the SSE4.2 fallback on AVX2-capable hosts
+  cpu_info->EnableFeature(::arrow::internal::CpuInfo::AVX2, false);
+  CheckEmbeddedSequences(all_valid_sequences, all_invalid_sequences);
+  cpu_info->EnableFeature(::arrow::internal::CpuInfo::AVX2, true);
+}
+
+TEST_F(UTF8ValidationTest, RandomBytesMatchScalar) {
+  // Compare the SIMD validators against the scalar state machine on
+  // mostly-valid random input
+#ifdef ARROW_VALGRIND
+  const int niters = 50;
+#else
+  const int niters = 1000;
+#endif
+  const int nchars = 100;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::uniform_int_distribution<int> pos_dist(0, nchars * 4);
+
+  for (int i = 0; i < niters; ++i) {
+    std::string s;
+    s.reserve(nchars * 4);
+    for (int j = 0; j < nchars; ++j) {
+      s += all_valid_sequences[valid_dist(gen)];
+    }
+    // Clobber a random byte
+    s[pos_dist(gen) % s.size()] = static_cast<char>(byte_dist(gen));
+    const auto data = reinterpret_cast<const uint8_t*>(s.data());
+    const auto size = static_cast<int64_t>(s.size());
+    ASSERT_EQ(internal::ValidateUTF8Inline(data, size),
+              internal::ValidateUTF8Simd(data, size));
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -107,6 +107,66 @@ cdef _ndarray_to_array(object values, object mask, DataType type,
         return pyarrow_wrap_array(chunked_out.get().chunk(0))
 
 
+def _ndarrays_to_table(list arrays, list names, list types, list masks=None,
+                       c_bool from_pandas=False, c_bool safe=True,
+                       c_bool use_threads=True, MemoryPool memory_pool=None):
+    """
+    Convert 1-dimensional NumPy arrays, e.g. the columns of a pandas.DataFrame,
+    to the columns of a Table. The arrays are converted in parallel if
+    use_threads is true, without holding the GIL except when converting
+    Python objects.
+
+    Parameters
+    ----------
+    arrays : list of numpy.ndarray
+    names : list of str
+    types : list of DataType or None
+        None to infer the column type from the array.
+    masks : list of numpy.ndarray or None, optional
+        Boolean masks of the null values (True is null), per array.
+    from_pandas : bool, default False
+        Use pandas's semantics for null values.
+    safe : bool, default True
+        Check for overflows or other unsafe conversions.
+    use_threads : bool, default True
+    memory_pool : MemoryPool, optional
+
+    Returns
+    -------
+    Table
+    """
+    cdef:
+        vector[PyObject*] c_arrays
+        vector[PyObject*] c_masks
+        vector[c_string] c_names
+        vector[shared_ptr[CDataType]] c_types
+        CCastOptions cast_options = CCastOptions(safe)
+        CMemoryPool* pool = maybe_unbox_memory_pool(memory_pool)
+        shared_ptr[CTable] c_table
+        DataType type_
+
+    if len(names) != len(arrays) or len(types) != len(arrays):
+        raise ValueError("Expected as many names and types as arrays")
+    for arr, name, type_ in zip(arrays, names, types):
+        c_arrays.push_back(<PyObject*> arr)
+        c_names.push_back(tobytes(name))
+        if type_ is None:
+            c_types.push_back(shared_ptr[CDataType]())
+        else:
+            c_types.push_back(type_.sp_type)
+    if masks is not None:
+        if len(masks) != len(arrays):
+            raise ValueError("Expected as many masks as arrays")
+        for mask in masks:
+            c_masks.push_back(NULL if mask is None else <PyObject*> mask)
+
+    with nogil:
+        check_status(NdarraysToTable(pool, c_arrays, c_masks, c_names, c_types,
+                                     from_pandas, cast_options, use_threads,
+                                     &c_table))
+    return pyarrow_wrap_table(c_table)
+
+
 cdef _codes_to_indices(object codes, object mask, DataType type,
                        MemoryPool memory_pool):
     """
@@ -537,7 +597,8 @@ cdef class _PandasConvertible:
             bint safe=True,
             bint split_blocks=False,
             bint self_destruct=False,
-            types_mapper=None
+            types_mapper=None,
+            bint arrow_extension_arrays=False
     ):
         """
         Convert to a pandas-compatible NumPy array or DataFrame, as appropriate
@@ -595,6 +656,14 @@ cdef class _PandasConvertible:
             expected to return a pandas ExtensionDtype or ``None`` if the
             default conversion should be used for that type. If you have
             a dictionary mapping, you can pass ``dict.get`` as function.
+        arrow_extension_arrays : bool, default False
+            EXPERIMENTAL: If True, convert string and binary columns, as well
+            as integer columns with nulls, to pandas extension arrays backed
+            by the Arrow data rather than to NumPy arrays of Python objects or
+            floats. Chunks are preserved and, where pandas supports it
+            (``pd.ArrowDtype``, ``pd.StringDtype("pyarrow")``), no data is
+            copied. Columns handled by ``types_mapper``, ``categories`` or
+            ``strings_to_categorical`` are not affected.
 
         Returns
         -------
@@ -611,7 +680,8 @@ cdef class _PandasConvertible:
             deduplicate_objects=deduplicate_objects,
             safe=safe,
             split_blocks=split_blocks,
-            self_destruct=self_destruct
+            self_destruct=self_destruct,
+            arrow_extension_arrays=arrow_extension_arrays
         )
         return self._to_pandas(options, categories=categories,
                                ignore_metadata=ignore_metadata,
@@ -631,6 +701,7 @@ cdef PandasOptions _convert_pandas_options(dict options):
     result.safe_cast = options['safe']
     result.split_blocks = options['split_blocks']
     result.self_destruct = options['self_destruct']
+    result.arrow_extension_arrays = options['arrow_extension_arrays']
     return result
 
 
@@ -1163,6 +1234,15 @@ cdef _array_like_to_pandas(obj, options):
 
     arr = wrap_array_output(out)
 
+    if isinstance(arr, ChunkedArray):
+        # passed through because of the arrow_extension_arrays option
+        from pyarrow.pandas_compat import arrow_backed_dtype
+        pandas_dtype = arrow_backed_dtype(original_type)
+        if pandas_dtype is None:
+            arr = np.asarray(arr)
+        else:
+            arr = pandas_dtype.__from_arrow__(arr)
+
     if (isinstance(original_type, TimestampType) and
             options["timestamp_as_object"]):
         # ARROW-5359 - need to specify object dtype to avoid pandas to
@@ -690,6 +690,9 @@ cdef extern from "arrow/api.h" namespace "arrow" nogil:
         CResult[shared_ptr[CRecordBatch]] FromStructArray(
             const shared_ptr[CArray]& array)
 
+        CResult[shared_ptr[CTensor]] ToTensor(c_bool null_to_nan, c_bool row_major,
+                                              CMemoryPool* pool) const
+
         c_bool Equals(const CRecordBatch& other, c_bool check_metadata)
 
         shared_ptr[CSchema] schema()
@@ -1726,6 +1729,14 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
                            const CCastOptions& cast_options,
                            shared_ptr[CChunkedArray]* out)
 
+    CStatus NdarraysToTable(CMemoryPool* pool, const vector[PyObject*]& arrays,
+                            const vector[PyObject*]& masks,
+                            const vector[c_string]& names,
+                            const vector[shared_ptr[CDataType]]& types,
+                            c_bool from_pandas,
+                            const CCastOptions& cast_options,
+                            c_bool use_threads, shared_ptr[CTable]* out)
+
     CStatus NdarrayToTensor(CMemoryPool* pool, object ao,
                             const vector[c_string]& dim_names,
                             shared_ptr[CTensor]* out)
@@ -1832,6 +1843,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         c_bool safe_cast
         c_bool split_blocks
         c_bool self_destruct
+        c_bool arrow_extension_arrays
         unordered_set[c_string] categorical_columns
         unordered_set[c_string] extension_columns
 
@@ -563,34 +563,89 @@ def dataframe_to_arrays(df, schema, preserve_index, nthreads=1, columns=None,
             e.args += ("Conversion failed for column {!s} with type {!s}"
                        .format(col.name, col.dtype),)
             raise e
-        if not field_nullable and result.null_count > 0:
+        if not field_nullable:
+            _check_non_nullable(result, field)
+        return result
+
+    def _check_non_nullable(result, field):
+        if result.null_count > 0:
             raise ValueError("Field {} was non-nullable but pandas column "
                              "had {} null values".format(str(field),
                                                          result.null_count))
-        return result
+
+    def _ndarray_values(col, field):
+        # The values and type of columns which pa.array() converts as plain
+        # NumPy arrays, or None for the other columns (e.g. categorical or
+        # extension arrays)
+        if hasattr(col, '__arrow_array__'):
+            return None
+        values = _pandas_api.get_values(col)
+        if (not isinstance(values, np.ndarray) or
+                isinstance(values, np.ma.MaskedArray) or values.ndim != 1):
+            return None
+        return get_datetimetz_type(values, col.dtype,
+                                   field.type if field is not None else None)
 
     def _can_definitely_zero_copy(arr):
         return (isinstance(arr, np.ndarray) and
                 arr.flags.contiguous and
                 issubclass(arr.dtype.type, np.integer))
 
+    arrays = [None] * len(columns_to_convert)
+
+    # Convert the NumPy columns together, in parallel if nthreads != 1, and
+    # without holding the GIL except to convert Python objects
+    ndarray_columns = []
+    ndarray_values = []
+    ndarray_types = []
+    for i, (c, f) in enumerate(zip(columns_to_convert, convert_fields)):
+        values_and_type = _ndarray_values(c, f)
+        if values_and_type is not None:
+            ndarray_columns.append(i)
+            ndarray_values.append(values_and_type[0])
+            ndarray_types.append(values_and_type[1])
+    if ndarray_columns:
+        try:
+            table = pa.lib._ndarrays_to_table(
+                ndarray_values, [str(i) for i in ndarray_columns],
+                ndarray_types, from_pandas=True, safe=safe,
+                use_threads=nthreads != 1)
+        except (pa.ArrowInvalid,
+                pa.ArrowNotImplementedError,
+                pa.ArrowTypeError):
+            # Convert the columns one by one, to report the failing column
+            table = None
+        for j, i in enumerate(ndarray_columns):
+            field = convert_fields[i]
+            if table is None:
+                arrays[i] = convert_column(columns_to_convert[i], field)
+                continue
+            result = table.column(j)
+            if result.num_chunks == 1:
+                result = result.chunk(0)
+            if field is not None and not field.nullable:
+                _check_non_nullable(result, field)
+            arrays[i] = result
+
+    other_columns = [i for i, array in enumerate(arrays) if array is None]
     if nthreads == 1:
-        arrays = [convert_column(c, f)
-                  for c, f in zip(columns_to_convert, convert_fields)]
+        for i in other_columns:
+            arrays[i] = convert_column(columns_to_convert[i],
+                                       convert_fields[i])
     else:
         from concurrent import futures
 
-        arrays = []
         with futures.ThreadPoolExecutor(nthreads) as executor:
-            for c, f in zip(columns_to_convert, convert_fields):
+            for i in other_columns:
+                c, f = columns_to_convert[i], convert_fields[i]
                 if _can_definitely_zero_copy(c.values):
-                    arrays.append(convert_column(c, f))
+                    arrays[i] = convert_column(c, f)
                 else:
-                    arrays.append(executor.submit(convert_column, c, f))
+                    arrays[i] = executor.submit(convert_column, c, f)
 
-        for i, maybe_fut in enumerate(arrays):
-            if isinstance(maybe_fut, futures.Future):
-                arrays[i] = maybe_fut.result()
+        for i in other_columns:
+            if isinstance(arrays[i], futures.Future):
+                arrays[i] = arrays[i].result()
 
     types = [x.type for x in arrays]
 
@@ -731,7 +786,14 @@ def _reconstruct_block(item, columns=None, extension_columns=None):
         arr = item['py_array']
         assert len(placement) == 1
         name = columns[placement[0]]
-        pandas_dtype = extension_columns[name]
+        if name in extension_columns:
+            pandas_dtype = extension_columns[name]
+        else:
+            # passed through because of the arrow_extension_arrays option
+            pandas_dtype = arrow_backed_dtype(arr.type)
+            if pandas_dtype is None:
+                return _int.make_block(np.asarray(arr), placement=placement,
+                                       klass=_int.ObjectBlock)
         if not hasattr(pandas_dtype, '__from_arrow__'):
             raise ValueError("This column does not support to be converted "
                              "to a pandas ExtensionArray")
@@ -744,6 +806,45 @@ def _reconstruct_block(item, columns=None, extension_columns=None):
     return block
 
 
+_nullable_integer_dtype_names = {
+    pa.int8(): 'Int8',
+    pa.int16(): 'Int16',
+    pa.int32(): 'Int32',
+    pa.int64(): 'Int64',
+    pa.uint8(): 'UInt8',
+    pa.uint16(): 'UInt16',
+    pa.uint32(): 'UInt32',
+    pa.uint64(): 'UInt64',
+}
+
+
+def arrow_backed_dtype(typ):
+    """
+    Return the pandas ExtensionDtype used for an Arrow string, binary or
+    integer type with the ``arrow_extension_arrays`` option of to_pandas, or
+    None if the installed pandas version has no suitable dtype.
+
+    Where pandas provides arrays backed by Arrow data (``pd.ArrowDtype`` or
+    the "pyarrow" storage of ``pd.StringDtype``), the Arrow chunks are wrapped
+    without copying. Otherwise strings and integers fall back to the
+    ``string`` and nullable integer dtypes, which copy the data chunk by chunk.
+    """
+    pd = _pandas_api.pd
+    if hasattr(pd, 'ArrowDtype'):
+        return pd.ArrowDtype(typ)
+    # Before pandas 1.0 the extension dtypes cannot be built from Arrow data
+    # (no __from_arrow__), so the columns are converted to object instead
+    if _pandas_api.loose_version < '1.0':
+        return None
+    if pa.types.is_string(typ) or pa.types.is_large_string(typ):
+        if _pandas_api.loose_version >= '1.3':
+            return pd.StringDtype("pyarrow")
+        return pd.StringDtype()
+    elif typ in _nullable_integer_dtype_names:
+        return _pandas_api.pandas_dtype(_nullable_integer_dtype_names[typ])
+    return None
+
+
 def make_datetimetz(tz):
     tz = pa.lib.string_to_tzinfo(tz)
     return _pandas_api.datetimetz_type('ns', tz=tz)
@@ -1113,8 +1214,15 @@ def _table_to_blocks(options, block_table, categories, extension_columns):
     columns = block_table.column_names
     result = pa.lib.table_to_blocks(options, block_table, categories,
                                     list(extension_columns.keys()))
-    return [_reconstruct_block(item, columns, extension_columns)
-            for item in result]
+    # Drop each converted column as soon as its block is built, so that
+    # together with self_destruct the Arrow memory of columns copied by
+    # pandas is released incrementally
+    result.reverse()
+    blocks = []
+    while result:
+        blocks.append(_reconstruct_block(result.pop(), columns,
+                                         extension_columns))
+    return blocks
 
 
 def _flatten_single_level_multiindex(index):
@@ -930,6 +930,38 @@ cdef class RecordBatch(_PandasConvertible):
                 CRecordBatch.FromStructArray(struct_array.sp_array))
         return pyarrow_wrap_batch(c_record_batch)
 
+    def to_tensor(self, c_bool null_to_nan=False, c_bool row_major=True,
+                  MemoryPool memory_pool=None):
+        """
+        Convert to a two-dimensional Tensor, with one row per record.
+
+        All columns must be integers or floating point numbers; they are
+        converted to a common type.  A batch with a single column without
+        nulls is converted without copying.
+
+        Parameters
+        ----------
+        null_to_nan : bool, default False
+            Whether to convert nulls to NaN, and integer columns with nulls
+            to float64.  If False, nulls raise an error.
+        row_major : bool, default True
+            Whether the tensor is row-major (C order) or column-major
+            (Fortran order).
+        memory_pool : MemoryPool, default None
+            For memory allocations, if required, otherwise use default pool.
+
+        Returns
+        -------
+        pyarrow.Tensor
+        """
+        cdef:
+            shared_ptr[CTensor] c_tensor
+            CMemoryPool* pool = maybe_unbox_memory_pool(memory_pool)
+        with nogil:
+            c_tensor = GetResultValue(
+                self.batch.ToTensor(null_to_nan, row_major, pool))
+        return pyarrow_wrap_tensor(c_tensor)
+
     def _export_to_c(self, uintptr_t out_ptr, uintptr_t out_schema_ptr=0):
         """
         Export to a C ArrowArray struct, given its pointer.
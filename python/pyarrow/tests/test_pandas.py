@@ -1527,6 +1527,34 @@ class TestConvertStringLikeTypes:
         _check_pandas_roundtrip(
             df, schema=pa.schema([('a', pa.large_binary())]))
 
+    def test_wide_frame_of_strings_threaded(self):
+        # The object columns are converted in parallel, only holding the GIL
+        # to extract the string data
+        nrows, ncols = 2000, 40
+        data = OrderedDict()
+        for i in range(ncols):
+            data['str{}'.format(i)] = [
+                None if j % 7 == i % 7 else 'value {} {}'.format(i, j)
+                for j in range(nrows)]
+        data['ints'] = np.arange(nrows)
+        df = pd.DataFrame(data)
+
+        table = pa.Table.from_pandas(df, nthreads=4)
+        assert table.equals(pa.Table.from_pandas(df, nthreads=1))
+        for i in range(ncols):
+            column = table.column('str{}'.format(i))
+            assert column.type == pa.string()
+            assert column.null_count == df['str{}'.format(i)].isnull().sum()
+        assert table.column('ints').type == pa.int64()
+        _check_pandas_roundtrip(df, use_threads=True)
+
+        # A failing column is still reported
+        schema = pa.schema([('str0', pa.string()), ('str1', pa.int64())])
+        with pytest.raises(pa.ArrowInvalid,
+                           match='Conversion failed for column str1'):
+            pa.Table.from_pandas(df[['str0', 'str1']], schema=schema,
+                                 nthreads=4)
+
     def test_large_string(self):
         s = pd.Series(['123', '', 'a', None])
         _check_series_roundtrip(s, type_=pa.large_string())
@@ -3206,6 +3234,80 @@ def test_to_pandas_self_destruct():
     _check_to_pandas_memory_unchanged(t, self_destruct=True)
 
 
+def test_to_pandas_arrow_extension_arrays():
+    if not hasattr(pd, 'ArrowDtype'):
+        pytest.skip("requires pandas with pd.ArrowDtype")
+
+    strings = pa.chunked_array([['a', None, 'bc'], ['d', 'ef']])
+    ints = pa.chunked_array([[1, None], [3, 4, 5]], type=pa.int32())
+    floats = pa.chunked_array([[1.5, 2.5, None], [4.5, 5.5]])
+    t = pa.table([strings, ints, floats], ['strings', 'ints', 'floats'])
+
+    for split_blocks in [False, True]:
+        # Strings and nullable integers are wrapped without copying
+        prior_allocation = pa.total_allocated_bytes()
+        df = t.to_pandas(arrow_extension_arrays=True,
+                         split_blocks=split_blocks)
+        assert pa.total_allocated_bytes() == prior_allocation
+
+        assert df['strings'].dtype == pd.ArrowDtype(pa.string())
+        assert df['ints'].dtype == pd.ArrowDtype(pa.int32())
+        assert df['floats'].dtype == np.float64
+        assert df['strings'].tolist() == ['a', None, 'bc', 'd', 'ef']
+        assert df['ints'].tolist() == [1, None, 3, 4, 5]
+
+        # The chunks are preserved
+        result = pa.chunked_array(df['strings'].array)
+        assert result.num_chunks == 2
+        assert result.equals(strings)
+
+    # Integers without nulls keep the default conversion
+    t = pa.table([pa.array([1, 2, 3], type=pa.int64())], ['ints'])
+    df = t.to_pandas(arrow_extension_arrays=True)
+    assert df['ints'].dtype == np.int64
+
+    # types_mapper and strings_to_categorical take precedence
+    t = pa.table([strings], ['strings'])
+    df = t.to_pandas(arrow_extension_arrays=True,
+                     strings_to_categorical=True)
+    assert isinstance(df['strings'].dtype, pd.CategoricalDtype)
+    df = t.to_pandas(arrow_extension_arrays=True,
+                     types_mapper={pa.string(): pd.StringDtype()}.get)
+    assert df['strings'].dtype == pd.StringDtype()
+
+
+def test_to_pandas_arrow_extension_arrays_series():
+    if not hasattr(pd, 'ArrowDtype'):
+        pytest.skip("requires pandas with pd.ArrowDtype")
+
+    arr = pa.chunked_array([[b'a', None], [b'bc']])
+    result = arr.to_pandas(arrow_extension_arrays=True)
+    assert result.dtype == pd.ArrowDtype(pa.binary())
+    assert pa.chunked_array(result.array).num_chunks == 2
+
+    arr = pa.array([1, None, 3], type=pa.uint8())
+    result = arr.to_pandas(arrow_extension_arrays=True)
+    assert result.dtype == pd.ArrowDtype(pa.uint8())
+    assert result.tolist() == [1, None, 3]
+
+
+def test_to_pandas_arrow_extension_arrays_self_destruct():
+    if not hasattr(pd, 'ArrowDtype'):
+        pytest.skip("requires pandas with pd.ArrowDtype")
+
+    K = 10
+
+    def _make_table():
+        return pa.table([
+            pa.chunked_array([['foo', None, 'bar'] * 1000] * 4)
+            for i in range(K)
+        ], ['f{}'.format(i) for i in range(K)])
+
+    t = _make_table()
+    _check_to_pandas_memory_unchanged(t, arrow_extension_arrays=True,
+                                      self_destruct=True)
+
+
 def test_table_uses_memory_pool():
     N = 10000
     arr = pa.array(np.arange(N, dtype=np.int64))
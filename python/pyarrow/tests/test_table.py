@@ -464,6 +464,29 @@ def test_recordbatch_from_struct_array():
     ))
 
 
+def test_recordbatch_to_tensor():
+    batch = pa.record_batch([
+        pa.array([1, 2, 3], type=pa.int16()),
+        pa.array([4, 5, 6], type=pa.int32()),
+    ], ["a", "b"])
+    tensor = batch.to_tensor()
+    assert tensor.type == pa.int32()
+    assert tensor.shape == (3, 2)
+    np.testing.assert_array_equal(tensor.to_numpy(),
+                                  np.array([[1, 4], [2, 5], [3, 6]]))
+    column_major = batch.to_tensor(row_major=False)
+    assert column_major.strides == (4, 12)
+    np.testing.assert_array_equal(column_major.to_numpy(), tensor.to_numpy())
+
+    batch = pa.record_batch([pa.array([1, None], type=pa.int8())], ["a"])
+    with pytest.raises(TypeError):
+        batch.to_tensor()
+    result = batch.to_tensor(null_to_nan=True).to_numpy()
+    assert result.dtype == np.float64
+    assert result[0, 0] == 1
+    assert np.isnan(result[1, 0])
+
+
 def _table_like_slice_tests(factory):
     data = [
         pa.array(range(5)),